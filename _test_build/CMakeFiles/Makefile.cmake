@@ -0,0 +1,163 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/googletest/CMakeLists.txt"
+  "/root/repo/cmake/package/package.cmake"
+  "/root/repo/iceoryx_hoofs/CMakeLists.txt"
+  "/root/repo/iceoryx_hoofs/cmake/Config.cmake.in"
+  "/root/repo/iceoryx_hoofs/cmake/IceoryxHoofsDeployment.cmake"
+  "/root/repo/iceoryx_hoofs/cmake/iceoryx_hoofsConfig.cmake"
+  "/root/repo/iceoryx_hoofs/cmake/iceoryx_hoofsConfigVersion.cmake"
+  "/root/repo/iceoryx_hoofs/cmake/iceoryx_hoofs_deployment.hpp.in"
+  "/root/repo/iceoryx_hoofs/cmake/iceoryx_hoofs_testingConfig.cmake"
+  "/root/repo/iceoryx_hoofs/test/CMakeLists.txt"
+  "/root/repo/iceoryx_hoofs/test/stresstests/benchmark_optional_and_expected/CMakeLists.txt"
+  "/root/repo/iceoryx_hoofs/testing/CMakeLists.txt"
+  "/root/repo/iceoryx_meta/CMakeLists.txt"
+  "/root/repo/iceoryx_meta/build_options.cmake"
+  "/root/repo/iceoryx_meta/install_help_and_config.cmake"
+  "/root/repo/iceoryx_meta/tests.cmake"
+  "/root/repo/iceoryx_platform/CMakeLists.txt"
+  "/root/repo/iceoryx_platform/cmake/Config.cmake.in"
+  "/root/repo/iceoryx_platform/cmake/IceoryxConfigureOptionMacro.cmake"
+  "/root/repo/iceoryx_platform/cmake/IceoryxPackageHelper.cmake"
+  "/root/repo/iceoryx_platform/cmake/IceoryxPlatform.cmake"
+  "/root/repo/iceoryx_platform/cmake/IceoryxPlatformSettings.cmake"
+  "/root/repo/iceoryx_platform/cmake/iceoryx_platformConfig.cmake"
+  "/root/repo/iceoryx_platform/cmake/iceoryx_platformConfigVersion.cmake"
+  "/root/repo/iceoryx_platform/cmake/iceoryx_versions.h.in"
+  "/root/repo/iceoryx_platform/cmake/iceoryxversions.cmake"
+  "/root/repo/iceoryx_platform/linux/cmake/IceoryxPlatformDeployment.cmake"
+  "/root/repo/iceoryx_platform/linux/cmake/IceoryxPlatformSettings.cmake"
+  "/root/repo/iceoryx_platform/linux/cmake/platform_settings.hpp.in"
+  "/root/repo/iceoryx_platform/test/CMakeLists.txt"
+  "/root/repo/iceoryx_posh/CMakeLists.txt"
+  "/root/repo/iceoryx_posh/cmake/Config.cmake.in"
+  "/root/repo/iceoryx_posh/cmake/IceoryxPoshDeployment.cmake"
+  "/root/repo/iceoryx_posh/cmake/iceoryx_poshConfig.cmake"
+  "/root/repo/iceoryx_posh/cmake/iceoryx_poshConfigVersion.cmake"
+  "/root/repo/iceoryx_posh/cmake/iceoryx_posh_deployment.hpp.in"
+  "/root/repo/iceoryx_posh/cmake/iceoryx_posh_testingConfig.cmake"
+  "/root/repo/iceoryx_posh/roudi_env/CMakeLists.txt"
+  "/root/repo/iceoryx_posh/test/CMakeLists.txt"
+  "/root/repo/iceoryx_posh/test/stresstests/benchmark_used_chunk_list/CMakeLists.txt"
+  "/root/repo/iceoryx_posh/testing/CMakeLists.txt"
+  "/usr/lib/x86_64-linux-gnu/cmake/GTest/GMockTargets-none.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/GTest/GMockTargets.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/GTest/GTestConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/GTest/GTestConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/GTest/GTestTargets-none.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/GTest/GTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-AnyNewerVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindDependencyMacro.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "dependencies/googletest/prebuild/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "generated/iceoryx_platform/include/iceoryx_versions.h"
+  "platform/iceoryx_platformConfigVersion.cmake"
+  "platform/iceoryx_platformConfig.cmake"
+  "generated/iceoryx_platform/include/iceoryx_platform/platform_settings.hpp"
+  "platform/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "platform/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "hoofs/iceoryx_hoofsConfigVersion.cmake"
+  "hoofs/iceoryx_hoofsConfig.cmake"
+  "generated/iceoryx_hoofs/include/iox/iceoryx_hoofs_deployment.hpp"
+  "hoofs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "hoofs/testing/iceoryx_hoofs_testingConfigVersion.cmake"
+  "hoofs/testing/iceoryx_hoofs_testingConfig.cmake"
+  "hoofs/testing/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "hoofs/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "hoofs/test/stresstests/benchmark_optional_and_expected/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "posh/iceoryx_poshConfigVersion.cmake"
+  "posh/iceoryx_poshConfig.cmake"
+  "generated/iceoryx_posh/include/iceoryx_posh/iceoryx_posh_deployment.hpp"
+  "posh/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "posh/roudi_env/iceoryx_posh_roudi_envConfigVersion.cmake"
+  "posh/roudi_env/iceoryx_posh_roudi_envConfig.cmake"
+  "posh/roudi_env/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "posh/testing/iceoryx_posh_testingConfigVersion.cmake"
+  "posh/testing/iceoryx_posh_testingConfig.cmake"
+  "posh/testing/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "posh/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "posh/test/stresstests/benchmark_used_chunk_list/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/all_tests.dir/DependInfo.cmake"
+  "CMakeFiles/mock_tests.dir/DependInfo.cmake"
+  "CMakeFiles/module_tests.dir/DependInfo.cmake"
+  "CMakeFiles/integration_tests.dir/DependInfo.cmake"
+  "CMakeFiles/timing_module_tests.dir/DependInfo.cmake"
+  "CMakeFiles/timing_integration_tests.dir/DependInfo.cmake"
+  "platform/CMakeFiles/iceoryx_platform.dir/DependInfo.cmake"
+  "platform/test/CMakeFiles/platform_moduletests.dir/DependInfo.cmake"
+  "platform/test/CMakeFiles/platform_integrationtests.dir/DependInfo.cmake"
+  "hoofs/CMakeFiles/iceoryx_hoofs.dir/DependInfo.cmake"
+  "hoofs/testing/CMakeFiles/iceoryx_hoofs_testing.dir/DependInfo.cmake"
+  "hoofs/test/CMakeFiles/hoofs_moduletests.dir/DependInfo.cmake"
+  "hoofs/test/CMakeFiles/hoofs_mocktests.dir/DependInfo.cmake"
+  "hoofs/test/CMakeFiles/hoofs_integrationtests.dir/DependInfo.cmake"
+  "hoofs/test/CMakeFiles/hoofs_stresstests.dir/DependInfo.cmake"
+  "hoofs/test/CMakeFiles/test_stress_spsc_sofi.dir/DependInfo.cmake"
+  "hoofs/test/stresstests/benchmark_optional_and_expected/CMakeFiles/iox-bm-optional-and-expected.dir/DependInfo.cmake"
+  "posh/CMakeFiles/iceoryx_posh.dir/DependInfo.cmake"
+  "posh/CMakeFiles/iceoryx_posh_gateway.dir/DependInfo.cmake"
+  "posh/CMakeFiles/iceoryx_posh_roudi.dir/DependInfo.cmake"
+  "posh/roudi_env/CMakeFiles/iceoryx_posh_roudi_env.dir/DependInfo.cmake"
+  "posh/testing/CMakeFiles/iceoryx_posh_testing.dir/DependInfo.cmake"
+  "posh/test/CMakeFiles/posh_moduletests.dir/DependInfo.cmake"
+  "posh/test/CMakeFiles/posh_integrationtests.dir/DependInfo.cmake"
+  "posh/test/CMakeFiles/posh_allocationtests.dir/DependInfo.cmake"
+  "posh/test/stresstests/benchmark_used_chunk_list/CMakeFiles/iox-bm-used-chunk-list.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,41 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_ICEORYX_HOOFS_DEPLOYMENT_HPP
+#define IOX_HOOFS_ICEORYX_HOOFS_DEPLOYMENT_HPP
+
+#include "iox/iceoryx_hoofs_types.hpp"
+
+namespace iox
+{
+namespace build
+{
+
+/// @note Do not change the constants here, the file is autogenerated!
+///       Edit the iceoryx_hoofs_deployment.cmake to change the default values,
+///       or configure via cmake, e.g. with '-DIOX_MINIMAL_LOG_LEVEL="INFO"'.
+///       If you include iceoryx by source into your cmake project, just add e.g.
+///       set(IOX_MINIMAL_LOG_LEVEL "INFO") before add_subdirectory(iceoryx_hoofs).
+
+constexpr iox::log::LogLevel IOX_MINIMAL_LOG_LEVEL = iox::log::LogLevel::Trace;
+
+constexpr uint64_t IOX_MAX_NAMED_PIPE_MESSAGE_SIZE = static_cast<uint64_t>(4096);
+constexpr uint32_t IOX_MAX_NAMED_PIPE_NUMBER_OF_MESSAGES = static_cast<uint32_t>(10);
+
+} // namespace build
+} // namespace iox
+
+#endif // IOX_HOOFS_ICEORYX_HOOFS_DEPLOYMENT_HPP
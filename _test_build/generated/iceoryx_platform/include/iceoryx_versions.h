@@ -0,0 +1,29 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_ICEORYX_VERSIONS_H
+#define IOX_ICEORYX_VERSIONS_H
+
+#define ICEORYX_VERSION_MAJOR    2
+#define ICEORYX_VERSION_MINOR    95
+#define ICEORYX_VERSION_PATCH    4
+#define ICEORYX_VERSION_TWEAK    0
+
+#define ICEORYX_LATEST_RELEASE_VERSION    "2.95.4"
+#define ICEORYX_BUILDDATE                 "REPRODUCIBLE-BUILD"
+#define ICEORYX_SHA1                      "7270e6385faf866becf02b0591db6861b0170102-dirty"
+
+#endif // IOX_ICEORYX_VERSIONS_H
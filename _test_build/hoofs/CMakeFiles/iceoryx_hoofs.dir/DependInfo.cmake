@@ -0,0 +1,68 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/iceoryx_hoofs/cli/source/arguments.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/cli/source/arguments.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/cli/source/arguments.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/cli/source/command_line_parser.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/cli/source/command_line_parser.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/cli/source/command_line_parser.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/cli/source/option.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/cli/source/option.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/cli/source/option.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/cli/source/option_definition.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/cli/source/option_definition.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/cli/source/option_definition.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/cli/source/option_manager.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/cli/source/option_manager.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/cli/source/option_manager.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/concurrent/buffer/source/mpmc_loffli.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/concurrent/buffer/source/mpmc_loffli.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/concurrent/buffer/source/mpmc_loffli.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/concurrent/sync/source/spin_lock.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/concurrent/sync/source/spin_lock.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/concurrent/sync/source/spin_lock.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/concurrent/sync/source/spin_semaphore.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/concurrent/sync/source/spin_semaphore.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/concurrent/sync/source/spin_semaphore.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/filesystem/source/file_reader.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/filesystem/source/file_reader.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/filesystem/source/file_reader.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/filesystem/source/filesystem.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/filesystem/source/filesystem.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/filesystem/source/filesystem.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/memory/source/bump_allocator.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/memory/source/bump_allocator.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/memory/source/bump_allocator.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/memory/source/memory.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/memory/source/memory.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/memory/source/memory.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/memory/source/relative_pointer_data.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/memory/source/relative_pointer_data.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/memory/source/relative_pointer_data.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/posix/auth/source/posix_group.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/auth/source/posix_group.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/auth/source/posix_group.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/posix/auth/source/posix_user.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/auth/source/posix_user.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/auth/source/posix_user.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/posix/design/source/file_management_interface.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/design/source/file_management_interface.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/design/source/file_management_interface.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/posix/filesystem/source/file.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/filesystem/source/file.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/filesystem/source/file.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/posix/filesystem/source/file_lock.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/filesystem/source/file_lock.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/filesystem/source/file_lock.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/posix/filesystem/source/posix_acl.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/filesystem/source/posix_acl.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/filesystem/source/posix_acl.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/posix/ipc/source/message_queue.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/ipc/source/message_queue.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/ipc/source/message_queue.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/posix/ipc/source/named_pipe.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/ipc/source/named_pipe.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/ipc/source/named_pipe.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/posix/ipc/source/posix_memory_map.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/ipc/source/posix_memory_map.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/ipc/source/posix_memory_map.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/posix/ipc/source/posix_shared_memory.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/ipc/source/posix_shared_memory.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/ipc/source/posix_shared_memory.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/posix/ipc/source/posix_shared_memory_object.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/ipc/source/posix_shared_memory_object.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/ipc/source/posix_shared_memory_object.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/posix/ipc/source/unix_domain_socket.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/ipc/source/unix_domain_socket.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/ipc/source/unix_domain_socket.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/posix/sync/source/mutex.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/sync/source/mutex.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/sync/source/mutex.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/posix/sync/source/named_semaphore.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/sync/source/named_semaphore.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/sync/source/named_semaphore.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/posix/sync/source/semaphore_helper.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/sync/source/semaphore_helper.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/sync/source/semaphore_helper.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/posix/sync/source/signal_handler.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/sync/source/signal_handler.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/sync/source/signal_handler.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/posix/sync/source/signal_watcher.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/sync/source/signal_watcher.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/sync/source/signal_watcher.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/posix/sync/source/thread.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/sync/source/thread.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/sync/source/thread.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/posix/sync/source/unnamed_semaphore.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/sync/source/unnamed_semaphore.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/sync/source/unnamed_semaphore.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/posix/time/source/adaptive_wait.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/time/source/adaptive_wait.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/time/source/adaptive_wait.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/posix/time/source/deadline_timer.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/time/source/deadline_timer.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/time/source/deadline_timer.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/posix/utility/source/posix_scheduler.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/utility/source/posix_scheduler.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/utility/source/posix_scheduler.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/posix/utility/source/system_configuration.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/utility/source/system_configuration.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/utility/source/system_configuration.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/posix/vocabulary/source/file_name.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/vocabulary/source/file_name.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/vocabulary/source/file_name.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/posix/vocabulary/source/file_path.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/vocabulary/source/file_path.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/vocabulary/source/file_path.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/posix/vocabulary/source/group_name.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/vocabulary/source/group_name.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/vocabulary/source/group_name.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/posix/vocabulary/source/path.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/vocabulary/source/path.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/vocabulary/source/path.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/posix/vocabulary/source/user_name.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/vocabulary/source/user_name.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/posix/vocabulary/source/user_name.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/primitives/source/type_traits.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/primitives/source/type_traits.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/primitives/source/type_traits.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/reporting/source/console_logger.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/reporting/source/console_logger.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/reporting/source/console_logger.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/reporting/source/default_error_handler.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/reporting/source/default_error_handler.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/reporting/source/default_error_handler.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/reporting/source/hoofs_error_reporting.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/reporting/source/hoofs_error_reporting.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/reporting/source/hoofs_error_reporting.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/reporting/source/logger.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/reporting/source/logger.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/reporting/source/logger.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/reporting/source/logging.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/reporting/source/logging.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/reporting/source/logging.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/time/source/duration.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/time/source/duration.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/time/source/duration.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/utility/source/unique_id.cpp" "hoofs/CMakeFiles/iceoryx_hoofs.dir/utility/source/unique_id.cpp.o" "gcc" "hoofs/CMakeFiles/iceoryx_hoofs.dir/utility/source/unique_id.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/platform/CMakeFiles/iceoryx_platform.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
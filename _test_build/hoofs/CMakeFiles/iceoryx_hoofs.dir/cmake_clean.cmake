@@ -0,0 +1,107 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/iceoryx_hoofs.dir/cli/source/arguments.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/cli/source/arguments.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/cli/source/command_line_parser.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/cli/source/command_line_parser.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/cli/source/option.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/cli/source/option.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/cli/source/option_definition.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/cli/source/option_definition.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/cli/source/option_manager.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/cli/source/option_manager.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/concurrent/buffer/source/mpmc_loffli.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/concurrent/buffer/source/mpmc_loffli.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/concurrent/sync/source/spin_lock.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/concurrent/sync/source/spin_lock.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/concurrent/sync/source/spin_semaphore.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/concurrent/sync/source/spin_semaphore.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/filesystem/source/file_reader.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/filesystem/source/file_reader.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/filesystem/source/filesystem.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/filesystem/source/filesystem.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/memory/source/bump_allocator.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/memory/source/bump_allocator.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/memory/source/memory.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/memory/source/memory.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/memory/source/relative_pointer_data.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/memory/source/relative_pointer_data.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/auth/source/posix_group.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/auth/source/posix_group.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/auth/source/posix_user.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/auth/source/posix_user.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/design/source/file_management_interface.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/design/source/file_management_interface.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/filesystem/source/file.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/filesystem/source/file.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/filesystem/source/file_lock.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/filesystem/source/file_lock.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/filesystem/source/posix_acl.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/filesystem/source/posix_acl.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/ipc/source/message_queue.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/ipc/source/message_queue.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/ipc/source/named_pipe.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/ipc/source/named_pipe.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/ipc/source/posix_memory_map.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/ipc/source/posix_memory_map.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/ipc/source/posix_shared_memory.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/ipc/source/posix_shared_memory.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/ipc/source/posix_shared_memory_object.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/ipc/source/posix_shared_memory_object.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/ipc/source/unix_domain_socket.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/ipc/source/unix_domain_socket.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/sync/source/mutex.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/sync/source/mutex.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/sync/source/named_semaphore.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/sync/source/named_semaphore.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/sync/source/semaphore_helper.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/sync/source/semaphore_helper.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/sync/source/signal_handler.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/sync/source/signal_handler.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/sync/source/signal_watcher.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/sync/source/signal_watcher.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/sync/source/thread.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/sync/source/thread.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/sync/source/unnamed_semaphore.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/sync/source/unnamed_semaphore.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/time/source/adaptive_wait.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/time/source/adaptive_wait.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/time/source/deadline_timer.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/time/source/deadline_timer.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/utility/source/posix_scheduler.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/utility/source/posix_scheduler.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/utility/source/system_configuration.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/utility/source/system_configuration.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/vocabulary/source/file_name.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/vocabulary/source/file_name.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/vocabulary/source/file_path.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/vocabulary/source/file_path.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/vocabulary/source/group_name.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/vocabulary/source/group_name.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/vocabulary/source/path.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/vocabulary/source/path.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/vocabulary/source/user_name.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/posix/vocabulary/source/user_name.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/primitives/source/type_traits.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/primitives/source/type_traits.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/reporting/source/console_logger.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/reporting/source/console_logger.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/reporting/source/default_error_handler.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/reporting/source/default_error_handler.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/reporting/source/hoofs_error_reporting.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/reporting/source/hoofs_error_reporting.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/reporting/source/logger.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/reporting/source/logger.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/reporting/source/logging.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/reporting/source/logging.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/time/source/duration.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/time/source/duration.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs.dir/utility/source/unique_id.cpp.o"
+  "CMakeFiles/iceoryx_hoofs.dir/utility/source/unique_id.cpp.o.d"
+  "libiceoryx_hoofs.a"
+  "libiceoryx_hoofs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/iceoryx_hoofs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/iceoryx_hoofs/test/integrationtests/main_test_hoofs_integration.cpp" "hoofs/test/CMakeFiles/hoofs_integrationtests.dir/integrationtests/main_test_hoofs_integration.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_integrationtests.dir/integrationtests/main_test_hoofs_integration.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/hoofs/CMakeFiles/iceoryx_hoofs.dir/DependInfo.cmake"
+  "/root/repo/_test_build/hoofs/testing/CMakeFiles/iceoryx_hoofs_testing.dir/DependInfo.cmake"
+  "/root/repo/_test_build/platform/CMakeFiles/iceoryx_platform.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
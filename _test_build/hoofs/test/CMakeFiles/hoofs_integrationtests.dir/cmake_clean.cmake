@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hoofs_integrationtests.dir/integrationtests/main_test_hoofs_integration.cpp.o"
+  "CMakeFiles/hoofs_integrationtests.dir/integrationtests/main_test_hoofs_integration.cpp.o.d"
+  "hoofs_integrationtests"
+  "hoofs_integrationtests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hoofs_integrationtests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hoofs_mocktests.dir/mocktests/main_test_hoofs_mock.cpp.o"
+  "CMakeFiles/hoofs_mocktests.dir/mocktests/main_test_hoofs_mock.cpp.o.d"
+  "CMakeFiles/hoofs_mocktests.dir/mocktests/test_fatal_failure.cpp.o"
+  "CMakeFiles/hoofs_mocktests.dir/mocktests/test_fatal_failure.cpp.o.d"
+  "hoofs_mocktests"
+  "hoofs_mocktests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hoofs_mocktests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
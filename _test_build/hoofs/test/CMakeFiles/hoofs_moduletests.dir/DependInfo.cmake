@@ -0,0 +1,113 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/iceoryx_hoofs/test/moduletests/error_reporting/test_auxiliary_types.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/error_reporting/test_auxiliary_types.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/error_reporting/test_auxiliary_types.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/error_reporting/test_custom_error_reporting.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/error_reporting/test_custom_error_reporting.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/error_reporting/test_custom_error_reporting.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/error_reporting/test_default_error_handler.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/error_reporting/test_default_error_handler.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/error_reporting/test_default_error_handler.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/error_reporting/test_error_kind.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/error_reporting/test_error_kind.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/error_reporting/test_error_kind.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/error_reporting/test_error_reporting_macros.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/error_reporting/test_error_reporting_macros.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/error_reporting/test_error_reporting_macros.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/error_reporting/test_error_reporting_violation.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/error_reporting/test_error_reporting_violation.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/error_reporting/test_error_reporting_violation.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/error_reporting/test_testing_error_handler.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/error_reporting/test_testing_error_handler.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/error_reporting/test_testing_error_handler.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/main_test_hoofs_modules.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/main_test_hoofs_modules.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/main_test_hoofs_modules.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_buffer_stack.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_buffer_stack.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_buffer_stack.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_cli_cli_definition.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_cli_cli_definition.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_cli_cli_definition.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_cli_command_line_parser.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_cli_command_line_parser.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_cli_command_line_parser.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_cli_option.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_cli_option.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_cli_option.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_cli_option_definition.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_cli_option_definition.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_cli_option_definition.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_concurrent_mpmc_index_queue.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_mpmc_index_queue.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_mpmc_index_queue.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_concurrent_mpmc_lockfree_queue.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_mpmc_lockfree_queue.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_mpmc_lockfree_queue.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_concurrent_mpmc_lockfree_queue_cyclic_index.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_mpmc_lockfree_queue_cyclic_index.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_mpmc_lockfree_queue_cyclic_index.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_concurrent_mpmc_loffli.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_mpmc_loffli.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_mpmc_loffli.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_concurrent_mpmc_resizeable_lockfree_queue.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_mpmc_resizeable_lockfree_queue.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_mpmc_resizeable_lockfree_queue.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_concurrent_periodic_task.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_periodic_task.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_periodic_task.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_concurrent_smart_lock.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_smart_lock.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_smart_lock.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_concurrent_spsc_fifo.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_spsc_fifo.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_spsc_fifo.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_concurrent_spsc_sofi.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_spsc_sofi.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_spsc_sofi.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_container_fixed_position_container.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_container_fixed_position_container.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_container_fixed_position_container.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_container_forward_list.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_container_forward_list.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_container_forward_list.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_container_list.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_container_list.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_container_list.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_container_uninitialized_array.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_container_uninitialized_array.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_container_uninitialized_array.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_container_vector.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_container_vector.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_container_vector.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_design_functional_interface_and_then.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_functional_interface_and_then.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_functional_interface_and_then.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_design_functional_interface_common.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_functional_interface_common.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_functional_interface_common.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_design_functional_interface_concat_multiple_calls.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_functional_interface_concat_multiple_calls.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_functional_interface_concat_multiple_calls.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_design_functional_interface_expect.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_functional_interface_expect.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_functional_interface_expect.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_design_functional_interface_or_else.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_functional_interface_or_else.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_functional_interface_or_else.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_design_functional_interface_types.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_functional_interface_types.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_functional_interface_types.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_design_functional_interface_value_or.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_functional_interface_value_or.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_functional_interface_value_or.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_design_move_and_copy_helper.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_move_and_copy_helper.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_move_and_copy_helper.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_design_newtype.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_newtype.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_newtype.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_design_polymorphic_handler.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_polymorphic_handler.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_polymorphic_handler.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_design_static_lifetime_guard.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_static_lifetime_guard.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_static_lifetime_guard.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_filesystem_file_reader.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_filesystem_file_reader.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_filesystem_file_reader.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_filesystem_filesystem.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_filesystem_filesystem.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_filesystem_filesystem.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_functional_function.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_functional_function.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_functional_function.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_functional_function_ref.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_functional_function_ref.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_functional_function_ref.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_memory_bump_allocator.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_memory_bump_allocator.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_memory_bump_allocator.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_memory_memory.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_memory_memory.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_memory_memory.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_memory_relative_pointer.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_memory_relative_pointer.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_memory_relative_pointer.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_memory_relative_pointer_data.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_memory_relative_pointer_data.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_memory_relative_pointer_data.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_memory_relocatable_ptr.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_memory_relocatable_ptr.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_memory_relocatable_ptr.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_memory_scope_guard.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_memory_scope_guard.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_memory_scope_guard.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_memory_static_storage.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_memory_static_storage.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_memory_static_storage.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_memory_unique_ptr.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_memory_unique_ptr.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_memory_unique_ptr.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_posix_access_rights.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_access_rights.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_access_rights.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_posix_file.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_file.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_file.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_posix_file_lock.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_file_lock.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_file_lock.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_posix_filesystem_posix_acl.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_filesystem_posix_acl.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_filesystem_posix_acl.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_posix_ipc_unix_domain_sockets.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_ipc_unix_domain_sockets.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_ipc_unix_domain_sockets.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_posix_mutex.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_mutex.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_mutex.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_posix_named_semaphore.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_named_semaphore.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_named_semaphore.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_posix_posix_call.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_posix_call.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_posix_call.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_posix_semaphore_interface.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_semaphore_interface.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_semaphore_interface.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_posix_shared_memory.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_shared_memory.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_shared_memory.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_posix_shared_memory_object.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_shared_memory_object.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_shared_memory_object.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_posix_signal_handler.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_signal_handler.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_signal_handler.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_posix_sync_signal_watcher.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_sync_signal_watcher.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_sync_signal_watcher.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_posix_thread.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_thread.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_thread.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_posix_unnamed_semaphore.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_unnamed_semaphore.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_unnamed_semaphore.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_primitives_algorithm.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_primitives_algorithm.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_primitives_algorithm.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_primitives_size.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_primitives_size.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_primitives_size.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_primitives_type_traits.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_primitives_type_traits.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_primitives_type_traits.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_reporting_console_logger.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_reporting_console_logger.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_reporting_console_logger.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_reporting_logging.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_reporting_logging.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_reporting_logging.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_reporting_logstream.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_reporting_logstream.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_reporting_logstream.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_reporting_logstream_arithmetic.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_reporting_logstream_arithmetic.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_reporting_logstream_arithmetic.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_reporting_logstream_hex_oct_bin.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_reporting_logstream_hex_oct_bin.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_reporting_logstream_hex_oct_bin.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_time_adaptive_wait.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_time_adaptive_wait.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_time_adaptive_wait.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_time_deadline_timer.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_time_deadline_timer.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_time_deadline_timer.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_time_unit_duration.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_time_unit_duration.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_time_unit_duration.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_utility_convert.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_utility_convert.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_utility_convert.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_utility_deprecation_marker.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_utility_deprecation_marker.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_utility_deprecation_marker.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_utility_into.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_utility_into.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_utility_into.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_utility_serialization.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_utility_serialization.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_utility_serialization.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_utility_std_chrono_support.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_utility_std_chrono_support.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_utility_std_chrono_support.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_utility_std_string_support.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_utility_std_string_support.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_utility_std_string_support.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_utility_unique_id.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_utility_unique_id.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_utility_unique_id.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_vocabulary_expected.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_expected.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_expected.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_vocabulary_optional.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_optional.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_optional.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_vocabulary_semantic_string.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_semantic_string.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_semantic_string.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_vocabulary_span.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_span.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_span.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_vocabulary_string.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_string.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_string.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_vocabulary_string_comparison.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_string_comparison.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_string_comparison.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_vocabulary_string_concatenate_append_and_insert.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_string_concatenate_append_and_insert.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_string_concatenate_append_and_insert.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_vocabulary_string_ctor_and_assign.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_string_ctor_and_assign.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_string_ctor_and_assign.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/test/moduletests/test_vocabulary_variant.cpp" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_variant.cpp.o" "gcc" "hoofs/test/CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_variant.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/hoofs/CMakeFiles/iceoryx_hoofs.dir/DependInfo.cmake"
+  "/root/repo/_test_build/hoofs/testing/CMakeFiles/iceoryx_hoofs_testing.dir/DependInfo.cmake"
+  "/root/repo/_test_build/platform/CMakeFiles/iceoryx_platform.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
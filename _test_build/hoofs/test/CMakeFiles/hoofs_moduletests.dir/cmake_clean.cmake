@@ -0,0 +1,193 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/error_reporting/test_auxiliary_types.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/error_reporting/test_auxiliary_types.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/error_reporting/test_custom_error_reporting.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/error_reporting/test_custom_error_reporting.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/error_reporting/test_default_error_handler.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/error_reporting/test_default_error_handler.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/error_reporting/test_error_kind.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/error_reporting/test_error_kind.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/error_reporting/test_error_reporting_macros.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/error_reporting/test_error_reporting_macros.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/error_reporting/test_error_reporting_violation.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/error_reporting/test_error_reporting_violation.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/error_reporting/test_testing_error_handler.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/error_reporting/test_testing_error_handler.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/main_test_hoofs_modules.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/main_test_hoofs_modules.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_buffer_stack.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_buffer_stack.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_cli_cli_definition.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_cli_cli_definition.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_cli_command_line_parser.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_cli_command_line_parser.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_cli_option.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_cli_option.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_cli_option_definition.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_cli_option_definition.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_mpmc_index_queue.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_mpmc_index_queue.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_mpmc_lockfree_queue.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_mpmc_lockfree_queue.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_mpmc_lockfree_queue_cyclic_index.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_mpmc_lockfree_queue_cyclic_index.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_mpmc_loffli.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_mpmc_loffli.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_mpmc_resizeable_lockfree_queue.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_mpmc_resizeable_lockfree_queue.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_periodic_task.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_periodic_task.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_smart_lock.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_smart_lock.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_spsc_fifo.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_spsc_fifo.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_spsc_sofi.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_concurrent_spsc_sofi.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_container_fixed_position_container.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_container_fixed_position_container.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_container_forward_list.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_container_forward_list.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_container_list.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_container_list.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_container_uninitialized_array.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_container_uninitialized_array.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_container_vector.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_container_vector.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_functional_interface_and_then.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_functional_interface_and_then.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_functional_interface_common.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_functional_interface_common.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_functional_interface_concat_multiple_calls.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_functional_interface_concat_multiple_calls.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_functional_interface_expect.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_functional_interface_expect.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_functional_interface_or_else.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_functional_interface_or_else.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_functional_interface_types.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_functional_interface_types.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_functional_interface_value_or.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_functional_interface_value_or.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_move_and_copy_helper.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_move_and_copy_helper.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_newtype.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_newtype.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_polymorphic_handler.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_polymorphic_handler.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_static_lifetime_guard.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_design_static_lifetime_guard.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_filesystem_file_reader.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_filesystem_file_reader.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_filesystem_filesystem.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_filesystem_filesystem.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_functional_function.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_functional_function.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_functional_function_ref.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_functional_function_ref.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_memory_bump_allocator.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_memory_bump_allocator.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_memory_memory.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_memory_memory.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_memory_relative_pointer.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_memory_relative_pointer.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_memory_relative_pointer_data.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_memory_relative_pointer_data.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_memory_relocatable_ptr.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_memory_relocatable_ptr.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_memory_scope_guard.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_memory_scope_guard.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_memory_static_storage.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_memory_static_storage.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_memory_unique_ptr.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_memory_unique_ptr.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_access_rights.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_access_rights.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_file.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_file.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_file_lock.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_file_lock.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_filesystem_posix_acl.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_filesystem_posix_acl.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_ipc_unix_domain_sockets.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_ipc_unix_domain_sockets.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_mutex.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_mutex.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_named_semaphore.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_named_semaphore.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_posix_call.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_posix_call.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_semaphore_interface.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_semaphore_interface.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_shared_memory.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_shared_memory.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_shared_memory_object.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_shared_memory_object.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_signal_handler.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_signal_handler.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_sync_signal_watcher.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_sync_signal_watcher.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_thread.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_thread.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_unnamed_semaphore.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_posix_unnamed_semaphore.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_primitives_algorithm.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_primitives_algorithm.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_primitives_size.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_primitives_size.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_primitives_type_traits.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_primitives_type_traits.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_reporting_console_logger.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_reporting_console_logger.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_reporting_logging.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_reporting_logging.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_reporting_logstream.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_reporting_logstream.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_reporting_logstream_arithmetic.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_reporting_logstream_arithmetic.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_reporting_logstream_hex_oct_bin.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_reporting_logstream_hex_oct_bin.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_time_adaptive_wait.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_time_adaptive_wait.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_time_deadline_timer.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_time_deadline_timer.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_time_unit_duration.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_time_unit_duration.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_utility_convert.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_utility_convert.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_utility_deprecation_marker.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_utility_deprecation_marker.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_utility_into.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_utility_into.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_utility_serialization.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_utility_serialization.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_utility_std_chrono_support.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_utility_std_chrono_support.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_utility_std_string_support.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_utility_std_string_support.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_utility_unique_id.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_utility_unique_id.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_expected.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_expected.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_optional.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_optional.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_semantic_string.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_semantic_string.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_span.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_span.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_string.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_string.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_string_comparison.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_string_comparison.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_string_concatenate_append_and_insert.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_string_concatenate_append_and_insert.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_string_ctor_and_assign.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_string_ctor_and_assign.cpp.o.d"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_variant.cpp.o"
+  "CMakeFiles/hoofs_moduletests.dir/moduletests/test_vocabulary_variant.cpp.o.d"
+  "hoofs_moduletests"
+  "hoofs_moduletests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hoofs_moduletests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hoofs_stresstests.dir/stresstests/test_hoofs_stress.cpp.o"
+  "CMakeFiles/hoofs_stresstests.dir/stresstests/test_hoofs_stress.cpp.o.d"
+  "CMakeFiles/hoofs_stresstests.dir/stresstests/test_mpmc_lockfree_queue_stresstest.cpp.o"
+  "CMakeFiles/hoofs_stresstests.dir/stresstests/test_mpmc_lockfree_queue_stresstest.cpp.o.d"
+  "CMakeFiles/hoofs_stresstests.dir/stresstests/test_mpmc_resizeable_lockfree_queue_stresstest.cpp.o"
+  "CMakeFiles/hoofs_stresstests.dir/stresstests/test_mpmc_resizeable_lockfree_queue_stresstest.cpp.o.d"
+  "hoofs_stresstests"
+  "hoofs_stresstests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hoofs_stresstests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
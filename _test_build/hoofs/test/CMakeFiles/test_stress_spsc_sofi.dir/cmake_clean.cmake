@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_stress_spsc_sofi.dir/stresstests/sofi/test_stress_spsc_sofi.cpp.o"
+  "CMakeFiles/test_stress_spsc_sofi.dir/stresstests/sofi/test_stress_spsc_sofi.cpp.o.d"
+  "test_stress_spsc_sofi"
+  "test_stress_spsc_sofi.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_stress_spsc_sofi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../iox-bm-optional-and-expected"
+  "../../iox-bm-optional-and-expected.pdb"
+  "CMakeFiles/iox-bm-optional-and-expected.dir/benchmark_optional_and_expected.cpp.o"
+  "CMakeFiles/iox-bm-optional-and-expected.dir/benchmark_optional_and_expected.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/iox-bm-optional-and-expected.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
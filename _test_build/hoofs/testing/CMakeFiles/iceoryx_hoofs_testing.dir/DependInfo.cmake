@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/iceoryx_hoofs/testing/error_reporting/testing_error_handler.cpp" "hoofs/testing/CMakeFiles/iceoryx_hoofs_testing.dir/error_reporting/testing_error_handler.cpp.o" "gcc" "hoofs/testing/CMakeFiles/iceoryx_hoofs_testing.dir/error_reporting/testing_error_handler.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/testing/error_reporting/testing_support.cpp" "hoofs/testing/CMakeFiles/iceoryx_hoofs_testing.dir/error_reporting/testing_support.cpp.o" "gcc" "hoofs/testing/CMakeFiles/iceoryx_hoofs_testing.dir/error_reporting/testing_support.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/testing/mocks/time_mock.cpp" "hoofs/testing/CMakeFiles/iceoryx_hoofs_testing.dir/mocks/time_mock.cpp.o" "gcc" "hoofs/testing/CMakeFiles/iceoryx_hoofs_testing.dir/mocks/time_mock.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/testing/testing_logger.cpp" "hoofs/testing/CMakeFiles/iceoryx_hoofs_testing.dir/testing_logger.cpp.o" "gcc" "hoofs/testing/CMakeFiles/iceoryx_hoofs_testing.dir/testing_logger.cpp.o.d"
+  "/root/repo/iceoryx_hoofs/testing/timing_test.cpp" "hoofs/testing/CMakeFiles/iceoryx_hoofs_testing.dir/timing_test.cpp.o" "gcc" "hoofs/testing/CMakeFiles/iceoryx_hoofs_testing.dir/timing_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/hoofs/CMakeFiles/iceoryx_hoofs.dir/DependInfo.cmake"
+  "/root/repo/_test_build/platform/CMakeFiles/iceoryx_platform.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/iceoryx_hoofs_testing.dir/error_reporting/testing_error_handler.cpp.o"
+  "CMakeFiles/iceoryx_hoofs_testing.dir/error_reporting/testing_error_handler.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs_testing.dir/error_reporting/testing_support.cpp.o"
+  "CMakeFiles/iceoryx_hoofs_testing.dir/error_reporting/testing_support.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs_testing.dir/mocks/time_mock.cpp.o"
+  "CMakeFiles/iceoryx_hoofs_testing.dir/mocks/time_mock.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs_testing.dir/testing_logger.cpp.o"
+  "CMakeFiles/iceoryx_hoofs_testing.dir/testing_logger.cpp.o.d"
+  "CMakeFiles/iceoryx_hoofs_testing.dir/timing_test.cpp.o"
+  "CMakeFiles/iceoryx_hoofs_testing.dir/timing_test.cpp.o.d"
+  "libiceoryx_hoofs_testing.a"
+  "libiceoryx_hoofs_testing.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/iceoryx_hoofs_testing.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
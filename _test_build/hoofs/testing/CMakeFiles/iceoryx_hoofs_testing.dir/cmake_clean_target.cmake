@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libiceoryx_hoofs_testing.a"
+)
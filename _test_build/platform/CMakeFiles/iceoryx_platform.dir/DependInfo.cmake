@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/iceoryx_platform/generic/source/_string.cpp" "platform/CMakeFiles/iceoryx_platform.dir/generic/source/_string.cpp.o" "gcc" "platform/CMakeFiles/iceoryx_platform.dir/generic/source/_string.cpp.o.d"
+  "/root/repo/iceoryx_platform/generic/source/acl_feature_off.cpp" "platform/CMakeFiles/iceoryx_platform.dir/generic/source/acl_feature_off.cpp.o" "gcc" "platform/CMakeFiles/iceoryx_platform.dir/generic/source/acl_feature_off.cpp.o.d"
+  "/root/repo/iceoryx_platform/generic/source/acl_feature_on.cpp" "platform/CMakeFiles/iceoryx_platform.dir/generic/source/acl_feature_on.cpp.o" "gcc" "platform/CMakeFiles/iceoryx_platform.dir/generic/source/acl_feature_on.cpp.o.d"
+  "/root/repo/iceoryx_platform/generic/source/logging.cpp" "platform/CMakeFiles/iceoryx_platform.dir/generic/source/logging.cpp.o" "gcc" "platform/CMakeFiles/iceoryx_platform.dir/generic/source/logging.cpp.o.d"
+  "/root/repo/iceoryx_platform/generic/source/stdlib.cpp" "platform/CMakeFiles/iceoryx_platform.dir/generic/source/stdlib.cpp.o" "gcc" "platform/CMakeFiles/iceoryx_platform.dir/generic/source/stdlib.cpp.o.d"
+  "/root/repo/iceoryx_platform/linux/source/file.cpp" "platform/CMakeFiles/iceoryx_platform.dir/linux/source/file.cpp.o" "gcc" "platform/CMakeFiles/iceoryx_platform.dir/linux/source/file.cpp.o.d"
+  "/root/repo/iceoryx_platform/linux/source/fnctl.cpp" "platform/CMakeFiles/iceoryx_platform.dir/linux/source/fnctl.cpp.o" "gcc" "platform/CMakeFiles/iceoryx_platform.dir/linux/source/fnctl.cpp.o.d"
+  "/root/repo/iceoryx_platform/linux/source/grp.cpp" "platform/CMakeFiles/iceoryx_platform.dir/linux/source/grp.cpp.o" "gcc" "platform/CMakeFiles/iceoryx_platform.dir/linux/source/grp.cpp.o.d"
+  "/root/repo/iceoryx_platform/linux/source/mman.cpp" "platform/CMakeFiles/iceoryx_platform.dir/linux/source/mman.cpp.o" "gcc" "platform/CMakeFiles/iceoryx_platform.dir/linux/source/mman.cpp.o.d"
+  "/root/repo/iceoryx_platform/linux/source/mqueue.cpp" "platform/CMakeFiles/iceoryx_platform.dir/linux/source/mqueue.cpp.o" "gcc" "platform/CMakeFiles/iceoryx_platform.dir/linux/source/mqueue.cpp.o.d"
+  "/root/repo/iceoryx_platform/linux/source/socket.cpp" "platform/CMakeFiles/iceoryx_platform.dir/linux/source/socket.cpp.o" "gcc" "platform/CMakeFiles/iceoryx_platform.dir/linux/source/socket.cpp.o.d"
+  "/root/repo/iceoryx_platform/linux/source/unistd.cpp" "platform/CMakeFiles/iceoryx_platform.dir/linux/source/unistd.cpp.o" "gcc" "platform/CMakeFiles/iceoryx_platform.dir/linux/source/unistd.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
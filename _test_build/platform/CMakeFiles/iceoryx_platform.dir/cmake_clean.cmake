@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/iceoryx_platform.dir/generic/source/_string.cpp.o"
+  "CMakeFiles/iceoryx_platform.dir/generic/source/_string.cpp.o.d"
+  "CMakeFiles/iceoryx_platform.dir/generic/source/acl_feature_off.cpp.o"
+  "CMakeFiles/iceoryx_platform.dir/generic/source/acl_feature_off.cpp.o.d"
+  "CMakeFiles/iceoryx_platform.dir/generic/source/acl_feature_on.cpp.o"
+  "CMakeFiles/iceoryx_platform.dir/generic/source/acl_feature_on.cpp.o.d"
+  "CMakeFiles/iceoryx_platform.dir/generic/source/logging.cpp.o"
+  "CMakeFiles/iceoryx_platform.dir/generic/source/logging.cpp.o.d"
+  "CMakeFiles/iceoryx_platform.dir/generic/source/stdlib.cpp.o"
+  "CMakeFiles/iceoryx_platform.dir/generic/source/stdlib.cpp.o.d"
+  "CMakeFiles/iceoryx_platform.dir/linux/source/file.cpp.o"
+  "CMakeFiles/iceoryx_platform.dir/linux/source/file.cpp.o.d"
+  "CMakeFiles/iceoryx_platform.dir/linux/source/fnctl.cpp.o"
+  "CMakeFiles/iceoryx_platform.dir/linux/source/fnctl.cpp.o.d"
+  "CMakeFiles/iceoryx_platform.dir/linux/source/grp.cpp.o"
+  "CMakeFiles/iceoryx_platform.dir/linux/source/grp.cpp.o.d"
+  "CMakeFiles/iceoryx_platform.dir/linux/source/mman.cpp.o"
+  "CMakeFiles/iceoryx_platform.dir/linux/source/mman.cpp.o.d"
+  "CMakeFiles/iceoryx_platform.dir/linux/source/mqueue.cpp.o"
+  "CMakeFiles/iceoryx_platform.dir/linux/source/mqueue.cpp.o.d"
+  "CMakeFiles/iceoryx_platform.dir/linux/source/socket.cpp.o"
+  "CMakeFiles/iceoryx_platform.dir/linux/source/socket.cpp.o.d"
+  "CMakeFiles/iceoryx_platform.dir/linux/source/unistd.cpp.o"
+  "CMakeFiles/iceoryx_platform.dir/linux/source/unistd.cpp.o.d"
+  "libiceoryx_platform.a"
+  "libiceoryx_platform.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/iceoryx_platform.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/platform_integrationtests.dir/integrationtests/main_test_platform_integration.cpp.o"
+  "CMakeFiles/platform_integrationtests.dir/integrationtests/main_test_platform_integration.cpp.o.d"
+  "platform_integrationtests"
+  "platform_integrationtests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/platform_integrationtests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/iceoryx_platform/test/moduletests/main_test_platform_modules.cpp" "platform/test/CMakeFiles/platform_moduletests.dir/moduletests/main_test_platform_modules.cpp.o" "gcc" "platform/test/CMakeFiles/platform_moduletests.dir/moduletests/main_test_platform_modules.cpp.o.d"
+  "/root/repo/iceoryx_platform/test/moduletests/test_platform_atomic.cpp" "platform/test/CMakeFiles/platform_moduletests.dir/moduletests/test_platform_atomic.cpp.o" "gcc" "platform/test/CMakeFiles/platform_moduletests.dir/moduletests/test_platform_atomic.cpp.o.d"
+  "/root/repo/iceoryx_platform/test/moduletests/test_platform_logging.cpp" "platform/test/CMakeFiles/platform_moduletests.dir/moduletests/test_platform_logging.cpp.o" "gcc" "platform/test/CMakeFiles/platform_moduletests.dir/moduletests/test_platform_logging.cpp.o.d"
+  "/root/repo/iceoryx_platform/test/moduletests/test_platform_stdlib.cpp" "platform/test/CMakeFiles/platform_moduletests.dir/moduletests/test_platform_stdlib.cpp.o" "gcc" "platform/test/CMakeFiles/platform_moduletests.dir/moduletests/test_platform_stdlib.cpp.o.d"
+  "/root/repo/iceoryx_platform/test/moduletests/test_platform_string.cpp" "platform/test/CMakeFiles/platform_moduletests.dir/moduletests/test_platform_string.cpp.o" "gcc" "platform/test/CMakeFiles/platform_moduletests.dir/moduletests/test_platform_string.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/platform/CMakeFiles/iceoryx_platform.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
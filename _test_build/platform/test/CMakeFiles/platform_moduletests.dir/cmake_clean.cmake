@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/platform_moduletests.dir/moduletests/main_test_platform_modules.cpp.o"
+  "CMakeFiles/platform_moduletests.dir/moduletests/main_test_platform_modules.cpp.o.d"
+  "CMakeFiles/platform_moduletests.dir/moduletests/test_platform_atomic.cpp.o"
+  "CMakeFiles/platform_moduletests.dir/moduletests/test_platform_atomic.cpp.o.d"
+  "CMakeFiles/platform_moduletests.dir/moduletests/test_platform_logging.cpp.o"
+  "CMakeFiles/platform_moduletests.dir/moduletests/test_platform_logging.cpp.o.d"
+  "CMakeFiles/platform_moduletests.dir/moduletests/test_platform_stdlib.cpp.o"
+  "CMakeFiles/platform_moduletests.dir/moduletests/test_platform_stdlib.cpp.o.d"
+  "CMakeFiles/platform_moduletests.dir/moduletests/test_platform_string.cpp.o"
+  "CMakeFiles/platform_moduletests.dir/moduletests/test_platform_string.cpp.o.d"
+  "platform_moduletests"
+  "platform_moduletests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/platform_moduletests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,39 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "Release".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "iceoryx_posh::iceoryx_posh" for configuration "Release"
+set_property(TARGET iceoryx_posh::iceoryx_posh APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(iceoryx_posh::iceoryx_posh PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libiceoryx_posh.a"
+  )
+
+list(APPEND _cmake_import_check_targets iceoryx_posh::iceoryx_posh )
+list(APPEND _cmake_import_check_files_for_iceoryx_posh::iceoryx_posh "${_IMPORT_PREFIX}/lib/libiceoryx_posh.a" )
+
+# Import target "iceoryx_posh::iceoryx_posh_roudi" for configuration "Release"
+set_property(TARGET iceoryx_posh::iceoryx_posh_roudi APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(iceoryx_posh::iceoryx_posh_roudi PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libiceoryx_posh_roudi.a"
+  )
+
+list(APPEND _cmake_import_check_targets iceoryx_posh::iceoryx_posh_roudi )
+list(APPEND _cmake_import_check_files_for_iceoryx_posh::iceoryx_posh_roudi "${_IMPORT_PREFIX}/lib/libiceoryx_posh_roudi.a" )
+
+# Import target "iceoryx_posh::iceoryx_posh_gateway" for configuration "Release"
+set_property(TARGET iceoryx_posh::iceoryx_posh_gateway APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(iceoryx_posh::iceoryx_posh_gateway PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libiceoryx_posh_gateway.a"
+  )
+
+list(APPEND _cmake_import_check_targets iceoryx_posh::iceoryx_posh_gateway )
+list(APPEND _cmake_import_check_files_for_iceoryx_posh::iceoryx_posh_gateway "${_IMPORT_PREFIX}/lib/libiceoryx_posh_gateway.a" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
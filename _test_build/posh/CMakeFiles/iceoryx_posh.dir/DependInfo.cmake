@@ -0,0 +1,89 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/iceoryx_posh/experimental/source/node.cpp" "posh/CMakeFiles/iceoryx_posh.dir/experimental/source/node.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/experimental/source/node.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/capro/capro_message.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/capro/capro_message.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/capro/capro_message.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/capro/service_description.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/capro/service_description.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/capro/service_description.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/iceoryx_posh_types.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/iceoryx_posh_types.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/iceoryx_posh_types.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/mepoo/chunk_header.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/mepoo/chunk_header.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/mepoo/chunk_header.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/mepoo/chunk_management.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/mepoo/chunk_management.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/mepoo/chunk_management.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/mepoo/chunk_management_management.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/mepoo/chunk_management_management.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/mepoo/chunk_management_management.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/mepoo/chunk_settings.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/mepoo/chunk_settings.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/mepoo/chunk_settings.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/mepoo/mem_pool.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/mepoo/mem_pool.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/mepoo/mem_pool.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/mepoo/memory_info.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/mepoo/memory_info.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/mepoo/memory_info.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/mepoo/memory_manager.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/mepoo/memory_manager.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/mepoo/memory_manager.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/mepoo/mepoo_config.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/mepoo/mepoo_config.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/mepoo/mepoo_config.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/mepoo/mepoo_segment.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/mepoo/mepoo_segment.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/mepoo/mepoo_segment.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/mepoo/segment_config.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/mepoo/segment_config.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/mepoo/segment_config.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/mepoo/segment_manager.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/mepoo/segment_manager.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/mepoo/segment_manager.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/mepoo/shared_chunk.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/mepoo/shared_chunk.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/mepoo/shared_chunk.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/mepoo/shared_multi_chunk.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/mepoo/shared_multi_chunk.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/mepoo/shared_multi_chunk.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/mepoo/shm_safe_unmanaged_chunk.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/mepoo/shm_safe_unmanaged_chunk.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/mepoo/shm_safe_unmanaged_chunk.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/mepoo/shm_safe_unmanaged_multi_chunk.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/mepoo/shm_safe_unmanaged_multi_chunk.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/mepoo/shm_safe_unmanaged_multi_chunk.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/arena_block_size_planner.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/arena_block_size_planner.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/arena_block_size_planner.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/building_blocks/condition_listener.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/building_blocks/condition_listener.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/building_blocks/condition_listener.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/building_blocks/condition_notifier.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/building_blocks/condition_notifier.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/building_blocks/condition_notifier.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/building_blocks/condition_variable_data.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/building_blocks/condition_variable_data.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/building_blocks/condition_variable_data.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/building_blocks/locking_policy.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/building_blocks/locking_policy.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/building_blocks/locking_policy.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/building_blocks/unique_port_id.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/building_blocks/unique_port_id.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/building_blocks/unique_port_id.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/client_options.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/client_options.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/client_options.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/listener.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/listener.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/listener.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/message_layout.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/message_layout.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/message_layout.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/notification_info.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/notification_info.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/notification_info.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/ports/base_port.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/base_port.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/base_port.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/ports/base_port_data.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/base_port_data.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/base_port_data.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/ports/client_port_data.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/client_port_data.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/client_port_data.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/ports/client_port_roudi.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/client_port_roudi.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/client_port_roudi.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/ports/client_port_user.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/client_port_user.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/client_port_user.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/ports/interface_port.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/interface_port.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/interface_port.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/ports/interface_port_data.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/interface_port_data.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/interface_port_data.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/ports/publisher_port_data.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/publisher_port_data.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/publisher_port_data.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/ports/publisher_port_roudi.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/publisher_port_roudi.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/publisher_port_roudi.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/ports/publisher_port_user.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/publisher_port_user.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/publisher_port_user.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/ports/server_port_data.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/server_port_data.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/server_port_data.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/ports/server_port_roudi.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/server_port_roudi.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/server_port_roudi.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/ports/server_port_user.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/server_port_user.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/server_port_user.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/ports/subscriber_port_data.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/subscriber_port_data.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/subscriber_port_data.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/ports/subscriber_port_multi_producer.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/subscriber_port_multi_producer.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/subscriber_port_multi_producer.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/ports/subscriber_port_roudi.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/subscriber_port_roudi.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/subscriber_port_roudi.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/ports/subscriber_port_single_producer.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/subscriber_port_single_producer.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/subscriber_port_single_producer.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/ports/subscriber_port_user.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/subscriber_port_user.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/ports/subscriber_port_user.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/publisher_options.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/publisher_options.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/publisher_options.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/rpc_header.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/rpc_header.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/rpc_header.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/server_options.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/server_options.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/server_options.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/subscriber_options.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/subscriber_options.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/subscriber_options.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/trigger.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/trigger.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/trigger.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/trigger_handle.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/trigger_handle.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/trigger_handle.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/popo/user_trigger.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/user_trigger.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/popo/user_trigger.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/posh_error_reporting.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/posh_error_reporting.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/posh_error_reporting.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/roudi/service_registry.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/roudi/service_registry.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/roudi/service_registry.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/runtime/heartbeat.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/runtime/heartbeat.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/runtime/heartbeat.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/runtime/ipc_interface_base.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/runtime/ipc_interface_base.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/runtime/ipc_interface_base.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/runtime/ipc_interface_creator.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/runtime/ipc_interface_creator.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/runtime/ipc_interface_creator.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/runtime/ipc_interface_user.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/runtime/ipc_interface_user.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/runtime/ipc_interface_user.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/runtime/ipc_message.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/runtime/ipc_message.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/runtime/ipc_message.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/runtime/ipc_runtime_interface.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/runtime/ipc_runtime_interface.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/runtime/ipc_runtime_interface.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/runtime/port_config_info.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/runtime/port_config_info.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/runtime/port_config_info.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/runtime/posh_runtime.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/runtime/posh_runtime.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/runtime/posh_runtime.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/runtime/posh_runtime_impl.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/runtime/posh_runtime_impl.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/runtime/posh_runtime_impl.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/runtime/posh_runtime_single_process.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/runtime/posh_runtime_single_process.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/runtime/posh_runtime_single_process.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/runtime/service_discovery.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/runtime/service_discovery.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/runtime/service_discovery.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/runtime/shared_memory_user.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/runtime/shared_memory_user.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/runtime/shared_memory_user.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/version/version_info.cpp" "posh/CMakeFiles/iceoryx_posh.dir/source/version/version_info.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh.dir/source/version/version_info.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/hoofs/CMakeFiles/iceoryx_hoofs.dir/DependInfo.cmake"
+  "/root/repo/_test_build/platform/CMakeFiles/iceoryx_platform.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,147 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/iceoryx_posh.dir/experimental/source/node.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/experimental/source/node.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/capro/capro_message.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/capro/capro_message.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/capro/service_description.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/capro/service_description.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/iceoryx_posh_types.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/iceoryx_posh_types.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/mepoo/chunk_header.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/mepoo/chunk_header.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/mepoo/chunk_management.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/mepoo/chunk_management.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/mepoo/chunk_management_management.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/mepoo/chunk_management_management.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/mepoo/chunk_settings.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/mepoo/chunk_settings.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/mepoo/mem_pool.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/mepoo/mem_pool.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/mepoo/memory_info.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/mepoo/memory_info.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/mepoo/memory_manager.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/mepoo/memory_manager.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/mepoo/mepoo_config.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/mepoo/mepoo_config.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/mepoo/mepoo_segment.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/mepoo/mepoo_segment.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/mepoo/segment_config.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/mepoo/segment_config.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/mepoo/segment_manager.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/mepoo/segment_manager.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/mepoo/shared_chunk.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/mepoo/shared_chunk.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/mepoo/shared_multi_chunk.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/mepoo/shared_multi_chunk.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/mepoo/shm_safe_unmanaged_chunk.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/mepoo/shm_safe_unmanaged_chunk.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/mepoo/shm_safe_unmanaged_multi_chunk.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/mepoo/shm_safe_unmanaged_multi_chunk.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/arena_block_size_planner.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/arena_block_size_planner.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/building_blocks/condition_listener.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/building_blocks/condition_listener.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/building_blocks/condition_notifier.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/building_blocks/condition_notifier.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/building_blocks/condition_variable_data.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/building_blocks/condition_variable_data.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/building_blocks/locking_policy.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/building_blocks/locking_policy.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/building_blocks/unique_port_id.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/building_blocks/unique_port_id.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/client_options.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/client_options.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/listener.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/listener.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/message_layout.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/message_layout.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/notification_info.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/notification_info.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/base_port.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/base_port.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/base_port_data.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/base_port_data.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/client_port_data.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/client_port_data.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/client_port_roudi.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/client_port_roudi.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/client_port_user.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/client_port_user.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/interface_port.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/interface_port.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/interface_port_data.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/interface_port_data.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/publisher_port_data.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/publisher_port_data.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/publisher_port_roudi.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/publisher_port_roudi.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/publisher_port_user.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/publisher_port_user.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/server_port_data.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/server_port_data.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/server_port_roudi.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/server_port_roudi.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/server_port_user.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/server_port_user.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/subscriber_port_data.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/subscriber_port_data.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/subscriber_port_multi_producer.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/subscriber_port_multi_producer.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/subscriber_port_roudi.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/subscriber_port_roudi.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/subscriber_port_single_producer.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/subscriber_port_single_producer.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/subscriber_port_user.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/ports/subscriber_port_user.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/publisher_options.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/publisher_options.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/rpc_header.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/rpc_header.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/server_options.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/server_options.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/subscriber_options.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/subscriber_options.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/trigger.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/trigger.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/trigger_handle.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/trigger_handle.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/user_trigger.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/popo/user_trigger.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/posh_error_reporting.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/posh_error_reporting.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/roudi/service_registry.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/roudi/service_registry.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/runtime/heartbeat.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/runtime/heartbeat.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/runtime/ipc_interface_base.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/runtime/ipc_interface_base.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/runtime/ipc_interface_creator.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/runtime/ipc_interface_creator.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/runtime/ipc_interface_user.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/runtime/ipc_interface_user.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/runtime/ipc_message.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/runtime/ipc_message.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/runtime/ipc_runtime_interface.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/runtime/ipc_runtime_interface.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/runtime/port_config_info.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/runtime/port_config_info.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/runtime/posh_runtime.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/runtime/posh_runtime.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/runtime/posh_runtime_impl.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/runtime/posh_runtime_impl.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/runtime/posh_runtime_single_process.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/runtime/posh_runtime_single_process.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/runtime/service_discovery.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/runtime/service_discovery.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/runtime/shared_memory_user.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/runtime/shared_memory_user.cpp.o.d"
+  "CMakeFiles/iceoryx_posh.dir/source/version/version_info.cpp.o"
+  "CMakeFiles/iceoryx_posh.dir/source/version/version_info.cpp.o.d"
+  "libiceoryx_posh.a"
+  "libiceoryx_posh.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/iceoryx_posh.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/iceoryx_posh_gateway.dir/source/gateway/gateway_base.cpp.o"
+  "CMakeFiles/iceoryx_posh_gateway.dir/source/gateway/gateway_base.cpp.o.d"
+  "libiceoryx_posh_gateway.a"
+  "libiceoryx_posh_gateway.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/iceoryx_posh_gateway.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libiceoryx_posh_gateway.a"
+)
@@ -0,0 +1,41 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/iceoryx_posh/source/roudi/application/iceoryx_roudi_app.cpp" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/application/iceoryx_roudi_app.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/application/iceoryx_roudi_app.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/roudi/application/roudi_app.cpp" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/application/roudi_app.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/application/roudi_app.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/roudi/iceoryx_roudi_components.cpp" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/iceoryx_roudi_components.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/iceoryx_roudi_components.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/roudi/memory/default_roudi_memory.cpp" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/default_roudi_memory.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/default_roudi_memory.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/roudi/memory/iceoryx_roudi_memory_manager.cpp" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/iceoryx_roudi_memory_manager.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/iceoryx_roudi_memory_manager.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/roudi/memory/memory_block.cpp" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/memory_block.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/memory_block.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/roudi/memory/memory_provider.cpp" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/memory_provider.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/memory_provider.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/roudi/memory/mempool_collection_memory_block.cpp" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/mempool_collection_memory_block.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/mempool_collection_memory_block.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/roudi/memory/mempool_segment_manager_memory_block.cpp" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/mempool_segment_manager_memory_block.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/mempool_segment_manager_memory_block.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/roudi/memory/port_pool_memory_block.cpp" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/port_pool_memory_block.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/port_pool_memory_block.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/roudi/memory/posix_shm_memory_provider.cpp" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/posix_shm_memory_provider.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/posix_shm_memory_provider.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/roudi/memory/roudi_memory_manager.cpp" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/roudi_memory_manager.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/roudi_memory_manager.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/roudi/port_manager.cpp" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/port_manager.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/port_manager.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/roudi/port_pool.cpp" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/port_pool.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/port_pool.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/roudi/process.cpp" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/process.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/process.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/roudi/process_manager.cpp" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/process_manager.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/process_manager.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/roudi/roudi.cpp" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/roudi.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/roudi.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/roudi/roudi_cmd_line_parser.cpp" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/roudi_cmd_line_parser.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/roudi_cmd_line_parser.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/roudi/roudi_cmd_line_parser_config_file_option.cpp" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/roudi_cmd_line_parser_config_file_option.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/roudi_cmd_line_parser_config_file_option.cpp.o.d"
+  "/root/repo/iceoryx_posh/source/roudi/roudi_config.cpp" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/roudi_config.cpp.o" "gcc" "posh/CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/roudi_config.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/posh/CMakeFiles/iceoryx_posh.dir/DependInfo.cmake"
+  "/root/repo/_test_build/hoofs/CMakeFiles/iceoryx_hoofs.dir/DependInfo.cmake"
+  "/root/repo/_test_build/platform/CMakeFiles/iceoryx_platform.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,49 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/application/iceoryx_roudi_app.cpp.o"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/application/iceoryx_roudi_app.cpp.o.d"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/application/roudi_app.cpp.o"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/application/roudi_app.cpp.o.d"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/iceoryx_roudi_components.cpp.o"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/iceoryx_roudi_components.cpp.o.d"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/default_roudi_memory.cpp.o"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/default_roudi_memory.cpp.o.d"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/iceoryx_roudi_memory_manager.cpp.o"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/iceoryx_roudi_memory_manager.cpp.o.d"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/memory_block.cpp.o"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/memory_block.cpp.o.d"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/memory_provider.cpp.o"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/memory_provider.cpp.o.d"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/mempool_collection_memory_block.cpp.o"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/mempool_collection_memory_block.cpp.o.d"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/mempool_segment_manager_memory_block.cpp.o"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/mempool_segment_manager_memory_block.cpp.o.d"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/port_pool_memory_block.cpp.o"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/port_pool_memory_block.cpp.o.d"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/posix_shm_memory_provider.cpp.o"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/posix_shm_memory_provider.cpp.o.d"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/roudi_memory_manager.cpp.o"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/memory/roudi_memory_manager.cpp.o.d"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/port_manager.cpp.o"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/port_manager.cpp.o.d"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/port_pool.cpp.o"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/port_pool.cpp.o.d"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/process.cpp.o"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/process.cpp.o.d"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/process_manager.cpp.o"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/process_manager.cpp.o.d"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/roudi.cpp.o"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/roudi.cpp.o.d"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/roudi_cmd_line_parser.cpp.o"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/roudi_cmd_line_parser.cpp.o.d"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/roudi_cmd_line_parser_config_file_option.cpp.o"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/roudi_cmd_line_parser_config_file_option.cpp.o.d"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/roudi_config.cpp.o"
+  "CMakeFiles/iceoryx_posh_roudi.dir/source/roudi/roudi_config.cpp.o.d"
+  "libiceoryx_posh_roudi.a"
+  "libiceoryx_posh_roudi.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/iceoryx_posh_roudi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
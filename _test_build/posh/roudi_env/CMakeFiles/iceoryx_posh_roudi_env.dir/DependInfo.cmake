@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/iceoryx_posh/roudi_env/source/minimal_iceoryx_config.cpp" "posh/roudi_env/CMakeFiles/iceoryx_posh_roudi_env.dir/source/minimal_iceoryx_config.cpp.o" "gcc" "posh/roudi_env/CMakeFiles/iceoryx_posh_roudi_env.dir/source/minimal_iceoryx_config.cpp.o.d"
+  "/root/repo/iceoryx_posh/roudi_env/source/roudi_env.cpp" "posh/roudi_env/CMakeFiles/iceoryx_posh_roudi_env.dir/source/roudi_env.cpp.o" "gcc" "posh/roudi_env/CMakeFiles/iceoryx_posh_roudi_env.dir/source/roudi_env.cpp.o.d"
+  "/root/repo/iceoryx_posh/roudi_env/source/roudi_env_node_builder.cpp" "posh/roudi_env/CMakeFiles/iceoryx_posh_roudi_env.dir/source/roudi_env_node_builder.cpp.o" "gcc" "posh/roudi_env/CMakeFiles/iceoryx_posh_roudi_env.dir/source/roudi_env_node_builder.cpp.o.d"
+  "/root/repo/iceoryx_posh/roudi_env/source/runtime_test_interface.cpp" "posh/roudi_env/CMakeFiles/iceoryx_posh_roudi_env.dir/source/runtime_test_interface.cpp.o" "gcc" "posh/roudi_env/CMakeFiles/iceoryx_posh_roudi_env.dir/source/runtime_test_interface.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/posh/CMakeFiles/iceoryx_posh.dir/DependInfo.cmake"
+  "/root/repo/_test_build/hoofs/CMakeFiles/iceoryx_hoofs.dir/DependInfo.cmake"
+  "/root/repo/_test_build/posh/CMakeFiles/iceoryx_posh_roudi.dir/DependInfo.cmake"
+  "/root/repo/_test_build/platform/CMakeFiles/iceoryx_platform.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
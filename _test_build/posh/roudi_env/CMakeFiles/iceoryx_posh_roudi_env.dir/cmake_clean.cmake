@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/iceoryx_posh_roudi_env.dir/source/minimal_iceoryx_config.cpp.o"
+  "CMakeFiles/iceoryx_posh_roudi_env.dir/source/minimal_iceoryx_config.cpp.o.d"
+  "CMakeFiles/iceoryx_posh_roudi_env.dir/source/roudi_env.cpp.o"
+  "CMakeFiles/iceoryx_posh_roudi_env.dir/source/roudi_env.cpp.o.d"
+  "CMakeFiles/iceoryx_posh_roudi_env.dir/source/roudi_env_node_builder.cpp.o"
+  "CMakeFiles/iceoryx_posh_roudi_env.dir/source/roudi_env_node_builder.cpp.o.d"
+  "CMakeFiles/iceoryx_posh_roudi_env.dir/source/runtime_test_interface.cpp.o"
+  "CMakeFiles/iceoryx_posh_roudi_env.dir/source/runtime_test_interface.cpp.o.d"
+  "libiceoryx_posh_roudi_env.a"
+  "libiceoryx_posh_roudi_env.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/iceoryx_posh_roudi_env.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
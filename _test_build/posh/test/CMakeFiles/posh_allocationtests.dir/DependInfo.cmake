@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/iceoryx_posh/test/allocationtests/allocation_counter.cpp" "posh/test/CMakeFiles/posh_allocationtests.dir/allocationtests/allocation_counter.cpp.o" "gcc" "posh/test/CMakeFiles/posh_allocationtests.dir/allocationtests/allocation_counter.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/allocationtests/main_test_posh_allocation.cpp" "posh/test/CMakeFiles/posh_allocationtests.dir/allocationtests/main_test_posh_allocation.cpp.o" "gcc" "posh/test/CMakeFiles/posh_allocationtests.dir/allocationtests/main_test_posh_allocation.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/allocationtests/test_popo_arena_allocation_free.cpp" "posh/test/CMakeFiles/posh_allocationtests.dir/allocationtests/test_popo_arena_allocation_free.cpp.o" "gcc" "posh/test/CMakeFiles/posh_allocationtests.dir/allocationtests/test_popo_arena_allocation_free.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/allocationtests/test_popo_multi_chunk_allocation_free.cpp" "posh/test/CMakeFiles/posh_allocationtests.dir/allocationtests/test_popo_multi_chunk_allocation_free.cpp.o" "gcc" "posh/test/CMakeFiles/posh_allocationtests.dir/allocationtests/test_popo_multi_chunk_allocation_free.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/platform/CMakeFiles/iceoryx_platform.dir/DependInfo.cmake"
+  "/root/repo/_test_build/hoofs/CMakeFiles/iceoryx_hoofs.dir/DependInfo.cmake"
+  "/root/repo/_test_build/hoofs/testing/CMakeFiles/iceoryx_hoofs_testing.dir/DependInfo.cmake"
+  "/root/repo/_test_build/posh/CMakeFiles/iceoryx_posh.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
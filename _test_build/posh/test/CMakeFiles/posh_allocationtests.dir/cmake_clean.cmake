@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posh_allocationtests.dir/allocationtests/allocation_counter.cpp.o"
+  "CMakeFiles/posh_allocationtests.dir/allocationtests/allocation_counter.cpp.o.d"
+  "CMakeFiles/posh_allocationtests.dir/allocationtests/main_test_posh_allocation.cpp.o"
+  "CMakeFiles/posh_allocationtests.dir/allocationtests/main_test_posh_allocation.cpp.o.d"
+  "CMakeFiles/posh_allocationtests.dir/allocationtests/test_popo_arena_allocation_free.cpp.o"
+  "CMakeFiles/posh_allocationtests.dir/allocationtests/test_popo_arena_allocation_free.cpp.o.d"
+  "CMakeFiles/posh_allocationtests.dir/allocationtests/test_popo_multi_chunk_allocation_free.cpp.o"
+  "CMakeFiles/posh_allocationtests.dir/allocationtests/test_popo_multi_chunk_allocation_free.cpp.o.d"
+  "posh_allocationtests"
+  "posh_allocationtests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posh_allocationtests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,39 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/iceoryx_posh/test/integrationtests/main_test_posh_integration.cpp" "posh/test/CMakeFiles/posh_integrationtests.dir/integrationtests/main_test_posh_integration.cpp.o" "gcc" "posh/test/CMakeFiles/posh_integrationtests.dir/integrationtests/main_test_posh_integration.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/integrationtests/test_client_server.cpp" "posh/test/CMakeFiles/posh_integrationtests.dir/integrationtests/test_client_server.cpp.o" "gcc" "posh/test/CMakeFiles/posh_integrationtests.dir/integrationtests/test_client_server.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/integrationtests/test_interface_port_stack_blowup.cpp" "posh/test/CMakeFiles/posh_integrationtests.dir/integrationtests/test_interface_port_stack_blowup.cpp.o" "gcc" "posh/test/CMakeFiles/posh_integrationtests.dir/integrationtests/test_interface_port_stack_blowup.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/integrationtests/test_mq_interface_startup_race.cpp" "posh/test/CMakeFiles/posh_integrationtests.dir/integrationtests/test_mq_interface_startup_race.cpp.o" "gcc" "posh/test/CMakeFiles/posh_integrationtests.dir/integrationtests/test_mq_interface_startup_race.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/integrationtests/test_popo_chunk_building_blocks.cpp" "posh/test/CMakeFiles/posh_integrationtests.dir/integrationtests/test_popo_chunk_building_blocks.cpp.o" "gcc" "posh/test/CMakeFiles/posh_integrationtests.dir/integrationtests/test_popo_chunk_building_blocks.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/integrationtests/test_popo_port_user_building_blocks.cpp" "posh/test/CMakeFiles/posh_integrationtests.dir/integrationtests/test_popo_port_user_building_blocks.cpp.o" "gcc" "posh/test/CMakeFiles/posh_integrationtests.dir/integrationtests/test_popo_port_user_building_blocks.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/integrationtests/test_popo_pub_sub_listener.cpp" "posh/test/CMakeFiles/posh_integrationtests.dir/integrationtests/test_popo_pub_sub_listener.cpp.o" "gcc" "posh/test/CMakeFiles/posh_integrationtests.dir/integrationtests/test_popo_pub_sub_listener.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/integrationtests/test_posh_experimental_node.cpp" "posh/test/CMakeFiles/posh_integrationtests.dir/integrationtests/test_posh_experimental_node.cpp.o" "gcc" "posh/test/CMakeFiles/posh_integrationtests.dir/integrationtests/test_posh_experimental_node.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/integrationtests/test_posh_mepoo.cpp" "posh/test/CMakeFiles/posh_integrationtests.dir/integrationtests/test_posh_mepoo.cpp.o" "gcc" "posh/test/CMakeFiles/posh_integrationtests.dir/integrationtests/test_posh_mepoo.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/integrationtests/test_publisher_subscriber_communication.cpp" "posh/test/CMakeFiles/posh_integrationtests.dir/integrationtests/test_publisher_subscriber_communication.cpp.o" "gcc" "posh/test/CMakeFiles/posh_integrationtests.dir/integrationtests/test_publisher_subscriber_communication.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/integrationtests/test_roudi_env.cpp" "posh/test/CMakeFiles/posh_integrationtests.dir/integrationtests/test_roudi_env.cpp.o" "gcc" "posh/test/CMakeFiles/posh_integrationtests.dir/integrationtests/test_roudi_env.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/integrationtests/test_service_discovery.cpp" "posh/test/CMakeFiles/posh_integrationtests.dir/integrationtests/test_service_discovery.cpp.o" "gcc" "posh/test/CMakeFiles/posh_integrationtests.dir/integrationtests/test_service_discovery.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/integrationtests/test_shm_sigbus_handler.cpp" "posh/test/CMakeFiles/posh_integrationtests.dir/integrationtests/test_shm_sigbus_handler.cpp.o" "gcc" "posh/test/CMakeFiles/posh_integrationtests.dir/integrationtests/test_shm_sigbus_handler.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/platform/CMakeFiles/iceoryx_platform.dir/DependInfo.cmake"
+  "/root/repo/_test_build/hoofs/CMakeFiles/iceoryx_hoofs.dir/DependInfo.cmake"
+  "/root/repo/_test_build/hoofs/testing/CMakeFiles/iceoryx_hoofs_testing.dir/DependInfo.cmake"
+  "/root/repo/_test_build/posh/CMakeFiles/iceoryx_posh.dir/DependInfo.cmake"
+  "/root/repo/_test_build/posh/CMakeFiles/iceoryx_posh_gateway.dir/DependInfo.cmake"
+  "/root/repo/_test_build/posh/CMakeFiles/iceoryx_posh_roudi.dir/DependInfo.cmake"
+  "/root/repo/_test_build/posh/testing/CMakeFiles/iceoryx_posh_testing.dir/DependInfo.cmake"
+  "/root/repo/_test_build/posh/roudi_env/CMakeFiles/iceoryx_posh_roudi_env.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posh_integrationtests.dir/integrationtests/main_test_posh_integration.cpp.o"
+  "CMakeFiles/posh_integrationtests.dir/integrationtests/main_test_posh_integration.cpp.o.d"
+  "CMakeFiles/posh_integrationtests.dir/integrationtests/test_client_server.cpp.o"
+  "CMakeFiles/posh_integrationtests.dir/integrationtests/test_client_server.cpp.o.d"
+  "CMakeFiles/posh_integrationtests.dir/integrationtests/test_interface_port_stack_blowup.cpp.o"
+  "CMakeFiles/posh_integrationtests.dir/integrationtests/test_interface_port_stack_blowup.cpp.o.d"
+  "CMakeFiles/posh_integrationtests.dir/integrationtests/test_mq_interface_startup_race.cpp.o"
+  "CMakeFiles/posh_integrationtests.dir/integrationtests/test_mq_interface_startup_race.cpp.o.d"
+  "CMakeFiles/posh_integrationtests.dir/integrationtests/test_popo_chunk_building_blocks.cpp.o"
+  "CMakeFiles/posh_integrationtests.dir/integrationtests/test_popo_chunk_building_blocks.cpp.o.d"
+  "CMakeFiles/posh_integrationtests.dir/integrationtests/test_popo_port_user_building_blocks.cpp.o"
+  "CMakeFiles/posh_integrationtests.dir/integrationtests/test_popo_port_user_building_blocks.cpp.o.d"
+  "CMakeFiles/posh_integrationtests.dir/integrationtests/test_popo_pub_sub_listener.cpp.o"
+  "CMakeFiles/posh_integrationtests.dir/integrationtests/test_popo_pub_sub_listener.cpp.o.d"
+  "CMakeFiles/posh_integrationtests.dir/integrationtests/test_posh_experimental_node.cpp.o"
+  "CMakeFiles/posh_integrationtests.dir/integrationtests/test_posh_experimental_node.cpp.o.d"
+  "CMakeFiles/posh_integrationtests.dir/integrationtests/test_posh_mepoo.cpp.o"
+  "CMakeFiles/posh_integrationtests.dir/integrationtests/test_posh_mepoo.cpp.o.d"
+  "CMakeFiles/posh_integrationtests.dir/integrationtests/test_publisher_subscriber_communication.cpp.o"
+  "CMakeFiles/posh_integrationtests.dir/integrationtests/test_publisher_subscriber_communication.cpp.o.d"
+  "CMakeFiles/posh_integrationtests.dir/integrationtests/test_roudi_env.cpp.o"
+  "CMakeFiles/posh_integrationtests.dir/integrationtests/test_roudi_env.cpp.o.d"
+  "CMakeFiles/posh_integrationtests.dir/integrationtests/test_service_discovery.cpp.o"
+  "CMakeFiles/posh_integrationtests.dir/integrationtests/test_service_discovery.cpp.o.d"
+  "CMakeFiles/posh_integrationtests.dir/integrationtests/test_shm_sigbus_handler.cpp.o"
+  "CMakeFiles/posh_integrationtests.dir/integrationtests/test_shm_sigbus_handler.cpp.o.d"
+  "posh_integrationtests"
+  "posh_integrationtests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posh_integrationtests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
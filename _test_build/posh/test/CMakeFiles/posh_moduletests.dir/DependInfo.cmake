@@ -0,0 +1,128 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/iceoryx_posh/test/moduletests/main_test_posh_modules.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/main_test_posh_modules.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/main_test_posh_modules.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_base_port.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_base_port.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_base_port.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_capro_message.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_capro_message.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_capro_message.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_capro_service.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_capro_service.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_capro_service.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_compatibility_check_level.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_compatibility_check_level.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_compatibility_check_level.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_gw_channel.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_gw_channel.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_gw_channel.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_gw_gateway_discovery.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_gw_gateway_discovery.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_gw_gateway_discovery.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_gw_gateway_generic.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_gw_gateway_generic.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_gw_gateway_generic.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_mepoo_chunk_header.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_chunk_header.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_chunk_header.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_mepoo_chunk_management_management.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_chunk_management_management.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_chunk_management_management.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_mepoo_chunk_settings.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_chunk_settings.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_chunk_settings.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_mepoo_config.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_config.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_config.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_mepoo_memory_info.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_memory_info.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_memory_info.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_mepoo_memory_manager.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_memory_manager.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_memory_manager.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_mepoo_mempool.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_mempool.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_mempool.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_mepoo_segment.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_segment.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_segment.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_mepoo_segment_management.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_segment_management.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_segment_management.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_mepoo_shared_chunk.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_shared_chunk.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_shared_chunk.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_mepoo_shared_pointer.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_shared_pointer.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_shared_pointer.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_mepoo_shm_safe_unmanaged_chunk.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_shm_safe_unmanaged_chunk.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_shm_safe_unmanaged_chunk.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_mepoo_typed_mempool.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_typed_mempool.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_typed_mempool.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_monitoringmode_logstream.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_monitoringmode_logstream.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_monitoringmode_logstream.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_mq_message.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_mq_message.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_mq_message.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_arena_block_size_planner.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_arena_block_size_planner.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_arena_block_size_planner.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_arena_loan.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_arena_loan.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_arena_loan.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_base_client.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_base_client.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_base_client.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_base_publisher.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_base_publisher.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_base_publisher.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_base_server.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_base_server.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_base_server.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_base_subscriber.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_base_subscriber.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_base_subscriber.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_chunk_distributor.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_chunk_distributor.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_chunk_distributor.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_chunk_queue.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_chunk_queue.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_chunk_queue.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_chunk_receiver.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_chunk_receiver.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_chunk_receiver.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_chunk_sender.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_chunk_sender.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_chunk_sender.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_chunk_sender_loan_context.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_chunk_sender_loan_context.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_chunk_sender_loan_context.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_chunk_sender_recycling.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_chunk_sender_recycling.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_chunk_sender_recycling.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_client.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_client.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_client.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_client_options.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_client_options.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_client_options.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_client_port.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_client_port.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_client_port.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_client_server_arena.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_client_server_arena.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_client_server_arena.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_condition_variable.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_condition_variable.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_condition_variable.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_interface_port.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_interface_port.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_interface_port.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_listener.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_listener.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_listener.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_listener_waitset_attachments.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_listener_waitset_attachments.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_listener_waitset_attachments.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_loan_context_list.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_loan_context_list.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_loan_context_list.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_message_layout.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_message_layout.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_message_layout.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_notification_info.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_notification_info.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_notification_info.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_protobuf_sample.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_protobuf_sample.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_protobuf_sample.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_publisher.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_publisher.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_publisher.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_publisher_options.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_publisher_options.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_publisher_options.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_publisher_port.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_publisher_port.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_publisher_port.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_publisher_port_release.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_publisher_port_release.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_publisher_port_release.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_request.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_request.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_request.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_response.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_response.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_response.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_rpc_header.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_rpc_header.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_rpc_header.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_sample.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_sample.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_sample.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_server.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_server.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_server.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_server_options.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_server_options.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_server_options.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_server_port_roudi.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_server_port_roudi.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_server_port_roudi.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_server_port_user.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_server_port_user.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_server_port_user.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_smart_chunk.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_smart_chunk.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_smart_chunk.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_subscriber.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_subscriber.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_subscriber.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_subscriber_options.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_subscriber_options.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_subscriber_options.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_subscriber_port.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_subscriber_port.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_subscriber_port.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_toml_gateway_config_parser.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_toml_gateway_config_parser.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_toml_gateway_config_parser.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_trigger.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_trigger.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_trigger.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_trigger_handle.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_trigger_handle.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_trigger_handle.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_unique_port_id.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_unique_port_id.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_unique_port_id.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_untyped_client.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_untyped_client.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_untyped_client.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_untyped_publisher.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_untyped_publisher.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_untyped_publisher.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_untyped_server.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_untyped_server.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_untyped_server.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_untyped_subscriber.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_untyped_subscriber.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_untyped_subscriber.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_used_chunk_list.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_used_chunk_list.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_used_chunk_list.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_user_trigger.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_user_trigger.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_user_trigger.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_variant_queue.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_variant_queue.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_variant_queue.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_popo_waitset.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_waitset.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_popo_waitset.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_posh_runtime.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_posh_runtime.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_posh_runtime.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_posh_runtime_heartbeat.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_posh_runtime_heartbeat.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_posh_runtime_heartbeat.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_posh_runtime_single_process.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_posh_runtime_single_process.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_posh_runtime_single_process.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_posh_types.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_posh_types.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_posh_types.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_roudi_cmd_line_parser.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_cmd_line_parser.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_cmd_line_parser.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_roudi_cmd_line_parser_config_file_option.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_cmd_line_parser_config_file_option.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_cmd_line_parser_config_file_option.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_roudi_config_toml_file_provider.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_config_toml_file_provider.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_config_toml_file_provider.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_roudi_generic_memory_block.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_generic_memory_block.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_generic_memory_block.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_roudi_iceoryx_roudi_app.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_iceoryx_roudi_app.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_iceoryx_roudi_app.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_roudi_iceoyx_roudi_memory_manager.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_iceoyx_roudi_memory_manager.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_iceoyx_roudi_memory_manager.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_roudi_memory_block.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_memory_block.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_memory_block.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_roudi_memory_manager.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_memory_manager.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_memory_manager.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_roudi_memory_provider.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_memory_provider.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_memory_provider.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_roudi_mempool_introspection.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_mempool_introspection.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_mempool_introspection.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_roudi_port_introspection.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_port_introspection.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_port_introspection.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_roudi_portmanager.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_portmanager.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_portmanager.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_roudi_portmanager_client_server.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_portmanager_client_server.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_portmanager_client_server.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_roudi_portpool.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_portpool.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_portpool.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_roudi_posix_shm_memory_provider.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_posix_shm_memory_provider.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_posix_shm_memory_provider.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_roudi_process.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_process.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_process.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_roudi_process_introspection.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_process_introspection.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_process_introspection.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_roudi_process_manager.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_process_manager.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_process_manager.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_roudi_service_registry.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_service_registry.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_service_registry.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_runtime_ipc_interface.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_runtime_ipc_interface.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_runtime_ipc_interface.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_runtime_ipc_interface_creator.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_runtime_ipc_interface_creator.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_runtime_ipc_interface_creator.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_runtime_port_config_info.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_runtime_port_config_info.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_runtime_port_config_info.cpp.o.d"
+  "/root/repo/iceoryx_posh/test/moduletests/test_version_info.cpp" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_version_info.cpp.o" "gcc" "posh/test/CMakeFiles/posh_moduletests.dir/moduletests/test_version_info.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/platform/CMakeFiles/iceoryx_platform.dir/DependInfo.cmake"
+  "/root/repo/_test_build/hoofs/CMakeFiles/iceoryx_hoofs.dir/DependInfo.cmake"
+  "/root/repo/_test_build/hoofs/testing/CMakeFiles/iceoryx_hoofs_testing.dir/DependInfo.cmake"
+  "/root/repo/_test_build/posh/CMakeFiles/iceoryx_posh.dir/DependInfo.cmake"
+  "/root/repo/_test_build/posh/CMakeFiles/iceoryx_posh_gateway.dir/DependInfo.cmake"
+  "/root/repo/_test_build/posh/CMakeFiles/iceoryx_posh_roudi.dir/DependInfo.cmake"
+  "/root/repo/_test_build/posh/testing/CMakeFiles/iceoryx_posh_testing.dir/DependInfo.cmake"
+  "/root/repo/_test_build/posh/roudi_env/CMakeFiles/iceoryx_posh_roudi_env.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
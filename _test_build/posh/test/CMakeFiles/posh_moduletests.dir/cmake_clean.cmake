@@ -0,0 +1,213 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/posh_moduletests.dir/moduletests/main_test_posh_modules.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/main_test_posh_modules.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_base_port.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_base_port.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_capro_message.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_capro_message.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_capro_service.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_capro_service.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_compatibility_check_level.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_compatibility_check_level.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_gw_channel.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_gw_channel.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_gw_gateway_discovery.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_gw_gateway_discovery.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_gw_gateway_generic.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_gw_gateway_generic.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_chunk_header.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_chunk_header.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_chunk_management_management.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_chunk_management_management.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_chunk_settings.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_chunk_settings.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_config.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_config.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_memory_info.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_memory_info.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_memory_manager.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_memory_manager.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_mempool.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_mempool.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_segment.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_segment.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_segment_management.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_segment_management.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_shared_chunk.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_shared_chunk.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_shared_pointer.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_shared_pointer.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_shm_safe_unmanaged_chunk.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_shm_safe_unmanaged_chunk.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_typed_mempool.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_mepoo_typed_mempool.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_monitoringmode_logstream.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_monitoringmode_logstream.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_mq_message.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_mq_message.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_arena_block_size_planner.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_arena_block_size_planner.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_arena_loan.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_arena_loan.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_base_client.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_base_client.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_base_publisher.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_base_publisher.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_base_server.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_base_server.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_base_subscriber.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_base_subscriber.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_chunk_distributor.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_chunk_distributor.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_chunk_queue.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_chunk_queue.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_chunk_receiver.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_chunk_receiver.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_chunk_sender.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_chunk_sender.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_chunk_sender_loan_context.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_chunk_sender_loan_context.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_chunk_sender_recycling.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_chunk_sender_recycling.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_client.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_client.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_client_options.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_client_options.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_client_port.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_client_port.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_client_server_arena.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_client_server_arena.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_condition_variable.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_condition_variable.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_interface_port.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_interface_port.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_listener.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_listener.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_listener_waitset_attachments.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_listener_waitset_attachments.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_loan_context_list.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_loan_context_list.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_message_layout.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_message_layout.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_notification_info.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_notification_info.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_protobuf_sample.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_protobuf_sample.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_publisher.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_publisher.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_publisher_options.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_publisher_options.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_publisher_port.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_publisher_port.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_publisher_port_release.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_publisher_port_release.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_request.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_request.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_response.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_response.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_rpc_header.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_rpc_header.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_sample.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_sample.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_server.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_server.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_server_options.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_server_options.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_server_port_roudi.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_server_port_roudi.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_server_port_user.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_server_port_user.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_smart_chunk.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_smart_chunk.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_subscriber.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_subscriber.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_subscriber_options.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_subscriber_options.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_subscriber_port.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_subscriber_port.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_toml_gateway_config_parser.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_toml_gateway_config_parser.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_trigger.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_trigger.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_trigger_handle.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_trigger_handle.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_unique_port_id.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_unique_port_id.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_untyped_client.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_untyped_client.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_untyped_publisher.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_untyped_publisher.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_untyped_server.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_untyped_server.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_untyped_subscriber.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_untyped_subscriber.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_used_chunk_list.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_used_chunk_list.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_user_trigger.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_user_trigger.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_variant_queue.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_variant_queue.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_waitset.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_popo_waitset.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_posh_runtime.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_posh_runtime.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_posh_runtime_heartbeat.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_posh_runtime_heartbeat.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_posh_runtime_single_process.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_posh_runtime_single_process.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_posh_types.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_posh_types.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_cmd_line_parser.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_cmd_line_parser.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_cmd_line_parser_config_file_option.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_cmd_line_parser_config_file_option.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_config_toml_file_provider.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_config_toml_file_provider.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_generic_memory_block.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_generic_memory_block.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_iceoryx_roudi_app.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_iceoryx_roudi_app.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_iceoyx_roudi_memory_manager.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_iceoyx_roudi_memory_manager.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_memory_block.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_memory_block.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_memory_manager.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_memory_manager.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_memory_provider.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_memory_provider.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_mempool_introspection.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_mempool_introspection.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_port_introspection.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_port_introspection.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_portmanager.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_portmanager.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_portmanager_client_server.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_portmanager_client_server.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_portpool.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_portpool.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_posix_shm_memory_provider.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_posix_shm_memory_provider.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_process.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_process.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_process_introspection.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_process_introspection.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_process_manager.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_process_manager.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_service_registry.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_roudi_service_registry.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_runtime_ipc_interface.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_runtime_ipc_interface.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_runtime_ipc_interface_creator.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_runtime_ipc_interface_creator.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_runtime_port_config_info.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_runtime_port_config_info.cpp.o.d"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_version_info.cpp.o"
+  "CMakeFiles/posh_moduletests.dir/moduletests/test_version_info.cpp.o.d"
+  "posh_moduletests"
+  "posh_moduletests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/posh_moduletests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../iox-bm-used-chunk-list"
+  "../../iox-bm-used-chunk-list.pdb"
+  "CMakeFiles/iox-bm-used-chunk-list.dir/benchmark_used_chunk_list.cpp.o"
+  "CMakeFiles/iox-bm-used-chunk-list.dir/benchmark_used_chunk_list.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/iox-bm-used-chunk-list.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
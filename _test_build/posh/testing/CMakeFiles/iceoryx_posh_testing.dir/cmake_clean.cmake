@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/iceoryx_posh_testing.dir/source/roudi_gtest.cpp.o"
+  "CMakeFiles/iceoryx_posh_testing.dir/source/roudi_gtest.cpp.o.d"
+  "libiceoryx_posh_testing.a"
+  "libiceoryx_posh_testing.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/iceoryx_posh_testing.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -21,6 +21,7 @@ load("//bazel/buildifier_prebuilt:repositories.bzl", "load_buildifier_prebuilt_r
 load("//bazel/cpptoml:repositories.bzl", "load_cpptoml_repositories")
 load("//bazel/googletest:repositories.bzl", "load_googletest_repositories")
 load("//bazel/ncurses:repositories.bzl", "load_ncurses_repositories")
+load("//bazel/protobuf:repositories.bzl", "load_protobuf_repositories")
 load("//bazel/skylib:repositories.bzl", "load_bazel_skylib_repositories")
 
 def load_repositories():
@@ -33,3 +34,4 @@ def load_repositories():
     load_googletest_repositories()
     load_cpptoml_repositories()
     load_ncurses_repositories()
+    load_protobuf_repositories()
@@ -0,0 +1,40 @@
+"""
+Copyright (c) 2025 by Latitude AI. All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+SPDX-License-Identifier: Apache-2.0
+
+This module makes the protobuf copy bundled with iceoryx_posh available as @com_google_protobuf.
+Its dependencies are loaded afterwards with 'protobuf_deps' from '@com_google_protobuf//:protobuf_deps.bzl'.
+"""
+
+load("@bazel_tools//tools/build_defs/repo:http.bzl", "http_archive")
+load("@bazel_tools//tools/build_defs/repo:utils.bzl", "maybe")
+load("//bazel/googletest:repositories.bzl", "GOOGLETEST_VERSION")
+
+def load_protobuf_repositories():
+    maybe(
+        name = "com_google_protobuf",
+        repo_rule = native.local_repository,
+        path = "iceoryx_posh/protobuf-3.19.3",
+    )
+
+    # the tests of the bundled protobuf refer to googletest by this name
+    maybe(
+        name = "com_google_googletest",
+        repo_rule = http_archive,
+        urls = ["https://github.com/google/googletest/archive/refs/tags/release-{version}.zip".format(version = GOOGLETEST_VERSION)],
+        sha256 = "353571c2440176ded91c2de6d6cd88ddd41401d14692ec1f99e35d013feda55a",
+        strip_prefix = "googletest-release-{version}".format(version = GOOGLETEST_VERSION),
+    )
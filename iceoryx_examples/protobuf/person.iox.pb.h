@@ -0,0 +1,40 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: person.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_person_2eproto_2eiox_2epb_2eh
+#define GOOGLE_PROTOBUF_INCLUDED_person_2eproto_2eiox_2epb_2eh
+
+#include "iceoryx_posh/popo/protobuf_publisher.hpp"
+#include "iceoryx_posh/popo/protobuf_subscriber.hpp"
+
+#include "person.pb.h"
+
+namespace tutorial {
+
+constexpr uint64_t IceoryxSchemaFingerprint(const Person*) {
+  return 0x0b411c33a8681a4cULL;
+}
+
+class PersonZeroCopyPublisher final
+    : public ::iox::popo::ProtobufPublisher<Person> {
+ public:
+  explicit PersonZeroCopyPublisher(
+      const ::iox::capro::ServiceDescription& service,
+      const ::iox::popo::PublisherOptions& options =
+          ::iox::popo::PublisherOptions())
+      : ::iox::popo::ProtobufPublisher<Person>(service, options) {}
+};
+
+class PersonZeroCopySubscriber final
+    : public ::iox::popo::ProtobufSubscriber<Person> {
+ public:
+  explicit PersonZeroCopySubscriber(
+      const ::iox::capro::ServiceDescription& service,
+      const ::iox::popo::SubscriberOptions& options =
+          ::iox::popo::SubscriberOptions())
+      : ::iox::popo::ProtobufSubscriber<Person>(service, options) {}
+};
+
+}  // namespace tutorial
+
+#endif  // GOOGLE_PROTOBUF_INCLUDED_person_2eproto_2eiox_2epb_2eh
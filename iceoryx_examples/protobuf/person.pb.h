@@ -218,6 +218,7 @@ class Person final :
   const std::string name() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
   void set_name(ArgT0&& arg0, ArgT... args);
+  ::PROTOBUF_NAMESPACE_ID::StringPiece name_view() const;
   std::string* mutable_name();
   PROTOBUF_NODISCARD std::string* release_name();
   void set_allocated_name(std::string* name);
@@ -336,6 +337,9 @@ inline const std::string Person::name() const {
   // @@protoc_insertion_point(field_get:tutorial.Person.name)
   return _internal_name();
 }
+inline ::PROTOBUF_NAMESPACE_ID::StringPiece Person::name_view() const {
+  return name_.GetView();
+}
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void Person::set_name(ArgT0&& arg0, ArgT... args) {
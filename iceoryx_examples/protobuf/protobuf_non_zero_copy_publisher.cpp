@@ -34,16 +34,8 @@
 #include <mutex>
 #include <thread>
 
-#include <google/protobuf/arena.h>
-#include <google/protobuf/message.h>
-
 #include "person.pb.h"
 
-struct WriteBlock {
-    size_t size;
-
-};
-
 constexpr std::chrono::milliseconds CYCLE_TIME{100};
 
 void consoleOutput(const char* source, const char* arrow, const uint64_t counter)
@@ -54,44 +46,14 @@ void consoleOutput(const char* source, const char* arrow, const uint64_t counter
     std::cout << source << arrow << counter << std::endl;
 }
 
-iox::popo::Publisher<tutorial::Person, WriteBlock>* get_publisher_singleton_instance() {
-    static iox::popo::Publisher<tutorial::Person, WriteBlock>* pPub = nullptr;
-    if (pPub == nullptr) {
-        static iox::popo::PublisherOptions publisherOptions;
-        publisherOptions.historyCapacity = 10U;
-        static iox::popo::Publisher<tutorial::Person, WriteBlock> publisher({"NonZeroCopy", "Protobuf", "Demo"}, publisherOptions);
-        pPub = &publisher;
-    }
-    return pPub;
-}
-
-void* block_alloc(size_t size, size_t& actualSize) {
-    auto* pPub = get_publisher_singleton_instance();
-
-    if (pPub != nullptr) {
-        return pPub->loanBlock(size, actualSize);
-    }
-    return nullptr;
-}
-
-void block_dealloc(void* ptr, size_t size) {
-    auto* pPub = get_publisher_singleton_instance();
-
-    if (pPub != nullptr) {
-        return pPub->releaseBlock(ptr);
-    }
-}
-
 void publisher()
 {
-    google::protobuf::ArenaOptions options;
-    options.block_alloc = block_alloc;
-    options.block_dealloc = block_dealloc;
+    iox::popo::PublisherOptions publisherOptions;
+    publisherOptions.historyCapacity = 10U;
+    iox::popo::Publisher<tutorial::Person> publisher({"NonZeroCopy", "Protobuf", "Demo"}, publisherOptions);
 
     int32_t counter = 0;
 
-    iox::popo::Publisher<tutorial::Person, WriteBlock>* pPub = get_publisher_singleton_instance();
-
     //! [send]
     constexpr const char GREEN_RIGHT_ARROW[] = "\033[32m->\033[m ";
     while (!iox::hasTerminationRequested())
@@ -104,22 +66,14 @@ void publisher()
         person.add_value(counter + 2);
         person.set_name("NonZeroCopy" + std::to_string(counter));
 
-        WriteBlock wb;
-        wb.size = person.ByteSizeLong();
-        size_t actualSize;
-        void* buf = block_alloc(wb.size, actualSize);
-        person.SerializeToArray(buf, wb.size);
-        pPub->getSample(buf).and_then([&](auto& sample) {
-            //! [loan was successful]
-            sample.getUserHeader().size = wb.size;
-            consoleOutput("Sending   ", GREEN_RIGHT_ARROW, person.id());
-            sample.publish();
-        })
-        .or_else([&](auto& error) {
-            //! [loan failed]
-            std::cout << " could not loan sample! Error code: " << error << std::endl;
-            //! [loan failed]
-        });
+        // the message is serialized directly into the loaned chunk, its size is recorded in the user-header
+        publisher.publishSerialized(person)
+            .and_then([&] { consoleOutput("Sending   ", GREEN_RIGHT_ARROW, person.id()); })
+            .or_else([&](auto& error) {
+                //! [loan failed]
+                std::cout << " could not loan sample! Error code: " << error << std::endl;
+                //! [loan failed]
+            });
 
         std::this_thread::sleep_for(CYCLE_TIME);
     }
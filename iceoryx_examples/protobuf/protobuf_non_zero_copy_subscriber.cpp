@@ -1,4 +1,5 @@
 
+#include "iceoryx_posh/popo/lazy_message_view.hpp"
 #include "iceoryx_posh/popo/subscriber.hpp"
 #include "iceoryx_posh/popo/user_trigger.hpp"
 #include "iceoryx_posh/popo/wait_set.hpp"
@@ -8,15 +9,12 @@
 
 #include <iostream>
 #include <fstream>
+#include <unistd.h>
 
-#include "person.pb.h"
-
-
-struct WriteBlock {
-    size_t size;
-
-};
+#include <google/protobuf/io/zero_copy_stream_impl.h>
+#include <google/protobuf/util/json_util.h>
 
+#include "person.pb.h"
 
 //! [sig handler]
 volatile bool keepRunning{true};
@@ -51,7 +49,7 @@ int main()
     waitsetSigHandlerAccess = &waitset;
 
     // create subscriber
-    iox::popo::Subscriber<tutorial::Person, WriteBlock> subscriber({"NonZeroCopy", "Protobuf", "Demo"});
+    iox::popo::Subscriber<tutorial::Person> subscriber({"NonZeroCopy", "Protobuf", "Demo"});
 
     // attach subscriber to waitset
     waitset.attachState(subscriber, iox::popo::SubscriberState::HAS_DATA).or_else([](auto) {
@@ -77,19 +75,35 @@ int main()
             if (notification->doesOriginateFrom(&subscriber))
             {
                 // Consume a sample
-                subscriber.takeMultiChunk()
+                subscriber.take()
                     .and_then([](auto& sample) {
-                        auto size = sample.getUserHeader().size;
-                        tutorial::Person person;
-                        person.ParseFromArray(sample.get(), size);
-
-                        std::cout << " got value: " << person.id() << std::endl; 
-                        std::cout << " got repeated: ";
-                        for (int i = 0; i < person.value_size(); ++i) {
-                            std::cout << person.value(i) << " ";
-                        }
-                        std::cout << std::endl;
-                        std::cout << " got name: " << person.name() << std::endl;
+                        auto size = iox::mepoo::protobufSerializedSize<iox::mepoo::NoUserHeader>(
+                                        sample.getChunkHeader())
+                                        .value_or(0U);
+                        // only the fields which are accessed are parsed
+                        iox::popo::LazyMessageView<tutorial::Person> person(sample.get(), size);
+
+                        person.get(tutorial::Person::kIdFieldNumber).and_then([](auto& message) {
+                            std::cout << " got value: " << message->id() << std::endl;
+                        });
+                        person.getAll()
+                            .and_then([](auto& message) {
+                                std::cout << " got repeated: ";
+                                for (int i = 0; i < message->value_size(); ++i)
+                                {
+                                    std::cout << message->value(i) << " ";
+                                }
+                                std::cout << std::endl;
+                                std::cout << " got name: " << message->name() << std::endl;
+
+                                // the message was parsed by this process, so its reflection can be used
+                                std::cout << " as json: " << std::flush;
+                                google::protobuf::io::FileOutputStream out(STDOUT_FILENO);
+                                google::protobuf::util::MessageToJsonStream(*message, &out);
+                                out.Flush();
+                                std::cout << std::endl;
+                            })
+                            .or_else([](auto& error) { std::cout << " malformed message: " << error << std::endl; });
                     })
                     .or_else([](auto& reason) {
                         std::cout << "got no data, return code: " << static_cast<uint64_t>(reason) << std::endl;
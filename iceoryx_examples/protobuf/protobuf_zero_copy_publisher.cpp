@@ -18,9 +18,6 @@
 #include "iceoryx_posh/iceoryx_posh_config.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/roudi/roudi.hpp"
-#include "iceoryx_posh/popo/publisher.hpp"
-#include "iceoryx_posh/popo/subscriber.hpp"
-#include "iceoryx_posh/popo/sample.hpp"
 #include "iceoryx_posh/roudi/iceoryx_roudi_components.hpp"
 #include "iceoryx_posh/runtime/posh_runtime_single_process.hpp"
 #include "iox/detail/convert.hpp"
@@ -33,9 +30,7 @@
 #include <mutex>
 #include <thread>
 
-#include <google/protobuf/arena.h>
-
-#include "person.pb.h"
+#include "person.iox.pb.h"
 
 constexpr std::chrono::milliseconds CYCLE_TIME{100};
 
@@ -47,60 +42,29 @@ void consoleOutput(const char* source, const char* arrow, const uint64_t counter
     std::cout << source << arrow << counter << std::endl;
 }
 
-iox::popo::Publisher<tutorial::Person>* get_publisher_singleton_instance() {
-    static iox::popo::Publisher<tutorial::Person>* pPub = nullptr;
-    if (pPub == nullptr) {
-        static iox::popo::PublisherOptions publisherOptions;
-        publisherOptions.historyCapacity = 10U;
-        static iox::popo::Publisher<tutorial::Person> publisher({"ZeroCopy", "Protobuf", "Demo"}, publisherOptions);
-        pPub = &publisher;
-    }
-    return pPub;
-}
-
-void* block_alloc(size_t size, size_t& actualSize) {
-    auto* pPub = get_publisher_singleton_instance();
-
-    if (pPub != nullptr) {
-        return pPub->loanBlock(size, actualSize);
-    }
-    return nullptr;
-}
-
-void block_dealloc(void* ptr, size_t size) {
-    /*auto* pPub = get_publisher_singleton_instance();
-
-    if (pPub != nullptr) {
-        return pPub->releaseBlock(ptr);
-    }*/
-}
-
 void publisher()
 {
-    google::protobuf::ArenaOptions options;
-    options.block_alloc = block_alloc;
-    options.block_dealloc = block_dealloc;
+    iox::popo::PublisherOptions publisherOptions;
+    publisherOptions.historyCapacity = 10U;
+    // the generated publisher builds every message on an arena whose blocks are chunks of the publisher
+    tutorial::PersonZeroCopyPublisher publisher({"ZeroCopy", "Protobuf", "Demo"}, publisherOptions);
 
     int32_t counter = 0;
 
-    iox::popo::Publisher<tutorial::Person>* pPub = get_publisher_singleton_instance();
-
     //! [send]
     constexpr const char GREEN_RIGHT_ARROW[] = "\033[32m->\033[m ";
     while (!iox::hasTerminationRequested())
     {
-        google::protobuf::Arena arena(options);
-        tutorial::Person *person = google::protobuf::Arena::CreateMessage<tutorial::Person>(&arena);
-
-        pPub->getSample(person).and_then([&](auto& sample) {
-            sample->set_id(counter++);
-            sample->add_value(counter);
-            sample->add_value(counter + 1);
-            sample->add_value(counter + 2);
-            sample->set_name("zerocopy" + std::to_string(counter));
-            consoleOutput("Sending   ", GREEN_RIGHT_ARROW, sample->id());
-            std::cout << "Sending name   " << sample->name() << std::endl;;
-            sample.publish();
+        publisher.loan().and_then([&](auto& person) {
+            person->set_id(counter++);
+            person->mutable_value()->ReserveExact(3);
+            person->add_value(counter);
+            person->add_value(counter + 1);
+            person->add_value(counter + 2);
+            person->set_name("zerocopy" + std::to_string(counter));
+            consoleOutput("Sending   ", GREEN_RIGHT_ARROW, person->id());
+            std::cout << "Sending name   " << person->name() << std::endl;
+            person.publish();
         });
 
         std::this_thread::sleep_for(CYCLE_TIME);
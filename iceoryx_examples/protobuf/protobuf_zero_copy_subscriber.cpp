@@ -1,4 +1,3 @@
-#include "iceoryx_posh/popo/subscriber.hpp"
 #include "iceoryx_posh/popo/user_trigger.hpp"
 #include "iceoryx_posh/popo/wait_set.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
@@ -7,7 +6,7 @@
 
 #include <iostream>
 
-#include "person.pb.h"
+#include "person.iox.pb.h"
 
 //! [sig handler]
 volatile bool keepRunning{true};
@@ -42,7 +41,7 @@ int main()
     waitsetSigHandlerAccess = &waitset;
 
     // create subscriber
-    iox::popo::Subscriber<tutorial::Person> subscriber({"ZeroCopy", "Protobuf", "Demo"});
+    tutorial::PersonZeroCopySubscriber subscriber({"ZeroCopy", "Protobuf", "Demo"});
 
     // attach subscriber to waitset
     waitset.attachState(subscriber, iox::popo::SubscriberState::HAS_DATA).or_else([](auto) {
@@ -68,7 +67,7 @@ int main()
             if (notification->doesOriginateFrom(&subscriber))
             {
                 // Consume a sample
-                subscriber.takeMultiChunk()
+                subscriber.take()
                     .and_then([](auto& sample) { 
                         std::cout << " got value: " << sample->id() << std::endl; 
                         std::cout << " got repeated: ";
@@ -76,7 +75,7 @@ int main()
                             std::cout << sample->value(i) << " ";
                         }
                         std::cout << std::endl;
-                        std::cout << " got name: " << sample->name() << std::endl;
+                        std::cout << " got name: " << sample->name_view() << std::endl;
                     })
                     .or_else([](auto& reason) {
                         std::cout << "got no data, return code: " << static_cast<uint64_t>(reason) << std::endl;
@@ -31,6 +31,23 @@ if (BUILD_TEST)
     ### Only hoofs has mock tests
     list(APPEND MOCKTEST_CMD COMMAND ./hoofs/test/hoofs_mocktests --gtest_filter=-*.TimingTest_* --gtest_output=xml:${CMAKE_BINARY_DIR}/testresults/hoofs_MockTestResults.xml)
 
+    ### Only posh has allocation tests, they replace the global operator new and delete
+    list(APPEND ALLOCATIONTEST_CMD COMMAND ./posh/test/posh_allocationtests --gtest_output=xml:${CMAKE_BINARY_DIR}/testresults/posh_AllocationTestResults.xml)
+
+    ### posh has protobuf tests if it is built with protobuf support; the option is defined by posh, which is added
+    ### after this file, and is ON by default
+    if (NOT DEFINED PROTOBUF_CONFIG OR PROTOBUF_CONFIG)
+        list(APPEND PROTOBUFTEST_CMD COMMAND ./posh/test/posh_protobuftests --gtest_output=xml:${CMAKE_BINARY_DIR}/testresults/posh_ProtobufTestResults.xml)
+        ### the unit tests of the bundled protobuf are built with it and need its source directory as working directory;
+        ### the checked-in descriptor.pb.h keeps the string getters returning a reference, which the protobuf library
+        ### relies on, so it is not compared with the output of the bundled protoc
+        if (NOT DEFINED DOWNLOAD_PROTOBUF_LIB OR DOWNLOAD_PROTOBUF_LIB)
+            list(APPEND PROTOBUFTEST_CMD COMMAND ${CMAKE_COMMAND} -E chdir ${CMAKE_CURRENT_SOURCE_DIR}/../iceoryx_posh/protobuf-3.19.3
+                ${CMAKE_BINARY_DIR}/dependencies/protobuf/build/tests --gtest_filter=-BootstrapTest.GeneratedFilesMatch
+                --gtest_output=xml:${CMAKE_BINARY_DIR}/testresults/protobuf_UnitTestResults.xml)
+        endif()
+    endif()
+
     foreach(cmp IN ITEMS ${COMPONENTS})
         list(APPEND MODULETEST_CMD COMMAND ./${cmp}/test/${cmp}_moduletests --gtest_filter=-*.TimingTest_* --gtest_output=xml:${CMAKE_BINARY_DIR}/testresults/${cmp}_ModuleTestResults.xml)
     endforeach()
@@ -42,6 +59,8 @@ if (BUILD_TEST)
     add_custom_target( all_tests
         ${MODULETEST_CMD}
         ${MOCKTEST_CMD}
+        ${ALLOCATIONTEST_CMD}
+        ${PROTOBUFTEST_CMD}
         ${INTEGRATIONTEST_CMD}
         WORKING_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR}
         VERBATIM
@@ -56,6 +75,8 @@ if (BUILD_TEST)
     ### we need to create separate test targets for coverage scan
     add_custom_target( module_tests
         ${MODULETEST_CMD}
+        ${ALLOCATIONTEST_CMD}
+        ${PROTOBUFTEST_CMD}
         WORKING_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR}
         VERBATIM
     )
@@ -162,7 +162,8 @@ class ServiceDescription
     /// @brief string representation of the event
     IdString_t m_eventString;
 
-    /// @brief 128-Bit class hash (32-Bit * 4)
+    /// @brief 128-Bit class hash (32-Bit * 4); it carries the ABI hash of messages which can only be read in place
+    /// with the same layout, see 'popo::MessageLayout::withAbiHash'
     ClassHash m_classHash{0, 0, 0, 0};
 
     /// @brief How far this service should be propagated
@@ -45,6 +45,9 @@ struct ChunkManagement
 
     iox::RelativePointer<MemPool> m_mempool;
     iox::RelativePointer<MemPool> m_chunkManagementPool;
+
+    /// @brief link to the next chunk when this chunk is part of a ChunkManagementManagement chain
+    iox::RelativePointer<ChunkManagement> m_nextChunkManagement;
 };
 } // namespace mepoo
 } // namespace iox
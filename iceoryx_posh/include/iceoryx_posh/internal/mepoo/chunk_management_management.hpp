@@ -18,12 +18,13 @@
 #define IOX_POSH_MEPOO_CHUNK_MANAGEMENT_MANAGEMENT_HPP
 
 #include "iox/atomic.hpp"
-#include "iox/fixed_position_container.hpp"
 #include "iox/not_null.hpp"
 #include "iox/relative_pointer.hpp"
 #include "iceoryx_posh/internal/mepoo/chunk_management.hpp"
 
+#include <cstddef>
 #include <cstdint>
+#include <iterator>
 
 namespace iox
 {
@@ -32,24 +33,157 @@ namespace mepoo
 class MemPool;
 struct ChunkHeader;
 
-constexpr uint32_t MAX_CHUNK_NUMBER_IN_ONE_REQ = 3;
-
+/// @brief Owns all chunks of one multi-chunk sample. The chunks are kept as a singly linked chain of their
+/// ChunkManagement objects, which live in the chunk management pool of the MemoryManager. The chain is therefore
+/// unbounded and, like the rest of the struct, resides in shared memory so that RouDi can free it after an
+/// application crash.
 struct ChunkManagementManagement
 {
     using base_t = ChunkManagement;
     using referenceCounterBase_t = uint64_t;
-    using element_t = iox::RelativePointer<base_t>;
     using referenceCounter_t = concurrent::Atomic<referenceCounterBase_t>;
-    using chunkManagementContainer_t = FixedPositionContainer<element_t, MAX_CHUNK_NUMBER_IN_ONE_REQ>;
 
     ChunkManagementManagement(const not_null<MemPool*> chunkManagementPool) noexcept;
 
     referenceCounter_t m_referenceCounter{1U};
-    chunkManagementContainer_t m_chunkManagements;
+    iox::RelativePointer<ChunkManagement> m_firstChunkManagement;
+    iox::RelativePointer<ChunkManagement> m_lastChunkManagement;
+    uint64_t m_numberOfChunks{0U};
     iox::RelativePointer<MemPool> m_chunkManagementPool;
 
-    bool addChunkManagement(const not_null<ChunkManagement*> chunkManagement) noexcept;
+    /// @brief appends a chunk to the end of the chain and takes over its ownership
+    /// @param[in] chunkManagement of the chunk to append; it must not be part of another chain
+    void addChunkManagement(const not_null<ChunkManagement*> chunkManagement) noexcept;
+
+    /// @brief the first chunk of the chain, i.e. the one carrying the root message, or nullptr if the chain is empty
+    ChunkManagement* front() const noexcept;
+
+    uint64_t size() const noexcept;
+
+    bool empty() const noexcept;
+
+    /// @brief calls the provided callable with each ChunkManagement of the chain in insertion order
+    /// @note the callable must not modify the chain
+    template <typename Callable>
+    void forEach(const Callable& callable) const noexcept;
+
+    /// @brief frees every chunk of the chain in a single pass and leaves an empty chain behind
+    void releaseChunks() noexcept;
+
+    /// @brief frees every chunk behind the provided one, which becomes the last chunk of the chain
+    /// @param[in] lastKeptChunkManagement must be part of the chain
+    void releaseChunksAfter(ChunkManagement& lastKeptChunkManagement) noexcept;
+
+    /// @brief frees every chunk except the first one and detaches the first one from the chain
+    /// @return the detached first chunk with its reference count untouched or nullptr if the chain was empty
+    ChunkManagement* releaseAllButFirstChunk() noexcept;
 };
+
+/// @brief Non-owning view over the chunk headers of a ChunkManagementManagement chain in insertion order. It neither
+/// allocates nor copies, hence the chunks of a sample can be inspected on the hot path without heap allocations.
+/// @note the view must not outlive the chain and the chain must not be modified while the view is used
+class ChunkHeaderView
+{
+  public:
+    class Iterator
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = ChunkHeader*;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ChunkHeader* const*;
+        using reference = ChunkHeader*;
+
+        explicit Iterator(const ChunkManagement* const chunkManagement) noexcept
+            : m_chunkManagement(chunkManagement)
+        {
+        }
+
+        ChunkHeader* operator*() const noexcept
+        {
+            return m_chunkManagement->m_chunkHeader.get();
+        }
+
+        Iterator& operator++() noexcept
+        {
+            m_chunkManagement = m_chunkManagement->m_nextChunkManagement.get();
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept
+        {
+            Iterator previous{*this};
+            ++(*this);
+            return previous;
+        }
+
+        bool operator==(const Iterator& rhs) const noexcept
+        {
+            return m_chunkManagement == rhs.m_chunkManagement;
+        }
+
+        bool operator!=(const Iterator& rhs) const noexcept
+        {
+            return !(*this == rhs);
+        }
+
+      private:
+        const ChunkManagement* m_chunkManagement{nullptr};
+    };
+
+    using value_type = ChunkHeader*;
+    using iterator = Iterator;
+    using const_iterator = Iterator;
+
+    /// @brief creates an empty view
+    ChunkHeaderView() noexcept = default;
+
+    /// @brief creates a view over the chain of the provided ChunkManagementManagement
+    /// @param[in] chunkManagementManagement owning the chain; nullptr results in an empty view
+    explicit ChunkHeaderView(const ChunkManagementManagement* const chunkManagementManagement) noexcept
+        : m_chunkManagementManagement(chunkManagementManagement)
+    {
+    }
+
+    Iterator begin() const noexcept
+    {
+        return Iterator(m_chunkManagementManagement ? m_chunkManagementManagement->front() : nullptr);
+    }
+
+    Iterator end() const noexcept
+    {
+        return Iterator(nullptr);
+    }
+
+    uint64_t size() const noexcept
+    {
+        return m_chunkManagementManagement ? m_chunkManagementManagement->size() : 0U;
+    }
+
+    bool empty() const noexcept
+    {
+        return size() == 0U;
+    }
+
+    /// @brief the first chunk header, i.e. the one carrying the root message, or nullptr if the view is empty
+    ChunkHeader* front() const noexcept
+    {
+        return empty() ? nullptr : *begin();
+    }
+
+  private:
+    const ChunkManagementManagement* m_chunkManagementManagement{nullptr};
+};
+
+template <typename Callable>
+inline void ChunkManagementManagement::forEach(const Callable& callable) const noexcept
+{
+    for (ChunkManagement* current = m_firstChunkManagement.get(); current != nullptr;
+         current = current->m_nextChunkManagement.get())
+    {
+        callable(*current);
+    }
+}
 } // namespace mepoo
 } // namespace iox
 
@@ -74,6 +74,8 @@ class MemoryManager
     /// @return a SharedChunk if successful, otherwise a MemoryManager::Error
     expected<SharedChunk, Error> getChunk(const ChunkSettings& chunkSettings) noexcept;
 
+    /// @brief Obtains an empty ChunkManagementManagement to which the chunks of a multi-chunk sample can be appended
+    /// @return a pointer to the ChunkManagementManagement or nullptr if the pool is exhausted
     ChunkManagementManagement* getMultiChunk() noexcept;
 
     /// @brief Release a chunk back to the mempools
@@ -22,6 +22,7 @@
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_posh/mepoo/segment_config.hpp"
 #include "iox/bump_allocator.hpp"
 #include "iox/detail/posix_acl.hpp"
 #include "iox/filesystem.hpp"
@@ -41,7 +42,8 @@ class MePooSegment
                  BumpAllocator& managementAllocator,
                  const PosixGroup& readerGroup,
                  const PosixGroup& writerGroup,
-                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo()) noexcept;
+                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo(),
+                 const uint64_t fixedBaseAddress = SegmentConfig::NO_FIXED_BASE_ADDRESS) noexcept;
 
     PosixGroup getWriterGroup() const noexcept;
     PosixGroup getReaderGroup() const noexcept;
@@ -52,16 +54,22 @@ class MePooSegment
 
     uint64_t getSegmentSize() const noexcept;
 
+    /// @brief the address the segment is mapped at in all processes or SegmentConfig::NO_FIXED_BASE_ADDRESS if the
+    /// operating system chooses the address
+    uint64_t getFixedBaseAddress() const noexcept;
+
   protected:
     SharedMemoryObjectType createSharedMemoryObject(const MePooConfig& mempoolConfig,
                                                     const DomainId domainId,
-                                                    const PosixGroup& writerGroup) noexcept;
+                                                    const PosixGroup& writerGroup,
+                                                    const uint64_t fixedBaseAddress) noexcept;
 
   protected:
     PosixGroup m_readerGroup;
     PosixGroup m_writerGroup;
     uint64_t m_segmentId{0};
     uint64_t m_segmentSize{0};
+    uint64_t m_fixedBaseAddress{SegmentConfig::NO_FIXED_BASE_ADDRESS};
     iox::mepoo::MemoryInfo m_memoryInfo;
     SharedMemoryObjectType m_sharedMemoryObject;
     MemoryManagerType m_memoryManager;
@@ -42,11 +42,13 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
     BumpAllocator& managementAllocator,
     const PosixGroup& readerGroup,
     const PosixGroup& writerGroup,
-    const iox::mepoo::MemoryInfo& memoryInfo) noexcept
+    const iox::mepoo::MemoryInfo& memoryInfo,
+    const uint64_t fixedBaseAddress) noexcept
     : m_readerGroup(readerGroup)
     , m_writerGroup(writerGroup)
+    , m_fixedBaseAddress(fixedBaseAddress)
     , m_memoryInfo(memoryInfo)
-    , m_sharedMemoryObject(createSharedMemoryObject(mempoolConfig, domainId, writerGroup))
+    , m_sharedMemoryObject(createSharedMemoryObject(mempoolConfig, domainId, writerGroup, fixedBaseAddress))
 {
     using namespace detail;
     PosixAcl acl;
@@ -71,8 +73,17 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
 
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
 inline SharedMemoryObjectType MePooSegment<SharedMemoryObjectType, MemoryManagerType>::createSharedMemoryObject(
-    const MePooConfig& mempoolConfig, const DomainId domainId, const PosixGroup& writerGroup) noexcept
+    const MePooConfig& mempoolConfig,
+    const DomainId domainId,
+    const PosixGroup& writerGroup,
+    const uint64_t fixedBaseAddress) noexcept
 {
+    optional<const void*> baseAddressHint;
+    if (fixedBaseAddress != SegmentConfig::NO_FIXED_BASE_ADDRESS)
+    {
+        baseAddressHint = reinterpret_cast<const void*>(fixedBaseAddress);
+    }
+
     return std::move(
         typename SharedMemoryObjectType::Builder()
             .name([&domainId, &writerGroup] {
@@ -94,8 +105,24 @@ inline SharedMemoryObjectType MePooSegment<SharedMemoryObjectType, MemoryManager
             .accessMode(AccessMode::ReadWrite)
             .openMode(OpenMode::PurgeAndCreate)
             .permissions(SEGMENT_PERMISSIONS)
+            .baseAddressHint(baseAddressHint)
             .create()
-            .and_then([this](auto& sharedMemoryObject) {
+            .and_then([this, fixedBaseAddress](auto& sharedMemoryObject) {
+                // the address is only a hint for mmap; if the range is already occupied the kernel picks another one
+                // and the applications could not rely on the payload being at the same address in every process
+                if (fixedBaseAddress != SegmentConfig::NO_FIXED_BASE_ADDRESS
+                    && reinterpret_cast<uint64_t>(sharedMemoryObject.getBaseAddress()) != fixedBaseAddress)
+                {
+                    IOX_LOG(Fatal,
+                            "The payload segment could not be mapped at the configured fixed base address "
+                                << iox::log::hex(fixedBaseAddress) << " with size "
+                                << sharedMemoryObject.get_size().expect("Failed to get SHM size")
+                                << " since the address range is not available; it was mapped at "
+                                << iox::log::hex(sharedMemoryObject.getBaseAddress())
+                                << " instead. Please choose a different 'base-address' for the segment!");
+                    IOX_REPORT_FATAL(PoshError::MEPOO__SEGMENT_FIXED_BASE_ADDRESS_UNAVAILABLE);
+                }
+
                 auto maybeSegmentId = iox::UntypedRelativePointer::registerPtr(
                     sharedMemoryObject.getBaseAddress(),
                     sharedMemoryObject.get_size().expect("Failed to get SHM size"));
@@ -145,6 +172,12 @@ inline uint64_t MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getSegm
     return m_segmentSize;
 }
 
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline uint64_t MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getFixedBaseAddress() const noexcept
+{
+    return m_fixedBaseAddress;
+}
+
 } // namespace mepoo
 } // namespace iox
 
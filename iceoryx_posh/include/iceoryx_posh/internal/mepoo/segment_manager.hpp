@@ -60,12 +60,14 @@ class SegmentManager
                        uint64_t size,
                        bool isWritable,
                        uint64_t segmentId,
-                       const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo()) noexcept
+                       const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo(),
+                       uint64_t fixedBaseAddress = SegmentConfig::NO_FIXED_BASE_ADDRESS) noexcept
             : m_sharedMemoryName(sharedMemoryName)
             , m_size(size)
             , m_isWritable(isWritable)
             , m_segmentId(segmentId)
             , m_memoryInfo(memoryInfo)
+            , m_fixedBaseAddress(fixedBaseAddress)
 
         {
         }
@@ -75,6 +77,7 @@ class SegmentManager
         bool m_isWritable{false};
         uint64_t m_segmentId{0};
         iox::mepoo::MemoryInfo m_memoryInfo; // we can specify additional info about a segments memory here
+        uint64_t m_fixedBaseAddress{SegmentConfig::NO_FIXED_BASE_ADDRESS}; // address RouDi mapped the segment at
     };
 
     struct SegmentUserInformation
@@ -58,7 +58,8 @@ inline void SegmentManager<SegmentType>::createSegment(const SegmentConfig::Segm
                                     *m_managementAllocator,
                                     readerGroup,
                                     writerGroup,
-                                    segmentEntry.m_memoryInfo);
+                                    segmentEntry.m_memoryInfo,
+                                    segmentEntry.m_fixedBaseAddress);
 }
 
 template <typename SegmentType>
@@ -82,8 +83,12 @@ SegmentManager<SegmentType>::getSegmentMappings(const PosixUser& user) noexcept
                 // process
                 if (!foundInWriterGroup)
                 {
-                    mappingContainer.emplace_back(
-                        segment.getWriterGroup().getName(), segment.getSegmentSize(), true, segment.getSegmentId());
+                    mappingContainer.emplace_back(segment.getWriterGroup().getName(),
+                                                  segment.getSegmentSize(),
+                                                  true,
+                                                  segment.getSegmentId(),
+                                                  iox::mepoo::MemoryInfo(),
+                                                  segment.getFixedBaseAddress());
                     foundInWriterGroup = true;
                 }
                 else
@@ -105,8 +110,12 @@ SegmentManager<SegmentType>::getSegmentMappings(const PosixUser& user) noexcept
                        return mapping.m_segmentId == segment.getSegmentId();
                    }) == mappingContainer.end())
             {
-                mappingContainer.emplace_back(
-                    segment.getWriterGroup().getName(), segment.getSegmentSize(), false, segment.getSegmentId());
+                mappingContainer.emplace_back(segment.getWriterGroup().getName(),
+                                              segment.getSegmentSize(),
+                                              false,
+                                              segment.getSegmentId(),
+                                              iox::mepoo::MemoryInfo(),
+                                              segment.getFixedBaseAddress());
             }
         }
     }
@@ -24,6 +24,8 @@
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iox/relative_pointer.hpp"
 
+#include <vector>
+
 namespace iox
 {
 namespace mepoo
@@ -47,7 +49,8 @@ class SharedMultiChunk
     SharedMultiChunk& operator=(SharedMultiChunk&& rhs) noexcept;
 
     ChunkHeader* getChunkHeader() const noexcept;
-    std::vector<ChunkHeader*> getChunkHeaders() const noexcept;
+    /// @brief the chunk headers of all chunks of the sample; the view is empty if there is no sample
+    ChunkHeaderView getChunkHeaders() const noexcept;
     void* getUserPayload() const noexcept;
 
     ChunkManagementManagement* release() noexcept;
@@ -57,7 +60,8 @@ class SharedMultiChunk
       return m_chunkManagementManagement;
     }
 
-    bool addChunkManagement(const not_null<ChunkManagement*> chunkManagement) noexcept;
+    /// @brief appends a chunk to the chain of the underlying ChunkManagementManagement
+    void addChunkManagement(const not_null<ChunkManagement*> chunkManagement) noexcept;
 
     bool operator==(const SharedMultiChunk& rhs) const noexcept;
     /// @todo iox-#1617 use the newtype pattern to avoid the void pointer
@@ -46,8 +46,9 @@ class ShmSafeUnmanagedMultiChunk
     /// @brief Creates a SharedMultiChunk with incrementing the chunk reference counter and does not invalidate itself
     SharedMultiChunk cloneToSharedChunk() noexcept;
 
-    SharedChunk cloneFirstToSharedChunk() noexcept;
-
+    /// @brief Frees all but the first chunk of the underlying chain and hands the first chunk out as SharedChunk
+    /// without incrementing its reference counter. The now empty ChunkManagementManagement stays referenced by this
+    /// object.
     SharedChunk releaseFirstToSharedChunk() noexcept;
 
     /// @brief Checks if the underlying RelativePointerData to the chunk is logically a nullptr
@@ -58,7 +59,9 @@ class ShmSafeUnmanagedMultiChunk
     /// @return the pointer to the ChunkHeader of the underlying chunk or nullptr if isLogicalNullptr would return true
     ChunkHeader* getChunkHeader() noexcept;
 
-    std::vector<ChunkHeader*> getChunkHeaders() noexcept;
+    /// @brief Access to the ChunkHeaders of all chunks of the underlying sample
+    /// @return a view over the ChunkHeaders, which is empty if isLogicalNullptr would return true
+    ChunkHeaderView getChunkHeaders() const noexcept;
 
     /// @brief const access to the ChunkHeader of the underlying chunk
     /// @return the const pointer to the ChunkHeader of the underlying chunk or nullptr if isLogicalNullptr would return
@@ -72,6 +75,8 @@ class ShmSafeUnmanagedMultiChunk
     /// @return true if neither logically a nullptr nor other owner chunk owners present, otherwise false
     bool isNotLogicalNullptrAndHasNoOtherOwners() const noexcept;
 
+    /// @brief Appends a chunk to the chain of the underlying ChunkManagementManagement
+    /// @return false if isLogicalNullptr would return true, otherwise true
     bool addChunkManagement(const not_null<ChunkManagement*> chunkManagement) noexcept;
 
   private:
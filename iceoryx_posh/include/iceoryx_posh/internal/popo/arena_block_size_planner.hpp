@@ -0,0 +1,97 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_ARENA_BLOCK_SIZE_PLANNER_HPP
+#define IOX_POSH_POPO_ARENA_BLOCK_SIZE_PLANNER_HPP
+
+#include "iox/optional.hpp"
+#include "iox/type_traits.hpp"
+
+#include <cstdint>
+#include <utility>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Learns the arena footprint of the samples of a publisher and plans the size of the first block an arena
+/// loans for a new sample. With the doubling growth policy of the arena a sample would otherwise spread over
+/// several chunks; with the planned size a typical sample fits into a single chunk.
+/// The plan follows a high quantile of the recent footprints instead of their maximum. Occasional outliers therefore
+/// do not inflate every following loan but fall back to chaining additional blocks.
+/// @note not thread-safe, the planner is owned by a single publisher
+class ArenaBlockSizePlanner
+{
+  public:
+    /// @brief number of recent footprints the plan is based on
+    static constexpr uint32_t HISTORY_CAPACITY{16U};
+    /// @brief number of the largest footprints of a full history which are treated as outliers
+    static constexpr uint32_t NUMBER_OF_IGNORED_OUTLIERS{1U};
+    /// @brief reserve for the bookkeeping the arena places in its first block, like the block header, the serial
+    /// arena and the cleanup list, which is not part of the footprint
+    static constexpr uint64_t ARENA_BOOKKEEPING_RESERVE{256U};
+
+    /// @brief Returns the size to loan for the first block of a new sample
+    /// @param[in] requestedSize is the block size requested by the arena
+    /// @return the planned block size or the requested size if it is larger or nothing was learned yet
+    uint64_t firstBlockSize(const uint64_t requestedSize) const noexcept;
+
+    /// @brief Adds the footprint of a published sample to the history and updates the plan
+    /// @param[in] footprint is the number of bytes the sample occupied in its arena
+    void recordFootprint(const uint64_t footprint) noexcept;
+
+    /// @brief Returns the currently planned size for the first block, 0 if nothing was learned yet
+    uint64_t plannedBlockSize() const noexcept;
+
+  private:
+    void updatePlan() noexcept;
+
+  private:
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    uint64_t m_history[HISTORY_CAPACITY]{};
+    uint32_t m_historySize{0U};
+    uint32_t m_nextHistoryIndex{0U};
+    uint64_t m_plannedBlockSize{0U};
+};
+
+/// @brief Determines the arena footprint of a sample, which is only possible for types that are aware of the arena
+/// they were created on, like protobuf messages
+template <typename T, typename = void>
+struct ArenaFootprint
+{
+    static optional<uint64_t> of(const T&) noexcept
+    {
+        return nullopt;
+    }
+};
+
+template <typename T>
+struct ArenaFootprint<T, void_t<decltype(std::declval<const T&>().GetArena()->SpaceUsed())>>
+{
+    static optional<uint64_t> of(const T& message) noexcept
+    {
+        const auto* arena = message.GetArena();
+        if (arena == nullptr)
+        {
+            return nullopt;
+        }
+        return static_cast<uint64_t>(arena->SpaceUsed());
+    }
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_ARENA_BLOCK_SIZE_PLANNER_HPP
@@ -0,0 +1,117 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_ARENA_LOAN_HPP
+#define IOX_POSH_POPO_ARENA_LOAN_HPP
+
+#include "iceoryx_posh/internal/popo/arena_block_size_planner.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iox/memory.hpp"
+#include "iox/optional.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Keeps track of the chunks which a publisher, a loan context, a client or a server loaned as blocks for the
+/// arena a message is built on. The first block is the first chunk of a new sample, request or response and carries a
+/// 'ProtobufUserHeader'; every further block is added to the same sample, request or response. The position of the
+/// root message is recorded relative to the first block and the size of the first block is planned with the
+/// footprints of the previously sent messages.
+/// The loan does not need a container for its blocks: the last bytes of every block link it to the next block of the
+/// loan. The arena never sees these bytes, since they are not part of the usable size of the block.
+/// @tparam UserHeaderT is the header wrapped by the 'ProtobufUserHeader' of the first block
+/// @note not thread-safe, the loan is owned by a single publisher, loan context, client or server
+template <typename UserHeaderT>
+class ArenaLoan
+{
+  public:
+    /// @brief alignment of the blocks handed to the arena
+    static constexpr uint32_t BLOCK_ALIGNMENT{8U};
+
+    /// @brief Loans a chunk as block for the arena
+    /// @param[in] size is the block size requested by the arena
+    /// @param[out] actualSize is the usable size of the loaned block
+    /// @param[in] allocateFirst is called with the block size and BLOCK_ALIGNMENT to allocate the first chunk of a new
+    /// message and returns an 'expected<mepoo::ChunkHeader*, AllocationError>'
+    /// @param[in] allocateNext is called like 'allocateFirst' to add a chunk to the message
+    /// @return the block or nullptr if no chunk could be loaned
+    template <typename AllocateFirst, typename AllocateNext>
+    void* loanBlock(const size_t size,
+                    size_t& actualSize,
+                    const AllocateFirst& allocateFirst,
+                    const AllocateNext& allocateNext) noexcept;
+
+    /// @brief Takes back a block of the arena
+    /// @param[in] block as returned by 'loanBlock'; blocks of already sent messages are ignored
+    /// @return the first chunk of the loan once the arena handed back its last block, nullptr otherwise; the caller
+    /// releases the message with it
+    mepoo::ChunkHeader* releaseBlock(void* const block) noexcept;
+
+    /// @brief Checks whether a message was created in one of the blocks of the loan
+    /// @param[in] message is the address of the message
+    /// @return true if the message is located in one of the blocks, false otherwise
+    bool contains(const void* const message) const noexcept;
+
+    /// @brief Records the position of the root message in the 'ProtobufUserHeader' of the first block
+    /// @param[in] rootMessage is the address of the root message
+    /// @return the first chunk of the loan or nullptr if no block was loaned
+    mepoo::ChunkHeader* setRootMessage(const void* const rootMessage) noexcept;
+
+    /// @brief Returns the first chunk of the loan or nullptr if no block was loaned
+    mepoo::ChunkHeader* firstChunkHeader() const noexcept;
+
+    /// @brief Ends the loan when the message which is about to be sent belongs to it
+    /// @param[in] chunkHeader of the first chunk of the message which is sent
+    /// @param[in] footprint is the number of bytes the message occupied in its arena; if unknown, the sum of the block
+    /// sizes requested by the arena is used
+    void finish(const mepoo::ChunkHeader* const chunkHeader, const optional<uint64_t> footprint) noexcept;
+
+    /// @brief Forgets the blocks of the loan without learning from it, e.g. after they were released at once
+    void reset() noexcept;
+
+  private:
+    using ProtobufUserHeader_t = mepoo::ProtobufUserHeader<UserHeaderT>;
+
+    /// @brief placed behind the usable bytes of every block
+    struct BlockLink
+    {
+        mepoo::ChunkHeader* m_nextChunkHeader{nullptr};
+    };
+
+    /// @brief the number of bytes of a block which are handed to the arena
+    static uint64_t usableSize(const mepoo::ChunkHeader* const chunkHeader) noexcept;
+    static BlockLink& blockLink(const mepoo::ChunkHeader* const chunkHeader) noexcept;
+
+    bool isBlock(const mepoo::ChunkHeader* const chunkHeader) const noexcept;
+
+  private:
+    mepoo::ChunkHeader* m_firstChunkHeader{nullptr};
+    mepoo::ChunkHeader* m_lastChunkHeader{nullptr};
+    uint64_t m_numberOfBlocks{0U};
+    uint64_t m_releasedArenaBlocks{0U};
+    uint64_t m_requestedArenaBytes{0U};
+    ArenaBlockSizePlanner m_arenaBlockSizePlanner;
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/arena_loan.inl"
+
+#endif // IOX_POSH_POPO_ARENA_LOAN_HPP
@@ -0,0 +1,191 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_ARENA_LOAN_INL
+#define IOX_POSH_POPO_ARENA_LOAN_INL
+
+#include "iceoryx_posh/internal/popo/arena_loan.hpp"
+
+namespace iox
+{
+namespace popo
+{
+template <typename UserHeaderT>
+constexpr uint32_t ArenaLoan<UserHeaderT>::BLOCK_ALIGNMENT;
+
+template <typename UserHeaderT>
+template <typename AllocateFirst, typename AllocateNext>
+inline void* ArenaLoan<UserHeaderT>::loanBlock(const size_t size,
+                                               size_t& actualSize,
+                                               const AllocateFirst& allocateFirst,
+                                               const AllocateNext& allocateNext) noexcept
+{
+    const bool isFirstBlock = m_firstChunkHeader == nullptr;
+    auto allocateBlock = [&](const uint64_t blockSize) -> mepoo::ChunkHeader* {
+        // the link to the next block is placed behind the usable bytes
+        const uint64_t linkedBlockSize = align(blockSize, static_cast<uint64_t>(alignof(BlockLink))) + sizeof(BlockLink);
+        auto result = isFirstBlock ? allocateFirst(linkedBlockSize, BLOCK_ALIGNMENT)
+                                   : allocateNext(linkedBlockSize, BLOCK_ALIGNMENT);
+        return result.has_error() ? nullptr : result.value();
+    };
+
+    const uint64_t blockSize = isFirstBlock ? m_arenaBlockSizePlanner.firstBlockSize(size) : size;
+    auto* chunkHeader = allocateBlock(blockSize);
+    if (chunkHeader == nullptr && blockSize > size)
+    {
+        // the planned block might exceed the largest mempool; the arena can still chain smaller blocks
+        chunkHeader = allocateBlock(size);
+    }
+    m_requestedArenaBytes += size;
+
+    if (chunkHeader == nullptr)
+    {
+        return nullptr;
+    }
+
+    blockLink(chunkHeader).m_nextChunkHeader = nullptr;
+    if (isFirstBlock)
+    {
+        m_firstChunkHeader = chunkHeader;
+    }
+    else
+    {
+        blockLink(m_lastChunkHeader).m_nextChunkHeader = chunkHeader;
+    }
+    m_lastChunkHeader = chunkHeader;
+    ++m_numberOfBlocks;
+
+    actualSize = usableSize(chunkHeader);
+    return chunkHeader->userPayload();
+}
+
+template <typename UserHeaderT>
+inline mepoo::ChunkHeader* ArenaLoan<UserHeaderT>::releaseBlock(void* const block) noexcept
+{
+    // blocks of already sent messages are owned by the SharedMultiChunk which was delivered to the receivers
+    if (!isBlock(mepoo::ChunkHeader::fromUserPayload(block)))
+    {
+        return nullptr;
+    }
+
+    // the chunks of a loan can only be released together; the arena might still read the block list while it
+    // tears down, therefore the chunks are returned once the arena has handed back the last block of the loan
+    ++m_releasedArenaBlocks;
+    if (m_releasedArenaBlocks < m_numberOfBlocks)
+    {
+        return nullptr;
+    }
+
+    auto* firstChunkHeader = m_firstChunkHeader;
+    reset();
+    return firstChunkHeader;
+}
+
+template <typename UserHeaderT>
+inline bool ArenaLoan<UserHeaderT>::contains(const void* const message) const noexcept
+{
+    const auto address = reinterpret_cast<uint64_t>(message);
+    for (auto* chunkHeader = m_firstChunkHeader; chunkHeader != nullptr;
+         chunkHeader = blockLink(chunkHeader).m_nextChunkHeader)
+    {
+        const auto userPayloadAddress = reinterpret_cast<uint64_t>(chunkHeader->userPayload());
+        if (address >= userPayloadAddress && address < userPayloadAddress + usableSize(chunkHeader))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename UserHeaderT>
+inline mepoo::ChunkHeader* ArenaLoan<UserHeaderT>::setRootMessage(const void* const rootMessage) noexcept
+{
+    if (m_firstChunkHeader == nullptr)
+    {
+        return nullptr;
+    }
+
+    // all blocks of the arena are in the same segment, therefore the root message can be addressed relative to the
+    // first block, independent of the block it was placed in
+    auto* protobufUserHeader = static_cast<ProtobufUserHeader_t*>(m_firstChunkHeader->userHeader());
+    auto rootMessageOffset =
+        reinterpret_cast<uint64_t>(rootMessage) - reinterpret_cast<uint64_t>(m_firstChunkHeader->userPayload());
+    protobufUserHeader->m_rootMessageOffset = static_cast<int64_t>(rootMessageOffset);
+    return m_firstChunkHeader;
+}
+
+template <typename UserHeaderT>
+inline mepoo::ChunkHeader* ArenaLoan<UserHeaderT>::firstChunkHeader() const noexcept
+{
+    return m_firstChunkHeader;
+}
+
+template <typename UserHeaderT>
+inline void ArenaLoan<UserHeaderT>::finish(const mepoo::ChunkHeader* const chunkHeader,
+                                           const optional<uint64_t> footprint) noexcept
+{
+    if (m_firstChunkHeader == nullptr || m_firstChunkHeader != chunkHeader)
+    {
+        return;
+    }
+
+    m_arenaBlockSizePlanner.recordFootprint(footprint.value_or(m_requestedArenaBytes));
+    reset();
+}
+
+template <typename UserHeaderT>
+inline void ArenaLoan<UserHeaderT>::reset() noexcept
+{
+    m_firstChunkHeader = nullptr;
+    m_lastChunkHeader = nullptr;
+    m_numberOfBlocks = 0U;
+    m_releasedArenaBlocks = 0U;
+    m_requestedArenaBytes = 0U;
+}
+
+template <typename UserHeaderT>
+inline uint64_t ArenaLoan<UserHeaderT>::usableSize(const mepoo::ChunkHeader* const chunkHeader) noexcept
+{
+    const uint64_t linkOffset = chunkHeader->actualUserPayloadSize() - sizeof(BlockLink);
+    return linkOffset - linkOffset % alignof(BlockLink);
+}
+
+template <typename UserHeaderT>
+inline typename ArenaLoan<UserHeaderT>::BlockLink&
+ArenaLoan<UserHeaderT>::blockLink(const mepoo::ChunkHeader* const chunkHeader) noexcept
+{
+    auto* userPayload = static_cast<uint8_t*>(const_cast<mepoo::ChunkHeader*>(chunkHeader)->userPayload());
+    return *reinterpret_cast<BlockLink*>(userPayload + usableSize(chunkHeader));
+}
+
+template <typename UserHeaderT>
+inline bool ArenaLoan<UserHeaderT>::isBlock(const mepoo::ChunkHeader* const chunkHeader) const noexcept
+{
+    // only the links of the own blocks are followed; the chunk to look for might already be owned by someone else
+    for (auto* block = m_firstChunkHeader; block != nullptr; block = blockLink(block).m_nextChunkHeader)
+    {
+        if (block == chunkHeader)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_ARENA_LOAN_INL
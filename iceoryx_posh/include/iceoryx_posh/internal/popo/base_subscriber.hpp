@@ -124,9 +124,9 @@ class BaseSubscriber
     BaseSubscriber(BaseSubscriber&& rhs) noexcept = delete;
     BaseSubscriber& operator=(BaseSubscriber&& rhs) noexcept = delete;
 
-    /// @brief small helper method to unwrap the 'expected<optional<ChunkHeader*>>' from the 'tryGetChunk' method of the
-    /// port
-    expected<std::vector<mepoo::ChunkHeader*>, ChunkReceiveResult> takeChunks() noexcept;
+    /// @brief small helper method to forward the view on the chunk headers of the next sample from the
+    /// 'tryGetChunkHeaders' method of the port
+    expected<mepoo::ChunkHeaderView, ChunkReceiveResult> takeChunks() noexcept;
 
     void invalidateTrigger(const uint64_t trigger) noexcept;
 
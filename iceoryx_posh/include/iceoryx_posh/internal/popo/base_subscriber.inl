@@ -94,7 +94,7 @@ inline bool BaseSubscriber<port_t>::hasMissedData() noexcept
 }
 
 template <typename port_t>
-inline expected<std::vector<mepoo::ChunkHeader*>, ChunkReceiveResult> BaseSubscriber<port_t>::takeChunks() noexcept
+inline expected<mepoo::ChunkHeaderView, ChunkReceiveResult> BaseSubscriber<port_t>::takeChunks() noexcept
 {
     return m_port.tryGetChunkHeaders();
 }
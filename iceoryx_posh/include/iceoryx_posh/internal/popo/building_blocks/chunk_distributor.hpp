@@ -23,6 +23,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
 #include "iox/detail/adaptive_wait.hpp"
 #include "iox/detail/unique_id.hpp"
+#include "iox/function_ref.hpp"
 #include "iox/not_null.hpp"
 
 #include <algorithm>
@@ -82,7 +83,8 @@ class ChunkDistributor
     /// deliverToAllStoredQueues
     /// @param[in] queueToAdd chunk queue to add to the list
     /// @param[in] requestedHistory number of last chunks from history to send if available. If history size is smaller
-    /// then the available history size chunks are provided
+    /// then the available history size chunks are provided. A queue which cannot read the chunks in place, see
+    /// 'setMessageLayout', gets no history but a lost chunk instead
     /// @return if the queue could be added it returns success, otherwiese a ChunkDistributor error
     expected<void, ChunkDistributorError> tryAddQueue(not_null<ChunkQueueData_t* const> queueToAdd,
                                                       const uint64_t requestedHistory = 0U) noexcept;
@@ -105,14 +107,30 @@ class ChunkDistributor
     /// @return the number of queues the chunk was delivered to
     uint64_t deliverToAllStoredQueues(mepoo::SharedMultiChunk chunk) noexcept;
 
+    /// @brief Deliver the provided shared chunk to all the stored chunk queues whose consumer can read it in place
+    /// and a serialized copy of it to the others, see 'setMessageLayout'. The copy is created at most once and shared
+    /// by all these queues. The chunk will be added to the chunk history
+    /// @param[in] chunk is the SharedChunk to be delivered
+    /// @param[in] serializedCopy creates the serialized copy of the chunk without holding the lock of the queues; if
+    /// it returns an empty SharedMultiChunk, the queues which need the copy lose the chunk
+    /// @return the number of queues the chunk was delivered to
+    uint64_t deliverToAllStoredQueues(mepoo::SharedMultiChunk chunk,
+                                      const function_ref<mepoo::SharedMultiChunk()> serializedCopy) noexcept;
+
+    /// @brief Set the layout of the chunks which are delivered; queues of consumers which announced a different
+    /// layout get a serialized copy of the chunks and no history
+    /// @param[in] layout of the chunks
+    void setMessageLayout(const MessageLayout& layout) noexcept;
+
     /// @brief Deliver the provided shared chunk to the chunk queue with the provided ID. The chunk will NOT be added
     /// to the chunk history
     /// @param[in] uniqueQueueId is an unique ID which identifies the queue to which this chunk shall be delivered
     /// @param[in] lastKnownQueueIndex is used for a fast lookup of the queue with uniqueQueueId
-    /// @param[in] chunk is the SharedChunk to be delivered
+    /// @param[in] chunk is the SharedMultiChunk to be delivered
     /// @return ChunkDistributorError if the queue was not found
-    expected<void, ChunkDistributorError>
-    deliverToQueue(const UniqueId uniqueQueueId, const uint32_t lastKnownQueueIndex, mepoo::SharedChunk chunk) noexcept;
+    expected<void, ChunkDistributorError> deliverToQueue(const UniqueId uniqueQueueId,
+                                                         const uint32_t lastKnownQueueIndex,
+                                                         mepoo::SharedMultiChunk chunk) noexcept;
 
     /// @brief Lookup for the index of a queue with a specific iox::UniqueId
     /// @param[in] uniqueQueueId is the unique ID of the queue to query the index
@@ -80,7 +80,19 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(not_null<ChunkQueueData_
             // total history
             const auto startIndex =
                 (requestedHistory <= currChunkHistorySize) ? currChunkHistorySize - requestedHistory : 0u;
-            for (auto i = startIndex; i < currChunkHistorySize; ++i)
+            // the history is kept as it was sent; without the serializer of the producer, which is not available
+            // here, a consumer which cannot read the chunks in place does not get a history and is told so by a lost
+            // chunk
+            const bool isReadableInPlace =
+                getMembers()->m_messageLayout.isReadableInPlaceBy(ChunkQueuePusher_t(queueToAdd).getMessageLayout());
+            if (!isReadableInPlace && startIndex < currChunkHistorySize)
+            {
+                IOX_LOG(Warn,
+                        "The history cannot be delivered to a queue which cannot read the chunks in place! "
+                        << currChunkHistorySize - startIndex << " chunks are lost.");
+                ChunkQueuePusher_t(queueToAdd).lostAChunk();
+            }
+            for (auto i = startIndex; isReadableInPlace && i < currChunkHistorySize; ++i)
             {
                 pushToQueue(queueToAdd, getMembers()->m_history[i].cloneToSharedChunk());
             }
@@ -140,10 +152,44 @@ inline bool ChunkDistributor<ChunkDistributorDataType>::hasStoredQueues() const
 
 template <typename ChunkDistributorDataType>
 inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues(mepoo::SharedMultiChunk chunk) noexcept
+{
+    return deliverToAllStoredQueues(chunk, [] { return mepoo::SharedMultiChunk(); });
+}
+
+template <typename ChunkDistributorDataType>
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues(
+    mepoo::SharedMultiChunk chunk, const function_ref<mepoo::SharedMultiChunk()> serializedCopy) noexcept
 {
     uint64_t numberOfQueuesTheChunkWasDeliveredTo{0U};
     using QueueContainer = decltype(getMembers()->m_queues);
     QueueContainer fullQueuesAwaitingDelivery;
+
+    auto isReadableInPlaceBy = [&](ChunkQueueData_t* const queue) {
+        return getMembers()->m_messageLayout.isReadableInPlaceBy(ChunkQueuePusher_t(queue).getMessageLayout());
+    };
+
+    // the serialized copy is created once and without holding the lock, since serializing takes long
+    bool isSerializedCopyNeeded{false};
+    {
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+        for (auto& queue : getMembers()->m_queues)
+        {
+            isSerializedCopyNeeded = isSerializedCopyNeeded || !isReadableInPlaceBy(queue.get());
+        }
+    }
+    const mepoo::SharedMultiChunk serializedChunk =
+        isSerializedCopyNeeded ? serializedCopy() : mepoo::SharedMultiChunk();
+
+    // a queue which needs the serialized copy but was added after the check above is skipped, as if it was added
+    // after the delivery
+    auto chunkFor = [&](ChunkQueueData_t* const queue) -> const mepoo::SharedMultiChunk* {
+        if (isReadableInPlaceBy(queue))
+        {
+            return &chunk;
+        }
+        return isSerializedCopyNeeded ? &serializedChunk : nullptr;
+    };
+
     {
         typename MemberType_t::LockGuard_t lock(*getMembers());
 
@@ -153,7 +199,16 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQu
         {
             bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
 
-            if (pushToQueue(queue.get(), chunk))
+            const auto* queueChunk = chunkFor(queue.get());
+            if (queueChunk == nullptr)
+            {
+                continue;
+            }
+            if (!*queueChunk)
+            {
+                ChunkQueuePusher_t(queue.get()).lostAChunk();
+            }
+            else if (pushToQueue(queue.get(), *queueChunk))
             {
                 ++numberOfQueuesTheChunkWasDeliveredTo;
             }
@@ -209,7 +264,16 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQu
             // deliver to remaining queues
             for (auto& queue : remainingQueues)
             {
-                if (pushToQueue(queue.get(), chunk))
+                const auto* queueChunk = chunkFor(queue.get());
+                if (queueChunk == nullptr)
+                {
+                    continue;
+                }
+                if (!*queueChunk)
+                {
+                    ChunkQueuePusher_t(queue.get()).lostAChunk();
+                }
+                else if (pushToQueue(queue.get(), *queueChunk))
                 {
                     ++numberOfQueuesTheChunkWasDeliveredTo;
                 }
@@ -226,6 +290,14 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQu
     return numberOfQueuesTheChunkWasDeliveredTo;
 }
 
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::setMessageLayout(const MessageLayout& layout) noexcept
+{
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+
+    getMembers()->m_messageLayout = layout;
+}
+
 template <typename ChunkDistributorDataType>
 inline bool ChunkDistributor<ChunkDistributorDataType>::pushToQueue(not_null<ChunkQueueData_t* const> queue,
                                                                     mepoo::SharedMultiChunk chunk) noexcept
@@ -237,7 +309,7 @@ template <typename ChunkDistributorDataType>
 inline expected<void, ChunkDistributorError>
 ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(const UniqueId uniqueQueueId,
                                                            const uint32_t lastKnownQueueIndex,
-                                                           mepoo::SharedChunk chunk [[maybe_unused]]) noexcept
+                                                           mepoo::SharedMultiChunk chunk) noexcept
 {
     bool retry{false};
     do
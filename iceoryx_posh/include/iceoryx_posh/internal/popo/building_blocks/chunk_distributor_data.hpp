@@ -59,6 +59,10 @@ struct ChunkDistributorData : public LockingPolicy
         vector<mepoo::ShmSafeUnmanagedMultiChunk, ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY>;
     HistoryContainer_t m_history;
     const ConsumerTooSlowPolicy m_consumerTooSlowPolicy;
+
+    /// @brief the 'MessageLayout' of the chunks of the producer; queues of consumers which cannot read them in place
+    /// get a serialized copy
+    MessageLayout m_messageLayout;
 };
 
 } // namespace popo
@@ -21,6 +21,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/variant_queue.hpp"
+#include "iceoryx_posh/popo/message_layout.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
 #include "iox/atomic.hpp"
 #include "iox/detail/unique_id.hpp"
@@ -50,6 +51,12 @@ struct ChunkQueueData : public LockingPolicy
     RelativePointer<ConditionVariableData> m_conditionVariableDataPtr;
     optional<uint64_t> m_conditionVariableNotificationIndex;
     const QueueFullPolicy m_queueFullPolicy;
+
+    /// @brief the 'MessageLayout' of the consumer; it is announced by the consumer before it subscribes and chunks of
+    /// a producer with a different layout are delivered as serialized copy. Consumers which do not announce a layout
+    /// receive all chunks as they are.
+    concurrent::Atomic<uint64_t> m_layoutAbiHash{MessageLayout::LAYOUT_INDEPENDENT};
+    concurrent::Atomic<uint64_t> m_layoutAddressSpaceKey{0U};
 };
 
 } // namespace popo
@@ -92,6 +92,11 @@ class ChunkQueuePopper
     /// @return true if condition variable is set, false if not
     bool isConditionVariableSet() const noexcept;
 
+    /// @brief Announces the layout in which the consumer can read messages in place; chunks of producers with a
+    /// different layout are delivered as serialized copy
+    /// @param[in] layout of the messages of the consumer
+    void setMessageLayout(const MessageLayout& layout) noexcept;
+
   protected:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
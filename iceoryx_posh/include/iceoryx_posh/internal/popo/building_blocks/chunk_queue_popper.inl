@@ -152,6 +152,14 @@ inline bool ChunkQueuePopper<ChunkQueueDataType>::isConditionVariableSet() const
     return getMembers()->m_conditionVariableDataPtr.operator bool();
 }
 
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePopper<ChunkQueueDataType>::setMessageLayout(const MessageLayout& layout) noexcept
+{
+    getMembers()->m_layoutAbiHash.store(MessageLayout::LAYOUT_INDEPENDENT, std::memory_order_relaxed);
+    getMembers()->m_layoutAddressSpaceKey.store(layout.m_addressSpaceKey, std::memory_order_relaxed);
+    getMembers()->m_layoutAbiHash.store(layout.m_abiHash, std::memory_order_release);
+}
+
 } // namespace popo
 } // namespace iox
 
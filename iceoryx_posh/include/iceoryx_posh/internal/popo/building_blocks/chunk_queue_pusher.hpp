@@ -54,6 +54,10 @@ class ChunkQueuePusher
     /// @brief tell the queue that it lost a chunk (e.g. because push failed and there will be no retry)
     void lostAChunk() noexcept;
 
+    /// @brief Returns the layout in which the consumer can read messages in place
+    /// @return the layout of the consumer
+    MessageLayout getMessageLayout() const noexcept;
+
   protected:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
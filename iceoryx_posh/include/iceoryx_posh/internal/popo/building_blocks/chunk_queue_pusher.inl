@@ -75,6 +75,15 @@ inline void ChunkQueuePusher<ChunkQueueDataType>::lostAChunk() noexcept
     getMembers()->m_queueHasLostChunks.store(true, std::memory_order_relaxed);
 }
 
+template <typename ChunkQueueDataType>
+inline MessageLayout ChunkQueuePusher<ChunkQueueDataType>::getMessageLayout() const noexcept
+{
+    MessageLayout layout;
+    layout.m_abiHash = getMembers()->m_layoutAbiHash.load(std::memory_order_acquire);
+    layout.m_addressSpaceKey = getMembers()->m_layoutAddressSpaceKey.load(std::memory_order_relaxed);
+    return layout;
+}
+
 } // namespace popo
 } // namespace iox
 
@@ -71,16 +71,16 @@ class ChunkReceiver : public ChunkQueuePopper<typename ChunkReceiverDataType::Ch
     ChunkReceiver& operator=(ChunkReceiver&& rhs) noexcept = default;
     ~ChunkReceiver() noexcept = default;
 
-    /// @brief Tries to get the next received chunk. If there is a new one the ChunkHeader of this new chunk is received
-    /// The ownerhip of the SharedChunk remains in the ChunkReceiver for being able to cleanup if the user process
-    /// disappears
-    /// @return New chunk header, ChunkReceiveResult on error
-    /// or if there are no new chunks in the underlying queue
-    expected<std::vector<mepoo::ChunkHeader*>, ChunkReceiveResult> tryGetChunkHeaders() noexcept;
+    /// @brief Tries to get the next received sample. If there is a new one a view on the ChunkHeaders of all chunks of
+    /// this sample is received. The ownerhip of the SharedMultiChunk remains in the ChunkReceiver for being able to
+    /// cleanup if the user process disappears
+    /// @return View on the new chunk headers which stays valid until the sample is released, ChunkReceiveResult on
+    /// error or if there are no new chunks in the underlying queue
+    expected<mepoo::ChunkHeaderView, ChunkReceiveResult> tryGetChunkHeaders() noexcept;
 
-    /// @brief Release a chunk that was obtained with get
-    /// @param[in] chunkHeader, pointer to the ChunkHeader to release
-    void release(std::vector<mepoo::ChunkHeader*>& chunkHeaders) noexcept;
+    /// @brief Release a sample that was obtained with tryGetChunkHeaders
+    /// @param[in] chunkHeader, pointer to the ChunkHeader of the first chunk of the sample to release
+    void release(const mepoo::ChunkHeader* const chunkHeader) noexcept;
 
     /// @brief Release all the chunks that are currently held. Caution: Only call this if the user process is no more
     /// running E.g. This cleans up chunks that were held by a user process that died unexpectetly, for avoiding lost
@@ -70,7 +70,7 @@ ChunkReceiver<ChunkReceiverDataType>::getMembers() noexcept
 }
 
 template <typename ChunkReceiverDataType>
-inline expected<std::vector<mepoo::ChunkHeader*>, ChunkReceiveResult>
+inline expected<mepoo::ChunkHeaderView, ChunkReceiveResult>
 ChunkReceiver<ChunkReceiverDataType>::tryGetChunkHeaders() noexcept
 {
     auto popRet = this->tryPop();
@@ -79,7 +79,7 @@ ChunkReceiver<ChunkReceiverDataType>::tryGetChunkHeaders() noexcept
     {
         auto sharedMultiChunk = *popRet;
 
-        if (sharedMultiChunk.getChunkHeaders().size() == 0)
+        if (sharedMultiChunk.getChunkHeader() == nullptr)
         {
             return err(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
         }
@@ -101,11 +101,11 @@ ChunkReceiver<ChunkReceiverDataType>::tryGetChunkHeaders() noexcept
 }
 
 template <typename ChunkReceiverDataType>
-inline void ChunkReceiver<ChunkReceiverDataType>::release(std::vector<mepoo::ChunkHeader*>& chunkHeaders) noexcept
+inline void ChunkReceiver<ChunkReceiverDataType>::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
     mepoo::SharedMultiChunk chunk(nullptr);
 
-    if (!getMembers()->m_chunksInUse.remove(chunkHeaders, chunk))
+    if (!getMembers()->m_chunksInUse.remove(chunkHeader, chunk))
     {
         IOX_REPORT(PoshError::POPO__CHUNK_RECEIVER_INVALID_CHUNK_TO_RELEASE_FROM_USER, iox::er::RUNTIME_ERROR);
     }
@@ -31,6 +31,8 @@
 #include "iox/not_null.hpp"
 #include "iox/optional.hpp"
 
+#include <limits>
+
 namespace iox
 {
 namespace popo
@@ -69,6 +71,31 @@ inline std::ostream& operator<<(std::ostream& stream, AllocationError value) noe
 /// @return the reference to 'stream' which was provided as input parameter
 inline log::LogStream& operator<<(log::LogStream& stream, AllocationError value) noexcept;
 
+/// @brief The state of a loan context of a ChunkSender. A loan context assembles one sample at a time, independently
+/// of the other loan contexts and of the regular allocations of the ChunkSender. Each thread can therefore assemble its
+/// own sample and send it without synchronizing with the other threads of the application.
+struct ChunkSenderLoanContext
+{
+    static constexpr uint32_t INVALID_INDEX{std::numeric_limits<uint32_t>::max()};
+
+    /// @brief the entry of the LoanContextList which is owned by this loan context
+    uint32_t m_index{INVALID_INDEX};
+    /// @brief the sample which is currently assembled; nullptr if there is none
+    mepoo::ChunkManagementManagement* m_chunkManagementManagement{nullptr};
+};
+
+/// @brief Serializes the samples of a ChunkSender whose chunks can only be read in place by consumers with the same
+/// 'MessageLayout', e.g. protobuf messages which were built on an arena in the chunks of the sample
+struct ChunkSerializer
+{
+    /// @brief computes the size of the serialized message of a sample; nullopt if the sample cannot be serialized,
+    /// which is then lost for the consumers which need the serialized message
+    optional<uint64_t> (*serializedSize)(const mepoo::ChunkHeader* const sample){nullptr};
+    /// @brief serializes the message of a sample into the user-payload of 'target', which has the size returned by
+    /// 'serializedSize' and a copy of the user-header of the sample
+    void (*serialize)(const mepoo::ChunkHeader* const sample, mepoo::ChunkHeader* const target){nullptr};
+};
+
 /// @brief The ChunkSender is a building block of the shared memory communication infrastructure. It extends
 /// the functionality of a ChunkDistributor with the abililty to allocate and free memory chunks.
 /// For getting chunks of memory the MemoryManger is used. Together with the ChunkReceiver, they are the next
@@ -106,21 +133,40 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
                                                                const uint32_t userHeaderSize,
                                                                const uint32_t userHeaderAlignment) noexcept;
 
+    /// @brief Allocates a sample which consists of a single chunk. Unlike 'tryAllocate', the chunk is never added to
+    /// the sample which is currently assembled, hence a sample can be loaned while e.g. the blocks of an arena are
+    /// still pending; the assembly continues with the next call of 'tryAllocate'
+    /// @param[in] originId, the unique id of the entity which requested this allocate
+    /// @param[in] userPayloadSize, size of the user-payload without additional headers
+    /// @param[in] userPayloadAlignment, alignment of the user-payload
+    /// @param[in] userHeaderSize, size of the user-header; use iox::CHUNK_NO_USER_HEADER_SIZE to omit a
+    /// user-header
+    /// @param[in] userHeaderAlignment, alignment of the user-header; use iox::CHUNK_NO_USER_HEADER_ALIGNMENT
+    /// to omit a user-header
+    /// @return on success pointer to the ChunkHeader of the sample, error if not
+    expected<mepoo::ChunkHeader*, AllocationError> tryAllocateSingleChunk(const UniquePortId originId,
+                                                                          const uint64_t userPayloadSize,
+                                                                          const uint32_t userPayloadAlignment,
+                                                                          const uint32_t userHeaderSize,
+                                                                          const uint32_t userHeaderAlignment) noexcept;
+
     mepoo::ChunkManagementManagement* tryAllocateChunkManagementManagement() noexcept;
 
-    /// @brief Release an allocated chunk without sending it
-    /// @param[in] chunkHeader, pointer to the ChunkHeader to release
-    void release(std::vector<mepoo::ChunkHeader*>& chunkHeaders) noexcept;
+    /// @brief Release an allocated sample with all its chunks without sending it; if it is the sample which is
+    /// currently assembled, the next call of 'tryAllocate' starts a new one
+    /// @param[in] chunkHeader, pointer to the ChunkHeader of the first chunk of the sample to release
+    void release(const mepoo::ChunkHeader* const chunkHeader) noexcept;
 
-    /// @brief Send an allocated chunk to all connected ChunkQueuePopper
-    /// @param[in] chunkHeader, pointer to the ChunkHeader to send; the ownership of the pointer is transferred to this
-    /// method
+    /// @brief Send an allocated sample with all its chunks to all connected ChunkQueuePopper; if it is the sample which
+    /// is currently assembled, the next call of 'tryAllocate' starts a new one
+    /// @param[in] chunkHeader, pointer to the ChunkHeader of the first chunk of the sample to send; the ownership of
+    /// the sample is transferred to this method
     /// @return the number of receiver the chunk was send to
-    uint64_t send(std::vector<mepoo::ChunkHeader*>& chunkHeaders) noexcept;
+    uint64_t send(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
-    /// @brief Send an allocated chunk to a specific ChunkQueuePopper
-    /// @param[in] chunkHeader, pointer to the ChunkHeader to send; the ownership of the pointer is transferred to this
-    /// method
+    /// @brief Send an allocated sample with all its chunks to a specific ChunkQueuePopper
+    /// @param[in] chunkHeader, pointer to the ChunkHeader of the first chunk of the sample to send; the ownership of
+    /// the sample is transferred to this method
     /// @param[in] uniqueQueueId is an unique ID which identifies the queue to which this chunk shall be delivered
     /// @param[in] lastKnownQueueIndex is used for a fast lookup of the queue with uniqueQueueId
     /// @return true when successful, false otherwise
@@ -144,16 +190,80 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
 
     void resetChunkManagementManagement() noexcept;
 
+    /// @brief Claims a loan context in which a sample can be assembled independently of the other loan contexts
+    /// @return the loan context or an error if all loan contexts are in use
+    /// @note thread-safe and lock-free
+    expected<ChunkSenderLoanContext, AllocationError> tryAcquireLoanContext() noexcept;
+
+    /// @brief Returns a loan context; a sample which is still assembled in it is released
+    /// @param[in] loanContext to return; it is invalid afterwards
+    void releaseLoanContext(ChunkSenderLoanContext& loanContext) noexcept;
+
+    /// @brief Allocates a chunk for the sample which is assembled in a loan context; the first chunk starts a new
+    /// sample, every further chunk is added to it
+    /// @param[in] loanContext in which the sample is assembled
+    /// @param[in] originId, the unique id of the entity which requested this allocate
+    /// @param[in] userPayloadSize, size of the user-payload without additional headers
+    /// @param[in] userPayloadAlignment, alignment of the user-payload
+    /// @param[in] userHeaderSize, size of the user-header
+    /// @param[in] userHeaderAlignment, alignment of the user-header
+    /// @return on success pointer to the ChunkHeader of the new chunk, error if not
+    /// @note thread-safe as long as every thread uses its own loan context
+    expected<mepoo::ChunkHeader*, AllocationError> tryAllocate(ChunkSenderLoanContext& loanContext,
+                                                               const UniquePortId originId,
+                                                               const uint64_t userPayloadSize,
+                                                               const uint32_t userPayloadAlignment,
+                                                               const uint32_t userHeaderSize,
+                                                               const uint32_t userHeaderAlignment) noexcept;
+
+    /// @brief Releases the sample which is assembled in a loan context without sending it
+    /// @param[in] loanContext in which the sample is assembled
+    void release(ChunkSenderLoanContext& loanContext) noexcept;
+
+    /// @brief Sends the sample which is assembled in a loan context to all connected ChunkQueuePopper
+    /// @param[in] loanContext in which the sample is assembled; it can be used for the next sample afterwards
+    /// @return the number of receiver the sample was send to
+    /// @note thread-safe as long as every thread uses its own loan context; samples of loan contexts do not become
+    /// the previous chunk of the ChunkSender and are therefore never recycled
+    uint64_t send(ChunkSenderLoanContext& loanContext) noexcept;
+
+    /// @brief Sets the layout of the sent samples and the serializer which creates the copy of a sample for the
+    /// consumers which cannot read it in place
+    /// @param[in] layout of the sent samples
+    /// @param[in] serializer for the samples
+    void setMessageLayout(const MessageLayout& layout, const ChunkSerializer& serializer) noexcept;
+
   private:
-    /// @brief Get the SharedChunk from the provided ChunkHeader and do all that is required to send the chunk
-    /// @param[in] chunkHeader of the chunk that shall be send
+    /// @brief Get the SharedMultiChunk from the provided ChunkHeader and do all that is required to send the sample
+    /// @param[in] chunkHeader of the first chunk of the sample that shall be send
     /// @param[in][out] chunk that corresponds to the chunk header
-    /// @return true if there was a matching chunk with this header, false if not
-    bool getChunkReadyForSend(const mepoo::ChunkHeader* const chunkHeader, mepoo::SharedChunk& chunk) noexcept;
+    /// @return true if there was a matching sample with this header, false if not
+    bool getChunkReadyForSend(const mepoo::ChunkHeader* const chunkHeader, mepoo::SharedMultiChunk& chunk) noexcept;
+
+    /// @brief Checks whether a chunk is the first chunk of the sample which is currently assembled
+    bool isAssembledSample(const mepoo::ChunkHeader* const chunkHeader) const noexcept;
+
+    /// @brief Takes over the previous sample with all its chunks for the sample which is assembled next
+    expected<mepoo::ChunkHeader*, AllocationError> recyclePreviousSample(const UniquePortId originId,
+                                                                         const mepoo::ChunkSettings& chunkSettings) noexcept;
+
+    /// @brief Re-initializes the chunk-header of a chunk which is reused for a new sample
+    mepoo::ChunkHeader* recycleChunk(mepoo::ChunkHeader& chunkHeader,
+                                     const UniquePortId originId,
+                                     const mepoo::ChunkSettings& chunkSettings) noexcept;
+
+    /// @brief Frees the chunks of the previous sample which were not reused by the assembled sample
+    void finishRecycling() noexcept;
+
+    /// @brief Creates a single chunk sample with the serialized message of a sample
+    /// @return the serialized copy or an empty SharedMultiChunk if there is no serializer or no memory
+    mepoo::SharedMultiChunk serializedCopyOf(const mepoo::SharedMultiChunk& sample) noexcept;
 
-    bool getChunkReadyForSend(std::vector<mepoo::ChunkHeader*>& chunkHeaders, mepoo::SharedMultiChunk& chunk) noexcept; 
+    ChunkSerializer m_serializer;
 
     mepoo::ChunkManagementManagement* m_chunkManagementManagement{nullptr};
+    /// @brief the last chunk of the previous sample which was reused by the assembled sample
+    mepoo::ChunkManagement* m_lastRecycledChunkManagement{nullptr};
 
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
@@ -21,6 +21,8 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_sender.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 
+#include <cstring>
+
 namespace iox
 {
 
@@ -102,10 +104,11 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
                                               const uint32_t userHeaderSize,
                                               const uint32_t userHeaderAlignment) noexcept
 {
-    // use the chunk stored in m_lastChunkUnmanaged if:
-    //   - there is a valid chunk
+    // use the chunks stored in m_lastMultiChunkUnmanaged if:
+    //   - there is a valid sample
     //   - there is no other owner
-    //   - the new user-payload still fits in it
+    //   - the new user-payload still fits in its first chunk
+    // with 'm_recycleAllChunks' the following chunks of that sample are reused as well as long as they fit
     const auto chunkSettingsResult =
         mepoo::ChunkSettings::create(userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
     if (chunkSettingsResult.has_error())
@@ -120,63 +123,153 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     mepoo::ChunkHeader* lastChunkChunkHeader =
         lastMultiChunkUnmanaged.isNotLogicalNullptrAndHasNoOtherOwners() ? lastMultiChunkUnmanaged.getChunkHeader() : nullptr;
 
-    if (!m_chunkManagementManagement && lastChunkChunkHeader && (lastChunkChunkHeader->chunkSize() >= requiredChunkSize))
+    if (m_lastRecycledChunkManagement != nullptr)
+    {
+        // continue with the next chunk of the recycled previous sample as long as the chunks fit
+        auto nextChunkManagement = m_lastRecycledChunkManagement->m_nextChunkManagement.get();
+        if (nextChunkManagement != nullptr && nextChunkManagement->m_chunkHeader->chunkSize() >= requiredChunkSize)
+        {
+            m_lastRecycledChunkManagement = nextChunkManagement;
+            return ok(recycleChunk(*nextChunkManagement->m_chunkHeader.get(), originId, chunkSettings));
+        }
+
+        finishRecycling();
+    }
+    else if (!m_chunkManagementManagement && lastChunkChunkHeader && (lastChunkChunkHeader->chunkSize() >= requiredChunkSize))
     {
+        if (getMembers()->m_recycleAllChunks)
+        {
+            return recyclePreviousSample(originId, chunkSettings);
+        }
+
         auto sharedChunk = lastMultiChunkUnmanaged.releaseFirstToSharedChunk();
         m_chunkManagementManagement = lastMultiChunkUnmanaged.getChunkManagementManagement();
         if (getMembers()->m_chunksInUse.insert(sharedChunk, m_chunkManagementManagement,false))
         {
-            auto chunkSize = lastChunkChunkHeader->chunkSize();
-            lastChunkChunkHeader->~ChunkHeader();
-            new (lastChunkChunkHeader) mepoo::ChunkHeader(chunkSize, chunkSettings);
-            lastChunkChunkHeader->setOriginId(originId);
-            return ok(lastChunkChunkHeader);
+            // the used chunk list took over the ownership of the ChunkManagementManagement
+            lastMultiChunkUnmanaged = mepoo::ShmSafeUnmanagedMultiChunk();
+
+            return ok(recycleChunk(*lastChunkChunkHeader, originId, chunkSettings));
         }
         else
         {
+            m_chunkManagementManagement = nullptr;
             return err(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
         }
     }
-    else
+
+    // BEGIN of critical section, chunk will be lost if the process terminates in this section
+    // get a new chunk
+    auto getChunkResult = getMembers()->m_memoryMgr->getChunk(chunkSettings);
+
+    if (getChunkResult.has_error())
     {
-        // BEGIN of critical section, chunk will be lost if the process terminates in this section
-        // get a new chunk
-        auto getChunkResult = getMembers()->m_memoryMgr->getChunk(chunkSettings);
+        /// @todo iox-#1012 use error<E2>::from(E1); once available
+        return err(into<AllocationError>(getChunkResult.error()));
+    }
+
+    auto& chunk = getChunkResult.value();
 
-        if (getChunkResult.has_error())
+    bool initialized{false};
+    if (m_chunkManagementManagement == nullptr)
+    {
+        if ((m_chunkManagementManagement = tryAllocateChunkManagementManagement()) == nullptr)
         {
-            /// @todo iox-#1012 use error<E2>::from(E1); once available
-            return err(into<AllocationError>(getChunkResult.error()));
+            return err(AllocationError::RUNNING_OUT_OF_CHUNKS);
         }
+    }
+    else
+    {
+        initialized = true;
+    }
 
-        auto& chunk = getChunkResult.value();
+    // if the application allocated too much chunks, return no more chunks
+    if (getMembers()->m_chunksInUse.insert(chunk, m_chunkManagementManagement, initialized))
+    {
+        // END of critical section
+        chunk.getChunkHeader()->setOriginId(originId);
+        return ok(chunk.getChunkHeader());
+    }
+    else
+    {
+        // release the allocated chunk
+        chunk = nullptr;
+        return err(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
+    }
+}
 
-        bool initialized{false};
-        if (m_chunkManagementManagement == nullptr)
-        {
-            if ((m_chunkManagementManagement = tryAllocateChunkManagementManagement()) == nullptr)
-            {
-                return err(into<AllocationError>(getChunkResult.error()));
-            }
-        }
-        else
-        {
-            initialized = true;
-        }
+template <typename ChunkSenderDataType>
+inline expected<mepoo::ChunkHeader*, AllocationError>
+ChunkSender<ChunkSenderDataType>::tryAllocateSingleChunk(const UniquePortId originId,
+                                                         const uint64_t userPayloadSize,
+                                                         const uint32_t userPayloadAlignment,
+                                                         const uint32_t userHeaderSize,
+                                                         const uint32_t userHeaderAlignment) noexcept
+{
+    // the assembled sample is put aside, so that the chunk starts a sample of its own
+    auto* assembledChunkManagementManagement = m_chunkManagementManagement;
+    auto* lastRecycledChunkManagement = m_lastRecycledChunkManagement;
+    m_chunkManagementManagement = nullptr;
+    m_lastRecycledChunkManagement = nullptr;
 
-        // if the application allocated too much chunks, return no more chunks
-        if (getMembers()->m_chunksInUse.insert(chunk, m_chunkManagementManagement, initialized))
-        {
-            // END of critical section
-            chunk.getChunkHeader()->setOriginId(originId);
-            return ok(chunk.getChunkHeader());
-        }
-        else
-        {
-            // release the allocated chunk
-            chunk = nullptr;
-            return err(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
-        }
+    auto result = tryAllocate(originId, userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
+    // a single chunk sample never takes more than the first chunk of the previous sample
+    finishRecycling();
+
+    m_chunkManagementManagement = assembledChunkManagementManagement;
+    m_lastRecycledChunkManagement = lastRecycledChunkManagement;
+    return result;
+}
+
+template <typename ChunkSenderDataType>
+inline bool ChunkSender<ChunkSenderDataType>::isAssembledSample(const mepoo::ChunkHeader* const chunkHeader) const noexcept
+{
+    if (m_chunkManagementManagement == nullptr || m_chunkManagementManagement->empty())
+    {
+        return false;
+    }
+    return m_chunkManagementManagement->front()->m_chunkHeader.get() == chunkHeader;
+}
+
+template <typename ChunkSenderDataType>
+inline expected<mepoo::ChunkHeader*, AllocationError>
+ChunkSender<ChunkSenderDataType>::recyclePreviousSample(const UniquePortId originId,
+                                                        const mepoo::ChunkSettings& chunkSettings) noexcept
+{
+    auto& lastMultiChunkUnmanaged = getMembers()->m_lastMultiChunkUnmanaged;
+    m_chunkManagementManagement = lastMultiChunkUnmanaged.getChunkManagementManagement();
+
+    // the used chunk list takes over the ownership of the previous sample with all its chunks; the chunks which are
+    // not reused are freed when the assembled sample is sent
+    if (!getMembers()->m_chunksInUse.insert(lastMultiChunkUnmanaged.releaseToSharedChunk()))
+    {
+        m_chunkManagementManagement = nullptr;
+        return err(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
+    }
+
+    m_lastRecycledChunkManagement = m_chunkManagementManagement->front();
+    return ok(recycleChunk(*m_lastRecycledChunkManagement->m_chunkHeader.get(), originId, chunkSettings));
+}
+
+template <typename ChunkSenderDataType>
+inline mepoo::ChunkHeader* ChunkSender<ChunkSenderDataType>::recycleChunk(mepoo::ChunkHeader& chunkHeader,
+                                                                          const UniquePortId originId,
+                                                                          const mepoo::ChunkSettings& chunkSettings) noexcept
+{
+    auto chunkSize = chunkHeader.chunkSize();
+    chunkHeader.~ChunkHeader();
+    auto recycledChunkHeader = new (&chunkHeader) mepoo::ChunkHeader(chunkSize, chunkSettings);
+    recycledChunkHeader->setOriginId(originId);
+    return recycledChunkHeader;
+}
+
+template <typename ChunkSenderDataType>
+inline void ChunkSender<ChunkSenderDataType>::finishRecycling() noexcept
+{
+    if (m_lastRecycledChunkManagement != nullptr)
+    {
+        m_chunkManagementManagement->releaseChunksAfter(*m_lastRecycledChunkManagement);
+        m_lastRecycledChunkManagement = nullptr;
     }
 }
 
@@ -188,31 +281,54 @@ ChunkSender<ChunkSenderDataType>::tryAllocateChunkManagementManagement() noexcep
 }
 
 template <typename ChunkSenderDataType>
-inline void ChunkSender<ChunkSenderDataType>::release(std::vector<mepoo::ChunkHeader*>& chunkHeaders) noexcept
+inline void ChunkSender<ChunkSenderDataType>::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
+    // other samples can be released while a sample is assembled, they must not end its assembly
+    const bool isAssembled = isAssembledSample(chunkHeader);
+    if (isAssembled)
+    {
+        finishRecycling();
+    }
+
     mepoo::SharedMultiChunk chunk(nullptr);
     // d'tor of SharedChunk will release the memory, we do not have to touch the returned chunk
-    if (!getMembers()->m_chunksInUse.remove(chunkHeaders, chunk))
+    if (!getMembers()->m_chunksInUse.remove(chunkHeader, chunk))
     {
         IOX_REPORT(PoshError::POPO__CHUNK_SENDER_INVALID_CHUNK_TO_FREE_FROM_USER, iox::er::RUNTIME_ERROR);
     }
+
+    if (isAssembled)
+    {
+        resetChunkManagementManagement();
+    }
 }
 
 template <typename ChunkSenderDataType>
-inline uint64_t ChunkSender<ChunkSenderDataType>::send(std::vector<mepoo::ChunkHeader*>& chunkHeaders) noexcept
+inline uint64_t ChunkSender<ChunkSenderDataType>::send(mepoo::ChunkHeader* const chunkHeader) noexcept
 {
     uint64_t numberOfReceiverTheChunkWasDelivered{0};
     mepoo::SharedMultiChunk sharedMultiChunk{nullptr};
+    const bool isAssembled = isAssembledSample(chunkHeader);
+    if (isAssembled)
+    {
+        finishRecycling();
+    }
     // BEGIN of critical section, chunk will be lost if the process terminates in this section
-    if (getChunkReadyForSend(chunkHeaders, sharedMultiChunk))
+    if (getChunkReadyForSend(chunkHeader, sharedMultiChunk))
     {
-        numberOfReceiverTheChunkWasDelivered = this->deliverToAllStoredQueues(sharedMultiChunk);
+        numberOfReceiverTheChunkWasDelivered = this->deliverToAllStoredQueues(
+            sharedMultiChunk, [&] { return serializedCopyOf(sharedMultiChunk); });
 
         getMembers()->m_lastMultiChunkUnmanaged.releaseToSharedChunk();
         getMembers()->m_lastMultiChunkUnmanaged = sharedMultiChunk;
     }
     // END of critical section
 
+    if (isAssembled)
+    {
+        resetChunkManagementManagement();
+    }
+
     return numberOfReceiverTheChunkWasDelivered;
 }
 
@@ -221,40 +337,56 @@ inline bool ChunkSender<ChunkSenderDataType>::sendToQueue(mepoo::ChunkHeader* co
                                                           const UniqueId uniqueQueueId,
                                                           const uint32_t lastKnownQueueIndex) noexcept
 {
-    //mepoo::SharedMultiChunk chunk(nullptr);
+    mepoo::SharedMultiChunk sharedMultiChunk{nullptr};
+    const bool isAssembled = isAssembledSample(chunkHeader);
+    if (isAssembled)
+    {
+        finishRecycling();
+    }
     // BEGIN of critical section, chunk will be lost if the process terminates in this section
-    /*if (getChunkReadyForSend(chunkHeader, chunk))
+    const bool isReadyForSend = getChunkReadyForSend(chunkHeader, sharedMultiChunk);
+    if (isAssembled)
+    {
+        resetChunkManagementManagement();
+    }
+
+    if (isReadyForSend)
     {
-        auto deliveryResult = this->deliverToQueue(uniqueQueueId, lastKnownQueueIndex, chunk);
+        auto deliveryResult = this->deliverToQueue(uniqueQueueId, lastKnownQueueIndex, sharedMultiChunk);
 
         getMembers()->m_lastMultiChunkUnmanaged.releaseToSharedChunk();
-        getMembers()->m_lastMultiChunkUnmanaged = chunk;
+        getMembers()->m_lastMultiChunkUnmanaged = sharedMultiChunk;
 
         return !deliveryResult.has_error();
-    }*/
+    }
     // END of critical section
 
-    uint64_t id = uniqueQueueId;
-    IOX_LOG(Info, "ChunkHeader: " << reinterpret_cast<uint64_t>(const_cast<mepoo::ChunkHeader*>(chunkHeader)));
-    IOX_LOG(Info, "uniqueQueueId: " << id);
-    IOX_LOG(Info, "lastKnownQueueIndex: " << lastKnownQueueIndex);
-
     return false;
 }
 
 template <typename ChunkSenderDataType>
 inline void ChunkSender<ChunkSenderDataType>::pushToHistory(mepoo::ChunkHeader* const chunkHeader) noexcept
 {
-    mepoo::SharedChunk chunk(nullptr);
+    mepoo::SharedMultiChunk sharedMultiChunk{nullptr};
+    const bool isAssembled = isAssembledSample(chunkHeader);
+    if (isAssembled)
+    {
+        finishRecycling();
+    }
     // BEGIN of critical section, chunk will be lost if the process terminates in this section
-    if (getChunkReadyForSend(chunkHeader, chunk))
+    if (getChunkReadyForSend(chunkHeader, sharedMultiChunk))
     {
-        this->addToHistoryWithoutDelivery(chunk);
+        this->addToHistoryWithoutDelivery(sharedMultiChunk);
 
-        getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
-        getMembers()->m_lastChunkUnmanaged = chunk;
+        getMembers()->m_lastMultiChunkUnmanaged.releaseToSharedChunk();
+        getMembers()->m_lastMultiChunkUnmanaged = sharedMultiChunk;
     }
     // END of critical section
+
+    if (isAssembled)
+    {
+        resetChunkManagementManagement();
+    }
 }
 
 template <typename ChunkSenderDataType>
@@ -274,6 +406,7 @@ template <typename ChunkSenderDataType>
 inline void ChunkSender<ChunkSenderDataType>::releaseAll() noexcept
 {
     getMembers()->m_chunksInUse.cleanup();
+    getMembers()->m_loanContexts.cleanup();
     this->cleanup();
     getMembers()->m_lastMultiChunkUnmanaged.releaseToSharedChunk();
 }
@@ -282,31 +415,172 @@ template <typename ChunkSenderDataType>
 inline void ChunkSender<ChunkSenderDataType>::resetChunkManagementManagement() noexcept
 {
     m_chunkManagementManagement = nullptr;
+    m_lastRecycledChunkManagement = nullptr;
 }
 
 template <typename ChunkSenderDataType>
-inline bool ChunkSender<ChunkSenderDataType>::getChunkReadyForSend(const mepoo::ChunkHeader* const chunkHeader,
-                                                                   mepoo::SharedChunk& chunk) noexcept
+inline expected<ChunkSenderLoanContext, AllocationError> ChunkSender<ChunkSenderDataType>::tryAcquireLoanContext() noexcept
 {
-    if (getMembers()->m_chunksInUse.remove(chunkHeader, chunk))
+    ChunkSenderLoanContext loanContext;
+    if (!getMembers()->m_loanContexts.acquire(loanContext.m_index))
     {
-        chunk.getChunkHeader()->setSequenceNumber(getMembers()->m_sequenceNumber++);
-        return true;
+        return err(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
+    }
+    return ok(loanContext);
+}
+
+template <typename ChunkSenderDataType>
+inline void ChunkSender<ChunkSenderDataType>::releaseLoanContext(ChunkSenderLoanContext& loanContext) noexcept
+{
+    if (loanContext.m_index == ChunkSenderLoanContext::INVALID_INDEX)
+    {
+        return;
+    }
+
+    getMembers()->m_loanContexts.release(loanContext.m_index);
+    loanContext = ChunkSenderLoanContext();
+}
+
+template <typename ChunkSenderDataType>
+inline expected<mepoo::ChunkHeader*, AllocationError>
+ChunkSender<ChunkSenderDataType>::tryAllocate(ChunkSenderLoanContext& loanContext,
+                                              const UniquePortId originId,
+                                              const uint64_t userPayloadSize,
+                                              const uint32_t userPayloadAlignment,
+                                              const uint32_t userHeaderSize,
+                                              const uint32_t userHeaderAlignment) noexcept
+{
+    IOX_ENFORCE(loanContext.m_index != ChunkSenderLoanContext::INVALID_INDEX, "Allocation with an invalid loan context");
+
+    const auto chunkSettingsResult =
+        mepoo::ChunkSettings::create(userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
+    if (chunkSettingsResult.has_error())
+    {
+        return err(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
+    }
+
+    // the mempools are lock-free, therefore the loan contexts do not need to synchronize with each other
+    auto getChunkResult = getMembers()->m_memoryMgr->getChunk(chunkSettingsResult.value());
+    if (getChunkResult.has_error())
+    {
+        /// @todo iox-#1012 use error<E2>::from(E1); once available
+        return err(into<AllocationError>(getChunkResult.error()));
+    }
+
+    auto& chunk = getChunkResult.value();
+    auto chunkHeader = chunk.getChunkHeader();
+    chunkHeader->setOriginId(originId);
+
+    if (loanContext.m_chunkManagementManagement == nullptr)
+    {
+        // BEGIN of critical section, chunk will be lost if the process terminates in this section
+        auto chunkManagementManagement = tryAllocateChunkManagementManagement();
+        if (chunkManagementManagement == nullptr)
+        {
+            return err(AllocationError::RUNNING_OUT_OF_CHUNKS);
+        }
+        chunkManagementManagement->addChunkManagement(chunk.release());
+        getMembers()->m_loanContexts.store(loanContext.m_index, mepoo::SharedMultiChunk(chunkManagementManagement));
+        // END of critical section
+        loanContext.m_chunkManagementManagement = chunkManagementManagement;
     }
     else
+    {
+        // the sample is stored in the entry of the loan context, hence RouDi takes over the appended chunk as well
+        loanContext.m_chunkManagementManagement->addChunkManagement(chunk.release());
+    }
+
+    return ok(chunkHeader);
+}
+
+template <typename ChunkSenderDataType>
+inline void ChunkSender<ChunkSenderDataType>::release(ChunkSenderLoanContext& loanContext) noexcept
+{
+    // d'tor of SharedMultiChunk will release the memory
+    getMembers()->m_loanContexts.take(loanContext.m_index);
+    loanContext.m_chunkManagementManagement = nullptr;
+}
+
+template <typename ChunkSenderDataType>
+inline uint64_t ChunkSender<ChunkSenderDataType>::send(ChunkSenderLoanContext& loanContext) noexcept
+{
+    if (loanContext.m_chunkManagementManagement == nullptr)
     {
         IOX_REPORT(PoshError::POPO__CHUNK_SENDER_INVALID_CHUNK_TO_SEND_FROM_USER, iox::er::RUNTIME_ERROR);
-        return false;
+        return 0U;
     }
+
+    auto sharedMultiChunk = getMembers()->m_loanContexts.take(loanContext.m_index);
+    loanContext.m_chunkManagementManagement = nullptr;
+
+    sharedMultiChunk.getChunkHeader()->setSequenceNumber(
+        getMembers()->m_sequenceNumber.fetch_add(1U, std::memory_order_relaxed));
+    return this->deliverToAllStoredQueues(sharedMultiChunk, [&] { return serializedCopyOf(sharedMultiChunk); });
+}
+
+template <typename ChunkSenderDataType>
+inline void ChunkSender<ChunkSenderDataType>::setMessageLayout(const MessageLayout& layout,
+                                                               const ChunkSerializer& serializer) noexcept
+{
+    m_serializer = serializer;
+    this->Base_t::setMessageLayout(layout);
 }
 
 template <typename ChunkSenderDataType>
-inline bool ChunkSender<ChunkSenderDataType>::getChunkReadyForSend(std::vector<mepoo::ChunkHeader*>& chunkHeaders
-                                                                   , mepoo::SharedMultiChunk& chunk) noexcept
+inline mepoo::SharedMultiChunk
+ChunkSender<ChunkSenderDataType>::serializedCopyOf(const mepoo::SharedMultiChunk& sample) noexcept
 {
-    if (getMembers()->m_chunksInUse.remove(chunkHeaders, chunk))
+    if (m_serializer.serializedSize == nullptr || m_serializer.serialize == nullptr)
+    {
+        return mepoo::SharedMultiChunk();
+    }
+
+    const auto* sampleChunkHeader = sample.getChunkHeader();
+    const auto serializedSize = m_serializer.serializedSize(sampleChunkHeader);
+    if (!serializedSize.has_value())
+    {
+        return mepoo::SharedMultiChunk();
+    }
+    // the user-header directly follows the chunk-header, hence its alignment never exceeds the one of the chunk-header
+    auto chunkSettingsResult = mepoo::ChunkSettings::create(serializedSize.value(),
+                                                            CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
+                                                            sampleChunkHeader->userHeaderSize(),
+                                                            alignof(mepoo::ChunkHeader));
+    if (chunkSettingsResult.has_error())
+    {
+        return mepoo::SharedMultiChunk();
+    }
+
+    auto getChunkResult = getMembers()->m_memoryMgr->getChunk(chunkSettingsResult.value());
+    if (getChunkResult.has_error())
+    {
+        IOX_LOG(Warn, "No chunk available for the serialized copy of a sample: " << getChunkResult.error());
+        return mepoo::SharedMultiChunk();
+    }
+    auto* chunkManagementManagement = tryAllocateChunkManagementManagement();
+    if (chunkManagementManagement == nullptr)
+    {
+        return mepoo::SharedMultiChunk();
+    }
+
+    auto& chunk = getChunkResult.value();
+    auto* chunkHeader = chunk.getChunkHeader();
+    chunkHeader->setOriginId(sampleChunkHeader->originId());
+    chunkHeader->setSequenceNumber(sampleChunkHeader->sequenceNumber());
+    std::memcpy(chunkHeader->userHeader(), sampleChunkHeader->userHeader(), sampleChunkHeader->userHeaderSize());
+    m_serializer.serialize(sampleChunkHeader, chunkHeader);
+
+    chunkManagementManagement->addChunkManagement(chunk.release());
+    return mepoo::SharedMultiChunk(chunkManagementManagement);
+}
+
+template <typename ChunkSenderDataType>
+inline bool ChunkSender<ChunkSenderDataType>::getChunkReadyForSend(const mepoo::ChunkHeader* const chunkHeader,
+                                                                   mepoo::SharedMultiChunk& chunk) noexcept
+{
+    if (getMembers()->m_chunksInUse.remove(chunkHeader, chunk))
     {
-        chunk.getChunkHeader()->setSequenceNumber(getMembers()->m_sequenceNumber++);
+        chunk.getChunkHeader()->setSequenceNumber(getMembers()->m_sequenceNumber.fetch_add(1U, std::memory_order_relaxed));
         return true;
     }
     else
@@ -22,8 +22,10 @@
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_multi_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
+#include "iceoryx_posh/internal/popo/loan_context_list.hpp"
 #include "iceoryx_posh/internal/popo/used_chunk_list.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
+#include "iox/atomic.hpp"
 #include "iox/not_null.hpp"
 #include "iox/relative_pointer.hpp"
 
@@ -37,15 +39,18 @@ struct ChunkSenderData : public ChunkDistributorDataType
     explicit ChunkSenderData(not_null<mepoo::MemoryManager* const> memoryManager,
                              const ConsumerTooSlowPolicy consumerTooSlowPolicy,
                              const uint64_t historyCapacity = 0U,
-                             const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
+                             const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo(),
+                             const bool recycleAllChunks = false) noexcept;
 
     using ChunkDistributorData_t = ChunkDistributorDataType;
 
     const RelativePointer<mepoo::MemoryManager> m_memoryMgr;
     mepoo::MemoryInfo m_memoryInfo;
     UsedChunkList<MaxChunksAllocatedSimultaneously> m_chunksInUse;
-    mepoo::SequenceNumber_t m_sequenceNumber{0U};
+    LoanContextList<MAX_LOAN_CONTEXTS_PER_PUBLISHER> m_loanContexts;
+    concurrent::Atomic<mepoo::SequenceNumber_t> m_sequenceNumber{0U};
     mepoo::ShmSafeUnmanagedMultiChunk m_lastMultiChunkUnmanaged;
+    bool m_recycleAllChunks{false};
 };
 
 } // namespace popo
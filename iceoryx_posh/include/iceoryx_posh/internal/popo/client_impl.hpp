@@ -19,6 +19,7 @@
 
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/internal/popo/base_client.hpp"
+#include "iceoryx_posh/internal/popo/arena_loan.hpp"
 #include "iceoryx_posh/internal/popo/rpc_interface.hpp"
 #include "iceoryx_posh/internal/popo/typed_port_api_trait.hpp"
 #include "iceoryx_posh/popo/client_options.hpp"
@@ -59,6 +60,23 @@ class ClientImpl : public BaseClientT, private RpcInterface<Request<Req>, Client
     template <typename... Args>
     expected<Request<Req>, AllocationError> loan(Args&&... args) noexcept;
 
+    /// @brief Loans a chunk as block for an arena on which a request is built; the first block starts a new request
+    /// and every further block is added to it, see 'PublisherImpl::loanBlock'
+    /// @param[in] size is the block size requested by the arena
+    /// @param[out] actualSize is the usable size of the loaned block
+    /// @return the block or nullptr if no chunk could be loaned
+    void* loanBlock(size_t size, size_t& actualSize) noexcept;
+
+    /// @brief Returns a block of an arena which loans its blocks via 'loanBlock', see 'PublisherImpl::releaseBlock'
+    /// @param[in] ptr the block as returned by 'loanBlock'
+    void releaseBlock(void* ptr) noexcept;
+
+    /// @brief Wraps a message which was created on an arena that loans its blocks via 'loanBlock' into a Request and
+    /// records the position of the message in the user-header of the first block for the server
+    /// @param[in] userPayload the root message
+    /// @return a Request to send the message or an error if no block was loaned
+    expected<Request<Req>, AllocationError> getRequest(void* userPayload) noexcept;
+
     /// @brief Sends the given Request and then releases its loan.
     /// @param request to send.
     /// @return Error if sending was not successful
@@ -66,6 +84,7 @@ class ClientImpl : public BaseClientT, private RpcInterface<Request<Req>, Client
 
     /// @brief Take the Response from the top of the receive queue.
     /// @return Either a Response or a ChunkReceiveResult.
+    /// @details A response which was built on an arena of the server is located via the user-header of its first chunk.
     /// @details The Response takes care of the cleanup. Don't store the raw pointer to the content of the Response, but
     /// always the whole Response.
     expected<Response<const Res>, ChunkReceiveResult> take() noexcept;
@@ -78,6 +97,9 @@ class ClientImpl : public BaseClientT, private RpcInterface<Request<Req>, Client
 
   private:
     expected<Request<Req>, AllocationError> loanUninitialized() noexcept;
+
+  private:
+    ArenaLoan<RequestHeader> m_arenaLoan;
 };
 } // namespace popo
 } // namespace iox
@@ -19,6 +19,8 @@
 
 #include "iceoryx_posh/internal/popo/client_impl.hpp"
 
+#include <cassert>
+
 namespace iox
 {
 namespace popo
@@ -67,13 +69,62 @@ expected<Request<Req>, AllocationError> ClientImpl<Req, Res, BaseClientT>::loan(
         loanUninitialized().and_then([&](auto& request) { new (request.get()) Req(std::forward<Args>(args)...); }));
 }
 
+template <typename Req, typename Res, typename BaseClientT>
+void* ClientImpl<Req, Res, BaseClientT>::loanBlock(size_t size, size_t& actualSize) noexcept
+{
+    return m_arenaLoan.loanBlock(
+        size,
+        actualSize,
+        [this](const uint64_t blockSize, const uint32_t alignment) -> expected<mepoo::ChunkHeader*, AllocationError> {
+            auto result = port().allocateMultiChunkRequest(blockSize, alignment);
+            if (result.has_error())
+            {
+                return err(result.error());
+            }
+            return ok(result.value()->getChunkHeader());
+        },
+        [this](const uint64_t blockSize, const uint32_t alignment) {
+            return port().allocateRequestChunk(blockSize, alignment);
+        });
+}
+
+template <typename Req, typename Res, typename BaseClientT>
+void ClientImpl<Req, Res, BaseClientT>::releaseBlock(void* ptr) noexcept
+{
+    assert(ptr != nullptr && "block ptr should not be null");
+
+    auto* chunkHeader = m_arenaLoan.releaseBlock(ptr);
+    if (chunkHeader != nullptr)
+    {
+        port().releaseRequest(static_cast<RequestHeader*>(chunkHeader->userHeader()));
+    }
+}
+
+template <typename Req, typename Res, typename BaseClientT>
+expected<Request<Req>, AllocationError> ClientImpl<Req, Res, BaseClientT>::getRequest(void* userPayload) noexcept
+{
+    auto* chunkHeader = m_arenaLoan.setRootMessage(userPayload);
+    if (chunkHeader == nullptr)
+    {
+        IOX_LOG(Error, "The message was not created on an arena which loans its blocks from this client");
+        return err(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
+    }
+
+    // the chunks are owned by the arena until the request is sent, hence nothing to release here
+    return ok(Request<Req>(
+        iox::unique_ptr<Req>(static_cast<Req*>(userPayload), [](Req*) {}), chunkHeader, *this));
+}
+
 template <typename Req, typename Res, typename BaseClientT>
 expected<void, ClientSendError> ClientImpl<Req, Res, BaseClientT>::send(Request<Req>&& request) noexcept
 {
+    // the first chunk identifies the whole request, also when the message was built on an arena
+    auto* chunkHeader = request.getChunkHeader();
+    m_arenaLoan.finish(chunkHeader, ArenaFootprint<Req>::of(*request.get()));
+
     // take the ownership of the chunk from the Request to transfer it to 'sendRequest'
-    auto payload = request.release();
-    auto* requestHeader = static_cast<RequestHeader*>(mepoo::ChunkHeader::fromUserPayload(payload)->userHeader());
-    return port().sendRequest(requestHeader);
+    request.release();
+    return port().sendRequest(static_cast<RequestHeader*>(chunkHeader->userHeader()));
 }
 
 template <typename Req, typename Res, typename BaseClientT>
@@ -85,12 +136,12 @@ expected<Response<const Res>, ChunkReceiveResult> ClientImpl<Req, Res, BaseClien
         return err(result.error());
     }
     auto responseHeader = result.value();
-    auto payload = mepoo::ChunkHeader::fromUserHeader(responseHeader)->userPayload();
-    auto response = iox::unique_ptr<const Res>(static_cast<const Res*>(payload), [this](const Res* payload) {
-        auto* responseHeader = iox::popo::ResponseHeader::fromPayload(payload);
+    auto* chunkHeader = responseHeader->getChunkHeader();
+    auto payload = mepoo::protobufRootMessage<ResponseHeader>(chunkHeader);
+    auto response = iox::unique_ptr<const Res>(static_cast<const Res*>(payload), [this, responseHeader](const Res*) {
         this->port().releaseResponse(responseHeader);
     });
-    return ok(Response<const Res>{std::move(response)});
+    return ok(Response<const Res>{std::move(response), chunkHeader});
 }
 
 } // namespace popo
@@ -0,0 +1,266 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_LAZY_MESSAGE_VIEW_INL
+#define IOX_POSH_POPO_LAZY_MESSAGE_VIEW_INL
+
+#include "iceoryx_posh/popo/lazy_message_view.hpp"
+
+#include <limits>
+
+namespace iox
+{
+namespace popo
+{
+namespace internal
+{
+/// @brief Field parser for google::protobuf::internal::WireFormatParser which skips every field
+class ProtobufFieldSkipper
+{
+  public:
+    using ParseContext = google::protobuf::internal::ParseContext;
+
+    void AddVarint(const uint32_t, const uint64_t) noexcept
+    {
+    }
+
+    void AddFixed64(const uint32_t, const uint64_t) noexcept
+    {
+    }
+
+    void AddFixed32(const uint32_t, const uint32_t) noexcept
+    {
+    }
+
+    const char* ParseLengthDelimited(const uint32_t, const char* ptr, ParseContext* ctx) noexcept
+    {
+        const auto size = google::protobuf::internal::ReadSize(&ptr);
+        return (ptr == nullptr) ? nullptr : ctx->Skip(ptr, static_cast<int>(size));
+    }
+
+    const char* ParseGroup(const uint32_t fieldNumber, const char* ptr, ParseContext* ctx) noexcept
+    {
+        constexpr uint32_t WIRETYPE_START_GROUP{3U};
+        return ctx->ParseGroup(this, ptr, (fieldNumber << 3U) | WIRETYPE_START_GROUP);
+    }
+
+    // NOLINTNEXTLINE(readability-identifier-naming) called by ParseContext::ParseGroup
+    const char* _InternalParse(const char* ptr, ParseContext* ctx) noexcept
+    {
+        return google::protobuf::internal::WireFormatParser(*this, ptr, ctx);
+    }
+};
+} // namespace internal
+
+inline constexpr const char* asStringLiteral(const LazyMessageViewError value) noexcept
+{
+    switch (value)
+    {
+    case LazyMessageViewError::MALFORMED_MESSAGE:
+        return "LazyMessageViewError::MALFORMED_MESSAGE";
+    case LazyMessageViewError::MALFORMED_FIELD:
+        return "LazyMessageViewError::MALFORMED_FIELD";
+    }
+
+    return "[Undefined LazyMessageViewError]";
+}
+
+inline std::ostream& operator<<(std::ostream& stream, LazyMessageViewError value) noexcept
+{
+    stream << asStringLiteral(value);
+    return stream;
+}
+
+inline log::LogStream& operator<<(log::LogStream& stream, LazyMessageViewError value) noexcept
+{
+    stream << asStringLiteral(value);
+    return stream;
+}
+
+template <typename T, uint64_t Capacity>
+inline LazyMessageView<T, Capacity>::LazyMessageView(const void* const data, const uint64_t size) noexcept
+    : m_data(static_cast<const char*>(data))
+    , m_size(size)
+{
+    scan();
+}
+
+template <typename T, uint64_t Capacity>
+template <typename OnField>
+inline bool LazyMessageView<T, Capacity>::forEachField(const uint32_t begin, const OnField& onField) const noexcept
+{
+    using google::protobuf::internal::ParseContext;
+
+    const uint64_t size{m_size - begin};
+    const char* ptr{nullptr};
+    ParseContext ctx(google::protobuf::io::CodedInputStream::GetDefaultRecursionLimit(),
+                     false,
+                     &ptr,
+                     google::protobuf::StringPiece(m_data + begin, size));
+    // the remaining bytes are tracked across the buffer flips of the stream, in contrast to the pointer itself
+    auto offset = [&](const char* position) {
+        return static_cast<uint32_t>(m_size - static_cast<uint64_t>(ctx.BytesUntilLimit(position)));
+    };
+    internal::ProtobufFieldSkipper skipper;
+
+    while (!ctx.Done(&ptr))
+    {
+        const auto fieldBegin = offset(ptr);
+        uint32_t tag{0U};
+        ptr = google::protobuf::internal::ReadTag(ptr, &tag);
+        constexpr uint32_t WIRETYPE_MASK{7U};
+        constexpr uint32_t WIRETYPE_END_GROUP{4U};
+        if (ptr == nullptr || tag == 0U || (tag & WIRETYPE_MASK) == WIRETYPE_END_GROUP)
+        {
+            return false;
+        }
+        ptr = google::protobuf::internal::FieldParser(tag, skipper, ptr, &ctx);
+        if (ptr == nullptr)
+        {
+            return false;
+        }
+        if (!onField(tag >> 3U, fieldBegin, offset(ptr)))
+        {
+            return true;
+        }
+    }
+
+    // a field which overruns the end of the message leaves no valid position
+    return ptr != nullptr;
+}
+
+template <typename T, uint64_t Capacity>
+inline void LazyMessageView<T, Capacity>::scan() noexcept
+{
+    if (m_size > static_cast<uint64_t>(std::numeric_limits<int32_t>::max()))
+    {
+        m_isMalformed = true;
+        return;
+    }
+    m_wholeMessage.end = static_cast<uint32_t>(m_size);
+
+    m_isMalformed = !forEachField(0U, [this](const uint32_t fieldNumber, const uint32_t begin, const uint32_t end) {
+        if (!m_ranges.empty() && m_ranges.back().fieldNumber == fieldNumber && m_ranges.back().end == begin)
+        {
+            m_ranges.back().end = end;
+            return true;
+        }
+        if (!m_ranges.emplace_back(FieldRange{fieldNumber, begin, end, false}))
+        {
+            // the whole message is parsed on the first access, which also validates the remainder
+            m_exceedsCapacity = true;
+            m_remainderBegin = begin;
+            return false;
+        }
+        return true;
+    });
+}
+
+template <typename T, uint64_t Capacity>
+inline bool LazyMessageView<T, Capacity>::parse(FieldRange& range) noexcept
+{
+    using google::protobuf::internal::ParseContext;
+
+    const char* ptr{nullptr};
+    ParseContext ctx(google::protobuf::io::CodedInputStream::GetDefaultRecursionLimit(),
+                     false,
+                     &ptr,
+                     google::protobuf::StringPiece(m_data + range.begin, range.end - range.begin));
+    ptr = m_message._InternalParse(ptr, &ctx);
+    range.isParsed = (ptr != nullptr && ctx.EndedAtLimit());
+    return range.isParsed;
+}
+
+template <typename T, uint64_t Capacity>
+inline bool LazyMessageView<T, Capacity>::has(const uint32_t fieldNumber) const noexcept
+{
+    for (const auto& range : m_ranges)
+    {
+        if (range.fieldNumber == fieldNumber)
+        {
+            return true;
+        }
+    }
+    if (!m_exceedsCapacity)
+    {
+        return false;
+    }
+
+    bool isFound{false};
+    forEachField(m_remainderBegin, [&](const uint32_t number, const uint32_t, const uint32_t) {
+        isFound = (number == fieldNumber);
+        return !isFound;
+    });
+    return isFound;
+}
+
+template <typename T, uint64_t Capacity>
+inline expected<const T*, LazyMessageViewError> LazyMessageView<T, Capacity>::get(const uint32_t fieldNumber) noexcept
+{
+    if (m_isMalformed)
+    {
+        return err(LazyMessageViewError::MALFORMED_MESSAGE);
+    }
+    if (m_exceedsCapacity)
+    {
+        return getAll();
+    }
+
+    for (auto& range : m_ranges)
+    {
+        if (range.fieldNumber == fieldNumber && !range.isParsed && !parse(range))
+        {
+            return err(LazyMessageViewError::MALFORMED_FIELD);
+        }
+    }
+    return ok(static_cast<const T*>(&m_message));
+}
+
+template <typename T, uint64_t Capacity>
+inline expected<const T*, LazyMessageViewError> LazyMessageView<T, Capacity>::getAll() noexcept
+{
+    if (m_isMalformed)
+    {
+        return err(LazyMessageViewError::MALFORMED_MESSAGE);
+    }
+
+    if (m_exceedsCapacity)
+    {
+        if (!m_wholeMessage.isParsed)
+        {
+            m_message.Clear();
+            if (!parse(m_wholeMessage))
+            {
+                return err(LazyMessageViewError::MALFORMED_MESSAGE);
+            }
+        }
+        return ok(static_cast<const T*>(&m_message));
+    }
+
+    for (auto& range : m_ranges)
+    {
+        if (!range.isParsed && !parse(range))
+        {
+            return err(LazyMessageViewError::MALFORMED_FIELD);
+        }
+    }
+    return ok(static_cast<const T*>(&m_message));
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_LAZY_MESSAGE_VIEW_INL
@@ -0,0 +1,96 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_LOAN_CONTEXT_LIST_HPP
+#define IOX_POSH_POPO_LOAN_CONTEXT_LIST_HPP
+
+#include "iceoryx_posh/internal/mepoo/shared_multi_chunk.hpp"
+#include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_multi_chunk.hpp"
+#include "iox/detail/mpmc_loffli.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief This class keeps track of the samples which are assembled in the loan contexts of a ChunkSender.
+///        Like the UsedChunkList it is used by RouDi to retain ownership of the chunks when the application
+///        terminates while assembling a sample. In contrast to the UsedChunkList, each entry is owned by exactly one
+///        loan context, which might live on any thread. The entries are claimed and returned with a lock-free
+///        free-list and an entry is only written by the thread which currently owns it, hence no lock is required.
+template <uint32_t Capacity>
+class LoanContextList
+{
+    static_assert(Capacity > 0, "LoanContextList Capacity must be larger than 0!");
+
+  public:
+    /// @brief Constructs a LoanContextList with all entries being available
+    LoanContextList() noexcept;
+
+    LoanContextList(const LoanContextList&) = delete;
+    LoanContextList(LoanContextList&&) = delete;
+    LoanContextList& operator=(const LoanContextList&) = delete;
+    LoanContextList& operator=(LoanContextList&&) = delete;
+    ~LoanContextList() noexcept = default;
+
+    /// @brief Claims an entry for a loan context
+    /// @param[out] index of the claimed entry
+    /// @return true if an entry was available, otherwise false
+    /// @note thread-safe and lock-free
+    bool acquire(uint32_t& index) noexcept;
+
+    /// @brief Returns an entry which was claimed with 'acquire'; a sample which is still stored in it is released
+    /// @param[in] index of the entry to return
+    /// @note thread-safe and lock-free; only from the thread which owns the entry
+    void release(const uint32_t index) noexcept;
+
+    /// @brief Stores the sample which is assembled in the loan context; further chunks can be added to its
+    /// ChunkManagementManagement while it is stored
+    /// @param[in] index of the entry owned by the loan context
+    /// @param[in] chunk the sample to store; the entry must be empty
+    /// @note only from the thread which owns the entry
+    void store(const uint32_t index, mepoo::SharedMultiChunk chunk) noexcept;
+
+    /// @brief Takes the sample out of an entry
+    /// @param[in] index of the entry owned by the loan context
+    /// @return the stored sample or an empty SharedMultiChunk if there is none
+    /// @note only from the thread which owns the entry
+    mepoo::SharedMultiChunk take(const uint32_t index) noexcept;
+
+    /// @brief Cleans up all the remaining chunks and makes all entries available again
+    /// @note from RouDi context once the applications walked the plank. It is unsafe to call this if the application is
+    /// still running.
+    void cleanup() noexcept;
+
+  private:
+    void init() noexcept;
+
+  private:
+    using DataElement_t = mepoo::ShmSafeUnmanagedMultiChunk;
+    using FreeList_t = concurrent::MpmcLoFFLi;
+
+    FreeList_t::Index_t m_freeListStorage[FreeList_t::requiredIndexMemorySize(Capacity) / sizeof(FreeList_t::Index_t)];
+    FreeList_t m_freeList;
+    DataElement_t m_listData[Capacity];
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/loan_context_list.inl"
+
+#endif // IOX_POSH_POPO_LOAN_CONTEXT_LIST_HPP
@@ -0,0 +1,107 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_LOAN_CONTEXT_LIST_INL
+#define IOX_POSH_POPO_LOAN_CONTEXT_LIST_INL
+
+#include "iceoryx_posh/internal/popo/loan_context_list.hpp"
+#include "iox/assertions.hpp"
+
+#include <atomic>
+#include <new>
+
+namespace iox
+{
+namespace popo
+{
+template <uint32_t Capacity>
+inline LoanContextList<Capacity>::LoanContextList() noexcept
+{
+    static_assert(sizeof(DataElement_t) <= 8U, "The size of the data element type must not exceed 64 bit!");
+    static_assert(std::is_trivially_copyable<DataElement_t>::value,
+                  "The data element type must be trivially copyable!");
+
+    init();
+}
+
+template <uint32_t Capacity>
+inline bool LoanContextList<Capacity>::acquire(uint32_t& index) noexcept
+{
+    return m_freeList.pop(index);
+}
+
+template <uint32_t Capacity>
+inline void LoanContextList<Capacity>::release(const uint32_t index) noexcept
+{
+    IOX_ENFORCE(index < Capacity, "Index of the loan context out of range");
+
+    // d'tor of SharedMultiChunk releases an abandoned sample
+    take(index);
+    IOX_ENFORCE(m_freeList.push(index), "Returning a loan context which was not acquired");
+}
+
+template <uint32_t Capacity>
+inline void LoanContextList<Capacity>::store(const uint32_t index, mepoo::SharedMultiChunk chunk) noexcept
+{
+    IOX_ENFORCE(index < Capacity, "Index of the loan context out of range");
+    IOX_ENFORCE(m_listData[index].isLogicalNullptr(), "The loan context already holds a sample");
+
+    m_listData[index] = DataElement_t(chunk);
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+template <uint32_t Capacity>
+inline mepoo::SharedMultiChunk LoanContextList<Capacity>::take(const uint32_t index) noexcept
+{
+    IOX_ENFORCE(index < Capacity, "Index of the loan context out of range");
+
+    auto chunk = m_listData[index].releaseToSharedChunk();
+    std::atomic_thread_fence(std::memory_order_release);
+    return chunk;
+}
+
+template <uint32_t Capacity>
+inline void LoanContextList<Capacity>::cleanup() noexcept
+{
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    for (auto& data : m_listData)
+    {
+        // release ownership by creating a SharedMultiChunk
+        data.releaseToSharedChunk();
+    }
+
+    init();
+}
+
+template <uint32_t Capacity>
+inline void LoanContextList<Capacity>::init() noexcept
+{
+    // the free-list has no reset, therefore it is recreated to make all entries available again
+    m_freeList.~FreeList_t();
+    new (&m_freeList) FreeList_t();
+    m_freeList.init(m_freeListStorage, Capacity);
+
+    for (auto& data : m_listData)
+    {
+        data = DataElement_t();
+    }
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_LOAN_CONTEXT_LIST_INL
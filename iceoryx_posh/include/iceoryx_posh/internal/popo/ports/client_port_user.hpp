@@ -81,9 +81,30 @@ class ClientPortUser : public BasePort
     /// @param[in] userPayloadAlignment, alignment of the user-paylaod without additional headers
     /// @return on success pointer to a RequestHeader which can be used to access the chunk-header, user-header and
     /// user-payload fields, error if not
+    /// @note the RequestHeader is embedded in a 'ProtobufUserHeader' which records the position of a message that is
+    /// built on an arena
+    /// @note the request consists of a single chunk; a request which is assembled with 'allocateMultiChunkRequest' at
+    /// the same time is not affected
     expected<RequestHeader*, AllocationError> allocateRequest(const uint64_t userPayloadSize,
                                                               const uint32_t userPayloadAlignment) noexcept;
 
+    /// @brief Allocate the first chunk of a request which is assembled from several chunks, e.g. from the blocks of the
+    /// arena the request is built on; further chunks are added with 'allocateRequestChunk' until the request is sent
+    /// or released
+    /// @param[in] userPayloadSize, size of the user-paylaod without additional headers
+    /// @param[in] userPayloadAlignment, alignment of the user-paylaod without additional headers
+    /// @return on success pointer to the RequestHeader of the first chunk, error if not
+    expected<RequestHeader*, AllocationError> allocateMultiChunkRequest(const uint64_t userPayloadSize,
+                                                                        const uint32_t userPayloadAlignment) noexcept;
+
+    /// @brief Allocate a further chunk for the request which is assembled since 'allocateMultiChunkRequest', e.g. as an
+    /// additional block of the arena the request is built on; the chunk is sent or released together with the request
+    /// @param[in] userPayloadSize, size of the user-paylaod without additional headers
+    /// @param[in] userPayloadAlignment, alignment of the user-paylaod without additional headers
+    /// @return on success pointer to the ChunkHeader of the new chunk, error if not
+    expected<mepoo::ChunkHeader*, AllocationError> allocateRequestChunk(const uint64_t userPayloadSize,
+                                                                        const uint32_t userPayloadAlignment) noexcept;
+
     /// @brief Releases an allocated request without sending it
     /// @param[in] requestHeader, pointer to the RequestHeader to free
     void releaseRequest(const RequestHeader* const requestHeader) noexcept;
@@ -143,6 +164,11 @@ class ClientPortUser : public BasePort
     bool isConditionVariableSet() const noexcept;
 
   private:
+    using ProtobufRequestHeader_t = mepoo::ProtobufUserHeader<RequestHeader>;
+
+    expected<RequestHeader*, AllocationError>
+    initializeRequestHeader(const expected<mepoo::ChunkHeader*, AllocationError>& allocateResult) noexcept;
+
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
@@ -62,15 +62,30 @@ class PublisherPortUser : public BasePort
                                                                     const uint32_t userHeaderSize = 0U,
                                                                     const uint32_t userHeaderAlignment = 1U) noexcept;
 
+    /// @brief Allocate a chunk which carries a sample of its own, like 'tryAllocateChunk'; a sample which is assembled
+    /// from several chunks at the same time, e.g. by an arena, is not touched
+    /// @param[in] userPayloadSize, size of the user-payload without additional headers
+    /// @param[in] userPayloadAlignment, alignment of the user-payload
+    /// @param[in] userHeaderSize, size of the user-header; use iox::CHUNK_NO_USER_HEADER_SIZE to omit a user-header
+    /// @param[in] userHeaderAlignment, alignment of the user-header; use iox::CHUNK_NO_USER_HEADER_ALIGNMENT
+    /// to omit a user-header
+    /// @return on success pointer to a ChunkHeader which can be used to access the chunk-header, user-header and
+    /// user-payload fields, error if not
+    expected<mepoo::ChunkHeader*, AllocationError>
+    tryAllocateSingleChunk(const uint64_t userPayloadSize,
+                           const uint32_t userPayloadAlignment,
+                           const uint32_t userHeaderSize = 0U,
+                           const uint32_t userHeaderAlignment = 1U) noexcept;
+
     mepoo::ChunkManagementManagement* tryAllocateChunkManagementManagement() noexcept;
 
-    /// @brief Free an allocated chunk without sending it
-    /// @param[in] chunkHeader, pointer to the ChunkHeader to free
-    void releaseChunk(std::vector<mepoo::ChunkHeader*>& chunkHeaders) noexcept;
+    /// @brief Free all allocated chunks of a sample without sending them; the next allocation starts a new sample
+    /// @param[in] chunkHeader, pointer to the ChunkHeader of the first chunk of the sample
+    void releaseChunk(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
-    /// @brief Send an allocated chunk to all connected subscriber ports
-    /// @param[in] chunkHeader, pointer to the ChunkHeader to send
-    void sendChunk(std::vector<mepoo::ChunkHeader*>& chunkHeaders) noexcept;
+    /// @brief Send an allocated sample with all its chunks to all connected subscriber ports
+    /// @param[in] chunkHeader, pointer to the ChunkHeader of the first chunk of the sample
+    void sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
     /// @brief Returns the last sent chunk if there is one
     /// @return pointer to the ChunkHeader of the last sent Chunk if there is one, empty optional if not
@@ -92,6 +107,46 @@ class PublisherPortUser : public BasePort
 
     void resetChunkManagementManagement() noexcept;
 
+    /// @brief Claims a loan context in which a sample can be assembled and sent independently of the other loan
+    /// contexts, e.g. one per thread
+    /// @return the loan context or an error if all loan contexts of the publisher are in use
+    expected<ChunkSenderLoanContext, AllocationError> tryAcquireLoanContext() noexcept;
+
+    /// @brief Returns a loan context; a sample which is still assembled in it is released
+    /// @param[in] loanContext to return
+    void releaseLoanContext(ChunkSenderLoanContext& loanContext) noexcept;
+
+    /// @brief Allocate a chunk for the sample which is assembled in the loan context
+    /// @param[in] loanContext in which the sample is assembled
+    /// @param[in] userPayloadSize, size of the user-payload without additional headers
+    /// @param[in] userPayloadAlignment, alignment of the user-payload
+    /// @param[in] userHeaderSize, size of the user-header
+    /// @param[in] userHeaderAlignment, alignment of the user-header
+    /// @return on success pointer to the ChunkHeader of the new chunk, error if not
+    expected<mepoo::ChunkHeader*, AllocationError> tryAllocateChunk(ChunkSenderLoanContext& loanContext,
+                                                                    const uint64_t userPayloadSize,
+                                                                    const uint32_t userPayloadAlignment,
+                                                                    const uint32_t userHeaderSize = 0U,
+                                                                    const uint32_t userHeaderAlignment = 1U) noexcept;
+
+    /// @brief Free all chunks of the sample which is assembled in the loan context without sending them
+    /// @param[in] loanContext in which the sample is assembled
+    void releaseChunk(ChunkSenderLoanContext& loanContext) noexcept;
+
+    /// @brief Send the sample which is assembled in the loan context to all connected subscriber ports; if the port
+    /// is not offered, the sample is released
+    /// @param[in] loanContext in which the sample is assembled
+    void sendChunk(ChunkSenderLoanContext& loanContext) noexcept;
+
+    /// @brief Declares the samples of this port as layout dependent, i.e. subscribers of a process with a different
+    /// 'MessageLayout' get a serialized copy of them; must be called before the port is offered
+    /// @param[in] abiHash of the message type, see 'MessageLayout'
+    /// @param[in] isRelocatable is true if the pointers inside of the samples are relocated when they are read, see
+    /// 'MessageLayout::create'
+    /// @param[in] serializer which creates the serialized copy of a sample
+    void
+    setMessageLayout(const uint64_t abiHash, const bool isRelocatable, const ChunkSerializer& serializer) noexcept;
+
   private:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
@@ -134,10 +134,34 @@ class ServerPortUser : public BasePort
     /// @param[in] userPayloadAlignment, alignment of the user user-paylaod without additional headers
     /// @return on success pointer to a ChunkHeader which can be used to access the chunk-header, user-header and
     /// user-payload fields, error if not
+    /// @note the ResponseHeader is embedded in a 'ProtobufUserHeader' which records the position of a message that is
+    /// built on an arena
+    /// @note the response consists of a single chunk; a response which is assembled with 'allocateMultiChunkResponse'
+    /// at the same time is not affected
     expected<ResponseHeader*, AllocationError> allocateResponse(const RequestHeader* const requestHeader,
                                                                 const uint64_t userPayloadSize,
                                                                 const uint32_t userPayloadAlignment) noexcept;
 
+    /// @brief Allocate the first chunk of a response which is assembled from several chunks, e.g. from the blocks of
+    /// the arena the response is built on; further chunks are added with 'allocateResponseChunk' until the response is
+    /// sent or released
+    /// @param[in] requestHeader, the request header for the corresponding response
+    /// @param[in] userPayloadSize, size of the user user-paylaod without additional headers
+    /// @param[in] userPayloadAlignment, alignment of the user user-paylaod without additional headers
+    /// @return on success pointer to the ResponseHeader of the first chunk, error if not
+    expected<ResponseHeader*, AllocationError> allocateMultiChunkResponse(const RequestHeader* const requestHeader,
+                                                                          const uint64_t userPayloadSize,
+                                                                          const uint32_t userPayloadAlignment) noexcept;
+
+    /// @brief Allocate a further chunk for the response which is assembled since 'allocateMultiChunkResponse', e.g. as
+    /// an additional block of the arena the response is built on; the chunk is sent or released together with the
+    /// response
+    /// @param[in] userPayloadSize, size of the user user-paylaod without additional headers
+    /// @param[in] userPayloadAlignment, alignment of the user user-paylaod without additional headers
+    /// @return on success pointer to the ChunkHeader of the new chunk, error if not
+    expected<mepoo::ChunkHeader*, AllocationError> allocateResponseChunk(const uint64_t userPayloadSize,
+                                                                         const uint32_t userPayloadAlignment) noexcept;
+
     /// @brief Releases an allocated response without sending it
     /// @param[in] chunkHeader, pointer to the ChunkHeader to free
     void releaseResponse(const ResponseHeader* const responseHeader) noexcept;
@@ -173,6 +197,12 @@ class ServerPortUser : public BasePort
     bool isConditionVariableSet() const noexcept;
 
   private:
+    using ProtobufResponseHeader_t = mepoo::ProtobufUserHeader<ResponseHeader>;
+
+    expected<ResponseHeader*, AllocationError>
+    initializeResponseHeader(const RequestHeader* const requestHeader,
+                             const expected<mepoo::ChunkHeader*, AllocationError>& allocateResult) noexcept;
+
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
@@ -50,6 +50,11 @@ class SubscriberPortRouDi : public BasePort
     /// @return subscriber options
     const SubscriberOptions& getOptions() const noexcept;
 
+    /// @brief Indicates whether the subscriber announced a 'MessageLayout' and therefore gets a serialized copy of the
+    /// messages it cannot read in place
+    /// @return true if the subscriber can receive serialized copies, false if it reads all messages in place
+    bool receivesSerializedCopies() const noexcept;
+
     /// @brief get an optional CaPro message that requests changes to the subscription state of the subscriber
     /// @return CaPro message with new subscription requet, empty optional if no state change
     virtual optional<capro::CaproMessage> tryGetCaProMessage() noexcept = 0;
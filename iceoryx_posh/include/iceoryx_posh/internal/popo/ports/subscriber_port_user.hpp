@@ -61,15 +61,15 @@ class SubscriberPortUser : public BasePort
     /// @return SubscribeState
     SubscribeState getSubscriptionState() const noexcept;
 
-    /// @brief Tries to get the next chunk from the queue. If there is a new one, the ChunkHeader of the oldest chunk in
-    /// the queue is returned (FiFo queue)
-    /// @return New chunk header, ChunkReceiveResult on error
+    /// @brief Tries to get the next sample from the queue. If there is a new one, a view on the ChunkHeaders of the
+    /// oldest sample in the queue is returned (FiFo queue)
+    /// @return New chunk headers, ChunkReceiveResult on error
     /// or if there are no new chunks in the underlying queue
-    expected<std::vector<mepoo::ChunkHeader*>, ChunkReceiveResult> tryGetChunkHeaders() noexcept;
+    expected<mepoo::ChunkHeaderView, ChunkReceiveResult> tryGetChunkHeaders() noexcept;
 
-    /// @brief Release a chunk that was obtained with tryGetChunk
-    /// @param[in] chunkHeader, pointer to the ChunkHeader to release
-    void releaseChunk(std::vector<mepoo::ChunkHeader*>& chunkHeaders) noexcept;
+    /// @brief Release a sample that was obtained with tryGetChunkHeaders
+    /// @param[in] chunkHeader, pointer to the ChunkHeader of the first chunk of the sample
+    void releaseChunk(const mepoo::ChunkHeader* const chunkHeader) noexcept;
 
     /// @brief Release all the chunks that are currently queued up.
     void releaseQueuedChunks() noexcept;
@@ -92,6 +92,18 @@ class SubscriberPortUser : public BasePort
     /// @return true if a condition variable attached, otherwise false
     bool isConditionVariableSet() noexcept;
 
+    /// @brief Announces the 'MessageLayout' in which this process can read messages in place; publishers of layout
+    /// dependent messages deliver a serialized copy if their layout differs. Must be called before subscribing
+    /// @param[in] abiHash of the message type, see 'MessageLayout'
+    /// @param[in] isRelocatable is true if the pointers inside of the messages are relocated when they are read, see
+    /// 'MessageLayout::create'
+    void setMessageLayout(const uint64_t abiHash, const bool isRelocatable) noexcept;
+
+    /// @brief Announces that this process reads layout dependent messages as serialized copies only, see
+    /// 'MessageLayout::serializedOnly'. Must be called before subscribing
+    /// @param[in] abiHash of the message type, see 'MessageLayout'
+    void setSerializedMessageLayout(const uint64_t abiHash) noexcept;
+
   private:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
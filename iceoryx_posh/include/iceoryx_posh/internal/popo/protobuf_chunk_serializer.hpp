@@ -0,0 +1,150 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_PROTOBUF_CHUNK_SERIALIZER_HPP
+#define IOX_POSH_POPO_PROTOBUF_CHUNK_SERIALIZER_HPP
+
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_sender.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/popo/message_layout.hpp"
+#include "iox/optional.hpp"
+#include "iox/type_traits.hpp"
+
+#include <google/protobuf/message_lite.h>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace iox
+{
+namespace popo
+{
+namespace internal
+{
+template <typename T, typename = void>
+struct HasSchemaFingerprint : std::false_type
+{
+};
+
+/// @brief protoc with the iceoryx plugin generates 'IceoryxSchemaFingerprint' next to the message class; it is found
+/// via argument dependent lookup
+template <typename T>
+struct HasSchemaFingerprint<T, void_t<decltype(IceoryxSchemaFingerprint(std::declval<const T*>()))>> : std::true_type
+{
+};
+
+template <typename T>
+inline uint64_t schemaFingerprint(std::true_type) noexcept
+{
+    return IceoryxSchemaFingerprint(static_cast<const T*>(nullptr));
+}
+
+template <typename T>
+inline uint64_t schemaFingerprint(std::false_type) noexcept
+{
+    return MessageLayout::LAYOUT_INDEPENDENT;
+}
+} // namespace internal
+
+/// @brief The generated code relocates the pointers inside of an arena-built message when it is read at another
+/// address, therefore the 'MessageLayout' of protobuf messages does not depend on the addresses of the payload segments
+constexpr bool PROTOBUF_MESSAGES_ARE_RELOCATABLE{true};
+
+/// @brief Computes the ABI hash of a protobuf message type for its 'MessageLayout'. Processes with the same protobuf
+/// version and the same generated message class can read a message of the type built by the other in place.
+/// @details The hash covers the schema fingerprint which protoc computed from the fields of the message and all of its
+/// submessages, the protobuf version and the arena representation version of the generated code and of the protobuf
+/// runtime of this process and the size and alignment of the message class as seen by the compiler of this process.
+/// An equal hash only means that the data members of a message can be read in place; its virtual functions dispatch
+/// through the vtable of the process which built it and are never safe to call on a message of another process.
+/// @tparam T protobuf message type
+/// @return the ABI hash of the message type
+template <typename T>
+inline uint64_t protobufAbiHash() noexcept
+{
+    static const uint64_t abiHash = [] {
+        uint64_t hash = MessageLayout::ABI_HASH_SEED;
+        hash = MessageLayout::addToAbiHash(hash, internal::schemaFingerprint<T>(internal::HasSchemaFingerprint<T>{}));
+        hash = MessageLayout::addToAbiHash(hash, GOOGLE_PROTOBUF_VERSION);
+        hash = MessageLayout::addToAbiHash(hash, google::protobuf::internal::kArenaRepresentationVersion);
+        hash = MessageLayout::addToAbiHash(hash, sizeof(T));
+        hash = MessageLayout::addToAbiHash(hash, alignof(T));
+        hash = MessageLayout::addToAbiHash(hash, sizeof(std::string));
+        for (const char c : T::default_instance().GetTypeName())
+        {
+            hash = MessageLayout::addToAbiHash(hash, static_cast<uint64_t>(c));
+        }
+        return (hash == MessageLayout::LAYOUT_INDEPENDENT) ? hash + 1U : hash;
+    }();
+    return abiHash;
+}
+
+/// @brief Serializes protobuf messages which were built on an arena in the chunks of a 'ProtobufPublisher' for
+/// subscribers which cannot read them in place. Messages which were already published serialized are forwarded as
+/// they are; samples without a 'ProtobufUserHeader', e.g. from 'loanSample' or 'publishCopyOf', cannot be marked as
+/// serialized and are not serialized.
+/// @tparam T protobuf message type
+/// @tparam H user header type
+template <typename T, typename H>
+struct ProtobufChunkSerializer
+{
+    using ProtobufUserHeader_t = mepoo::ProtobufUserHeader<H>;
+
+    static optional<uint64_t> serializedSize(const mepoo::ChunkHeader* const sample) noexcept
+    {
+        if (mepoo::protobufUserHeader<H>(sample) == nullptr)
+        {
+            return nullopt;
+        }
+        auto serializedSize = mepoo::protobufSerializedSize<H>(sample);
+        if (serializedSize.has_value())
+        {
+            return serializedSize;
+        }
+        return static_cast<const T*>(mepoo::protobufRootMessage<H>(sample))->ByteSizeLong();
+    }
+
+    static void serialize(const mepoo::ChunkHeader* const sample, mepoo::ChunkHeader* const target) noexcept
+    {
+        // the user-header was copied from the sample, hence a serialized message is already marked as such
+        if (mepoo::protobufSerializedSize<H>(sample).has_value())
+        {
+            std::memcpy(target->userPayload(), sample->userPayload(), target->userPayloadSize());
+            return;
+        }
+
+        // 'serializedSize' was called right before and cached the sizes of all submessages
+        static_cast<const T*>(mepoo::protobufRootMessage<H>(sample))
+            ->SerializeWithCachedSizesToArray(static_cast<uint8_t*>(target->userPayload()));
+
+        auto* protobufUserHeader = static_cast<ProtobufUserHeader_t*>(target->userHeader());
+        protobufUserHeader->m_rootMessageOffset = ProtobufUserHeader_t::NO_ROOT_MESSAGE;
+        protobufUserHeader->m_serializedSize = target->userPayloadSize();
+    }
+
+    static ChunkSerializer create() noexcept
+    {
+        return ChunkSerializer{&serializedSize, &serialize};
+    }
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_PROTOBUF_CHUNK_SERIALIZER_HPP
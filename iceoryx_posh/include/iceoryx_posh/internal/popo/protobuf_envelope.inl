@@ -0,0 +1,161 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_PROTOBUF_ENVELOPE_INL
+#define IOX_POSH_POPO_PROTOBUF_ENVELOPE_INL
+
+#include "iceoryx_posh/popo/protobuf_envelope.hpp"
+
+#include <type_traits>
+#include <utility>
+
+namespace iox
+{
+namespace popo
+{
+template <typename... Ts>
+template <typename T>
+inline constexpr uint32_t ProtobufEnvelope<Ts...>::typeId() noexcept
+{
+    static_assert((std::is_same<T, Ts>::value || ...), "The message type is not part of the envelope");
+
+    constexpr bool IS_TYPE[]{std::is_same<T, Ts>::value...};
+    uint32_t id{0U};
+    while (!IS_TYPE[id])
+    {
+        ++id;
+    }
+    return id;
+}
+
+template <typename... Ts>
+inline uint64_t ProtobufEnvelope<Ts...>::abiHash() noexcept
+{
+    static const uint64_t abiHash = [] {
+        uint64_t hash = MessageLayout::ABI_HASH_SEED;
+        ((hash = MessageLayout::addToAbiHash(hash, protobufAbiHash<Ts>())), ...);
+        return (hash == MessageLayout::LAYOUT_INDEPENDENT) ? hash + 1U : hash;
+    }();
+    return abiHash;
+}
+
+template <typename... Ts>
+inline ProtobufEnvelopePublisher<ProtobufEnvelope<Ts...>>::ProtobufEnvelopePublisher(
+    const capro::ServiceDescription& service, const PublisherOptions& publisherOptions) noexcept
+    : ProtobufPublisher(service,
+                        publisherOptions,
+                        Envelope::abiHash(),
+                        ProtobufChunkSerializer<google::protobuf::MessageLite, ProtobufEnvelopeHeader>::create())
+{
+}
+
+template <typename... Ts>
+template <typename T>
+inline expected<ProtobufLoan<T, ProtobufEnvelopeHeader, google::protobuf::MessageLite>, AllocationError>
+ProtobufEnvelopePublisher<ProtobufEnvelope<Ts...>>::loan() noexcept
+{
+    constexpr uint32_t TYPE_ID{Envelope::template typeId<T>()};
+    auto result = this->template loanMessage<T>();
+    if (result.has_value())
+    {
+        result.value().getUserHeader().m_typeId = TYPE_ID;
+    }
+    return result;
+}
+
+template <typename... Ts>
+inline ProtobufEnvelopeSubscriber<ProtobufEnvelope<Ts...>>::ProtobufEnvelopeSubscriber(
+    const capro::ServiceDescription& service,
+    const SubscriberOptions& subscriberOptions,
+    const ProtobufDelivery delivery) noexcept
+    : ProtobufSubscriber(service, subscriberOptions, Envelope::abiHash(), delivery)
+{
+}
+
+template <typename... Ts>
+inline expected<ProtobufEnvelopeSample, ChunkReceiveResult>
+ProtobufEnvelopeSubscriber<ProtobufEnvelope<Ts...>>::take() noexcept
+{
+    using ProtobufUserHeader_t = mepoo::ProtobufUserHeader<ProtobufEnvelopeHeader>;
+
+    return this->takeMessage([](const mepoo::ChunkHeader* const chunkHeader,
+                                const uint64_t serializedSize) -> google::protobuf::MessageLite* {
+        // a serialized message always carries the user-header, otherwise its size would not be known
+        const auto typeId = static_cast<const ProtobufUserHeader_t*>(chunkHeader->userHeader())->m_userHeader.m_typeId;
+        if (typeId >= Envelope::NUMBER_OF_TYPES)
+        {
+            return nullptr;
+        }
+        return PARSERS[typeId](chunkHeader->userPayload(), serializedSize);
+    });
+}
+
+template <typename... Ts, typename... Handlers>
+inline ProtobufDispatchTable<ProtobufEnvelope<Ts...>, Handlers...>::ProtobufDispatchTable(Handlers... handlers) noexcept
+    : m_handlers{std::move(handlers)...}
+{
+}
+
+template <typename... Ts, typename... Handlers>
+inline bool ProtobufDispatchTable<ProtobufEnvelope<Ts...>, Handlers...>::operator()(
+    const ProtobufEnvelopeSample& sample) noexcept
+{
+    if (!sample)
+    {
+        return false;
+    }
+    return dispatch(sample.getUserHeader().m_typeId, *sample);
+}
+
+template <typename... Ts, typename... Handlers>
+inline bool ProtobufDispatchTable<ProtobufEnvelope<Ts...>, Handlers...>::dispatch(
+    const uint32_t typeId, const google::protobuf::MessageLite& message) noexcept
+{
+    if (typeId >= ProtobufEnvelope<Ts...>::NUMBER_OF_TYPES)
+    {
+        return false;
+    }
+    return CALLS[typeId](m_handlers, message);
+}
+
+template <typename... Ts, typename... Handlers>
+template <typename T>
+inline bool ProtobufDispatchTable<ProtobufEnvelope<Ts...>, Handlers...>::call(
+    HandlerSet& handlers, const google::protobuf::MessageLite& message) noexcept
+{
+    if constexpr (std::is_invocable<HandlerSet&, const T&>::value)
+    {
+        // the type id guarantees the dynamic type of the message
+        handlers(static_cast<const T&>(message));
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+template <typename Envelope, typename... Handlers>
+inline ProtobufDispatchTable<Envelope, std::decay_t<Handlers>...>
+makeProtobufDispatchTable(Handlers&&... handlers) noexcept
+{
+    return ProtobufDispatchTable<Envelope, std::decay_t<Handlers>...>(std::forward<Handlers>(handlers)...);
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_PROTOBUF_ENVELOPE_INL
@@ -0,0 +1,247 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_PROTOBUF_PUBLISHER_INL
+#define IOX_POSH_POPO_PROTOBUF_PUBLISHER_INL
+
+#include "iceoryx_posh/popo/protobuf_publisher.hpp"
+#include "iox/logging.hpp"
+
+namespace iox
+{
+namespace popo
+{
+template <typename T, typename H, typename P>
+inline ProtobufLoan<T, H, P>::ProtobufLoan(ProtobufPublisher<P, H>& publisher, Sample<P, H>&& sample) noexcept
+    : m_publisher(&publisher)
+    , m_sample(std::move(sample))
+{
+}
+
+template <typename T, typename H, typename P>
+inline ProtobufLoan<T, H, P>::ProtobufLoan(ProtobufLoan&& rhs) noexcept
+    : m_publisher(rhs.m_publisher)
+    , m_sample(std::move(rhs.m_sample))
+{
+    rhs.m_publisher = nullptr;
+}
+
+template <typename T, typename H, typename P>
+inline ProtobufLoan<T, H, P>& ProtobufLoan<T, H, P>::operator=(ProtobufLoan&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        endLoan();
+        m_publisher = rhs.m_publisher;
+        m_sample = std::move(rhs.m_sample);
+        rhs.m_publisher = nullptr;
+    }
+    return *this;
+}
+
+template <typename T, typename H, typename P>
+inline ProtobufLoan<T, H, P>::~ProtobufLoan() noexcept
+{
+    endLoan();
+}
+
+template <typename T, typename H, typename P>
+inline T* ProtobufLoan<T, H, P>::operator->() noexcept
+{
+    return get();
+}
+
+template <typename T, typename H, typename P>
+inline const T* ProtobufLoan<T, H, P>::operator->() const noexcept
+{
+    return get();
+}
+
+template <typename T, typename H, typename P>
+inline T& ProtobufLoan<T, H, P>::operator*() noexcept
+{
+    return *get();
+}
+
+template <typename T, typename H, typename P>
+inline const T& ProtobufLoan<T, H, P>::operator*() const noexcept
+{
+    return *get();
+}
+
+template <typename T, typename H, typename P>
+inline T* ProtobufLoan<T, H, P>::get() noexcept
+{
+    return static_cast<T*>(m_sample.get());
+}
+
+template <typename T, typename H, typename P>
+inline const T* ProtobufLoan<T, H, P>::get() const noexcept
+{
+    return static_cast<const T*>(m_sample.get());
+}
+
+template <typename T, typename H, typename P>
+template <typename R, typename>
+inline R& ProtobufLoan<T, H, P>::getUserHeader() noexcept
+{
+    return m_sample.getUserHeader();
+}
+
+template <typename T, typename H, typename P>
+inline expected<mepoo::ChunkHeader*, AllocationError>
+ProtobufLoan<T, H, P>::loanAttachedChunk(const uint64_t userPayloadSize, const uint32_t userPayloadAlignment) noexcept
+{
+    if (m_publisher == nullptr)
+    {
+        IOX_LOG(Error, "Tried to attach a chunk to a protobuf loan which has already ended");
+        return err(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
+    }
+    return m_publisher->loanAttachedChunk(userPayloadSize, userPayloadAlignment);
+}
+
+template <typename T, typename H, typename P>
+inline void ProtobufLoan<T, H, P>::publish() noexcept
+{
+    if (m_publisher == nullptr)
+    {
+        IOX_LOG(Error, "Tried to publish a protobuf loan which has already ended");
+        return;
+    }
+    m_sample.publish();
+    endLoan();
+}
+
+template <typename T, typename H, typename P>
+inline void ProtobufLoan<T, H, P>::endLoan() noexcept
+{
+    if (m_publisher != nullptr)
+    {
+        m_publisher->endLoan();
+        m_publisher = nullptr;
+    }
+}
+
+template <typename T, typename H>
+inline ProtobufPublisher<T, H>::ProtobufPublisher(const capro::ServiceDescription& service,
+                                                  const PublisherOptions& publisherOptions) noexcept
+    : ProtobufPublisher(service, publisherOptions, protobufAbiHash<T>(), ProtobufChunkSerializer<T, H>::create())
+{
+}
+
+template <typename T, typename H>
+inline ProtobufPublisher<T, H>::ProtobufPublisher(const capro::ServiceDescription& service,
+                                                  const PublisherOptions& publisherOptions,
+                                                  const uint64_t abiHash,
+                                                  const ChunkSerializer& serializer) noexcept
+    : Publisher<T, H>(MessageLayout::withAbiHash(service, abiHash), publisherOptions)
+{
+    this->port().setMessageLayout(abiHash, PROTOBUF_MESSAGES_ARE_RELOCATABLE, serializer);
+}
+
+template <typename T, typename H>
+inline expected<ProtobufLoan<T, H>, AllocationError> ProtobufPublisher<T, H>::loan() noexcept
+{
+    return loanMessage<T>();
+}
+
+template <typename T, typename H>
+template <typename U>
+inline expected<ProtobufLoan<U, H, T>, AllocationError> ProtobufPublisher<T, H>::loanMessage() noexcept
+{
+    static_assert(std::is_base_of<T, U>::value, "The message type must be the one of the publisher or derived from it");
+
+    if (m_arena != nullptr)
+    {
+        IOX_LOG(Error, "Only one loan of a protobuf publisher can be pending at a time");
+        return err(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
+    }
+
+    google::protobuf::ArenaOptions options;
+    options.block_context = this;
+    options.block_alloc_with_context = &ProtobufPublisher::loanArenaBlock;
+    options.block_dealloc_all = &ProtobufPublisher::releaseArenaBlocks;
+
+    // the arena cannot cope with a failing block allocation, therefore the first block is loaned upfront; it is
+    // handed back together with the blocks the arena loaned itself
+    static_assert(alignof(google::protobuf::SingleOwnerArena) <= alignof(mepoo::ProtobufUserHeader<H>),
+                  "The arena must fit behind the ProtobufUserHeader");
+    size_t initialBlockSize{0U};
+    void* arenaHeader{nullptr};
+    void* initialBlock = this->loanBlock(
+        options.start_block_size, initialBlockSize, sizeof(google::protobuf::SingleOwnerArena), arenaHeader);
+    if (initialBlock == nullptr)
+    {
+        return err(AllocationError::RUNNING_OUT_OF_CHUNKS);
+    }
+    options.initial_block = static_cast<char*>(initialBlock);
+    options.initial_block_size = initialBlockSize;
+    m_arena = new (arenaHeader) google::protobuf::SingleOwnerArena(options);
+
+    // the root message is recorded as T, which is the type the subscribers see it as
+    T* message = google::protobuf::Arena::CreateMessage<U>(m_arena->get());
+    auto sample = this->getSample(message);
+    if (sample.has_error())
+    {
+        endLoan();
+        return err(sample.error());
+    }
+    return ok(ProtobufLoan<U, H, T>(*this, std::move(sample.value())));
+}
+
+template <typename T, typename H>
+inline void ProtobufPublisher<T, H>::publish(Sample<T, H>&& sample) noexcept
+{
+    // the loan is finished first, hence the arena hands back no blocks when it is destroyed; the chunk is sent
+    // afterwards, so that no subscriber reads it while the arena is torn down and a chunk which is released right
+    // away for lack of subscribers is not written after its release
+    if (this->finishArenaLoan(sample))
+    {
+        endLoan();
+    }
+    this->sendSample(std::move(sample));
+}
+
+template <typename T, typename H>
+inline void ProtobufPublisher<T, H>::endLoan() noexcept
+{
+    // the arena hands back all blocks via 'releaseArenaBlocks' as last step of its destruction, which releases the
+    // chunk the arena lives in if the message was not published; a published message is already finished and its
+    // chunks are kept
+    if (m_arena != nullptr)
+    {
+        auto* arena = m_arena;
+        m_arena = nullptr;
+        arena->~SingleOwnerArena();
+    }
+}
+
+template <typename T, typename H>
+inline void* ProtobufPublisher<T, H>::loanArenaBlock(void* publisher, size_t size, size_t& actualSize) noexcept
+{
+    return static_cast<ProtobufPublisher*>(publisher)->loanBlock(size, actualSize);
+}
+
+template <typename T, typename H>
+inline void ProtobufPublisher<T, H>::releaseArenaBlocks(void* publisher) noexcept
+{
+    static_cast<ProtobufPublisher*>(publisher)->releaseBlocks();
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_PROTOBUF_PUBLISHER_INL
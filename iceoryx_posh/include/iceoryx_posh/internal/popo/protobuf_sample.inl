@@ -0,0 +1,135 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_PROTOBUF_SAMPLE_INL
+#define IOX_POSH_POPO_PROTOBUF_SAMPLE_INL
+
+#include "iceoryx_posh/popo/protobuf_sample.hpp"
+
+namespace iox
+{
+namespace popo
+{
+template <typename T, typename H>
+inline ProtobufSample<T, H>::ProtobufSample(ChunkHeader_t* const chunkHeader,
+                                            const function<void(T*)>& deleter) noexcept
+    : m_chunkHeader(chunkHeader)
+    , m_message(rootMessage(chunkHeader), deleter)
+{
+}
+
+template <typename T, typename H>
+inline ProtobufSample<T, H>::ProtobufSample(const mepoo::ChunkHeaderView chunkHeaders,
+                                            const function<void(T*)>& deleter) noexcept
+    : m_chunkHeader(chunkHeaders.front())
+    , m_chunkHeaders(chunkHeaders)
+    , m_message(rootMessage(m_chunkHeader), deleter)
+{
+}
+
+template <typename T, typename H>
+inline ProtobufSample<T, H>::ProtobufSample(ChunkHeader_t* const chunkHeader,
+                                            T* const message,
+                                            const function<void(T*)>& deleter) noexcept
+    : m_chunkHeader(chunkHeader)
+    , m_message(message, deleter)
+{
+}
+
+template <typename T, typename H>
+inline T* ProtobufSample<T, H>::rootMessage(ChunkHeader_t* const chunkHeader) noexcept
+{
+    return static_cast<T*>(mepoo::protobufRootMessage<typename std::remove_const<H>::type>(chunkHeader));
+}
+
+template <typename T, typename H>
+inline T* ProtobufSample<T, H>::operator->() noexcept
+{
+    return get();
+}
+
+template <typename T, typename H>
+inline const T* ProtobufSample<T, H>::operator->() const noexcept
+{
+    return get();
+}
+
+template <typename T, typename H>
+inline T& ProtobufSample<T, H>::operator*() noexcept
+{
+    return *get();
+}
+
+template <typename T, typename H>
+inline const T& ProtobufSample<T, H>::operator*() const noexcept
+{
+    return *get();
+}
+
+template <typename T, typename H>
+inline ProtobufSample<T, H>::operator bool() const noexcept
+{
+    return get() != nullptr;
+}
+
+template <typename T, typename H>
+inline T* ProtobufSample<T, H>::get() noexcept
+{
+    return m_message.get();
+}
+
+template <typename T, typename H>
+inline const T* ProtobufSample<T, H>::get() const noexcept
+{
+    return m_message.get();
+}
+
+template <typename T, typename H>
+inline typename ProtobufSample<T, H>::ChunkHeader_t* ProtobufSample<T, H>::getChunkHeader() noexcept
+{
+    return m_chunkHeader;
+}
+
+template <typename T, typename H>
+inline const mepoo::ChunkHeader* ProtobufSample<T, H>::getChunkHeader() const noexcept
+{
+    return m_chunkHeader;
+}
+
+template <typename T, typename H>
+inline mepoo::ChunkHeaderView ProtobufSample<T, H>::getChunkHeaders() const noexcept
+{
+    return m_chunkHeaders;
+}
+
+template <typename T, typename H>
+template <typename R, typename>
+inline add_const_conditionally_t<R, T>& ProtobufSample<T, H>::getUserHeader() noexcept
+{
+    return static_cast<ProtobufUserHeader_t*>(m_chunkHeader->userHeader())->m_userHeader;
+}
+
+template <typename T, typename H>
+template <typename R, typename>
+inline const R& ProtobufSample<T, H>::getUserHeader() const noexcept
+{
+    return const_cast<ProtobufSample<T, H>*>(this)->getUserHeader();
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_PROTOBUF_SAMPLE_INL
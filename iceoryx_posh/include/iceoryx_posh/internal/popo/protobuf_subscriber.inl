@@ -0,0 +1,143 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_PROTOBUF_SUBSCRIBER_INL
+#define IOX_POSH_POPO_PROTOBUF_SUBSCRIBER_INL
+
+#include "iceoryx_posh/popo/protobuf_subscriber.hpp"
+#include "iox/logging.hpp"
+
+#include <google/protobuf/message.h>
+
+namespace iox
+{
+namespace popo
+{
+template <typename T, typename H>
+inline ProtobufSubscriber<T, H>::ProtobufSubscriber(const capro::ServiceDescription& service,
+                                                    const SubscriberOptions& subscriberOptions,
+                                                    const ProtobufDelivery delivery) noexcept
+    : ProtobufSubscriber(service, subscriberOptions, protobufAbiHash<T>(), delivery)
+{
+}
+
+template <typename T, typename H>
+inline ProtobufSubscriber<T, H>::ProtobufSubscriber(const capro::ServiceDescription& service,
+                                                    const SubscriberOptions& subscriberOptions,
+                                                    const uint64_t abiHash,
+                                                    const ProtobufDelivery delivery) noexcept
+    : Subscriber<T, H>(MessageLayout::withAbiHash(service, abiHash), withoutSubscribeOnCreate(subscriberOptions))
+{
+    // the layout must be known to the publishers before the first message is delivered
+    if (delivery == ProtobufDelivery::SERIALIZED)
+    {
+        this->port().setSerializedMessageLayout(abiHash);
+    }
+    else
+    {
+        this->port().setMessageLayout(abiHash, PROTOBUF_MESSAGES_ARE_RELOCATABLE);
+    }
+    if (subscriberOptions.subscribeOnCreate)
+    {
+        this->subscribe();
+    }
+}
+
+template <typename T, typename H>
+inline SubscriberOptions
+ProtobufSubscriber<T, H>::withoutSubscribeOnCreate(const SubscriberOptions& subscriberOptions) noexcept
+{
+    auto options = subscriberOptions;
+    options.subscribeOnCreate = false;
+    return options;
+}
+
+template <typename T, typename H>
+inline expected<ProtobufSample<const T, const H>, ChunkReceiveResult> ProtobufSubscriber<T, H>::take() noexcept
+{
+    return takeMessage([](const mepoo::ChunkHeader* const chunkHeader, const uint64_t serializedSize) -> T* {
+        return parse<T>(chunkHeader->userPayload(), serializedSize);
+    });
+}
+
+template <typename T, typename H>
+template <typename M>
+inline T* ProtobufSubscriber<T, H>::parse(const void* const data, const uint64_t size) noexcept
+{
+    auto* message = new M();
+    if (!message->ParseFromArray(data, static_cast<int>(size)))
+    {
+        delete message;
+        return nullptr;
+    }
+    return message;
+}
+
+template <typename T, typename H>
+template <typename Parser>
+inline expected<ProtobufSample<const T, const H>, ChunkReceiveResult>
+ProtobufSubscriber<T, H>::takeMessage(const Parser& parse) noexcept
+{
+    auto result = this->takeChunks();
+    if (result.has_error())
+    {
+        return err(result.error());
+    }
+
+    const auto& chunkHeaders = result.value();
+    if (chunkHeaders.empty())
+    {
+        return err(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+    }
+
+    const mepoo::ChunkHeader* chunkHeader = chunkHeaders.front();
+    auto serializedSize = mepoo::protobufSerializedSize<H>(chunkHeader);
+    if (!serializedSize.has_value())
+    {
+        return ok<ProtobufSample<const T, const H>>(
+            chunkHeaders, [this, chunkHeader](const T*) { this->port().releaseChunk(chunkHeader); });
+    }
+
+    T* message = parse(chunkHeader, serializedSize.value());
+    if (message == nullptr)
+    {
+        IOX_LOG(Error, "Dropping a serialized message which could not be parsed");
+        this->port().releaseChunk(chunkHeader);
+        return err(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+    }
+
+    return ok<ProtobufSample<const T, const H>>(chunkHeader, message, [this, chunkHeader](const T* message) {
+        delete message;
+        this->port().releaseChunk(chunkHeader);
+    });
+}
+
+template <typename T, typename H>
+inline expected<const mepoo::ChunkHeader*, SerializedSampleError>
+ProtobufSubscriber<T, H>::serialized(const ProtobufSample<const T, const H>& sample) const noexcept
+{
+    const auto* chunkHeader = sample.getChunkHeader();
+    if (!mepoo::protobufSerializedSize<H>(chunkHeader).has_value())
+    {
+        return err(SerializedSampleError::NOT_SERIALIZED);
+    }
+    return ok(chunkHeader);
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_PROTOBUF_SUBSCRIBER_INL
@@ -18,6 +18,7 @@
 #ifndef IOX_POSH_POPO_TYPED_PUBLISHER_IMPL_HPP
 #define IOX_POSH_POPO_TYPED_PUBLISHER_IMPL_HPP
 
+#include "iceoryx_posh/internal/popo/arena_loan.hpp"
 #include "iceoryx_posh/internal/popo/base_publisher.hpp"
 #include "iceoryx_posh/internal/popo/publisher_interface.hpp"
 #include "iceoryx_posh/internal/popo/typed_port_api_trait.hpp"
@@ -57,11 +58,46 @@ class PublisherImpl : public BasePublisherType, private PublisherInterface<T, H>
     template <typename... Args>
     expected<Sample<T, H>, AllocationError> loan(Args&&... args) noexcept;
 
+    /// @brief Wraps a message which was created on an arena that loans its blocks via 'loanBlock' into a sample and
+    /// records the position of the message in the user-header of the first block for the subscriber
+    /// @param userPayload the root message
+    /// @return a sample to publish the message or an error if no block was loaned
     expected<Sample<T, H>, AllocationError> getSample(void* userPayload) noexcept;
 
+    /// @brief Loans a chunk with a 'ProtobufUserHeader<H>' as block for an arena
+    /// @details The first block of a sample is sized by the ArenaBlockSizePlanner of the publisher, so that a typical
+    /// sample fits into one chunk; further blocks are only requested for outliers
     void* loanBlock(size_t size, size_t& actualSize) noexcept;
+
+    /// @brief Loans a block like 'loanBlock' whose user-header reserves 'arenaHeaderSize' bytes behind the
+    /// 'ProtobufUserHeader<H>' for the bookkeeping of the arena, so that the whole block is available for messages
+    /// @details Subscribers only read the 'ProtobufUserHeader<H>' and ignore the reserved bytes
+    /// @param[out] arenaHeader the reserved bytes, aligned like the 'ProtobufUserHeader<H>'
+    void* loanBlock(size_t size, size_t& actualSize, const uint32_t arenaHeaderSize, void*& arenaHeader) noexcept;
+
+    /// @brief Returns a block of an arena which loans its blocks via 'loanBlock'
+    /// @details Blocks of published samples are ignored since they are owned by the sent sample. When the arena of a
+    /// sample which was not published is destroyed, all chunks of the loan are returned to the mempools as soon as
+    /// the last block was handed back, so that error paths do not exhaust the chunks a publisher can hold
+    /// @param ptr the block as returned by 'loanBlock'
     void releaseBlock(void* ptr) noexcept;
 
+    /// @brief Returns all blocks of an arena which loans its blocks via 'loanBlock' at once, for arenas which hand
+    /// back their blocks with a single call after they accessed them for the last time
+    /// @details Does nothing if the sample was published since the blocks are then owned by the sent sample
+    void releaseBlocks() noexcept;
+
+    /// @brief Loans a chunk which is attached to the sample whose arena blocks are loaned, e.g. for a large binary
+    /// payload which a message field refers to instead of copying it into the arena
+    /// @details The chunk is part of the sample like the arena blocks, i.e. it is sent and released together with
+    /// them and stays valid as long as a subscriber holds the sample
+    /// @param userPayloadSize size of the user-payload of the chunk
+    /// @param userPayloadAlignment alignment of the user-payload of the chunk
+    /// @return the ChunkHeader of the chunk or an error if no arena block is loaned or the chunk could not be loaned
+    expected<mepoo::ChunkHeader*, AllocationError>
+    loanAttachedChunk(const uint64_t userPayloadSize,
+                      const uint32_t userPayloadAlignment = CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT) noexcept;
+
     ///
     /// @brief publish Publishes the given sample and then releases its loan.
     /// @param sample The sample to publish.
@@ -83,19 +119,43 @@ class PublisherImpl : public BasePublisherType, private PublisherInterface<T, H>
     template <typename Callable, typename... ArgTypes>
     expected<void, AllocationError> publishResultOf(Callable c, ArgTypes... args) noexcept;
 
+    ///
+    /// @brief publishSerialized Serializes a protobuf message directly into a loaned chunk and publishes it.
+    /// @param message The message to serialize, e.g. a 'google::protobuf::MessageLite'.
+    /// @return Error if unable to allocate memory to loan.
+    /// @details The size of the message is computed once and the chunk is loaned with exactly that size, hence the
+    /// message must not be modified concurrently. The size is recorded in the 'ProtobufUserHeader<H>' of the chunk
+    /// and can be obtained by the subscriber with 'mepoo::protobufSerializedSize'.
+    ///
+    template <typename Message>
+    expected<void, AllocationError> publishSerialized(const Message& message) noexcept;
+
   public:
     using PortType = typename BasePublisherType::PortType;
     using BasePublisherType::port;
 
     PublisherImpl(PortType&& port) noexcept;
 
+  protected:
+    /// @brief Ends the arena loan of a sample which is about to be sent; afterwards its blocks are owned by the sample
+    /// and 'releaseBlock' and 'releaseBlocks' ignore them
+    /// @param sample which is about to be sent
+    /// @return true if the sample was built on the blocks of the arena loan, false for any other sample
+    bool finishArenaLoan(const Sample<T, H>& sample) noexcept;
+
+    /// @brief Takes the ownership of the chunks from the sample and sends them
+    /// @param sample which is sent, its deleter is not invoked anymore
+    void sendSample(Sample<T, H>&& sample) noexcept;
+
   private:
+    using ProtobufUserHeader_t = mepoo::ProtobufUserHeader<H>;
+
     Sample<T, H> convertChunkHeaderToSample(mepoo::ChunkHeader* const header) noexcept;
 
     expected<Sample<T, H>, AllocationError> loanSample() noexcept;
-  
+
   private:
-    std::vector<iox::mepoo::ChunkHeader*> m_chunkHeaders;
+    ArenaLoan<H> m_arenaLoan;
 };
 
 } // namespace popo
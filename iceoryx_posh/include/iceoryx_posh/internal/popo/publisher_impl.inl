@@ -49,34 +49,85 @@ inline expected<Sample<T, H>, AllocationError> PublisherImpl<T, H, BasePublisher
 
 template <typename T, typename H, typename BasePublisherType>
 expected<Sample<T, H>, AllocationError> PublisherImpl<T, H, BasePublisherType>::getSample(void* userPayload) noexcept {
-    return ok(Sample<T, H>(iox::unique_ptr<T>(reinterpret_cast<T*>(userPayload),
-                                           [this](T* userPayload) {
-                                           }),
-                        *this));
+    auto* firstChunkHeader = m_arenaLoan.setRootMessage(userPayload);
+    if (firstChunkHeader == nullptr)
+    {
+        IOX_LOG(Error, "The message was not created on an arena which loans its blocks from this publisher");
+        return err(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
+    }
+
+    // the chunks are owned by the arena until they are published, hence nothing to release here
+    return ok(Sample<T, H>(
+        iox::unique_ptr<T>(reinterpret_cast<T*>(userPayload), [](T*) {}), firstChunkHeader, *this));
 }
 
 template <typename T, typename H, typename BasePublisherType>
 inline void* PublisherImpl<T, H, BasePublisherType>::loanBlock(size_t size, size_t& actualSize) noexcept {
-    static constexpr uint32_t USER_HEADER_SIZE{std::is_same<H, mepoo::NoUserHeader>::value ? 0U : sizeof(H)};
+    void* arenaHeader{nullptr};
+    return loanBlock(size, actualSize, 0U, arenaHeader);
+}
 
-    auto result = port().tryAllocateChunk(size, 8, USER_HEADER_SIZE, alignof(H));
-    if (result.has_error())
+template <typename T, typename H, typename BasePublisherType>
+inline void* PublisherImpl<T, H, BasePublisherType>::loanBlock(size_t size,
+                                                              size_t& actualSize,
+                                                              const uint32_t arenaHeaderSize,
+                                                              void*& arenaHeader) noexcept
+{
+    const uint32_t userHeaderSize = static_cast<uint32_t>(sizeof(ProtobufUserHeader_t)) + arenaHeaderSize;
+    auto allocateBlock = [this, userHeaderSize](const uint64_t blockSize, const uint32_t alignment) {
+        return port().tryAllocateChunk(blockSize, alignment, userHeaderSize, alignof(ProtobufUserHeader_t));
+    };
+
+    void* block = m_arenaLoan.loanBlock(size, actualSize, allocateBlock, allocateBlock);
+    if (block == nullptr)
     {
         return nullptr;
     }
-    else
-    {
-        actualSize = result.value()->actualUserPayloadSize();
-        void* userPayload = result.value()->userPayload();
-        m_chunkHeaders.push_back(result.value());
-        return userPayload;
-    }
+
+    auto* protobufUserHeader = new (mepoo::ChunkHeader::fromUserPayload(block)->userHeader()) ProtobufUserHeader_t();
+    arenaHeader = protobufUserHeader + 1;
+    return block;
 }
 
 template <typename T, typename H, typename BasePublisherType>
 inline void PublisherImpl<T, H, BasePublisherType>::releaseBlock(void* ptr) noexcept {
     assert(ptr != nullptr && "block ptr should not be null");
-    // do nothing because SharedChunk is to release the allocated Chunk.
+
+    auto* firstChunkHeader = m_arenaLoan.releaseBlock(ptr);
+    if (firstChunkHeader != nullptr)
+    {
+        port().releaseChunk(firstChunkHeader);
+    }
+}
+
+template <typename T, typename H, typename BasePublisherType>
+inline void PublisherImpl<T, H, BasePublisherType>::releaseBlocks() noexcept
+{
+    auto* firstChunkHeader = m_arenaLoan.firstChunkHeader();
+    if (firstChunkHeader == nullptr)
+    {
+        return;
+    }
+
+    port().releaseChunk(firstChunkHeader);
+    m_arenaLoan.reset();
+}
+
+template <typename T, typename H, typename BasePublisherType>
+inline expected<mepoo::ChunkHeader*, AllocationError>
+PublisherImpl<T, H, BasePublisherType>::loanAttachedChunk(const uint64_t userPayloadSize,
+                                                          const uint32_t userPayloadAlignment) noexcept
+{
+    if (m_arenaLoan.firstChunkHeader() == nullptr)
+    {
+        IOX_LOG(Error, "A chunk can only be attached to a sample whose arena blocks are loaned from this publisher");
+        return err(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
+    }
+
+    // the port adds the chunk to the sample which is assembled; it is not tracked as arena block since the arena
+    // never hands it back
+    return port().tryAllocateChunk(
+        userPayloadSize, userPayloadAlignment, CHUNK_NO_USER_HEADER_SIZE, CHUNK_NO_USER_HEADER_ALIGNMENT);
 }
 
 template <typename T, typename H, typename BasePublisherType>
@@ -106,12 +157,37 @@ inline expected<void, AllocationError> PublisherImpl<T, H, BasePublisherType>::p
     });
 }
 
+template <typename T, typename H, typename BasePublisherType>
+template <typename Message>
+inline expected<void, AllocationError>
+PublisherImpl<T, H, BasePublisherType>::publishSerialized(const Message& message) noexcept
+{
+    // 'ByteSizeLong' caches the sizes of all submessages which are reused by 'SerializeWithCachedSizesToArray'
+    const uint64_t serializedSize = message.ByteSizeLong();
+    auto result = port().tryAllocateSingleChunk(serializedSize,
+                                                CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
+                                                sizeof(ProtobufUserHeader_t),
+                                                alignof(ProtobufUserHeader_t));
+    if (result.has_error())
+    {
+        return err(result.error());
+    }
+
+    auto* chunkHeader = result.value();
+    auto* protobufUserHeader = new (chunkHeader->userHeader()) ProtobufUserHeader_t();
+    protobufUserHeader->m_serializedSize = serializedSize;
+    message.SerializeWithCachedSizesToArray(static_cast<uint8_t*>(chunkHeader->userPayload()));
+    port().sendChunk(chunkHeader);
+    return ok();
+}
+
 template <typename T, typename H, typename BasePublisherType>
 inline expected<Sample<T, H>, AllocationError> PublisherImpl<T, H, BasePublisherType>::loanSample() noexcept
 {
     static constexpr uint32_t USER_HEADER_SIZE{std::is_same<H, mepoo::NoUserHeader>::value ? 0U : sizeof(H)};
 
-    auto result = port().tryAllocateChunk(sizeof(T), alignof(T), USER_HEADER_SIZE, alignof(H));
+    // the sample must not become part of the sample an arena assembles at the same time
+    auto result = port().tryAllocateSingleChunk(sizeof(T), alignof(T), USER_HEADER_SIZE, alignof(H));
     if (result.has_error())
     {
         return err(result.error());
@@ -125,8 +201,33 @@ inline expected<Sample<T, H>, AllocationError> PublisherImpl<T, H, BasePublisher
 template <typename T, typename H, typename BasePublisherType>
 inline void PublisherImpl<T, H, BasePublisherType>::publish(Sample<T, H>&& sample) noexcept
 {
-    port().sendChunk(m_chunkHeaders);
-    m_chunkHeaders.clear();
+    finishArenaLoan(sample);
+    sendSample(std::move(sample));
+}
+
+template <typename T, typename H, typename BasePublisherType>
+inline void PublisherImpl<T, H, BasePublisherType>::sendSample(Sample<T, H>&& sample) noexcept
+{
+    // release the ownership of the chunk before it is sent, otherwise the deleter of the sample would return it
+    auto* chunkHeader = sample.getChunkHeader();
+    sample.release();
+    port().sendChunk(chunkHeader);
+}
+
+template <typename T, typename H, typename BasePublisherType>
+inline bool PublisherImpl<T, H, BasePublisherType>::finishArenaLoan(const Sample<T, H>& sample) noexcept
+{
+    // the first chunk identifies the whole sample; samples from loanSample() have no arena blocks and leave a pending
+    // arena loan untouched
+    auto* chunkHeader = sample.getChunkHeader();
+    if (chunkHeader != m_arenaLoan.firstChunkHeader())
+    {
+        return false;
+    }
+
+    // types which do not know their arena fall back to the sum of the block sizes requested by the arena
+    m_arenaLoan.finish(chunkHeader, ArenaFootprint<T>::of(*sample.get()));
+    return true;
 }
 
 template <typename T, typename H, typename BasePublisherType>
@@ -135,9 +236,8 @@ PublisherImpl<T, H, BasePublisherType>::convertChunkHeaderToSample(mepoo::ChunkH
 {
     return Sample<T, H>(iox::unique_ptr<T>(reinterpret_cast<T*>(header->userPayload()),
                                            [this](T* userPayload) {
-                                               //auto* chunkHeader = iox::mepoo::ChunkHeader::fromUserPayload(userPayload);
-                                               //this->port().releaseChunk(chunkHeader);
-                                               IOX_LOG(Info, "userPayload: " << userPayload);
+                                               auto* chunkHeader = mepoo::ChunkHeader::fromUserPayload(userPayload);
+                                               this->port().releaseChunk(chunkHeader);
                                            }),
                         *this);
 }
@@ -0,0 +1,79 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_PUBLISHER_LOAN_CONTEXT_HPP
+#define IOX_POSH_POPO_PUBLISHER_LOAN_CONTEXT_HPP
+
+#include "iceoryx_posh/internal/popo/arena_loan.hpp"
+#include "iceoryx_posh/internal/popo/publisher_impl.hpp"
+#include "iceoryx_posh/internal/popo/publisher_interface.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/popo/sample.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief A loan context assembles the samples of a publisher independently of the other loan contexts of this
+/// publisher. Every thread which builds messages on an arena can hold its own loan context and publish the samples
+/// without synchronizing with the other threads; the blocks of the arena are loaned via 'loanBlock' of the context.
+/// @note The loan context must not outlive the publisher. A single loan context must only be used by one thread at a
+/// time.
+template <typename T, typename H = mepoo::NoUserHeader, typename BasePublisherType = BasePublisher<>>
+class PublisherLoanContext : private PublisherInterface<T, H>
+{
+  public:
+    explicit PublisherLoanContext(PublisherImpl<T, H, BasePublisherType>& publisher) noexcept;
+    ~PublisherLoanContext() noexcept;
+
+    PublisherLoanContext(const PublisherLoanContext&) = delete;
+    PublisherLoanContext(PublisherLoanContext&&) = delete;
+    PublisherLoanContext& operator=(const PublisherLoanContext&) = delete;
+    PublisherLoanContext& operator=(PublisherLoanContext&&) = delete;
+
+    /// @brief Loans a chunk with a 'ProtobufUserHeader<H>' as block for an arena of this loan context
+    /// @details The loan context is claimed from the publisher with the first block; nullptr is returned if the
+    /// publisher has no free loan context or the mempools are exhausted
+    void* loanBlock(size_t size, size_t& actualSize) noexcept;
+
+    /// @brief Returns a block of an arena of this loan context, see 'PublisherImpl::releaseBlock'
+    /// @param ptr the block as returned by 'loanBlock'
+    void releaseBlock(void* ptr) noexcept;
+
+    /// @brief Wraps a message which was created on an arena of this loan context into a sample
+    /// @param userPayload the root message
+    /// @return a sample to publish the message or an error if no block was loaned
+    expected<Sample<T, H>, AllocationError> getSample(void* userPayload) noexcept;
+
+    /// @brief Publishes the given sample of this loan context and then releases its loan
+    /// @param sample The sample to publish.
+    void publish(Sample<T, H>&& sample) noexcept override;
+
+  private:
+    using ProtobufUserHeader_t = mepoo::ProtobufUserHeader<H>;
+
+  private:
+    PublisherImpl<T, H, BasePublisherType>& m_publisher;
+    ChunkSenderLoanContext m_loanContext;
+    ArenaLoan<H> m_arenaLoan;
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/publisher_loan_context.inl"
+
+#endif // IOX_POSH_POPO_PUBLISHER_LOAN_CONTEXT_HPP
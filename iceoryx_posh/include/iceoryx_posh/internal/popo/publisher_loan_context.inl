@@ -0,0 +1,105 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_PUBLISHER_LOAN_CONTEXT_INL
+#define IOX_POSH_POPO_PUBLISHER_LOAN_CONTEXT_INL
+
+#include "iceoryx_posh/internal/popo/publisher_loan_context.hpp"
+
+#include <cassert>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+template <typename T, typename H, typename BasePublisherType>
+inline PublisherLoanContext<T, H, BasePublisherType>::PublisherLoanContext(
+    PublisherImpl<T, H, BasePublisherType>& publisher) noexcept
+    : m_publisher(publisher)
+{
+}
+
+template <typename T, typename H, typename BasePublisherType>
+inline PublisherLoanContext<T, H, BasePublisherType>::~PublisherLoanContext() noexcept
+{
+    m_publisher.port().releaseLoanContext(m_loanContext);
+}
+
+template <typename T, typename H, typename BasePublisherType>
+inline void* PublisherLoanContext<T, H, BasePublisherType>::loanBlock(size_t size, size_t& actualSize) noexcept
+{
+    if (m_loanContext.m_index == ChunkSenderLoanContext::INVALID_INDEX)
+    {
+        auto loanContextResult = m_publisher.port().tryAcquireLoanContext();
+        if (loanContextResult.has_error())
+        {
+            IOX_LOG(Error, "The publisher has no free loan context left");
+            return nullptr;
+        }
+        m_loanContext = loanContextResult.value();
+    }
+
+    auto allocateBlock = [this](const uint64_t blockSize, const uint32_t alignment) {
+        return m_publisher.port().tryAllocateChunk(
+            m_loanContext, blockSize, alignment, sizeof(ProtobufUserHeader_t), alignof(ProtobufUserHeader_t));
+    };
+
+    void* block = m_arenaLoan.loanBlock(size, actualSize, allocateBlock, allocateBlock);
+    if (block != nullptr)
+    {
+        new (mepoo::ChunkHeader::fromUserPayload(block)->userHeader()) ProtobufUserHeader_t();
+    }
+    return block;
+}
+
+template <typename T, typename H, typename BasePublisherType>
+inline void PublisherLoanContext<T, H, BasePublisherType>::releaseBlock(void* ptr) noexcept
+{
+    assert(ptr != nullptr && "block ptr should not be null");
+
+    if (m_arenaLoan.releaseBlock(ptr) != nullptr)
+    {
+        m_publisher.port().releaseChunk(m_loanContext);
+    }
+}
+
+template <typename T, typename H, typename BasePublisherType>
+inline expected<Sample<T, H>, AllocationError>
+PublisherLoanContext<T, H, BasePublisherType>::getSample(void* userPayload) noexcept
+{
+    auto* firstChunkHeader = m_arenaLoan.setRootMessage(userPayload);
+    if (firstChunkHeader == nullptr)
+    {
+        IOX_LOG(Error, "The message was not created on an arena which loans its blocks from this loan context");
+        return err(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
+    }
+
+    return ok(Sample<T, H>(
+        iox::unique_ptr<T>(reinterpret_cast<T*>(userPayload), [](T*) {}), firstChunkHeader, *this));
+}
+
+template <typename T, typename H, typename BasePublisherType>
+inline void PublisherLoanContext<T, H, BasePublisherType>::publish(Sample<T, H>&& sample) noexcept
+{
+    m_arenaLoan.finish(m_arenaLoan.firstChunkHeader(), ArenaFootprint<T>::of(*sample.get()));
+    m_publisher.port().sendChunk(m_loanContext);
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_PUBLISHER_LOAN_CONTEXT_INL
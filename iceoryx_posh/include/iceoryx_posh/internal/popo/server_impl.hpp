@@ -19,6 +19,7 @@
 
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/internal/popo/base_server.hpp"
+#include "iceoryx_posh/internal/popo/arena_loan.hpp"
 #include "iceoryx_posh/internal/popo/rpc_interface.hpp"
 #include "iceoryx_posh/internal/popo/typed_port_api_trait.hpp"
 #include "iceoryx_posh/popo/request.hpp"
@@ -53,6 +54,7 @@ class ServerImpl : public BaseServerT, private RpcInterface<Response<Res>, Serve
 
     /// @brief Take the Request from the top of the receive queue.
     /// @return Either a Request or a ServerRequestResult.
+    /// @details A request which was built on an arena of the client is located via the user-header of its first chunk.
     /// @details The Request takes care of the cleanup. Don't store the raw pointer to the content of the Request, but
     /// always the whole Request.
     expected<Request<const Req>, ServerRequestResult> take() noexcept;
@@ -66,6 +68,24 @@ class ServerImpl : public BaseServerT, private RpcInterface<Response<Res>, Serve
     template <typename... Args>
     expected<Response<Res>, AllocationError> loan(const Request<const Req>& request, Args&&... args) noexcept;
 
+    /// @brief Loans a chunk as block for an arena on which a response is built; the first block starts a new response
+    /// to the given request and every further block is added to it, see 'PublisherImpl::loanBlock'
+    /// @param[in] request The request to which the response belongs to, to determine where to send the response
+    /// @param[in] size is the block size requested by the arena
+    /// @param[out] actualSize is the usable size of the loaned block
+    /// @return the block or nullptr if no chunk could be loaned
+    void* loanBlock(const Request<const Req>& request, size_t size, size_t& actualSize) noexcept;
+
+    /// @brief Returns a block of an arena which loans its blocks via 'loanBlock', see 'PublisherImpl::releaseBlock'
+    /// @param[in] ptr the block as returned by 'loanBlock'
+    void releaseBlock(void* ptr) noexcept;
+
+    /// @brief Wraps a message which was created on an arena that loans its blocks via 'loanBlock' into a Response and
+    /// records the position of the message in the user-header of the first block for the client
+    /// @param[in] userPayload the root message
+    /// @return a Response to send the message or an error if no block was loaned
+    expected<Response<Res>, AllocationError> getResponse(void* userPayload) noexcept;
+
     /// @brief Sends the given Response and then releases its loan.
     /// @param response to send.
     /// @return Error if sending was not successful
@@ -79,6 +99,9 @@ class ServerImpl : public BaseServerT, private RpcInterface<Response<Res>, Serve
 
   private:
     expected<Response<Res>, AllocationError> loanUninitialized(const Request<const Req>& request) noexcept;
+
+  private:
+    ArenaLoan<ResponseHeader> m_arenaLoan;
 };
 } // namespace popo
 } // namespace iox
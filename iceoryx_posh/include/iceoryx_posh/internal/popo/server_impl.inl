@@ -19,6 +19,8 @@
 
 #include "iceoryx_posh/internal/popo/server_impl.hpp"
 
+#include <cassert>
+
 namespace iox
 {
 namespace popo
@@ -51,12 +53,12 @@ expected<Request<const Req>, ServerRequestResult> ServerImpl<Req, Res, BaseServe
         return err(result.error());
     }
     auto requestHeader = result.value();
-    auto payload = mepoo::ChunkHeader::fromUserHeader(requestHeader)->userPayload();
-    auto request = unique_ptr<const Req>(static_cast<const Req*>(payload), [this](const Req* payload) {
-        auto* requestHeader = iox::popo::RequestHeader::fromPayload(payload);
+    auto* chunkHeader = requestHeader->getChunkHeader();
+    auto payload = mepoo::protobufRootMessage<RequestHeader>(chunkHeader);
+    auto request = unique_ptr<const Req>(static_cast<const Req*>(payload), [this, requestHeader](const Req*) {
         this->port().releaseRequest(requestHeader);
     });
-    return ok(Request<const Req>{std::move(request)});
+    return ok(Request<const Req>{std::move(request), chunkHeader});
 }
 
 template <typename Req, typename Res, typename BaseServerT>
@@ -87,13 +89,66 @@ expected<Response<Res>, AllocationError> ServerImpl<Req, Res, BaseServerT>::loan
         [&](auto& response) { new (response.get()) Res(std::forward<Args>(args)...); }));
 }
 
+template <typename Req, typename Res, typename BaseServerT>
+void* ServerImpl<Req, Res, BaseServerT>::loanBlock(const Request<const Req>& request,
+                                                   size_t size,
+                                                   size_t& actualSize) noexcept
+{
+    const auto* requestHeader = &request.getRequestHeader();
+    return m_arenaLoan.loanBlock(
+        size,
+        actualSize,
+        [this, requestHeader](const uint64_t blockSize,
+                              const uint32_t alignment) -> expected<mepoo::ChunkHeader*, AllocationError> {
+            auto result = port().allocateMultiChunkResponse(requestHeader, blockSize, alignment);
+            if (result.has_error())
+            {
+                return err(result.error());
+            }
+            return ok(result.value()->getChunkHeader());
+        },
+        [this](const uint64_t blockSize, const uint32_t alignment) {
+            return port().allocateResponseChunk(blockSize, alignment);
+        });
+}
+
+template <typename Req, typename Res, typename BaseServerT>
+void ServerImpl<Req, Res, BaseServerT>::releaseBlock(void* ptr) noexcept
+{
+    assert(ptr != nullptr && "block ptr should not be null");
+
+    auto* chunkHeader = m_arenaLoan.releaseBlock(ptr);
+    if (chunkHeader != nullptr)
+    {
+        port().releaseResponse(static_cast<ResponseHeader*>(chunkHeader->userHeader()));
+    }
+}
+
+template <typename Req, typename Res, typename BaseServerT>
+expected<Response<Res>, AllocationError> ServerImpl<Req, Res, BaseServerT>::getResponse(void* userPayload) noexcept
+{
+    auto* chunkHeader = m_arenaLoan.setRootMessage(userPayload);
+    if (chunkHeader == nullptr)
+    {
+        IOX_LOG(Error, "The message was not created on an arena which loans its blocks from this server");
+        return err(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
+    }
+
+    // the chunks are owned by the arena until the response is sent, hence nothing to release here
+    return ok(Response<Res>(
+        unique_ptr<Res>(static_cast<Res*>(userPayload), [](Res*) {}), chunkHeader, *this));
+}
+
 template <typename Req, typename Res, typename BaseServerT>
 expected<void, ServerSendError> ServerImpl<Req, Res, BaseServerT>::send(Response<Res>&& response) noexcept
 {
+    // the first chunk identifies the whole response, also when the message was built on an arena
+    auto* chunkHeader = response.getChunkHeader();
+    m_arenaLoan.finish(chunkHeader, ArenaFootprint<Res>::of(*response.get()));
+
     // take the ownership of the chunk from the Response to transfer it to 'sendResponse'
-    auto payload = response.release();
-    auto* responseHeader = static_cast<ResponseHeader*>(mepoo::ChunkHeader::fromUserPayload(payload)->userHeader());
-    return port().sendResponse(responseHeader);
+    response.release();
+    return port().sendResponse(static_cast<ResponseHeader*>(chunkHeader->userHeader()));
 }
 
 } // namespace popo
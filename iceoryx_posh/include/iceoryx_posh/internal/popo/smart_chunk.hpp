@@ -32,7 +32,9 @@ namespace internal
 template <typename TransmissionInterface, typename T, typename H>
 struct SmartChunkPrivateData
 {
-    SmartChunkPrivateData(iox::unique_ptr<T>&& smartChunkUniquePtr, TransmissionInterface& producer) noexcept;
+    SmartChunkPrivateData(iox::unique_ptr<T>&& smartChunkUniquePtr,
+                          mepoo::ChunkHeader* const chunkHeader,
+                          TransmissionInterface& producer) noexcept;
 
     SmartChunkPrivateData(SmartChunkPrivateData&& rhs) noexcept = default;
     SmartChunkPrivateData& operator=(SmartChunkPrivateData&& rhs) noexcept = default;
@@ -42,6 +44,7 @@ struct SmartChunkPrivateData
     ~SmartChunkPrivateData() = default;
 
     optional<iox::unique_ptr<T>> smartChunkUniquePtr;
+    mepoo::ChunkHeader* chunkHeader{nullptr};
     std::reference_wrapper<TransmissionInterface> producerRef;
 };
 
@@ -49,7 +52,8 @@ struct SmartChunkPrivateData
 template <typename TransmissionInterface, typename T, typename H>
 struct SmartChunkPrivateData<TransmissionInterface, const T, H>
 {
-    explicit SmartChunkPrivateData(iox::unique_ptr<const T>&& smartChunkUniquePtr) noexcept;
+    SmartChunkPrivateData(iox::unique_ptr<const T>&& smartChunkUniquePtr,
+                          const mepoo::ChunkHeader* const chunkHeader) noexcept;
 
     SmartChunkPrivateData(SmartChunkPrivateData&& rhs) noexcept = default;
     SmartChunkPrivateData& operator=(SmartChunkPrivateData&& rhs) noexcept = default;
@@ -59,6 +63,7 @@ struct SmartChunkPrivateData<TransmissionInterface, const T, H>
     ~SmartChunkPrivateData() = default;
 
     optional<iox::unique_ptr<const T>> smartChunkUniquePtr;
+    const mepoo::ChunkHeader* chunkHeader{nullptr};
 };
 } // namespace internal
 
@@ -100,6 +105,27 @@ class SmartChunk
     template <typename S = T, typename = ForConsumerOnly<S, T>>
     explicit SmartChunk(iox::unique_ptr<T>&& smartChunkUniquePtr) noexcept;
 
+    /// @brief Constructor for a SmartChunk used by the Producer whose data is not located at the start of the
+    /// user-payload of its first chunk, e.g. a message which was created on an arena with chunks as blocks
+    /// @tparam S is a dummy template parameter to enable the constructor only for non-const T
+    /// @param smartChunkUniquePtr is a 'rvalue' to a 'iox::unique_ptr<T>' with to the data of the encapsulated type
+    /// T
+    /// @param chunkHeader is the ChunkHeader of the first chunk of the sample
+    /// @param producer is a reference to the producer to be able to use producer specific methods
+    template <typename S = T, typename = ForProducerOnly<S, T>>
+    SmartChunk(iox::unique_ptr<T>&& smartChunkUniquePtr,
+               mepoo::ChunkHeader* const chunkHeader,
+               TransmissionInterface& producer) noexcept;
+
+    /// @brief Constructor for a SmartChunk used by the Consumer whose data is not located at the start of the
+    /// user-payload of its first chunk, e.g. a message which was created on an arena with chunks as blocks
+    /// @tparam S is a dummy template parameter to enable the constructor only for const T
+    /// @param smartChunkUniquePtr is a 'rvalue' to a 'iox::unique_ptr<T>' with to the data of the encapsulated type
+    /// T
+    /// @param chunkHeader is the ChunkHeader of the first chunk of the sample
+    template <typename S = T, typename = ForConsumerOnly<S, T>>
+    SmartChunk(iox::unique_ptr<T>&& smartChunkUniquePtr, const mepoo::ChunkHeader* const chunkHeader) noexcept;
+
     ~SmartChunk() noexcept = default;
 
     SmartChunk& operator=(SmartChunk&& rhs) noexcept = default;
@@ -28,16 +28,20 @@ namespace internal
 {
 template <typename TransmissionInterface, typename T, typename H>
 inline SmartChunkPrivateData<TransmissionInterface, T, H>::SmartChunkPrivateData(
-    iox::unique_ptr<T>&& smartChunkUniquePtr, TransmissionInterface& producer) noexcept
+    iox::unique_ptr<T>&& smartChunkUniquePtr,
+    mepoo::ChunkHeader* const chunkHeader,
+    TransmissionInterface& producer) noexcept
     : smartChunkUniquePtr(std::move(smartChunkUniquePtr))
+    , chunkHeader(chunkHeader)
     , producerRef(producer)
 {
 }
 
 template <typename TransmissionInterface, typename T, typename H>
 inline SmartChunkPrivateData<TransmissionInterface, const T, H>::SmartChunkPrivateData(
-    iox::unique_ptr<const T>&& smartChunkUniquePtr) noexcept
+    iox::unique_ptr<const T>&& smartChunkUniquePtr, const mepoo::ChunkHeader* const chunkHeader) noexcept
     : smartChunkUniquePtr(std::move(smartChunkUniquePtr))
+    , chunkHeader(chunkHeader)
 {
 }
 } // namespace internal
@@ -46,14 +50,33 @@ template <typename TransmissionInterface, typename T, typename H>
 template <typename S, typename>
 inline SmartChunk<TransmissionInterface, T, H>::SmartChunk(iox::unique_ptr<T>&& smartChunkUniquePtr,
                                                            TransmissionInterface& producer) noexcept
-    : m_members({std::move(smartChunkUniquePtr), producer})
+    : SmartChunk(std::move(smartChunkUniquePtr),
+                 mepoo::ChunkHeader::fromUserPayload(smartChunkUniquePtr.get()),
+                 producer)
 {
 }
 
 template <typename TransmissionInterface, typename T, typename H>
 template <typename S, typename>
 inline SmartChunk<TransmissionInterface, T, H>::SmartChunk(iox::unique_ptr<T>&& smartChunkUniquePtr) noexcept
-    : m_members(std::move(smartChunkUniquePtr))
+    : SmartChunk(std::move(smartChunkUniquePtr), mepoo::ChunkHeader::fromUserPayload(smartChunkUniquePtr.get()))
+{
+}
+
+template <typename TransmissionInterface, typename T, typename H>
+template <typename S, typename>
+inline SmartChunk<TransmissionInterface, T, H>::SmartChunk(iox::unique_ptr<T>&& smartChunkUniquePtr,
+                                                           mepoo::ChunkHeader* const chunkHeader,
+                                                           TransmissionInterface& producer) noexcept
+    : m_members({std::move(smartChunkUniquePtr), chunkHeader, producer})
+{
+}
+
+template <typename TransmissionInterface, typename T, typename H>
+template <typename S, typename>
+inline SmartChunk<TransmissionInterface, T, H>::SmartChunk(iox::unique_ptr<T>&& smartChunkUniquePtr,
+                                                           const mepoo::ChunkHeader* const chunkHeader) noexcept
+    : m_members(std::move(smartChunkUniquePtr), chunkHeader)
 {
 }
 
@@ -103,20 +126,20 @@ template <typename TransmissionInterface, typename T, typename H>
 inline add_const_conditionally_t<mepoo::ChunkHeader, T>*
 SmartChunk<TransmissionInterface, T, H>::getChunkHeader() noexcept
 {
-    return mepoo::ChunkHeader::fromUserPayload(m_members.smartChunkUniquePtr->get());
+    return m_members.chunkHeader;
 }
 
 template <typename TransmissionInterface, typename T, typename H>
 inline const mepoo::ChunkHeader* SmartChunk<TransmissionInterface, T, H>::getChunkHeader() const noexcept
 {
-    return mepoo::ChunkHeader::fromUserPayload(m_members.smartChunkUniquePtr->get());
+    return m_members.chunkHeader;
 }
 
 template <typename TransmissionInterface, typename T, typename H>
 template <typename R, typename>
 inline add_const_conditionally_t<R, T>& SmartChunk<TransmissionInterface, T, H>::getUserHeader() noexcept
 {
-    return *static_cast<R*>(mepoo::ChunkHeader::fromUserPayload(m_members.smartChunkUniquePtr->get())->userHeader());
+    return *static_cast<R*>(getChunkHeader()->userHeader());
 }
 
 template <typename TransmissionInterface, typename T, typename H>
@@ -20,6 +20,7 @@
 
 #include "iceoryx_posh/internal/popo/base_subscriber.hpp"
 #include "iceoryx_posh/internal/popo/typed_port_api_trait.hpp"
+#include "iceoryx_posh/popo/protobuf_sample.hpp"
 
 namespace iox
 {
@@ -50,11 +51,9 @@ class SubscriberImpl : public BaseSubscriberType
     /// @brief Take the samples from the top of the receive queue.
     /// @return Either a sample or a ChunkReceiveResult.
     /// @details The sample takes care of the cleanup. Don't store the raw pointer to the content of the sample, but
-    /// always the whole sample.
+    /// always the whole sample. The message is located via the 'ProtobufUserHeader' of the first chunk.
     ///
-    expected<Sample<const T, const H>, ChunkReceiveResult> take() noexcept;
-
-    expected<Sample<const T, const H>, ChunkReceiveResult> takeMultiChunk() noexcept;
+    expected<ProtobufSample<const T, const H>, ChunkReceiveResult> take() noexcept;
 
   protected:
     using PortType = typename BaseSubscriberType::PortType;
@@ -38,7 +38,8 @@ inline SubscriberImpl<T, H, BaseSubscriberType>::SubscriberImpl(const capro::Ser
 }
 
 template <typename T, typename H, typename BaseSubscriberType>
-inline expected<Sample<const T, const H>, ChunkReceiveResult> SubscriberImpl<T, H, BaseSubscriberType>::take() noexcept
+inline expected<ProtobufSample<const T, const H>, ChunkReceiveResult>
+SubscriberImpl<T, H, BaseSubscriberType>::take() noexcept
 {
     auto result = BaseSubscriberType::takeChunks();
     if (result.has_error())
@@ -46,40 +47,16 @@ inline expected<Sample<const T, const H>, ChunkReceiveResult> SubscriberImpl<T,
         return err(result.error());
     }
 
-    auto& chunkHeaders = result.value();
-    if (chunkHeaders.size() == 0)
+    const auto& chunkHeaders = result.value();
+    if (chunkHeaders.empty())
     {
-        return err(result.error());
-    }
-
-    mepoo::ChunkHeader* chunkHeader = chunkHeaders[0];
-    auto userPayloadPtr = static_cast<const T*>(chunkHeader->userPayload());
-    userPayloadPtr = reinterpret_cast<const T*>((reinterpret_cast<uint64_t>(userPayloadPtr) + 120));
-    auto samplePtr = iox::unique_ptr<const T>(userPayloadPtr, [this, &chunkHeaders](const T* userPayload) {
-        userPayload = reinterpret_cast<const T*>(reinterpret_cast<uint64_t>(userPayload) - 120);
-        this->port().releaseChunk(chunkHeaders);
-    });
-    return ok<Sample<const T, const H>>(std::move(samplePtr));
-}
-
-template <typename T, typename H, typename BaseSubscriberType>
-inline expected<Sample<const T, const H>, ChunkReceiveResult> SubscriberImpl<T, H, BaseSubscriberType>::takeMultiChunk() noexcept
-{
-    auto result = BaseSubscriberType::takeChunks();
-    if (result.has_error())
-    {
-        return err(result.error());
+        return err(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
     }
 
-    std::vector<mepoo::ChunkHeader*>& chunkHeaders = result.value();
-    mepoo::ChunkHeader* chunkHeader = chunkHeaders[0];
-    auto userPayloadPtr = static_cast<const T*>(chunkHeader->userPayload());
-    userPayloadPtr = reinterpret_cast<const T*>((reinterpret_cast<uint64_t>(userPayloadPtr) + 120));
-    auto samplePtr = iox::unique_ptr<const T>(userPayloadPtr, [this, &chunkHeaders](const T* userPayload) {
-        userPayload = reinterpret_cast<const T*>(reinterpret_cast<uint64_t>(userPayload) - 120);
-        this->port().releaseChunk(chunkHeaders);
-    });
-    return ok<Sample<const T, const H>>(std::move(samplePtr));
+    // the first chunk identifies the whole sample when it is released
+    const mepoo::ChunkHeader* chunkHeader = chunkHeaders.front();
+    return ok<ProtobufSample<const T, const H>>(
+        chunkHeaders, [this, chunkHeader](const T*) { this->port().releaseChunk(chunkHeader); });
 }
 
 template <typename T, typename H, typename BaseSubscriberType>
@@ -19,6 +19,7 @@
 
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/internal/popo/base_client.hpp"
+#include "iceoryx_posh/internal/popo/arena_loan.hpp"
 #include "iceoryx_posh/popo/client_options.hpp"
 #include "iceoryx_posh/popo/trigger_handle.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
@@ -50,6 +51,17 @@ class UntypedClientImpl : public BaseClientT
     /// @note An AllocationError occurs if no chunk is available in the shared memory.
     expected<void*, AllocationError> loan(const uint64_t payloadSize, const uint32_t payloadAlignment) noexcept;
 
+    /// @brief Loans a chunk as block for an arena on which a request is built; the first block starts a new request
+    /// and every further block is added to it, see 'PublisherImpl::loanBlock'
+    /// @param[in] size is the block size requested by the arena
+    /// @param[out] actualSize is the usable size of the loaned block
+    /// @return the block or nullptr if no chunk could be loaned
+    void* loanBlock(size_t size, size_t& actualSize) noexcept;
+
+    /// @brief Returns a block of an arena which loans its blocks via 'loanBlock', see 'PublisherImpl::releaseBlock'
+    /// @param[in] ptr the block as returned by 'loanBlock'
+    void releaseBlock(void* ptr) noexcept;
+
     /// @brief Releases the ownership of the request chunk provided by the payload pointer.
     /// @param requestPayload pointer to the payload of the chunk to be released
     /// @details The requestPayload pointer must have been previously provided by 'loan'
@@ -58,14 +70,17 @@ class UntypedClientImpl : public BaseClientT
     void releaseRequest(void* const requestPayload) noexcept;
 
     /// @brief Sends the provided memory chunk as request to the server.
-    /// @param requestPayload Pointer to the payload of the allocated shared memory chunk.
+    /// @param requestPayload Pointer to the payload of the allocated shared memory chunk or to the root message of an
+    /// arena which loans its blocks via 'loanBlock'; the position of the root message is recorded for the server
     /// @return Error if sending was not successful
     expected<void, ClientSendError> send(void* const requestPayload) noexcept;
 
     /// @brief Take the response chunk from the top of the receive queue.
     /// @return The payload pointer of the request chunk taken.
     /// @details No automatic cleanup of the associated chunk is performed
-    ///          and must be manually done by calling 'releaseResponse'
+    ///          and must be manually done by calling 'releaseResponse'. For a response which was built on an arena
+    ///          this is the payload of its first chunk; 'mepoo::protobufRootMessage<ResponseHeader>' locates the
+    ///          message.
     expected<const void*, ChunkReceiveResult> take() noexcept;
 
     /// @brief Releases the ownership of the response chunk provided by the payload pointer.
@@ -80,6 +95,9 @@ class UntypedClientImpl : public BaseClientT
     using BaseClientT::port;
 
     explicit UntypedClientImpl(PortType&& port) noexcept;
+
+  private:
+    ArenaLoan<RequestHeader> m_arenaLoan;
 };
 } // namespace popo
 } // namespace iox
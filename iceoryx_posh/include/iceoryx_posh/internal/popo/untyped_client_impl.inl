@@ -19,6 +19,8 @@
 
 #include "iceoryx_posh/internal/popo/untyped_client_impl.hpp"
 
+#include <cassert>
+
 namespace iox
 {
 namespace popo
@@ -55,6 +57,37 @@ expected<void*, AllocationError> UntypedClientImpl<BaseClientT>::loan(const uint
     return ok(mepoo::ChunkHeader::fromUserHeader(allocationResult.value())->userPayload());
 }
 
+template <typename BaseClientT>
+void* UntypedClientImpl<BaseClientT>::loanBlock(size_t size, size_t& actualSize) noexcept
+{
+    return m_arenaLoan.loanBlock(
+        size,
+        actualSize,
+        [this](const uint64_t blockSize, const uint32_t alignment) -> expected<mepoo::ChunkHeader*, AllocationError> {
+            auto result = port().allocateMultiChunkRequest(blockSize, alignment);
+            if (result.has_error())
+            {
+                return err(result.error());
+            }
+            return ok(result.value()->getChunkHeader());
+        },
+        [this](const uint64_t blockSize, const uint32_t alignment) {
+            return port().allocateRequestChunk(blockSize, alignment);
+        });
+}
+
+template <typename BaseClientT>
+void UntypedClientImpl<BaseClientT>::releaseBlock(void* ptr) noexcept
+{
+    assert(ptr != nullptr && "block ptr should not be null");
+
+    auto* chunkHeader = m_arenaLoan.releaseBlock(ptr);
+    if (chunkHeader != nullptr)
+    {
+        port().releaseRequest(static_cast<RequestHeader*>(chunkHeader->userHeader()));
+    }
+}
+
 template <typename BaseClientT>
 void UntypedClientImpl<BaseClientT>::releaseRequest(void* const requestPayload) noexcept
 {
@@ -68,6 +101,14 @@ void UntypedClientImpl<BaseClientT>::releaseRequest(void* const requestPayload)
 template <typename BaseClientT>
 expected<void, ClientSendError> UntypedClientImpl<BaseClientT>::send(void* const requestPayload) noexcept
 {
+    // a message on an arena can be located in any of its blocks; the first block identifies the whole request
+    if (m_arenaLoan.contains(requestPayload))
+    {
+        auto* chunkHeader = m_arenaLoan.setRootMessage(requestPayload);
+        m_arenaLoan.finish(chunkHeader, nullopt);
+        return port().sendRequest(static_cast<RequestHeader*>(chunkHeader->userHeader()));
+    }
+
     auto* chunkHeader = mepoo::ChunkHeader::fromUserPayload(requestPayload);
     if (chunkHeader == nullptr)
     {
@@ -19,6 +19,7 @@
 
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/internal/popo/base_server.hpp"
+#include "iceoryx_posh/internal/popo/arena_loan.hpp"
 #include "iceoryx_posh/popo/server_options.hpp"
 
 namespace iox
@@ -43,7 +44,9 @@ class UntypedServerImpl : public BaseServerT
     /// @brief Take the request chunk from the top of the receive queue.
     /// @return The payload pointer of the request chunk taken.
     /// @details No automatic cleanup of the associated chunk is performed
-    ///          and must be manually done by calling 'releaseRequest'
+    ///          and must be manually done by calling 'releaseRequest'. For a request which was built on an arena
+    ///          this is the payload of its first chunk; 'mepoo::protobufRootMessage<RequestHeader>' locates the
+    ///          message.
     expected<const void*, ServerRequestResult> take() noexcept;
 
     /// @brief Releases the ownership of the request chunk provided by the payload pointer.
@@ -65,8 +68,22 @@ class UntypedServerImpl : public BaseServerT
                                           const uint64_t payloadSize,
                                           const uint32_t payloadAlignment) noexcept;
 
+    /// @brief Loans a chunk as block for an arena on which a response is built; the first block starts a new response
+    /// to the given request and every further block is added to it, see 'PublisherImpl::loanBlock'
+    /// @param[in] requestHeader The requestHeader to which the response belongs to, to determine where to send the
+    /// response
+    /// @param[in] size is the block size requested by the arena
+    /// @param[out] actualSize is the usable size of the loaned block
+    /// @return the block or nullptr if no chunk could be loaned
+    void* loanBlock(const RequestHeader* const requestHeader, size_t size, size_t& actualSize) noexcept;
+
+    /// @brief Returns a block of an arena which loans its blocks via 'loanBlock', see 'PublisherImpl::releaseBlock'
+    /// @param[in] ptr the block as returned by 'loanBlock'
+    void releaseBlock(void* ptr) noexcept;
+
     /// @brief Sends the provided memory chunk as response to the client.
-    /// @param responsePayload Pointer to the payload of the allocated shared memory chunk.
+    /// @param responsePayload Pointer to the payload of the allocated shared memory chunk or to the root message of an
+    /// arena which loans its blocks via 'loanBlock'; the position of the root message is recorded for the client
     /// @return Error if sending was not successful
     expected<void, ServerSendError> send(void* const responsePayload) noexcept;
 
@@ -82,6 +99,9 @@ class UntypedServerImpl : public BaseServerT
     using BaseServerT::port;
 
     explicit UntypedServerImpl(PortType&& port) noexcept;
+
+  private:
+    ArenaLoan<ResponseHeader> m_arenaLoan;
 };
 } // namespace popo
 } // namespace iox
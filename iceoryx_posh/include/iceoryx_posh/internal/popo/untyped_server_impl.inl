@@ -19,6 +19,8 @@
 
 #include "iceoryx_posh/internal/popo/untyped_server_impl.hpp"
 
+#include <cassert>
+
 namespace iox
 {
 namespace popo
@@ -78,9 +80,51 @@ expected<void*, AllocationError> UntypedServerImpl<BaseServerT>::loan(const Requ
     return ok(mepoo::ChunkHeader::fromUserHeader(allocationResult.value())->userPayload());
 }
 
+template <typename BaseServerT>
+void* UntypedServerImpl<BaseServerT>::loanBlock(const RequestHeader* const requestHeader,
+                                                size_t size,
+                                                size_t& actualSize) noexcept
+{
+    return m_arenaLoan.loanBlock(
+        size,
+        actualSize,
+        [this, requestHeader](const uint64_t blockSize,
+                              const uint32_t alignment) -> expected<mepoo::ChunkHeader*, AllocationError> {
+            auto result = port().allocateMultiChunkResponse(requestHeader, blockSize, alignment);
+            if (result.has_error())
+            {
+                return err(result.error());
+            }
+            return ok(result.value()->getChunkHeader());
+        },
+        [this](const uint64_t blockSize, const uint32_t alignment) {
+            return port().allocateResponseChunk(blockSize, alignment);
+        });
+}
+
+template <typename BaseServerT>
+void UntypedServerImpl<BaseServerT>::releaseBlock(void* ptr) noexcept
+{
+    assert(ptr != nullptr && "block ptr should not be null");
+
+    auto* chunkHeader = m_arenaLoan.releaseBlock(ptr);
+    if (chunkHeader != nullptr)
+    {
+        port().releaseResponse(static_cast<ResponseHeader*>(chunkHeader->userHeader()));
+    }
+}
+
 template <typename BaseServerT>
 expected<void, ServerSendError> UntypedServerImpl<BaseServerT>::send(void* const responsePayload) noexcept
 {
+    // a message on an arena can be located in any of its blocks; the first block identifies the whole response
+    if (m_arenaLoan.contains(responsePayload))
+    {
+        auto* chunkHeader = m_arenaLoan.setRootMessage(responsePayload);
+        m_arenaLoan.finish(chunkHeader, nullopt);
+        return port().sendResponse(static_cast<ResponseHeader*>(chunkHeader->userHeader()));
+    }
+
     auto* chunkHeader = mepoo::ChunkHeader::fromUserPayload(responsePayload);
     if (chunkHeader == nullptr)
     {
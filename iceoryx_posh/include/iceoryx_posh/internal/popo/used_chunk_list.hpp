@@ -31,6 +31,19 @@ namespace iox
 {
 namespace popo
 {
+namespace internal
+{
+/// @brief exponent of the smallest power of two which is at least twice the capacity of a UsedChunkList
+constexpr uint32_t usedChunkListLookupTableBits(const uint32_t capacity) noexcept
+{
+    uint32_t bits{1U};
+    while ((1U << bits) < 2U * capacity)
+    {
+        ++bits;
+    }
+    return bits;
+}
+} // namespace internal
 
 /// @brief This class is used to keep track of the chunks currently in use by the application.
 ///        In case the application terminates while holding chunks, this list is used by RouDi to retain ownership of
@@ -42,6 +55,10 @@ namespace popo
 ///        accessed. Additionally, the type stored is this array must be less or equal to 64 bit in order to write it
 ///        within one clock cycle to prevent torn writes, which would corrupt the list and could potentially crash
 ///        RouDi.
+///        The samples are found by the ChunkHeader of their first chunk with an open addressing hash table which holds
+///        indices into the array, hence remove is independent of the number of held samples and chunks per sample.
+///        The hash is derived from the address of the ChunkHeader in the runtime process. This is fine since only the
+///        runtime uses the lookup table; RouDi solely accesses the array for the cleanup.
 template <uint32_t Capacity>
 class UsedChunkList
 {
@@ -53,18 +70,25 @@ class UsedChunkList
 
     /// @brief Inserts a SharedChunk into the list
     /// @param[in] chunk to store in the list
+    /// @param[in] chunkManagementManagement which takes over the chunk when a new sample is started
+    /// @param[in] initialized if true, the chunk is appended to the sample of 'chunkManagementManagement', which must
+    /// already be in the list, and occupies no entry of its own
     /// @return true if successful, otherwise false if e.g. the list is already full
     /// @note only from runtime context
     bool insert(mepoo::SharedChunk chunk, mepoo::ChunkManagementManagement* chunkManagementManagement, bool initialized) noexcept;
 
+    /// @brief Inserts a SharedMultiChunk with all its chunks into the list; further chunks can be appended to it
+    /// with the 'initialized' flag of the other insert overload
+    /// @param[in] chunk to store in the list
+    /// @return true if successful, otherwise false if e.g. the list is already full
     bool insert(mepoo::SharedMultiChunk chunk) noexcept;
 
-    /// @brief Removes a chunk from the list
-    /// @param[in] chunkHeader to look for a corresponding SharedChunk
+    /// @brief Removes a sample with all its chunks from the list
+    /// @param[in] chunkHeader of the first chunk of the sample to look for a corresponding SharedMultiChunk
     /// @param[out] chunk which is removed
     /// @return true if successfully removed, otherwise false if e.g. the chunkHeader was not found in the list
     /// @note only from runtime context
-    bool remove(std::vector<mepoo::ChunkHeader*>& chunkHeaders, mepoo::SharedMultiChunk& chunk) noexcept;
+    bool remove(const mepoo::ChunkHeader* chunkHeader, mepoo::SharedMultiChunk& chunk) noexcept;
 
     /// @brief Cleans up all the remaining chunks from the list.
     /// @note from RouDi context once the applications walked the plank. It is unsafe to call this if the application is
@@ -74,19 +98,29 @@ class UsedChunkList
   private:
     void init() noexcept;
 
+    /// @brief Occupies a free entry of the array and registers it in the lookup table
+    /// @return the index of the entry or INVALID_INDEX if the list is full
+    uint32_t acquireEntry(const mepoo::ChunkHeader* chunkHeader) noexcept;
+
+    static uint32_t homeBucket(const mepoo::ChunkHeader* chunkHeader) noexcept;
+    uint32_t findBucket(const mepoo::ChunkHeader* chunkHeader) const noexcept;
+    void removeBucket(uint32_t bucket) noexcept;
+
   private:
     static constexpr uint32_t INVALID_INDEX{Capacity};
+    /// @brief power of two with a load factor of at most 0.5 to keep the probe sequences short
+    static constexpr uint32_t LOOKUP_TABLE_BITS{internal::usedChunkListLookupTableBits(Capacity)};
+    static constexpr uint32_t LOOKUP_TABLE_SIZE{1U << LOOKUP_TABLE_BITS};
 
     using DataElement_t = mepoo::ShmSafeUnmanagedMultiChunk;
     static constexpr DataElement_t DATA_ELEMENT_LOGICAL_NULLPTR{};
 
   private:
     concurrent::AtomicFlag m_synchronizer = ATOMIC_FLAG_INIT;
-    uint32_t m_usedListHead{INVALID_INDEX};
-    uint32_t m_currentUsedIndex{INVALID_INDEX};
     uint32_t m_freeListHead{0u};
     uint32_t m_listIndices[Capacity];
     DataElement_t m_listData[Capacity];
+    uint32_t m_lookupTable[LOOKUP_TABLE_SIZE];
 };
 
 } // namespace popo
@@ -42,121 +42,64 @@ bool UsedChunkList<Capacity>::insert(mepoo::SharedChunk chunk
                                      , mepoo::ChunkManagementManagement* chunkManagementManagement
                                      , bool initialized) noexcept
 {
-    auto hasFreeSpace = m_freeListHead != INVALID_INDEX;
-    if (hasFreeSpace)
+    if (initialized)
     {
-        // get next free entry after freelistHead
-        auto nextFree = m_listIndices[m_freeListHead];
-
-        // freeListHead is getting new usedListHead, next of this entry is updated to next in usedList
-        m_listIndices[m_freeListHead] = m_usedListHead;
-        m_usedListHead = m_freeListHead;
-
-        if (!initialized)
-        {
-            m_listData[m_usedListHead] = DataElement_t(chunkManagementManagement);
-            m_listData[m_usedListHead].addChunkManagement(chunk.release());
-            m_currentUsedIndex = m_usedListHead;      
-        } 
-        else
-        {
-            m_listData[m_currentUsedIndex].addChunkManagement(chunk.release());
-        }
-
-        // set freeListHead to the next free entry
-        m_freeListHead = nextFree;
+        // the chunk belongs to the sample which is currently assembled and therefore needs no entry of its own; the
+        // entry of that sample refers to the same ChunkManagementManagement, hence RouDi takes over the chunk as well
+        chunkManagementManagement->addChunkManagement(chunk.release());
 
         m_synchronizer.clear(std::memory_order_release);
         return true;
     }
-    else
+
+    auto index = acquireEntry(chunk.getChunkHeader());
+    if (index == INVALID_INDEX)
     {
         return false;
     }
+
+    m_listData[index] = DataElement_t(chunkManagementManagement);
+    m_listData[index].addChunkManagement(chunk.release());
+
+    m_synchronizer.clear(std::memory_order_release);
+    return true;
 }
 
 template <uint32_t Capacity>
 bool UsedChunkList<Capacity>::insert(mepoo::SharedMultiChunk chunk) noexcept
 {
-    auto hasFreeSpace = m_freeListHead != INVALID_INDEX;
-    if (hasFreeSpace)
-    {
-        // get next free entry after freelistHead
-        auto nextFree = m_listIndices[m_freeListHead];
-
-        // freeListHead is getting new usedListHead, next of this entry is updated to next in usedList
-        m_listIndices[m_freeListHead] = m_usedListHead;
-        m_usedListHead = m_freeListHead;
-
-        m_listData[m_usedListHead] = DataElement_t(chunk);
-
-        // set freeListHead to the next free entry
-        m_freeListHead = nextFree;
-
-        m_synchronizer.clear(std::memory_order_release);
-        return true;
-    }
-    else
+    auto index = acquireEntry(chunk.getChunkHeader());
+    if (index == INVALID_INDEX)
     {
         return false;
     }
+
+    m_listData[index] = DataElement_t(chunk);
+
+    m_synchronizer.clear(std::memory_order_release);
+    return true;
 }
 
 template <uint32_t Capacity>
-bool UsedChunkList<Capacity>::remove(std::vector<mepoo::ChunkHeader*>& chunkHeaders, mepoo::SharedMultiChunk& chunk) noexcept
+bool UsedChunkList<Capacity>::remove(const mepoo::ChunkHeader* chunkHeader, mepoo::SharedMultiChunk& chunk) noexcept
 {
-    auto previous = INVALID_INDEX;
-
-    // go through usedList with stored chunks
-    for (auto current = m_usedListHead; current != INVALID_INDEX; current = m_listIndices[current])
+    auto bucket = findBucket(chunkHeader);
+    if (bucket == LOOKUP_TABLE_SIZE)
     {
-        if (!m_listData[current].isLogicalNullptr())
-        {
-            // does the entry match the one we want to remove?
-            //if (m_listData[current].getChunkHeaders() == chunkHeaders)
-            auto chunkHeadersInList = m_listData[current].getChunkHeaders();
-            bool hit = true;
-            if (chunkHeadersInList.size() == chunkHeaders.size())
-            {
-                for (decltype(chunkHeadersInList.size()) i = 0; i < chunkHeaders.size(); ++i)
-                {
-                    if (chunkHeadersInList[i] != chunkHeaders[i])
-                    {
-                        hit = false;
-                        break;
-                    }
-                }
-            }
-            else
-            {
-                hit = false;
-            }
-
-            if (hit)
-            {
-                chunk = m_listData[current].releaseToSharedChunk();
-
-                // remove index from used list
-                if (current == m_usedListHead)
-                {
-                    m_usedListHead = m_listIndices[current];
-                }
-                else
-                {
-                    m_listIndices[previous] = m_listIndices[current];
-                }
-
-                // insert index to free list
-                m_listIndices[current] = m_freeListHead;
-                m_freeListHead = current;
-
-                m_synchronizer.clear(std::memory_order_release);
-                return true;
-            }
-        }
-        previous = current;
+        return false;
     }
-    return false;
+
+    auto index = m_lookupTable[bucket];
+    removeBucket(bucket);
+
+    chunk = m_listData[index].releaseToSharedChunk();
+
+    // insert index to free list
+    m_listIndices[index] = m_freeListHead;
+    m_freeListHead = index;
+
+    m_synchronizer.clear(std::memory_order_release);
+    return true;
 }
 
 template <uint32_t Capacity>
@@ -195,9 +138,13 @@ void UsedChunkList<Capacity>::init() noexcept
     }
 
 
-    m_usedListHead = INVALID_INDEX;
     m_freeListHead = 0U;
 
+    for (auto& bucket : m_lookupTable)
+    {
+        bucket = INVALID_INDEX;
+    }
+
     // clear data
     for (auto& data : m_listData)
     {
@@ -207,6 +154,69 @@ void UsedChunkList<Capacity>::init() noexcept
     m_synchronizer.clear(std::memory_order_release);
 }
 
+template <uint32_t Capacity>
+uint32_t UsedChunkList<Capacity>::acquireEntry(const mepoo::ChunkHeader* chunkHeader) noexcept
+{
+    auto index = m_freeListHead;
+    if (index == INVALID_INDEX)
+    {
+        return INVALID_INDEX;
+    }
+    m_freeListHead = m_listIndices[index];
+
+    // with at most half of the buckets occupied there is always a free bucket
+    auto bucket = homeBucket(chunkHeader);
+    while (m_lookupTable[bucket] != INVALID_INDEX)
+    {
+        bucket = (bucket + 1U) & (LOOKUP_TABLE_SIZE - 1U);
+    }
+    m_lookupTable[bucket] = index;
+
+    return index;
+}
+
+template <uint32_t Capacity>
+uint32_t UsedChunkList<Capacity>::homeBucket(const mepoo::ChunkHeader* chunkHeader) noexcept
+{
+    // Fibonacci hashing; the upper bits of the product depend on all bits of the address
+    constexpr uint64_t GOLDEN_RATIO{0x9E3779B97F4A7C15ULL};
+    auto hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(chunkHeader)) * GOLDEN_RATIO;
+    return static_cast<uint32_t>(hash >> (64U - LOOKUP_TABLE_BITS));
+}
+
+template <uint32_t Capacity>
+uint32_t UsedChunkList<Capacity>::findBucket(const mepoo::ChunkHeader* chunkHeader) const noexcept
+{
+    for (auto bucket = homeBucket(chunkHeader); m_lookupTable[bucket] != INVALID_INDEX;
+         bucket = (bucket + 1U) & (LOOKUP_TABLE_SIZE - 1U))
+    {
+        // the first chunk identifies the whole sample
+        if (m_listData[m_lookupTable[bucket]].getChunkHeader() == chunkHeader)
+        {
+            return bucket;
+        }
+    }
+    return LOOKUP_TABLE_SIZE;
+}
+
+template <uint32_t Capacity>
+void UsedChunkList<Capacity>::removeBucket(uint32_t bucket) noexcept
+{
+    // backward shift deletion; entries behind the hole move up if the hole is on their probe sequence, this keeps
+    // the table free of tombstones
+    constexpr uint32_t MASK{LOOKUP_TABLE_SIZE - 1U};
+    for (auto next = (bucket + 1U) & MASK; m_lookupTable[next] != INVALID_INDEX; next = (next + 1U) & MASK)
+    {
+        auto home = homeBucket(m_listData[m_lookupTable[next]].getChunkHeader());
+        if (((next - home) & MASK) >= ((next - bucket) & MASK))
+        {
+            m_lookupTable[bucket] = m_lookupTable[next];
+            bucket = next;
+        }
+    }
+    m_lookupTable[bucket] = INVALID_INDEX;
+}
+
 } // namespace popo
 } // namespace iox
 
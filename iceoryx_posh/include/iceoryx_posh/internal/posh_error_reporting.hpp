@@ -130,6 +130,7 @@ namespace iox
     error(MEPOO__SEGMENT_COULD_NOT_APPLY_POSIX_RIGHTS_TO_SHARED_MEMORY) \
     error(MEPOO__SEGMENT_UNABLE_TO_CREATE_SHARED_MEMORY_OBJECT) \
     error(MEPOO__SEGMENT_INSUFFICIENT_SEGMENT_IDS) \
+    error(MEPOO__SEGMENT_FIXED_BASE_ADDRESS_UNAVAILABLE) \
     error(MEPOO__INTROSPECTION_CONTAINER_FULL) \
     error(MEPOO__CANNOT_ALLOCATE_CHUNK) \
     error(MEPOO__MAXIMUM_NUMBER_OF_MEMPOOLS_REACHED) \
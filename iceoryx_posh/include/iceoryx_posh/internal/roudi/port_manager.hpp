@@ -160,6 +160,12 @@ class PortManager
     bool isCompatiblePubSub(const PublisherPortRouDiType& publisher,
                             const SubscriberPortType& subscriber) const noexcept;
 
+    /// @brief A subscriber can be connected to a publisher whose messages have another ABI hash, see
+    /// 'popo::MessageLayout::withAbiHash', only if it receives serialized copies of the messages; ports with an ABI
+    /// hash are never connected to ports without one
+    bool isCompatibleLayout(const PublisherPortRouDiType& publisher,
+                            const SubscriberPortType& subscriber) const noexcept;
+
     bool sendToAllMatchingPublisherPorts(const capro::CaproMessage& message,
                                          SubscriberPortType& subscriberSource) noexcept;
 
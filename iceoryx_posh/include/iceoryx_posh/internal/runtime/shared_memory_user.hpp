@@ -77,7 +77,8 @@ class SharedMemoryUser
                                                                 const ResourceType resourceType,
                                                                 const ShmName_t& shmName,
                                                                 const uint64_t shmSize,
-                                                                const AccessMode accessMode) noexcept;
+                                                                const AccessMode accessMode,
+                                                                const uint64_t fixedBaseAddress) noexcept;
 
 
   private:
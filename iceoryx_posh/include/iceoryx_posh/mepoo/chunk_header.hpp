@@ -22,8 +22,10 @@
 #include "iceoryx_posh/internal/popo/building_blocks/unique_port_id.hpp"
 #include "iceoryx_posh/mepoo/chunk_settings.hpp"
 #include "iox/memory.hpp"
+#include "iox/optional.hpp"
 
 #include <cstdint>
+#include <limits>
 
 namespace iox
 {
@@ -40,9 +42,47 @@ struct NoUserHeader
 {
 };
 
+/// @brief User-header of the chunks which carry the arena blocks of a protobuf message. The publisher records where
+/// the root message was placed by the arena, relative to the user-payload of the first chunk, so that a subscriber
+/// does not need to know the internal block layout of the arena to find the message. A message which was published
+/// serialized instead records its size in bytes.
+/// @note the user-header of the publisher is the first member, which keeps it at the start of the user-header area
+/// @note the header is recognized by its magic value and version, not by the size of the user-header, since a
+/// foreign user-header might be as large or larger; the version must be increased when the layout changes
+template <typename H = NoUserHeader>
+struct ProtobufUserHeader
+{
+    static constexpr uint32_t MAGIC{0x42504F49U}; // 'IOPB' in little endian byte order
+    static constexpr uint32_t VERSION{1U};
+    static constexpr int64_t NO_ROOT_MESSAGE{std::numeric_limits<int64_t>::min()};
+    static constexpr uint64_t NOT_SERIALIZED{std::numeric_limits<uint64_t>::max()};
+
+    ProtobufUserHeader() noexcept = default;
+
+    /// @brief Constructs the embedded user-header in place, e.g. for user-headers without a default constructor like
+    /// the 'RequestHeader' of a client
+    /// @param[in] args are forwarded to the constructor of the user-header
+    template <typename... Args>
+    explicit ProtobufUserHeader(in_place_t, Args&&... args) noexcept
+        : m_userHeader(std::forward<Args>(args)...)
+    {
+    }
+
+    H m_userHeader;
+    uint32_t m_magic{MAGIC};
+    uint32_t m_version{VERSION};
+    int64_t m_rootMessageOffset{NO_ROOT_MESSAGE};
+    uint64_t m_serializedSize{NOT_SERIALIZED};
+};
 
-static constexpr uint64_t PROTO_USER_HEADER_SIZE{120};
-using ProtoUserHeader = ZeroedBuffer<char, PROTO_USER_HEADER_SIZE>;
+template <typename H>
+constexpr uint32_t ProtobufUserHeader<H>::MAGIC;
+template <typename H>
+constexpr uint32_t ProtobufUserHeader<H>::VERSION;
+template <typename H>
+constexpr int64_t ProtobufUserHeader<H>::NO_ROOT_MESSAGE;
+template <typename H>
+constexpr uint64_t ProtobufUserHeader<H>::NOT_SERIALIZED;
 
 struct ChunkHeader
 {
@@ -181,6 +221,83 @@ struct ChunkHeader
     UserPayloadOffset_t m_userPayloadOffset{sizeof(ChunkHeader)};
 };
 
+/// @brief Obtains the 'ProtobufUserHeader<H>' of a chunk
+/// @param[in] chunkHeader of the chunk
+/// @return the user-header or nullptr if the chunk carries no user-header, a smaller one or one with a different
+/// magic value or version
+template <typename H>
+inline const ProtobufUserHeader<H>* protobufUserHeader(const ChunkHeader* const chunkHeader) noexcept
+{
+    using ProtobufUserHeader_t = ProtobufUserHeader<H>;
+
+    if (chunkHeader->userHeaderSize() < sizeof(ProtobufUserHeader_t))
+    {
+        return nullptr;
+    }
+    auto* userHeader = static_cast<const ProtobufUserHeader_t*>(chunkHeader->userHeader());
+    if (userHeader->m_magic != ProtobufUserHeader_t::MAGIC || userHeader->m_version != ProtobufUserHeader_t::VERSION)
+    {
+        return nullptr;
+    }
+    return userHeader;
+}
+
+/// @brief Locates the root message of a sample whose first chunk might carry a 'ProtobufUserHeader<H>'. Chunks
+/// without it or without a recorded root message carry the message at the start of the user-payload, e.g. a
+/// serialized message or a message which was not created on an arena.
+/// @param[in] chunkHeader of the first chunk of the sample
+/// @return the address of the root message
+template <typename H>
+inline const void* protobufRootMessage(const ChunkHeader* const chunkHeader) noexcept
+{
+    using ProtobufUserHeader_t = ProtobufUserHeader<H>;
+
+    auto userPayloadAddress = reinterpret_cast<uint64_t>(chunkHeader->userPayload());
+    auto* userHeader = protobufUserHeader<H>(chunkHeader);
+    if (userHeader == nullptr)
+    {
+        return reinterpret_cast<const void*>(userPayloadAddress);
+    }
+    auto rootMessageOffset = userHeader->m_rootMessageOffset;
+    if (rootMessageOffset == ProtobufUserHeader_t::NO_ROOT_MESSAGE)
+    {
+        return reinterpret_cast<const void*>(userPayloadAddress);
+    }
+
+    // the offset might be negative when the arena placed the message in a block with a lower address than the first
+    // one; the unsigned arithmetic wraps around accordingly
+    return reinterpret_cast<const void*>(userPayloadAddress + static_cast<uint64_t>(rootMessageOffset));
+}
+
+/// @copydoc protobufRootMessage(const ChunkHeader* const)
+template <typename H>
+inline void* protobufRootMessage(ChunkHeader* const chunkHeader) noexcept
+{
+    return const_cast<void*>(protobufRootMessage<H>(static_cast<const ChunkHeader*>(chunkHeader)));
+}
+
+/// @brief Obtains the size of a message which was serialized into the user-payload, e.g. by
+/// 'Publisher::publishSerialized'. The user-payload might be larger than the message due to the chunk layout.
+/// @param[in] chunkHeader of the chunk carrying the serialized message
+/// @return the size of the serialized message in bytes or 'nullopt' if the chunk carries no serialized message
+template <typename H>
+inline optional<uint64_t> protobufSerializedSize(const ChunkHeader* const chunkHeader) noexcept
+{
+    using ProtobufUserHeader_t = ProtobufUserHeader<H>;
+
+    auto* userHeader = protobufUserHeader<H>(chunkHeader);
+    if (userHeader == nullptr)
+    {
+        return nullopt;
+    }
+    auto serializedSize = userHeader->m_serializedSize;
+    if (serializedSize == ProtobufUserHeader_t::NOT_SERIALIZED)
+    {
+        return nullopt;
+    }
+    return serializedSize;
+}
+
 } // namespace mepoo
 } // namespace iox
 
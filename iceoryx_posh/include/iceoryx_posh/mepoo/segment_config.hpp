@@ -29,16 +29,20 @@ namespace mepoo
 {
 struct SegmentConfig
 {
+    static constexpr uint64_t NO_FIXED_BASE_ADDRESS{0U};
+
     struct SegmentEntry
     {
         SegmentEntry(const PosixGroup::groupName_t& readerGroup,
                      const PosixGroup::groupName_t& writerGroup,
                      const MePooConfig& memPoolConfig,
-                     iox::mepoo::MemoryInfo memoryInfo = iox::mepoo::MemoryInfo()) noexcept
+                     iox::mepoo::MemoryInfo memoryInfo = iox::mepoo::MemoryInfo(),
+                     const uint64_t fixedBaseAddress = NO_FIXED_BASE_ADDRESS) noexcept
             : m_readerGroup(readerGroup)
             , m_writerGroup(writerGroup)
             , m_mempoolConfig(memPoolConfig)
             , m_memoryInfo(memoryInfo)
+            , m_fixedBaseAddress(fixedBaseAddress)
 
         {
         }
@@ -47,6 +51,9 @@ struct SegmentConfig
         PosixGroup::groupName_t m_writerGroup;
         MePooConfig m_mempoolConfig;
         iox::mepoo::MemoryInfo m_memoryInfo;
+        /// @brief virtual address at which RouDi and all applications map the segment, which keeps absolute
+        /// pointers into the segment valid across processes; NO_FIXED_BASE_ADDRESS lets the OS choose the address
+        uint64_t m_fixedBaseAddress{NO_FIXED_BASE_ADDRESS};
     };
 
     vector<SegmentEntry, MAX_SHM_SEGMENTS> m_sharedMemorySegments;
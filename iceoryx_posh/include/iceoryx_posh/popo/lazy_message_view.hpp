@@ -0,0 +1,134 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_LAZY_MESSAGE_VIEW_HPP
+#define IOX_POSH_POPO_LAZY_MESSAGE_VIEW_HPP
+
+#include "iox/expected.hpp"
+#include "iox/logging.hpp"
+#include "iox/vector.hpp"
+
+#include <google/protobuf/parse_context.h>
+
+#include <cstdint>
+#include <ostream>
+
+namespace iox
+{
+namespace popo
+{
+enum class LazyMessageViewError : uint8_t
+{
+    /// @brief the tags and lengths of the serialized message do not add up to its size
+    MALFORMED_MESSAGE,
+    /// @brief the value of an accessed field could not be parsed
+    MALFORMED_FIELD
+};
+
+/// @brief Converts the LazyMessageViewError to a string literal
+/// @param[in] value to convert to a string literal
+/// @return pointer to a string literal
+inline constexpr const char* asStringLiteral(const LazyMessageViewError value) noexcept;
+
+/// @brief Convenience stream operator to easily use the 'asStringLiteral' function with std::ostream
+/// @param[in] stream sink to write the message to
+/// @param[in] value to convert to a string literal
+/// @return the reference to 'stream' which was provided as input parameter
+inline std::ostream& operator<<(std::ostream& stream, LazyMessageViewError value) noexcept;
+
+/// @brief Convenience stream operator to easily use the 'asStringLiteral' function with iox::log::LogStream
+/// @param[in] stream sink to write the message to
+/// @param[in] value to convert to a string literal
+/// @return the reference to 'stream' which was provided as input parameter
+inline log::LogStream& operator<<(log::LogStream& stream, LazyMessageViewError value) noexcept;
+
+/// @brief A read-only view of a serialized protobuf message, e.g. the user-payload of a chunk received by a
+/// subscriber, which parses only the fields that are accessed.
+/// @details The constructor scans the tags of the message once and remembers the byte range of every field.
+/// Consecutive occurrences of a field, like the elements of a repeated field, share one range. A field is parsed
+/// into the cached message on its first access and merged in wire order, so the cached value equals the one of a
+/// full parse. Members of a oneof are the exception, the last accessed member wins. If the message has more ranges
+/// than Capacity, the whole message is parsed on the first access instead.
+/// @code
+///     LazyMessageView<tutorial::Person> view(sample.get(), sample.getUserHeader().size);
+///     view.get(tutorial::Person::kIdFieldNumber).and_then([](auto& person) { std::cout << person->id(); });
+/// @endcode
+/// @tparam T is the protobuf message type
+/// @tparam Capacity is the maximum number of field ranges of the message
+template <typename T, uint64_t Capacity = 64U>
+class LazyMessageView
+{
+  public:
+    /// @brief Scans the tags of a serialized message
+    /// @param[in] data of the serialized message, must outlive the view
+    /// @param[in] size of the serialized message in bytes
+    LazyMessageView(const void* const data, const uint64_t size) noexcept;
+
+    ~LazyMessageView() noexcept = default;
+
+    LazyMessageView(const LazyMessageView&) = delete;
+    LazyMessageView(LazyMessageView&&) = delete;
+    LazyMessageView& operator=(const LazyMessageView&) = delete;
+    LazyMessageView& operator=(LazyMessageView&&) = delete;
+
+    /// @brief Checks whether the serialized message contains a field without parsing it
+    /// @param[in] fieldNumber of the field
+    /// @return true if the field occurs in the serialized message, false otherwise
+    bool has(const uint32_t fieldNumber) const noexcept;
+
+    /// @brief Parses a field unless it was accessed before
+    /// @param[in] fieldNumber of the field, e.g. T::kIdFieldNumber
+    /// @return the message with all fields which were accessed so far or the error
+    expected<const T*, LazyMessageViewError> get(const uint32_t fieldNumber) noexcept;
+
+    /// @brief Parses all fields which were not accessed before
+    /// @return the completely parsed message or the error
+    expected<const T*, LazyMessageViewError> getAll() noexcept;
+
+  private:
+    struct FieldRange
+    {
+        uint32_t fieldNumber{0U};
+        uint32_t begin{0U};
+        uint32_t end{0U};
+        bool isParsed{false};
+    };
+
+    /// @brief Calls 'onField(fieldNumber, begin, end)' for every field from the offset 'begin' on, until it returns
+    /// false
+    /// @return false if the message is malformed, true otherwise
+    template <typename OnField>
+    bool forEachField(const uint32_t begin, const OnField& onField) const noexcept;
+    void scan() noexcept;
+    bool parse(FieldRange& range) noexcept;
+
+  private:
+    const char* m_data{nullptr};
+    uint64_t m_size{0U};
+    T m_message;
+    vector<FieldRange, Capacity> m_ranges;
+    bool m_isMalformed{false};
+    bool m_exceedsCapacity{false};
+    uint32_t m_remainderBegin{0U};
+    FieldRange m_wholeMessage;
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/lazy_message_view.inl"
+
+#endif // IOX_POSH_POPO_LAZY_MESSAGE_VIEW_HPP
@@ -0,0 +1,110 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_MESSAGE_LAYOUT_HPP
+#define IOX_POSH_POPO_MESSAGE_LAYOUT_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Identifies the in-memory layout of the messages of a process. Messages which contain pointers, like protobuf
+/// messages which were built on an arena in the chunks of a publisher, can only be read in place by a process with the
+/// same layout, i.e. the same build of the message types and, unless the readers relocate the pointers, the payload
+/// segments mapped at the same addresses. Other consumers need a serialized copy of the message.
+/// @note The layout covers the reads via the data members of the messages only. Virtual functions of a message
+/// dispatch through the vtable of the executable which built it and are never safe to call on a message of another
+/// process, regardless of the layout.
+struct MessageLayout
+{
+    /// @brief the ABI hash of messages which can be read in place by any process, e.g. plain old data
+    static constexpr uint64_t LAYOUT_INDEPENDENT{0U};
+    /// @brief the address space key of a consumer which reads serialized copies only, see 'serializedOnly'
+    static constexpr uint64_t SERIALIZED_ONLY{0U};
+    /// @brief the address space key of relocatable messages, which can be read at any address, see 'create'
+    static constexpr uint64_t RELOCATABLE{1U};
+    /// @brief the initial value to build an ABI hash with 'addToAbiHash'
+    static constexpr uint64_t ABI_HASH_SEED{14695981039346656037U};
+    /// @brief marks a class hash which carries an ABI hash, see 'withAbiHash'
+    static constexpr uint32_t ABI_HASH_MARKER{0x694F5841U};
+
+    /// @brief hash of the build of the message types, e.g. of the protobuf version and the generated code
+    uint64_t m_abiHash{LAYOUT_INDEPENDENT};
+    /// @brief hash of the addresses at which the payload segments are mapped into the process, 'RELOCATABLE' if the
+    /// messages do not depend on these addresses
+    uint64_t m_addressSpaceKey{0U};
+
+    /// @brief Creates the layout of the messages of the calling process
+    /// @param[in] abiHash of the message types
+    /// @param[in] managementMemory is any address within the management segment of the port; the management segment
+    /// is addressed via relative pointers only and therefore excluded from the address space key
+    /// @param[in] isRelocatable is true if the readers translate the pointers inside of a message to the address at
+    /// which it is mapped, like the generated code of the bundled protobuf does; the layout then depends on the ABI
+    /// hash only and the payload segments can be mapped at different addresses in every process
+    /// @return the layout of the messages of this process
+    static MessageLayout
+    create(const uint64_t abiHash, const void* const managementMemory, const bool isRelocatable) noexcept;
+
+    /// @brief Creates the layout of a consumer which never reads layout dependent messages in place, e.g. a gateway or
+    /// a recorder which forwards the serialized message; the publisher produces the serialized copy once per sample
+    /// and shares it between all such consumers
+    /// @param[in] abiHash of the message types
+    /// @return the layout of the consumer
+    static MessageLayout serializedOnly(const uint64_t abiHash) noexcept;
+
+    /// @brief Adds a property of the message types, like a size or a version, to an ABI hash
+    /// @param[in] abiHash to add the property to, starting with 'ABI_HASH_SEED'
+    /// @param[in] value of the property
+    /// @return the new ABI hash
+    static uint64_t addToAbiHash(const uint64_t abiHash, const uint64_t value) noexcept;
+
+    /// @brief Stores an ABI hash in the class hash of a service description; this way the ABI hash is known to RouDi
+    /// before the ports are connected and travels with every CaPro message of the port
+    /// @details The first 64 bits of the class hash carry the ABI hash, the third element a digest of the class hash
+    /// of 'service' and the last one 'ABI_HASH_MARKER'
+    /// @param[in] service whose service, instance, event, class hash and interface are kept
+    /// @param[in] abiHash to store, 'LAYOUT_INDEPENDENT' if the messages of the service can be read in place by anyone
+    /// @return the service description with the ABI hash
+    static capro::ServiceDescription withAbiHash(const capro::ServiceDescription& service,
+                                                 const uint64_t abiHash) noexcept;
+
+    /// @brief Reads the ABI hash from the class hash of a service description
+    /// @param[in] service which was created with 'withAbiHash'
+    /// @return the ABI hash, 'LAYOUT_INDEPENDENT' if the class hash is not marked with 'ABI_HASH_MARKER'
+    static uint64_t abiHashOf(const capro::ServiceDescription& service) noexcept;
+
+    /// @brief Indicates whether the messages contain absolute pointers and can only be read with the same layout
+    /// @return true if the layout matters, false otherwise
+    bool isLayoutDependent() const noexcept;
+
+    /// @brief Indicates whether a consumer with the given layout can read the messages of this layout in place
+    /// @param[in] consumer is the layout of the consumer; a layout independent consumer did not announce a layout and
+    /// reads all messages in place, a 'serializedOnly' consumer reads only layout independent messages in place
+    /// @return true if the consumer can read the messages in place, false if it needs a serialized copy
+    bool isReadableInPlaceBy(const MessageLayout& consumer) const noexcept;
+
+    bool operator==(const MessageLayout& rhs) const noexcept;
+    bool operator!=(const MessageLayout& rhs) const noexcept;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_MESSAGE_LAYOUT_HPP
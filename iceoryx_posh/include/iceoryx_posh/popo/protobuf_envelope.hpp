@@ -0,0 +1,184 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_PROTOBUF_ENVELOPE_HPP
+#define IOX_POSH_POPO_PROTOBUF_ENVELOPE_HPP
+
+#include "iceoryx_posh/popo/protobuf_publisher.hpp"
+#include "iceoryx_posh/popo/protobuf_subscriber.hpp"
+
+#include <google/protobuf/message_lite.h>
+
+#include <cstdint>
+#include <limits>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The user-header of the messages of a 'ProtobufEnvelopePublisher', which carries the type of the message
+struct ProtobufEnvelopeHeader
+{
+    static constexpr uint32_t INVALID_TYPE_ID{std::numeric_limits<uint32_t>::max()};
+
+    uint32_t m_typeId{INVALID_TYPE_ID};
+};
+
+/// @brief The protobuf message types which are sent over one topic, instead of wrapping them into a
+/// 'google.protobuf.Any' or a 'oneof'. The type id of a message is the position of its type in the list, hence the
+/// publisher and the subscribers of a topic have to use the same envelope. The ABI hash of the envelope covers all
+/// types in their order, so that RouDi does not connect ports with different envelopes.
+/// @tparam Ts protobuf message types
+template <typename... Ts>
+struct ProtobufEnvelope
+{
+    static_assert(sizeof...(Ts) > 0U, "An envelope needs at least one message type");
+
+    static constexpr uint32_t NUMBER_OF_TYPES{sizeof...(Ts)};
+
+    /// @brief The type id of a message type of the envelope
+    /// @tparam T protobuf message type, which must be part of the envelope
+    /// @return the position of T in the envelope
+    template <typename T>
+    static constexpr uint32_t typeId() noexcept;
+
+    /// @brief The ABI hash of the envelope for its 'MessageLayout'
+    /// @return the hash of the ABI hashes of all types of the envelope
+    static uint64_t abiHash() noexcept;
+};
+
+/// @brief A message of an envelope which was taken by a 'ProtobufEnvelopeSubscriber'; the type id in the user-header
+/// tells its type
+using ProtobufEnvelopeSample = ProtobufSample<const google::protobuf::MessageLite, const ProtobufEnvelopeHeader>;
+
+template <typename Envelope>
+class ProtobufEnvelopePublisher;
+
+/// @brief The ProtobufEnvelopePublisher publishes messages of all types of an envelope over one topic. Like with the
+/// 'ProtobufPublisher', a message is built in place on an arena in the chunks of the publisher; its type id is stored
+/// in the user-header of the first chunk.
+/// @tparam Ts protobuf message types of the envelope
+template <typename... Ts>
+class ProtobufEnvelopePublisher<ProtobufEnvelope<Ts...>>
+    : public ProtobufPublisher<google::protobuf::MessageLite, ProtobufEnvelopeHeader>
+{
+  public:
+    using Envelope = ProtobufEnvelope<Ts...>;
+
+    explicit ProtobufEnvelopePublisher(const capro::ServiceDescription& service,
+                                       const PublisherOptions& publisherOptions = PublisherOptions()) noexcept;
+
+    /// @brief Loans an empty message of a type of the envelope on an arena whose blocks are chunks of this publisher
+    /// @tparam T protobuf message type, which must be part of the envelope
+    /// @return the loan or an error if the first block could not be loaned; TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL is
+    /// returned if a loan of this publisher is still pending
+    template <typename T>
+    expected<ProtobufLoan<T, ProtobufEnvelopeHeader, google::protobuf::MessageLite>, AllocationError> loan() noexcept;
+};
+
+template <typename Envelope>
+class ProtobufEnvelopeSubscriber;
+
+/// @brief The ProtobufEnvelopeSubscriber receives the messages of a 'ProtobufEnvelopePublisher'. Like with the
+/// 'ProtobufSubscriber', they are read in place or, for a process with another 'MessageLayout', parsed from a
+/// serialized copy into the type given by their type id. The messages are handed to typed handlers with a
+/// 'ProtobufDispatchTable'.
+/// @tparam Ts protobuf message types of the envelope
+template <typename... Ts>
+class ProtobufEnvelopeSubscriber<ProtobufEnvelope<Ts...>>
+    : public ProtobufSubscriber<google::protobuf::MessageLite, ProtobufEnvelopeHeader>
+{
+  public:
+    using Envelope = ProtobufEnvelope<Ts...>;
+
+    explicit ProtobufEnvelopeSubscriber(
+        const capro::ServiceDescription& service,
+        const SubscriberOptions& subscriberOptions = SubscriberOptions(),
+        const ProtobufDelivery delivery = ProtobufDelivery::IN_PLACE_IF_POSSIBLE) noexcept;
+
+    ///
+    /// @brief Take the message from the top of the receive queue.
+    /// @return Either the message or a ChunkReceiveResult.
+    /// @details A serialized message with an unknown type id or which cannot be parsed is dropped and
+    /// NO_CHUNK_AVAILABLE is returned.
+    ///
+    expected<ProtobufEnvelopeSample, ChunkReceiveResult> take() noexcept;
+
+  private:
+    using Parser = google::protobuf::MessageLite* (*)(const void* const, const uint64_t);
+    static constexpr Parser PARSERS[]{&parse<Ts>...};
+};
+
+template <typename Envelope, typename... Handlers>
+class ProtobufDispatchTable;
+
+/// @brief Hands the messages of an envelope to typed handlers. The handler of every type of the envelope is selected
+/// at compile time by overload resolution among the handlers; at runtime the type id indexes a table of these
+/// calls, hence neither the message is parsed nor its type is looked up via reflection. Types without a matching
+/// handler are ignored.
+/// @code
+/// auto dispatchTable = makeProtobufDispatchTable<ProtobufEnvelope<Person, Position>>(
+///     [](const Person& person) { std::cout << person.name_view() << std::endl; },
+///     [](const Position& position) { std::cout << position.frame() << std::endl; });
+/// subscriber.take().and_then([&](auto& sample) { dispatchTable(sample); });
+/// @endcode
+/// @tparam Ts protobuf message types of the envelope
+/// @tparam Handlers function objects, e.g. lambdas, which are called with a 'const T&' of a type of the envelope
+template <typename... Ts, typename... Handlers>
+class ProtobufDispatchTable<ProtobufEnvelope<Ts...>, Handlers...>
+{
+  public:
+    explicit ProtobufDispatchTable(Handlers... handlers) noexcept;
+
+    /// @brief Calls the handler for the type of a message
+    /// @param[in] sample taken from a 'ProtobufEnvelopeSubscriber' of the same envelope
+    /// @return true if a handler was called, false if the type id is unknown or there is no handler for the type
+    bool operator()(const ProtobufEnvelopeSample& sample) noexcept;
+
+    /// @brief Calls the handler for a message of the envelope
+    /// @param[in] typeId of the message
+    /// @param[in] message whose dynamic type is the one of the type id
+    /// @return true if a handler was called, false if the type id is unknown or there is no handler for the type
+    bool dispatch(const uint32_t typeId, const google::protobuf::MessageLite& message) noexcept;
+
+  private:
+    struct HandlerSet : Handlers...
+    {
+        using Handlers::operator()...;
+    };
+
+    template <typename T>
+    static bool call(HandlerSet& handlers, const google::protobuf::MessageLite& message) noexcept;
+
+    using Call = bool (*)(HandlerSet&, const google::protobuf::MessageLite&);
+    static constexpr Call CALLS[]{&call<Ts>...};
+
+    HandlerSet m_handlers;
+};
+
+/// @brief Creates a 'ProtobufDispatchTable' for an envelope
+/// @tparam Envelope the 'ProtobufEnvelope' of the subscriber
+/// @param[in] handlers function objects, e.g. lambdas, which are called with a 'const T&' of a type of the envelope
+/// @return the dispatch table
+template <typename Envelope, typename... Handlers>
+ProtobufDispatchTable<Envelope, std::decay_t<Handlers>...> makeProtobufDispatchTable(Handlers&&... handlers) noexcept;
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/protobuf_envelope.inl"
+
+#endif // IOX_POSH_POPO_PROTOBUF_ENVELOPE_HPP
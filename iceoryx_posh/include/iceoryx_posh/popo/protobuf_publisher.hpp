@@ -0,0 +1,166 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_PROTOBUF_PUBLISHER_HPP
+#define IOX_POSH_POPO_PROTOBUF_PUBLISHER_HPP
+
+#include "iceoryx_posh/internal/popo/protobuf_chunk_serializer.hpp"
+#include "iceoryx_posh/popo/publisher.hpp"
+
+#include <google/protobuf/arena.h>
+
+namespace iox
+{
+namespace popo
+{
+template <typename T, typename H>
+class ProtobufPublisher;
+
+/// @brief A protobuf message which is built in place on an arena whose blocks are chunks of a ProtobufPublisher
+/// @details Dropping the loan without publishing it returns all chunks of the message to the mempools
+/// @note String and bytes fields have to be set with 'set_<field>' to be read in place by the subscribers; a value
+/// modified via 'mutable_<field>' is kept in a 'std::string' on the heap of the publisher until it is set again
+/// @tparam T protobuf message type of the loan
+/// @tparam H user header type
+/// @tparam P message type of the publisher, a base class of T if the publisher sends messages of several types
+template <typename T, typename H = mepoo::NoUserHeader, typename P = T>
+class ProtobufLoan
+{
+  public:
+    ~ProtobufLoan() noexcept;
+
+    ProtobufLoan(const ProtobufLoan&) = delete;
+    ProtobufLoan& operator=(const ProtobufLoan&) = delete;
+    ProtobufLoan(ProtobufLoan&& rhs) noexcept;
+    ProtobufLoan& operator=(ProtobufLoan&& rhs) noexcept;
+
+    /// @brief Transparent access to the message
+    /// @return a pointer to the message
+    T* operator->() noexcept;
+
+    /// @brief Transparent read-only access to the message
+    /// @return a const pointer to the message
+    const T* operator->() const noexcept;
+
+    /// @brief Provides a reference to the message
+    /// @return a reference to the message
+    T& operator*() noexcept;
+
+    /// @brief Provides a const reference to the message
+    /// @return a const reference to the message
+    const T& operator*() const noexcept;
+
+    /// @brief Mutable access to the message
+    /// @return a pointer to the message
+    T* get() noexcept;
+
+    /// @brief Read-only access to the message
+    /// @return a const pointer to the message
+    const T* get() const noexcept;
+
+    /// @brief Retrieve the user-header which is published alongside the message
+    /// @return the user-header
+    template <typename R = H, typename = std::enable_if_t<!std::is_same<R, mepoo::NoUserHeader>::value>>
+    R& getUserHeader() noexcept;
+
+    /// @brief Loans a chunk which is published and released together with the message, e.g. for an image which a
+    /// 'bytes' field refers to via the generated 'unsafe_arena_set_referenced_<field>' instead of copying it
+    /// @param[in] userPayloadSize size of the user-payload of the chunk
+    /// @param[in] userPayloadAlignment alignment of the user-payload of the chunk
+    /// @return the ChunkHeader of the chunk or an error if the loan has ended or the chunk could not be loaned
+    expected<mepoo::ChunkHeader*, AllocationError>
+    loanAttachedChunk(const uint64_t userPayloadSize,
+                      const uint32_t userPayloadAlignment = CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT) noexcept;
+
+    /// @brief Publishes the message with all chunks of the arena and ends the loan
+    void publish() noexcept;
+
+  private:
+    friend class ProtobufPublisher<P, H>;
+
+    ProtobufLoan(ProtobufPublisher<P, H>& publisher, Sample<P, H>&& sample) noexcept;
+
+    void endLoan() noexcept;
+
+  private:
+    ProtobufPublisher<P, H>* m_publisher{nullptr};
+    Sample<P, H> m_sample;
+};
+
+/// @brief The ProtobufPublisher loans protobuf messages which are built directly in the chunks of the publisher.
+/// Every loan has its own single owner arena whose blocks are loaned from this publisher; the arena itself lives in
+/// the user-header of the first chunk, so that the whole first chunk is available for the message. The message is published with all of
+/// its chunks and taken by a 'Subscriber<T, H>' as read-only view into them. A 'ProtobufSubscriber<T, H>' of a
+/// process which cannot read the message in place, see 'MessageLayout', gets a serialized copy instead; the copy is
+/// created once per message and shared by all these subscribers.
+/// @tparam T protobuf message type
+/// @tparam H user header type
+/// @note Only one loan of a ProtobufPublisher can be pending at a time; use a 'PublisherLoanContext' for messages
+/// which are built concurrently
+template <typename T, typename H = mepoo::NoUserHeader>
+class ProtobufPublisher : public Publisher<T, H>
+{
+  public:
+    explicit ProtobufPublisher(const capro::ServiceDescription& service,
+                               const PublisherOptions& publisherOptions = PublisherOptions()) noexcept;
+
+    ProtobufPublisher(const ProtobufPublisher&) = delete;
+    ProtobufPublisher(ProtobufPublisher&&) = delete;
+    ProtobufPublisher& operator=(const ProtobufPublisher&) = delete;
+    ProtobufPublisher& operator=(ProtobufPublisher&&) = delete;
+
+    /// @brief Loans an empty message on an arena whose blocks are chunks of this publisher
+    /// @return the loan or an error if the first block could not be loaned; TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL is
+    /// returned if a loan of this publisher is still pending
+    expected<ProtobufLoan<T, H>, AllocationError> loan() noexcept;
+
+    /// @brief Publishes a sample; the arena of a loaned message is destroyed before the message is sent, since it
+    /// lives in the first chunk of the message which must not be written once the subscribers can read it
+    /// @param sample to publish
+    void publish(Sample<T, H>&& sample) noexcept override;
+
+  protected:
+    /// @brief Constructs a publisher whose messages have the provided ABI hash and serializer, e.g. for messages of
+    /// several types
+    ProtobufPublisher(const capro::ServiceDescription& service,
+                      const PublisherOptions& publisherOptions,
+                      const uint64_t abiHash,
+                      const ChunkSerializer& serializer) noexcept;
+
+    /// @brief Loans an empty message of type U, which is T or derived from it
+    template <typename U>
+    expected<ProtobufLoan<U, H, T>, AllocationError> loanMessage() noexcept;
+
+  private:
+    template <typename, typename, typename>
+    friend class ProtobufLoan;
+
+    void endLoan() noexcept;
+
+    /// @brief block functions of the arena; the publisher is passed as arena block context
+    static void* loanArenaBlock(void* publisher, size_t size, size_t& actualSize) noexcept;
+    static void releaseArenaBlocks(void* publisher) noexcept;
+
+  private:
+    google::protobuf::SingleOwnerArena* m_arena{nullptr};
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/protobuf_publisher.inl"
+
+#endif // IOX_POSH_POPO_PROTOBUF_PUBLISHER_HPP
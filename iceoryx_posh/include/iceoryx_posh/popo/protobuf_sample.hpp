@@ -0,0 +1,134 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_PROTOBUF_SAMPLE_HPP
+#define IOX_POSH_POPO_PROTOBUF_SAMPLE_HPP
+
+#include "iceoryx_posh/internal/mepoo/chunk_management_management.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iox/type_traits.hpp"
+#include "iox/unique_ptr.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The ProtobufSample class is a read-only view of a protobuf message which was built in place on an arena
+/// whose blocks are chunks of a publisher. The message is located via the 'ProtobufUserHeader' of the first chunk
+/// and not by assumptions about the internal block layout of the arena.
+/// @tparam T is the protobuf message type
+/// @tparam H is the user-header of the publisher, which is embedded in the 'ProtobufUserHeader'
+template <typename T, typename H = add_const_conditionally_t<mepoo::NoUserHeader, T>>
+class ProtobufSample
+{
+    using ChunkHeader_t = add_const_conditionally_t<mepoo::ChunkHeader, T>;
+    using ProtobufUserHeader_t =
+        add_const_conditionally_t<mepoo::ProtobufUserHeader<typename std::remove_const<H>::type>, T>;
+
+    template <typename R, typename HH>
+    using HasUserHeader = std::enable_if_t<std::is_same<R, HH>::value
+                                               && !std::is_same<std::remove_const_t<R>, mepoo::NoUserHeader>::value,
+                                           R>;
+
+  public:
+    /// @brief Constructs a ProtobufSample for the message carried by a chunk
+    /// @param[in] chunkHeader of the first chunk of the message, i.e. the first block of the arena
+    /// @param[in] deleter which releases the chunks of the message
+    ProtobufSample(ChunkHeader_t* const chunkHeader, const function<void(T*)>& deleter) noexcept;
+
+    /// @brief Constructs a ProtobufSample for the message carried by the chunks of a received sample
+    /// @param[in] chunkHeaders of all chunks of the sample, the first one carries the message
+    /// @param[in] deleter which releases the chunks of the message
+    ProtobufSample(const mepoo::ChunkHeaderView chunkHeaders, const function<void(T*)>& deleter) noexcept;
+
+    /// @brief Constructs a ProtobufSample for a message which was parsed from the serialized message of a chunk
+    /// @param[in] chunkHeader of the chunk with the serialized message
+    /// @param[in] message which was parsed from the chunk
+    /// @param[in] deleter which releases the message and the chunk
+    ProtobufSample(ChunkHeader_t* const chunkHeader, T* const message, const function<void(T*)>& deleter) noexcept;
+
+    ~ProtobufSample() noexcept = default;
+
+    ProtobufSample(const ProtobufSample&) = delete;
+    ProtobufSample& operator=(const ProtobufSample&) = delete;
+    ProtobufSample(ProtobufSample&& rhs) noexcept = default;
+    ProtobufSample& operator=(ProtobufSample&& rhs) noexcept = default;
+
+    /// @brief Transparent access to the message
+    /// @return a pointer to the message
+    T* operator->() noexcept;
+
+    /// @brief Transparent read-only access to the message
+    /// @return a const pointer to the message
+    const T* operator->() const noexcept;
+
+    /// @brief Provides a reference to the message
+    /// @return a reference to the message
+    T& operator*() noexcept;
+
+    /// @brief Provides a const reference to the message
+    /// @return a const reference to the message
+    const T& operator*() const noexcept;
+
+    /// @brief Indicates whether the sample is valid, i.e. refers to a message
+    /// @return true if valid otherwise false
+    explicit operator bool() const noexcept;
+
+    /// @brief Mutable access to the message
+    /// @return a pointer to the message
+    T* get() noexcept;
+
+    /// @brief Read-only access to the message
+    /// @return a const pointer to the message
+    const T* get() const noexcept;
+
+    /// @brief Retrieve the ChunkHeader of the first chunk of the message
+    /// @return the ChunkHeader of the first chunk
+    ChunkHeader_t* getChunkHeader() noexcept;
+
+    /// @brief Retrieve the const ChunkHeader of the first chunk of the message
+    /// @return the const ChunkHeader of the first chunk
+    const mepoo::ChunkHeader* getChunkHeader() const noexcept;
+
+    /// @brief Retrieve the chunk headers of all chunks of a received sample
+    /// @return the chunk headers or an empty view if the sample was not constructed from them
+    mepoo::ChunkHeaderView getChunkHeaders() const noexcept;
+
+    /// @brief Retrieve the user-header the publisher stored alongside the message
+    /// @return the user-header
+    template <typename R = H, typename = HasUserHeader<R, H>>
+    add_const_conditionally_t<R, T>& getUserHeader() noexcept;
+
+    /// @brief Retrieve the const user-header the publisher stored alongside the message
+    /// @return the const user-header
+    template <typename R = H, typename = HasUserHeader<R, H>>
+    const R& getUserHeader() const noexcept;
+
+  private:
+    static T* rootMessage(ChunkHeader_t* const chunkHeader) noexcept;
+
+  private:
+    ChunkHeader_t* m_chunkHeader{nullptr};
+    mepoo::ChunkHeaderView m_chunkHeaders;
+    iox::unique_ptr<T> m_message;
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/protobuf_sample.inl"
+
+#endif // IOX_POSH_POPO_PROTOBUF_SAMPLE_HPP
@@ -0,0 +1,116 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_PROTOBUF_SUBSCRIBER_HPP
+#define IOX_POSH_POPO_PROTOBUF_SUBSCRIBER_HPP
+
+#include "iceoryx_posh/internal/popo/protobuf_chunk_serializer.hpp"
+#include "iceoryx_posh/popo/subscriber.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The representation in which a 'ProtobufSubscriber' receives the messages of layout dependent publishers
+enum class ProtobufDelivery : uint8_t
+{
+    /// @brief the messages are read in place if the 'MessageLayout' matches, otherwise a serialized copy is delivered
+    IN_PLACE_IF_POSSIBLE,
+    /// @brief a serialized copy is always delivered, e.g. to a gateway or a recorder which forwards the serialized
+    /// message; the publisher produces the copy once per sample and shares it between all such subscribers
+    SERIALIZED
+};
+
+enum class SerializedSampleError
+{
+    /// @brief the message of the sample is read in place and there is no serialized message
+    NOT_SERIALIZED
+};
+
+/// @brief The ProtobufSubscriber receives the messages of a 'ProtobufPublisher' in the representation which fits its
+/// process. When the process has the same 'MessageLayout' as the publisher, the messages are read in place in the
+/// chunks of the publisher; otherwise the publisher delivers a serialized copy which is parsed on 'take'. Serialized
+/// messages, e.g. from 'ProtobufPublisher::publishSerialized', are parsed as well.
+/// @note The history of a publisher is kept as it was sent and RouDi, which delivers it, cannot serialize it. A
+/// subscriber which does not read the messages in place therefore gets no history and 'hasMissedData' reports it.
+/// @tparam T protobuf message type
+/// @tparam H user header type
+template <typename T, typename H = mepoo::NoUserHeader>
+class ProtobufSubscriber : public Subscriber<T, H>
+{
+  public:
+    explicit ProtobufSubscriber(const capro::ServiceDescription& service,
+                                const SubscriberOptions& subscriberOptions = SubscriberOptions(),
+                                const ProtobufDelivery delivery = ProtobufDelivery::IN_PLACE_IF_POSSIBLE) noexcept;
+
+    ProtobufSubscriber(const ProtobufSubscriber&) = delete;
+    ProtobufSubscriber(ProtobufSubscriber&&) = delete;
+    ProtobufSubscriber& operator=(const ProtobufSubscriber&) = delete;
+    ProtobufSubscriber& operator=(ProtobufSubscriber&&) = delete;
+
+    ///
+    /// @brief Take the message from the top of the receive queue.
+    /// @return Either the message or a ChunkReceiveResult.
+    /// @details The message is a view into the chunks of the publisher or parsed from a serialized copy on the heap;
+    /// in both cases the sample takes care of the cleanup. A serialized message which cannot be parsed is dropped and
+    /// NO_CHUNK_AVAILABLE is returned.
+    ///
+    expected<ProtobufSample<const T, const H>, ChunkReceiveResult> take() noexcept;
+
+    ///
+    /// @brief Provides the serialized message of a taken sample, e.g. for a gateway or a recorder.
+    /// @param[in] sample which was taken from this subscriber
+    /// @return Either the chunk with the serialized message in its user-payload or a SerializedSampleError.
+    /// @details The chunk is the serialized copy delivered by the publisher or a message which was published
+    /// serialized; it is valid as long as the sample is held. A subscriber which forwards every message creates the
+    /// subscriber with 'ProtobufDelivery::SERIALIZED', otherwise the messages of a publisher with the same
+    /// 'MessageLayout' are read in place and NOT_SERIALIZED is returned. The serialized message is never produced by
+    /// the subscriber, which can therefore map the payload segments of the publisher read-only.
+    ///
+    expected<const mepoo::ChunkHeader*, SerializedSampleError>
+    serialized(const ProtobufSample<const T, const H>& sample) const noexcept;
+
+  protected:
+    /// @brief Constructs a subscriber whose messages have the provided ABI hash, e.g. for messages of several types
+    ProtobufSubscriber(const capro::ServiceDescription& service,
+                       const SubscriberOptions& subscriberOptions,
+                       const uint64_t abiHash,
+                       const ProtobufDelivery delivery = ProtobufDelivery::IN_PLACE_IF_POSSIBLE) noexcept;
+
+    /// @brief Takes the message from the top of the receive queue like 'take'
+    /// @param[in] parse is called with the ChunkHeader and the size of a serialized message and returns the message
+    /// parsed from the user-payload, allocated with new, or nullptr if it could not be parsed
+    template <typename Parser>
+    expected<ProtobufSample<const T, const H>, ChunkReceiveResult> takeMessage(const Parser& parse) noexcept;
+
+    /// @brief Parses a serialized message
+    /// @tparam M protobuf message type of the serialized message, which is T or derived from it
+    /// @param[in] data of the serialized message
+    /// @param[in] size of the serialized message
+    /// @return the message allocated with new or nullptr if it could not be parsed
+    template <typename M>
+    static T* parse(const void* const data, const uint64_t size) noexcept;
+
+  private:
+    static SubscriberOptions withoutSubscribeOnCreate(const SubscriberOptions& subscriberOptions) noexcept;
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/protobuf_subscriber.inl"
+
+#endif // IOX_POSH_POPO_PROTOBUF_SUBSCRIBER_HPP
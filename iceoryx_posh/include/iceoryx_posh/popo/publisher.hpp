@@ -19,6 +19,7 @@
 #define IOX_POSH_POPO_TYPED_PUBLISHER_HPP
 
 #include "iceoryx_posh/internal/popo/publisher_impl.hpp"
+#include "iceoryx_posh/internal/popo/publisher_loan_context.hpp"
 
 #include <vector>
 
@@ -45,6 +45,10 @@ struct PublisherOptions
     /// @brief The option whether the publisher should block when the subscriber queue is full
     ConsumerTooSlowPolicy subscriberTooSlowPolicy{ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
 
+    /// @brief The option whether the publisher reuses all chunks of its previous sample for the next one once no
+    /// subscriber holds the previous sample anymore; without this option only the first chunk is reused
+    bool recycleAllChunks{false};
+
     /// @brief serialization of the PublisherOptions
     Serialization serialize() const noexcept;
     /// @brief deserialization of the PublisherOptions
@@ -41,6 +41,7 @@ set(libprotobuf_lite_includes
   ${protobuf_source_dir}/src/google/protobuf/explicitly_constructed.h
   ${protobuf_source_dir}/src/google/protobuf/extension_set.h
   ${protobuf_source_dir}/src/google/protobuf/extension_set_inl.h
+  ${protobuf_source_dir}/src/google/protobuf/flat_field.h
   ${protobuf_source_dir}/src/google/protobuf/generated_enum_util.h
   ${protobuf_source_dir}/src/google/protobuf/generated_message_table_driven.h
   ${protobuf_source_dir}/src/google/protobuf/generated_message_table_driven_lite.h
@@ -65,6 +66,7 @@ set(libprotobuf_lite_includes
   ${protobuf_source_dir}/src/google/protobuf/metadata_lite.h
   ${protobuf_source_dir}/src/google/protobuf/parse_context.h
   ${protobuf_source_dir}/src/google/protobuf/port.h
+  ${protobuf_source_dir}/src/google/protobuf/relocation.h
   ${protobuf_source_dir}/src/google/protobuf/repeated_field.h
   ${protobuf_source_dir}/src/google/protobuf/repeated_ptr_field.h
   ${protobuf_source_dir}/src/google/protobuf/stubs/bytestream.h
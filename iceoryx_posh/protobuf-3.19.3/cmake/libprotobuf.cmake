@@ -52,6 +52,7 @@ set(libprotobuf_files
   ${protobuf_source_dir}/src/google/protobuf/util/type_resolver_util.cc
   ${protobuf_source_dir}/src/google/protobuf/wire_format.cc
   ${protobuf_source_dir}/src/google/protobuf/wrappers.pb.cc
+  ${protobuf_source_dir}/src/iox/options.pb.cc
 )
 
 set(libprotobuf_includes
@@ -97,6 +98,7 @@ set(libprotobuf_includes
   ${protobuf_source_dir}/src/google/protobuf/util/type_resolver_util.h
   ${protobuf_source_dir}/src/google/protobuf/wire_format.h
   ${protobuf_source_dir}/src/google/protobuf/wrappers.pb.h
+  ${protobuf_source_dir}/src/iox/options.pb.h
 )
 
 if (CMAKE_CXX_COMPILER_ID STREQUAL "MSVC")
@@ -1,32 +1,38 @@
-if (NOT EXISTS "${PROJECT_SOURCE_DIR}/../third_party/googletest/CMakeLists.txt")
-  message(FATAL_ERROR
-          "Cannot find third_party/googletest directory that's needed to "
-          "build tests. If you use git, make sure you have cloned submodules:\n"
-          "  git submodule update --init --recursive\n"
-          "If instead you want to skip tests, run cmake with:\n"
-          "  cmake -Dprotobuf_BUILD_TESTS=OFF\n")
-endif()
-
 option(protobuf_ABSOLUTE_TEST_PLUGIN_PATH
   "Using absolute test_plugin path in tests" ON)
 mark_as_advanced(protobuf_ABSOLUTE_TEST_PLUGIN_PATH)
 
-set(googlemock_source_dir "${protobuf_source_dir}/third_party/googletest/googlemock")
-set(googletest_source_dir "${protobuf_source_dir}/third_party/googletest/googletest")
-include_directories(
-  ${googlemock_source_dir}
-  ${googletest_source_dir}
-  ${googletest_source_dir}/include
-  ${googlemock_source_dir}/include
-)
+if (protobuf_USE_EXTERNAL_GTEST)
+  find_package(GTest CONFIG REQUIRED)
+else (protobuf_USE_EXTERNAL_GTEST)
+  if (NOT EXISTS "${PROJECT_SOURCE_DIR}/../third_party/googletest/CMakeLists.txt")
+    message(FATAL_ERROR
+            "Cannot find third_party/googletest directory that's needed to "
+            "build tests. If you use git, make sure you have cloned submodules:\n"
+            "  git submodule update --init --recursive\n"
+            "If instead you want to skip tests, run cmake with:\n"
+            "  cmake -Dprotobuf_BUILD_TESTS=OFF\n")
+  endif()
 
-add_library(gmock STATIC
-  "${googlemock_source_dir}/src/gmock-all.cc"
-  "${googletest_source_dir}/src/gtest-all.cc"
-)
-target_link_libraries(gmock ${CMAKE_THREAD_LIBS_INIT})
-add_library(gmock_main STATIC "${googlemock_source_dir}/src/gmock_main.cc")
-target_link_libraries(gmock_main gmock)
+  set(googlemock_source_dir "${protobuf_source_dir}/third_party/googletest/googlemock")
+  set(googletest_source_dir "${protobuf_source_dir}/third_party/googletest/googletest")
+  include_directories(
+    ${googlemock_source_dir}
+    ${googletest_source_dir}
+    ${googletest_source_dir}/include
+    ${googlemock_source_dir}/include
+  )
+
+  add_library(gmock STATIC
+    "${googlemock_source_dir}/src/gmock-all.cc"
+    "${googletest_source_dir}/src/gtest-all.cc"
+  )
+  target_link_libraries(gmock ${CMAKE_THREAD_LIBS_INIT})
+  add_library(gmock_main STATIC "${googlemock_source_dir}/src/gmock_main.cc")
+  target_link_libraries(gmock_main gmock)
+  add_library(GTest::gmock ALIAS gmock)
+  add_library(GTest::gmock_main ALIAS gmock_main)
+endif (protobuf_USE_EXTERNAL_GTEST)
 
 set(lite_test_protos
   google/protobuf/map_lite_unittest.proto
@@ -49,6 +55,7 @@ set(tests_protos
   google/protobuf/unittest_empty.proto
   google/protobuf/unittest_import.proto
   google/protobuf/unittest_import_public.proto
+  google/protobuf/unittest_iox_flat.proto
   google/protobuf/unittest_lazy_dependencies.proto
   google/protobuf/unittest_lazy_dependencies_custom_option.proto
   google/protobuf/unittest_lazy_dependencies_enum.proto
@@ -154,6 +161,7 @@ set(tests_files
   ${protobuf_source_dir}/src/google/protobuf/drop_unknown_fields_test.cc
   ${protobuf_source_dir}/src/google/protobuf/dynamic_message_unittest.cc
   ${protobuf_source_dir}/src/google/protobuf/extension_set_unittest.cc
+  ${protobuf_source_dir}/src/google/protobuf/flat_field_unittest.cc
   ${protobuf_source_dir}/src/google/protobuf/generated_message_reflection_unittest.cc
   ${protobuf_source_dir}/src/google/protobuf/inlined_string_field_unittest.cc
   ${protobuf_source_dir}/src/google/protobuf/io/coded_stream_unittest.cc
@@ -222,7 +230,7 @@ if(MINGW)
 endif()
 
 add_executable(tests ${tests_files} ${common_test_files} ${tests_proto_files} ${lite_test_proto_files})
-target_link_libraries(tests libprotoc libprotobuf gmock_main)
+target_link_libraries(tests libprotoc libprotobuf GTest::gmock_main)
 
 set(test_plugin_files
   ${protobuf_source_dir}/src/google/protobuf/compiler/mock_code_generator.cc
@@ -232,19 +240,19 @@ set(test_plugin_files
 )
 
 add_executable(test_plugin ${test_plugin_files})
-target_link_libraries(test_plugin libprotoc libprotobuf gmock)
+target_link_libraries(test_plugin libprotoc libprotobuf GTest::gmock)
 
 set(lite_test_files
   ${protobuf_source_dir}/src/google/protobuf/lite_unittest.cc
 )
 add_executable(lite-test ${lite_test_files} ${common_lite_test_files} ${lite_test_proto_files})
-target_link_libraries(lite-test libprotobuf-lite gmock_main)
+target_link_libraries(lite-test libprotobuf-lite GTest::gmock_main)
 
 set(lite_arena_test_files
   ${protobuf_source_dir}/src/google/protobuf/lite_arena_unittest.cc
 )
 add_executable(lite-arena-test ${lite_arena_test_files} ${common_lite_test_files} ${lite_test_proto_files})
-target_link_libraries(lite-arena-test libprotobuf-lite gmock_main)
+target_link_libraries(lite-arena-test libprotobuf-lite GTest::gmock_main)
 
 add_custom_target(check
   COMMAND tests
@@ -31,7 +31,8 @@ declare -a RUNTIME_PROTO_FILES=(\
   google/protobuf/struct.proto \
   google/protobuf/timestamp.proto \
   google/protobuf/type.proto \
-  google/protobuf/wrappers.proto)
+  google/protobuf/wrappers.proto \
+  iox/options.proto)
 
 declare -a COMPILER_PROTO_FILES=(\
   google/protobuf/compiler/plugin.proto)
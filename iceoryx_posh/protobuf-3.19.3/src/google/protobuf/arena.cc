@@ -68,7 +68,9 @@ static SerialArena::Memory AllocateMemory(const AllocationPolicy* policy_ptr,
   size = std::max(size, SerialArena::kBlockHeaderSize + min_bytes);
 
   void* mem;
-  if (policy.block_alloc == nullptr) {
+  if (policy.block_alloc_with_context != nullptr) {
+    mem = policy.block_alloc_with_context(policy.block_context, size, size);
+  } else if (policy.block_alloc == nullptr) {
     mem = ::operator new(size);
   } else {
     mem = policy.block_alloc(size, size);
@@ -80,6 +82,10 @@ class GetDeallocator {
  public:
   GetDeallocator(const AllocationPolicy* policy, size_t* space_allocated)
       : dealloc_(policy ? policy->block_dealloc : nullptr),
+        dealloc_with_context_(policy ? policy->block_dealloc_with_context
+                                     : nullptr),
+        context_(policy ? policy->block_context : nullptr),
+        dealloc_all_(policy ? policy->block_dealloc_all : nullptr),
         space_allocated_(space_allocated) {}
 
   void operator()(SerialArena::Memory mem) const {
@@ -88,7 +94,11 @@ class GetDeallocator {
     // so return it in an unpoisoned state.
     ASAN_UNPOISON_MEMORY_REGION(mem.ptr, mem.size);
 #endif  // ADDRESS_SANITIZER
-    if (dealloc_) {
+    if (dealloc_all_) {
+      // Handed back together by ReleaseAll().
+    } else if (dealloc_with_context_) {
+      dealloc_with_context_(context_, mem.ptr, mem.size);
+    } else if (dealloc_) {
       dealloc_(mem.ptr, mem.size);
     } else {
 #if defined(__GXX_DELETE_WITH_SIZE__) || defined(__cpp_sized_deallocation)
@@ -100,15 +110,25 @@ class GetDeallocator {
     *space_allocated_ += mem.size;
   }
 
+  // Hands back all blocks at once if the policy has a batch hook; must be
+  // called after the last access to the blocks.
+  void ReleaseAll() const {
+    if (dealloc_all_) dealloc_all_(context_);
+  }
+
  private:
   void (*dealloc_)(void*, size_t);
+  void (*dealloc_with_context_)(void*, void*, size_t);
+  void* context_;
+  void (*dealloc_all_)(void*);
   size_t* space_allocated_;
 };
 
-SerialArena::SerialArena(Block* b, void* owner) : space_allocated_(b->size) {
+SerialArena::SerialArena(Block* b, void* owner, size_t header_size)
+    : space_allocated_(b->size) {
   owner_ = owner;
   head_ = b;
-  ptr_ = b->Pointer(kBlockHeaderSize + ThreadSafeArena::kSerialArenaSize);
+  ptr_ = b->Pointer(header_size);
   limit_ = b->Pointer(b->size & static_cast<size_t>(-8));
 }
 
@@ -116,7 +136,15 @@ SerialArena* SerialArena::New(Memory mem, void* owner) {
   GOOGLE_DCHECK_LE(kBlockHeaderSize + ThreadSafeArena::kSerialArenaSize, mem.size);
 
   auto b = new (mem.ptr) Block{nullptr, mem.size};
-  return new (b->Pointer(kBlockHeaderSize)) SerialArena(b, owner);
+  return new (b->Pointer(kBlockHeaderSize)) SerialArena(
+      b, owner, kBlockHeaderSize + ThreadSafeArena::kSerialArenaSize);
+}
+
+SerialArena* SerialArena::NewInline(void* serial_mem, Memory mem) {
+  GOOGLE_DCHECK_LE(kBlockHeaderSize, mem.size);
+
+  auto b = new (mem.ptr) Block{nullptr, mem.size};
+  return new (serial_mem) SerialArena(b, nullptr, kBlockHeaderSize);
 }
 
 template <typename Deallocator>
@@ -286,15 +314,43 @@ void ThreadSafeArena::InitializeWithPolicy(void* mem, size_t size,
 #undef GOOGLE_DCHECK_POLICY_FLAGS_
 }
 
+void ThreadSafeArena::InitializeSingleOwner(void* serial_mem, void* mem,
+                                            size_t size,
+                                            AllocationPolicy* policy) {
+  GOOGLE_DCHECK_EQ(reinterpret_cast<uintptr_t>(mem) & 7, 0u);
+  GOOGLE_DCHECK_EQ(reinterpret_cast<uintptr_t>(serial_mem) & 7, 0u);
+  // No lifecycle id is drawn since the thread cache is never consulted.
+  tag_and_id_ = kSingleOwnerArena;
+  alloc_policy_.set_policy(policy);
+  alloc_policy_.set_should_record_allocs(
+      policy->metrics_collector != nullptr &&
+      policy->metrics_collector->RecordAllocs());
+  // Neither the SerialArena nor the policy is placed in the block, therefore
+  // any block which holds a block header is sufficient.
+  if (mem != nullptr && size >= kBlockHeaderSize) {
+    alloc_policy_.set_is_user_owned_initial_block(true);
+  } else {
+    alloc_policy_.set_is_user_owned_initial_block(false);
+    auto tmp = AllocateMemory(policy, 0, 0);
+    mem = tmp.ptr;
+    size = tmp.size;
+  }
+
+  SerialArena* serial = SerialArena::NewInline(serial_mem, {mem, size});
+  serial->set_next(nullptr);
+  threads_.store(serial, std::memory_order_relaxed);
+  hint_.store(serial, std::memory_order_relaxed);
+}
+
 void ThreadSafeArena::Init() {
 #ifndef NDEBUG
   const bool was_message_owned = IsMessageOwned();
 #endif  // NDEBUG
   ThreadCache& tc = thread_cache();
   auto id = tc.next_lifecycle_id;
-  // We increment lifecycle_id's by multiples of two so we can use bit 0 as
-  // a tag.
-  constexpr uint64_t kDelta = 2;
+  // We increment lifecycle_id's by multiples of four so we can use bits 0 and
+  // 1 as tags.
+  constexpr uint64_t kDelta = 4;
   constexpr uint64_t kInc = ThreadCache::kPerThreadIds * kDelta;
   if (PROTOBUF_PREDICT_FALSE((id & (kInc - 1)) == 0)) {
     constexpr auto relaxed = std::memory_order_relaxed;
@@ -332,14 +388,16 @@ ThreadSafeArena::~ThreadSafeArena() {
   // Policy is about to get deleted.
   auto* p = alloc_policy_.get();
   ArenaMetricsCollector* collector = p ? p->metrics_collector : nullptr;
+  const auto deallocator = GetDeallocator(p, &space_allocated);
 
   if (alloc_policy_.is_user_owned_initial_block()) {
     space_allocated += mem.size;
   } else {
-    GetDeallocator(alloc_policy_.get(), &space_allocated)(mem);
+    deallocator(mem);
   }
 
   if (collector) collector->OnDestroy(space_allocated);
+  deallocator.ReleaseAll();
 }
 
 SerialArena::Memory ThreadSafeArena::Free(size_t* space_allocated) {
@@ -362,17 +420,45 @@ uint64_t ThreadSafeArena::Reset() {
   auto mem = Free(&space_allocated);
 
   AllocationPolicy* policy = alloc_policy_.get();
-  if (policy) {
+  if (IsSingleOwner()) {
+    // The policy and the SerialArena are owned by the caller and stay valid.
+    const auto deallocator = GetDeallocator(policy, &space_allocated);
+    if (alloc_policy_.is_user_owned_initial_block()) {
+      space_allocated += mem.size;
+      if (policy->block_dealloc_all) {
+        // The initial block may be handed back by the batch hook as well.
+        mem.ptr = nullptr;
+        mem.size = 0;
+      }
+    } else {
+      deallocator(mem);
+      mem.ptr = nullptr;
+      mem.size = 0;
+    }
+    ArenaMetricsCollector* collector = policy->metrics_collector;
+    if (collector) collector->OnReset(space_allocated);
+    deallocator.ReleaseAll();
+    InitializeSingleOwner(hint_.load(std::memory_order_relaxed), mem.ptr,
+                          mem.size, policy);
+  } else if (policy) {
     auto saved_policy = *policy;
+    const auto deallocator = GetDeallocator(&saved_policy, &space_allocated);
     if (alloc_policy_.is_user_owned_initial_block()) {
       space_allocated += mem.size;
+      if (saved_policy.block_dealloc_all) {
+        // The initial block may be handed back by the batch hook as well.
+        alloc_policy_.set_is_user_owned_initial_block(false);
+        mem.ptr = nullptr;
+        mem.size = 0;
+      }
     } else {
-      GetDeallocator(alloc_policy_.get(), &space_allocated)(mem);
+      deallocator(mem);
       mem.ptr = nullptr;
       mem.size = 0;
     }
     ArenaMetricsCollector* collector = saved_policy.metrics_collector;
     if (collector) collector->OnReset(space_allocated);
+    deallocator.ReleaseAll();
     InitializeWithPolicy(mem.ptr, mem.size, saved_policy);
   } else {
     GOOGLE_DCHECK(!alloc_policy_.should_record_allocs());
@@ -453,6 +539,9 @@ uint64_t ThreadSafeArena::SpaceUsed() const {
   for (; serial; serial = serial->next()) {
     space_used += serial->SpaceUsed();
   }
+  // The SerialArena and the policy of a single owner arena are not part of its
+  // blocks.
+  if (IsSingleOwner()) return space_used + kSerialArenaSize;
   return space_used - (alloc_policy_.get() ? sizeof(AllocationPolicy) : 0);
 }
 
@@ -462,6 +551,10 @@ void ThreadSafeArena::CleanupList() {
 
 PROTOBUF_NOINLINE
 SerialArena* ThreadSafeArena::GetSerialArenaFallback(void* me) {
+  // A single owner arena never gets a SerialArena per thread, also not when
+  // its allocations are recorded for a metrics collector.
+  if (IsSingleOwner()) return hint_.load(std::memory_order_relaxed);
+
   // Look for this SerialArena in our linked list.
   SerialArena* serial = threads_.load(std::memory_order_acquire);
   for (; serial; serial = serial->next()) {
@@ -66,10 +66,13 @@ namespace protobuf {
 
 struct ArenaOptions;  // defined below
 class Arena;    // defined below
+class SingleOwnerArena;  // defined below
 class Message;  // defined in message.h
 class MessageLite;
 template <typename Key, typename T>
 class Map;
+template <typename Element>
+class RepeatedField;  // defined in repeated_field.h
 
 namespace arena_metrics {
 
@@ -90,6 +93,7 @@ class EpsCopyInputStream;  // defined in parse_context.h
 
 template <typename Type>
 class GenericTypeHandler;  // defined in repeated_field.h
+class RepeatedPtrFieldBase;  // defined in repeated_ptr_field.h
 
 inline PROTOBUF_ALWAYS_INLINE
 void* AlignTo(void* ptr, size_t align) {
@@ -152,6 +156,26 @@ struct ArenaOptions {
   // calls free.
   void (*block_dealloc)(void*, size_t);
 
+  // An opaque pointer, e.g. to the owner of the blocks, which is passed as
+  // first argument to the functions below. This way several arenas can obtain
+  // their blocks from different owners without a global lookup.
+  void* block_context;
+
+  // Like block_alloc and block_dealloc, but with block_context as first
+  // argument. If set, they are used instead of block_alloc and block_dealloc.
+  void* (*block_alloc_with_context)(void* context, size_t size,
+                                    size_t& actual_size);
+  void (*block_dealloc_with_context)(void* context, void* block, size_t size);
+
+  // If set, the arena hands back all blocks it obtained from block_alloc or
+  // block_alloc_with_context with a single call instead of one dealloc call
+  // per block. It is called when the arena is reset or destroyed, after the
+  // arena accessed its blocks for the last time. The hook may hand back an
+  // initial block which it provided as well, hence Reset() does not reuse the
+  // initial block but starts over with a new block from the allocation
+  // functions.
+  void (*block_dealloc_all)(void* context);
+
   ArenaOptions()
       : start_block_size(internal::AllocationPolicy::kDefaultStartBlockSize),
         max_block_size(internal::AllocationPolicy::kDefaultMaxBlockSize),
@@ -159,6 +183,10 @@ struct ArenaOptions {
         initial_block_size(0),
         block_alloc(nullptr),
         block_dealloc(nullptr),
+        block_context(nullptr),
+        block_alloc_with_context(nullptr),
+        block_dealloc_with_context(nullptr),
+        block_dealloc_all(nullptr),
         make_metrics_collector(nullptr) {}
 
  private:
@@ -177,6 +205,10 @@ struct ArenaOptions {
     res.max_block_size = max_block_size;
     res.block_alloc = block_alloc;
     res.block_dealloc = block_dealloc;
+    res.block_context = block_context;
+    res.block_alloc_with_context = block_alloc_with_context;
+    res.block_dealloc_with_context = block_dealloc_with_context;
+    res.block_dealloc_all = block_dealloc_all;
     res.metrics_collector = MetricsCollector();
     return res;
   }
@@ -184,6 +216,7 @@ struct ArenaOptions {
   friend void arena_metrics::EnableArenaMetrics(ArenaOptions*);
 
   friend class Arena;
+  friend class SingleOwnerArena;
   friend class ArenaOptionsTestFriend;
 };
 
@@ -527,6 +560,12 @@ class PROTOBUF_EXPORT PROTOBUF_ALIGNAS(8) Arena final {
   // Constructor solely used by message-owned arena.
   inline Arena(internal::MessageOwned) : impl_(internal::MessageOwned{}) {}
 
+  // Constructor solely used by SingleOwnerArena.
+  inline Arena(internal::SingleOwner, void* serial_arena, char* initial_block,
+               size_t initial_block_size, internal::AllocationPolicy* policy)
+      : impl_(internal::SingleOwner{}, serial_arena, initial_block,
+              initial_block_size, policy) {}
+
   // Checks whether this arena is message-owned.
   PROTOBUF_ALWAYS_INLINE bool IsMessageOwned() const {
     return impl_.IsMessageOwned();
@@ -794,6 +833,14 @@ class PROTOBUF_EXPORT PROTOBUF_ALIGNAS(8) Arena final {
     }
   }
 
+  // Grows the array [p, p + old_n) to new_n bytes if it is the last
+  // allocation of the calling thread and its block has room, so a repeated
+  // field keeps one contiguous buffer instead of abandoning the old one.
+  bool MaybeExtendArray(void* p, size_t old_n, size_t new_n) {
+    return impl_.MaybeExtendAligned(p, internal::AlignUpTo8(old_n),
+                                    internal::AlignUpTo8(new_n));
+  }
+
   void* AllocateAlignedNoHook(size_t n);
   void* AllocateAlignedWithHook(size_t n, const std::type_info* type);
   std::pair<void*, internal::SerialArena::CleanupNode*>
@@ -808,6 +855,43 @@ class PROTOBUF_EXPORT PROTOBUF_ALIGNAS(8) Arena final {
   friend class MessageLite;
   template <typename Key, typename T>
   friend class Map;
+  template <typename Element>
+  friend class RepeatedField;  // For MaybeExtendArray.
+  friend class internal::RepeatedPtrFieldBase;  // For MaybeExtendArray.
+  friend class SingleOwnerArena;
+};
+
+// An arena for messages which are built by a single thread in the initial
+// block of the given options, e.g. a shared memory chunk which is handed to
+// another process as a whole.
+//
+// In contrast to an Arena with an initial block, the bookkeeping of the arena
+// (its SerialArena and allocation policy) is kept in this object instead of
+// the initial block, so that the object can be placed in a header next to the
+// block. Allocations are a pointer bump without looking up the calling thread
+// and no per-thread arenas are created; hence the arena must only be used by
+// the thread that created it. Further blocks are obtained from the options if
+// the initial block is exhausted. Objects with non-trivial destructors are
+// still supported, but their cleanup nodes take space from the block, so the
+// arena is meant for messages with trivially destructible fields.
+class PROTOBUF_EXPORT PROTOBUF_ALIGNAS(8) SingleOwnerArena final {
+ public:
+  explicit SingleOwnerArena(const ArenaOptions& options)
+      : policy_(options.AllocationPolicy()),
+        arena_(internal::SingleOwner{}, serial_arena_, options.initial_block,
+               options.initial_block_size, &policy_) {}
+
+  // The arena to create messages on.
+  Arena* get() { return &arena_; }
+  const Arena* get() const { return &arena_; }
+
+ private:
+  // Initialized before and destroyed after arena_, which refers to them.
+  internal::AllocationPolicy policy_;
+  alignas(8) char serial_arena_[internal::ThreadSafeArena::kSerialArenaSize];
+  Arena arena_;
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(SingleOwnerArena);
 };
 
 // Defined above for supporting environments without RTTI.
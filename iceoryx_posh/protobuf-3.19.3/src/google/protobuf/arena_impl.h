@@ -99,12 +99,22 @@ struct AllocationPolicy {
   size_t max_block_size = kDefaultMaxBlockSize;
   void* (*block_alloc)(size_t, size_t&) = nullptr;
   void (*block_dealloc)(void*, size_t) = nullptr;
+  // Context passed to the block functions below, which take precedence over
+  // block_alloc and block_dealloc when set.
+  void* block_context = nullptr;
+  void* (*block_alloc_with_context)(void*, size_t, size_t&) = nullptr;
+  void (*block_dealloc_with_context)(void*, void*, size_t) = nullptr;
+  // Batch hook replacing the per block dealloc functions: called once when
+  // the arena is reset or destroyed, after the last access to its blocks.
+  void (*block_dealloc_all)(void*) = nullptr;
   ArenaMetricsCollector* metrics_collector = nullptr;
 
   bool IsDefault() const {
     return start_block_size == kDefaultMaxBlockSize &&
            max_block_size == kDefaultMaxBlockSize && block_alloc == nullptr &&
-           block_dealloc == nullptr && metrics_collector == nullptr;
+           block_dealloc == nullptr && block_alloc_with_context == nullptr &&
+           block_dealloc_with_context == nullptr &&
+           block_dealloc_all == nullptr && metrics_collector == nullptr;
   }
 };
 
@@ -239,6 +249,20 @@ class PROTOBUF_EXPORT SerialArena {
     return true;
   }
 
+  // Grows the allocation [p, p + old_n) to new_n bytes if it is the most
+  // recent allocation of this SerialArena and the current block has room for
+  // the difference. Returns false and does nothing otherwise.
+  bool MaybeExtendAligned(void* p, size_t old_n, size_t new_n) {
+    GOOGLE_DCHECK_EQ(internal::AlignUpTo8(old_n), old_n);  // Must be aligned.
+    GOOGLE_DCHECK_EQ(internal::AlignUpTo8(new_n), new_n);  // Must be aligned.
+    GOOGLE_DCHECK_GE(new_n, old_n);
+    if (static_cast<char*>(p) + old_n != ptr_ || !HasSpace(new_n - old_n)) {
+      return false;
+    }
+    AllocateFromExisting(new_n - old_n);
+    return true;
+  }
+
   std::pair<void*, CleanupNode*> AllocateAlignedWithCleanup(
       size_t n, const AllocationPolicy* policy) {
     GOOGLE_DCHECK_EQ(internal::AlignUpTo8(n), n);  // Must be already aligned.
@@ -280,6 +304,9 @@ class PROTOBUF_EXPORT SerialArena {
   // Creates a new SerialArena inside mem using the remaining memory as for
   // future allocations.
   static SerialArena* New(SerialArena::Memory mem, void* owner);
+  // Creates a new SerialArena at serial_mem, outside of mem, so that all of
+  // mem but the block header is available for allocations.
+  static SerialArena* NewInline(void* serial_mem, SerialArena::Memory mem);
   // Free SerialArena returning the memory passed in to New
   template <typename Deallocator>
   Memory Free(Deallocator deallocator);
@@ -312,8 +339,8 @@ class PROTOBUF_EXPORT SerialArena {
   char* ptr_;
   char* limit_;
 
-  // Constructor is private as only New() should be used.
-  inline SerialArena(Block* b, void* owner);
+  // Constructor is private as only New() and NewInline() should be used.
+  inline SerialArena(Block* b, void* owner, size_t header_size);
   void* AllocateAlignedFallback(size_t n, const AllocationPolicy* policy);
   std::pair<void*, CleanupNode*> AllocateAlignedWithCleanupFallback(
       size_t n, const AllocationPolicy* policy);
@@ -335,6 +362,12 @@ struct MessageOwned {
   explicit MessageOwned() = default;
 };
 
+// Tag type used to invoke the constructor of a single owner arena, see
+// SingleOwnerArena in arena.h.
+struct SingleOwner {
+  explicit SingleOwner() = default;
+};
+
 // This class provides the core Arena memory allocation library. Different
 // implementations only need to implement the public interface below.
 // Arena is not a template type as that would only be useful if all protos
@@ -357,6 +390,14 @@ class PROTOBUF_EXPORT ThreadSafeArena {
     InitializeWithPolicy(mem, size, policy);
   }
 
+  // Constructor solely used by single owner arenas. The SerialArena is created
+  // at serial_mem and the policy is owned by the caller; both must outlive the
+  // arena.
+  ThreadSafeArena(internal::SingleOwner, void* serial_mem, void* mem,
+                  size_t size, AllocationPolicy* policy) {
+    InitializeSingleOwner(serial_mem, mem, size, policy);
+  }
+
   // Destructor deletes all owned heap allocated objects, and destructs objects
   // that have non-trivial destructors, except for proto2 message objects whose
   // destructors can be skipped. Also, frees all blocks except the initial block
@@ -392,6 +433,18 @@ class PROTOBUF_EXPORT ThreadSafeArena {
     return false;
   }
 
+  // Grows the allocation [p, p + old_n) in place if it is the most recent
+  // allocation of the calling thread. Allocation hooks see every allocation,
+  // so nothing is extended while they are installed.
+  bool MaybeExtendAligned(void* p, size_t old_n, size_t new_n) {
+    SerialArena* arena;
+    if (PROTOBUF_PREDICT_TRUE(!alloc_policy_.should_record_allocs() &&
+                              GetSerialArenaFast(&arena))) {
+      return arena->MaybeExtendAligned(p, old_n, new_n);
+    }
+    return false;
+  }
+
   std::pair<void*, SerialArena::CleanupNode*> AllocateAlignedWithCleanup(
       size_t n, const std::type_info* type);
 
@@ -403,11 +456,18 @@ class PROTOBUF_EXPORT ThreadSafeArena {
     return tag_and_id_ & kMessageOwnedArena;
   }
 
+  // Checks whether this arena is only used by the thread that created it.
+  PROTOBUF_ALWAYS_INLINE bool IsSingleOwner() const {
+    return tag_and_id_ & kSingleOwnerArena;
+  }
+
  private:
   // Unique for each arena. Changes on Reset().
   uint64_t tag_and_id_ = 0;
-  // The LSB of tag_and_id_ indicates if the arena is message-owned.
-  enum : uint64_t { kMessageOwnedArena = 1 };
+  // The LSB of tag_and_id_ indicates if the arena is message-owned, the next
+  // bit if it is a single owner arena. A single owner arena has no lifecycle
+  // id since it never uses the thread cache.
+  enum : uint64_t { kMessageOwnedArena = 1, kSingleOwnerArena = 2 };
 
   TaggedAllocationPolicyPtr alloc_policy_;  // Tagged pointer to AllocPolicy.
 
@@ -418,6 +478,8 @@ class PROTOBUF_EXPORT ThreadSafeArena {
   const AllocationPolicy* AllocPolicy() const { return alloc_policy_.get(); }
   void InitializeFrom(void* mem, size_t size);
   void InitializeWithPolicy(void* mem, size_t size, AllocationPolicy policy);
+  void InitializeSingleOwner(void* serial_mem, void* mem, size_t size,
+                             AllocationPolicy* policy);
   void* AllocateAlignedFallback(size_t n, const std::type_info* type);
   std::pair<void*, SerialArena::CleanupNode*>
   AllocateAlignedWithCleanupFallback(size_t n, const std::type_info* type);
@@ -429,7 +491,7 @@ class PROTOBUF_EXPORT ThreadSafeArena {
   void CleanupList();
 
   inline uint64_t LifeCycleId() const {
-    return tag_and_id_ & ~kMessageOwnedArena;
+    return tag_and_id_ & ~(kMessageOwnedArena | kSingleOwnerArena);
   }
 
   inline void CacheSerialArena(SerialArena* serial) {
@@ -458,6 +520,11 @@ class PROTOBUF_EXPORT ThreadSafeArena {
 
   PROTOBUF_NDEBUG_INLINE bool GetSerialArenaFromThreadCache(
       SerialArena** arena) {
+    // A single owner arena has exactly one SerialArena, which hint_ points to.
+    if (PROTOBUF_PREDICT_FALSE(IsSingleOwner())) {
+      *arena = hint_.load(std::memory_order_relaxed);
+      return true;
+    }
     // If this thread already owns a block in this arena then try to use that.
     // This fast path optimizes the case where multiple threads allocate from
     // the same arena.
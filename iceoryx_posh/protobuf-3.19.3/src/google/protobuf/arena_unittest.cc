@@ -35,6 +35,7 @@
 #include <cstring>
 #include <memory>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <typeinfo>
 #include <vector>
@@ -62,6 +63,7 @@
 #include <google/protobuf/port_def.inc>
 
 using proto2_arena_unittest::ArenaMessage;
+using protobuf_unittest::ForeignMessage;
 using protobuf_unittest::TestAllExtensions;
 using protobuf_unittest::TestAllTypes;
 using protobuf_unittest::TestEmptyMessage;
@@ -505,6 +507,67 @@ TEST(ArenaTest, ReleaseString) {
 }
 
 
+TEST(ArenaTest, ReferencedBytesAreSeenByReflectionAndSerialization) {
+  Arena arena;
+  TestAllTypes* arena_message = Arena::CreateMessage<TestAllTypes>(&arena);
+  std::string payload(100, 'p');
+  payload[50] = '\0';
+  arena_message->unsafe_arena_set_referenced_optional_bytes(payload.data(),
+                                                            payload.size());
+
+  // The value is not copied.
+  EXPECT_TRUE(arena_message->has_optional_bytes());
+  EXPECT_EQ(payload, arena_message->optional_bytes_view());
+  EXPECT_EQ(payload.data(), arena_message->optional_bytes_view().data());
+  EXPECT_EQ(payload, arena_message->optional_bytes());
+
+  const Reflection* reflection = arena_message->GetReflection();
+  const FieldDescriptor* field =
+      arena_message->GetDescriptor()->FindFieldByName("optional_bytes");
+  EXPECT_TRUE(reflection->HasField(*arena_message, field));
+  EXPECT_EQ(payload, reflection->GetString(*arena_message, field));
+  std::string scratch;
+  EXPECT_EQ(payload,
+            reflection->GetStringReference(*arena_message, field, &scratch));
+
+  TestAllTypes parsed;
+  ASSERT_TRUE(parsed.ParseFromString(arena_message->SerializeAsString()));
+  EXPECT_EQ(payload, parsed.optional_bytes());
+}
+
+TEST(ArenaTest, MutableReferencedBytesHoldTheValue) {
+  Arena arena;
+  TestAllTypes* arena_message = Arena::CreateMessage<TestAllTypes>(&arena);
+  const std::string payload(100, 'p');
+  arena_message->unsafe_arena_set_referenced_optional_bytes(payload.data(),
+                                                            payload.size());
+
+  std::string* value = arena_message->mutable_optional_bytes();
+  EXPECT_EQ(payload, *value);
+  value->append("q");
+  EXPECT_EQ(payload + "q", arena_message->optional_bytes_view());
+  EXPECT_EQ(payload + "q", arena_message->optional_bytes());
+  EXPECT_EQ(std::string(100, 'p'), payload);
+}
+
+TEST(ArenaTest, ReferencedBytesAreCopiedIfShortOrWithoutArena) {
+  const std::string short_payload(8, 's');
+  const std::string long_payload(100, 'l');
+
+  Arena arena;
+  TestAllTypes* arena_message = Arena::CreateMessage<TestAllTypes>(&arena);
+  arena_message->unsafe_arena_set_referenced_optional_bytes(
+      short_payload.data(), short_payload.size());
+  EXPECT_EQ(short_payload, arena_message->optional_bytes_view());
+  EXPECT_NE(short_payload.data(), arena_message->optional_bytes_view().data());
+
+  TestAllTypes message;
+  message.unsafe_arena_set_referenced_optional_bytes(long_payload.data(),
+                                                     long_payload.size());
+  EXPECT_EQ(long_payload, message.optional_bytes_view());
+  EXPECT_NE(long_payload.data(), message.optional_bytes_view().data());
+}
+
 TEST(ArenaTest, SwapBetweenArenasWithAllFieldsSet) {
   Arena arena1;
   TestAllTypes* arena1_message = Arena::CreateMessage<TestAllTypes>(&arena1);
@@ -1550,6 +1613,262 @@ TEST(ArenaTest, ArenaHooksWhenAllocationsNotNeeded) {
   EXPECT_EQ(0, hooks_num_allocations);
 }
 
+bool IsInBlock(const void* p, const std::vector<char>& block) {
+  return p >= block.data() && p < block.data() + block.size();
+}
+
+TEST(SingleOwnerArenaTest, AllocatesFromTheInitialBlock) {
+  std::vector<char> arena_block(1024);
+  ArenaOptions options;
+  options.initial_block = arena_block.data();
+  options.initial_block_size = arena_block.size();
+  SingleOwnerArena arena(options);
+  EXPECT_EQ(1024, arena.get()->SpaceAllocated());
+  EXPECT_EQ(0, arena.get()->SpaceUsed());
+
+  // Neither the SerialArena nor the policy take space from the block.
+  char* p = Arena::CreateArray<char>(arena.get(), 55);
+  EXPECT_TRUE(IsInBlock(p, arena_block));
+  EXPECT_EQ(1024, arena.get()->SpaceAllocated());
+  EXPECT_EQ(Align8(55), arena.get()->SpaceUsed());
+
+  auto* message = Arena::CreateMessage<ForeignMessage>(arena.get());
+  EXPECT_TRUE(IsInBlock(message, arena_block));
+  EXPECT_EQ(arena.get(), message->GetArena());
+}
+
+TEST(SingleOwnerArenaTest, TakesFurtherBlocksFromTheOptions) {
+  std::vector<char> arena_block(1024);
+  ArenaOptions options;
+  options.initial_block = arena_block.data();
+  options.initial_block_size = arena_block.size();
+  SingleOwnerArena arena(options);
+
+  Arena::CreateArray<char>(arena.get(), 800);
+  char* p = Arena::CreateArray<char>(arena.get(), 800);
+  EXPECT_FALSE(IsInBlock(p, arena_block));
+  EXPECT_LT(1024, arena.get()->SpaceAllocated());
+  EXPECT_EQ(Align8(800) * 2, arena.get()->SpaceUsed());
+}
+
+TEST(SingleOwnerArenaTest, ResetKeepsTheInitialBlock) {
+  std::vector<char> arena_block(1024);
+  ArenaOptions options;
+  options.initial_block = arena_block.data();
+  options.initial_block_size = arena_block.size();
+  SingleOwnerArena arena(options);
+
+  Arena::CreateArray<char>(arena.get(), 800);
+  Arena::CreateArray<char>(arena.get(), 800);
+  const uint64_t space_allocated = arena.get()->SpaceAllocated();
+  EXPECT_EQ(space_allocated, arena.get()->Reset());
+
+  EXPECT_EQ(1024, arena.get()->SpaceAllocated());
+  EXPECT_EQ(0, arena.get()->SpaceUsed());
+  char* p = Arena::CreateArray<char>(arena.get(), 55);
+  EXPECT_TRUE(IsInBlock(p, arena_block));
+  EXPECT_EQ(Align8(55), arena.get()->SpaceUsed());
+  EXPECT_EQ(1024, arena.get()->Reset());
+}
+
+TEST(SingleOwnerArenaTest, ResetWithoutInitialBlock) {
+  SingleOwnerArena arena{ArenaOptions()};
+  EXPECT_LT(0, arena.get()->SpaceAllocated());
+  EXPECT_EQ(0, arena.get()->SpaceUsed());
+
+  Arena::CreateArray<char>(arena.get(), 55);
+  EXPECT_EQ(Align8(55), arena.get()->SpaceUsed());
+  EXPECT_LT(0, arena.get()->Reset());
+
+  EXPECT_EQ(0, arena.get()->SpaceUsed());
+  Arena::CreateArray<char>(arena.get(), 55);
+  EXPECT_EQ(Align8(55), arena.get()->SpaceUsed());
+}
+
+TEST(SingleOwnerArenaTest, RecordedAllocationsStayInTheInitialBlock) {
+  std::vector<char> arena_block(1024);
+  ArenaOptions options;
+  options.initial_block = arena_block.data();
+  options.initial_block_size = arena_block.size();
+  ArenaOptionsTestFriend::Enable(&options);
+
+  {
+    SingleOwnerArena arena(options);
+    EXPECT_EQ(1, hooks_num_init);
+    char* p = Arena::CreateArray<char>(arena.get(), 55);
+    auto* message = Arena::CreateMessage<ForeignMessage>(arena.get());
+    EXPECT_LE(2, hooks_num_allocations);
+
+    // Recording the allocations must not create a SerialArena for the thread.
+    EXPECT_TRUE(IsInBlock(p, arena_block));
+    EXPECT_TRUE(IsInBlock(message, arena_block));
+    EXPECT_EQ(1024, arena.get()->SpaceAllocated());
+
+    arena.get()->Reset();
+    EXPECT_EQ(1, hooks_num_reset);
+    p = Arena::CreateArray<char>(arena.get(), 55);
+    EXPECT_TRUE(IsInBlock(p, arena_block));
+    EXPECT_EQ(1024, arena.get()->SpaceAllocated());
+  }
+  EXPECT_EQ(1, hooks_num_destruct);
+}
+
+TEST(SingleOwnerArenaTest, DoesNotDisturbTheLifecycleIdsOfOtherArenas) {
+  // Ordinary arenas draw their ids in steps of four to keep the tag bits free.
+  // More arenas than ids per thread batch are created, so that a new batch is
+  // drawn, and each one must get its own SerialArena.
+  std::vector<char> arena_block(1024);
+  ArenaOptions options;
+  options.initial_block = arena_block.data();
+  options.initial_block_size = arena_block.size();
+  for (int i = 0; i < 600; ++i) {
+    SingleOwnerArena single_owner_arena(options);
+    Arena arena;
+    Arena::CreateArray<char>(&arena, 8);
+    Arena::CreateArray<char>(single_owner_arena.get(), 16);
+    EXPECT_EQ(Align8(8), arena.SpaceUsed());
+    EXPECT_EQ(Align8(16), single_owner_arena.get()->SpaceUsed());
+  }
+}
+
+TEST(SingleOwnerArenaTest, OrdinaryArenaStillCreatesSerialArenasPerThread) {
+  Arena arena;
+  Arena::CreateArray<char>(&arena, 8);
+  const uint64_t space_allocated = arena.SpaceAllocated();
+
+  std::thread thread([&arena] { Arena::CreateArray<char>(&arena, 8); });
+  thread.join();
+
+  EXPECT_LT(space_allocated, arena.SpaceAllocated());
+  EXPECT_EQ(Align8(8) * 2, arena.SpaceUsed());
+}
+
+
+// Owns the blocks of an arena like a pool, e.g. the chunks of a publisher.
+struct BlockOwner {
+  static void* Alloc(void* context, size_t size, size_t& actual_size) {
+    auto* owner = static_cast<BlockOwner*>(context);
+    // Hands out more than requested, which the arena has to use.
+    owner->blocks.emplace_back(size + 64);
+    actual_size = owner->blocks.back().size();
+    return owner->blocks.back().data();
+  }
+  static void Dealloc(void* context, void* block, size_t size) {
+    auto* owner = static_cast<BlockOwner*>(context);
+    ++owner->num_deallocs;
+    owner->deallocated_size += size;
+  }
+  static void DeallocAll(void* context) {
+    auto* owner = static_cast<BlockOwner*>(context);
+    ++owner->num_dealloc_alls;
+    owner->blocks.clear();
+  }
+
+  ArenaOptions Options() {
+    ArenaOptions options;
+    options.block_context = this;
+    options.block_alloc_with_context = &Alloc;
+    options.block_dealloc_with_context = &Dealloc;
+    return options;
+  }
+
+  std::vector<std::vector<char>> blocks;
+  int num_deallocs = 0;
+  int num_dealloc_alls = 0;
+  size_t deallocated_size = 0;
+};
+
+TEST(ArenaTest, BlockAllocWithContextGetsTheContext) {
+  BlockOwner owner;
+  ArenaOptions options = owner.Options();
+  options.start_block_size = 256;
+  options.max_block_size = 256;
+  {
+    Arena arena(options);
+    Arena::CreateArray<char>(&arena, 200);
+    Arena::CreateArray<char>(&arena, 200);
+    ASSERT_LE(2, owner.blocks.size());
+
+    // The arena uses the actual size of the blocks.
+    uint64_t space_allocated = 0;
+    for (const auto& block : owner.blocks) space_allocated += block.size();
+    EXPECT_EQ(space_allocated, arena.SpaceAllocated());
+  }
+  EXPECT_EQ(owner.blocks.size(), owner.num_deallocs);
+  EXPECT_EQ(0, owner.num_dealloc_alls);
+}
+
+TEST(ArenaTest, BlockDeallocAllHandsBackAllBlocksAtOnce) {
+  BlockOwner owner;
+  ArenaOptions options = owner.Options();
+  options.block_dealloc_all = &BlockOwner::DeallocAll;
+  options.start_block_size = 256;
+  options.max_block_size = 256;
+  {
+    Arena arena(options);
+    Arena::CreateArray<char>(&arena, 200);
+    Arena::CreateArray<char>(&arena, 200);
+    EXPECT_LE(2, owner.blocks.size());
+
+    EXPECT_LT(0, arena.Reset());
+    EXPECT_EQ(1, owner.num_dealloc_alls);
+    Arena::CreateArray<char>(&arena, 200);
+  }
+  EXPECT_EQ(0, owner.num_deallocs);
+  EXPECT_EQ(2, owner.num_dealloc_alls);
+  EXPECT_TRUE(owner.blocks.empty());
+}
+
+TEST(ArenaTest, ResetWithDeallocAllTakesANewBlock) {
+  BlockOwner owner;
+  ArenaOptions options = owner.Options();
+  options.block_dealloc_all = &BlockOwner::DeallocAll;
+  // The owner provides the initial block and hands it back with the others.
+  size_t initial_block_size = 0;
+  options.initial_block = static_cast<char*>(
+      BlockOwner::Alloc(&owner, 1024, initial_block_size));
+  options.initial_block_size = initial_block_size;
+  const char* initial_block_data = options.initial_block;
+
+  Arena arena(options);
+  char* p = Arena::CreateArray<char>(&arena, 55);
+  EXPECT_TRUE(p >= initial_block_data &&
+              p < initial_block_data + initial_block_size);
+
+  arena.Reset();
+  EXPECT_EQ(1, owner.num_dealloc_alls);
+  ASSERT_EQ(1, owner.blocks.size());
+  p = Arena::CreateArray<char>(&arena, 55);
+  EXPECT_TRUE(IsInBlock(p, owner.blocks.front()));
+  EXPECT_EQ(0, owner.num_deallocs);
+}
+
+TEST(SingleOwnerArenaTest, ResetWithDeallocAllTakesANewBlock) {
+  BlockOwner owner;
+  ArenaOptions options = owner.Options();
+  options.block_dealloc_all = &BlockOwner::DeallocAll;
+  size_t initial_block_size = 0;
+  options.initial_block = static_cast<char*>(
+      BlockOwner::Alloc(&owner, 1024, initial_block_size));
+  options.initial_block_size = initial_block_size;
+
+  {
+    SingleOwnerArena arena(options);
+    Arena::CreateArray<char>(arena.get(), 55);
+    Arena::CreateArray<char>(arena.get(), 2000);
+    EXPECT_EQ(2, owner.blocks.size());
+
+    arena.get()->Reset();
+    EXPECT_EQ(1, owner.num_dealloc_alls);
+    ASSERT_EQ(1, owner.blocks.size());
+    EXPECT_EQ(owner.blocks.front().size(), arena.get()->SpaceAllocated());
+    char* p = Arena::CreateArray<char>(arena.get(), 55);
+    EXPECT_TRUE(IsInBlock(p, owner.blocks.front()));
+  }
+  EXPECT_EQ(0, owner.num_deallocs);
+  EXPECT_EQ(2, owner.num_dealloc_alls);
+  EXPECT_TRUE(owner.blocks.empty());
+}
 
 }  // namespace protobuf
 }  // namespace google
@@ -30,6 +30,8 @@
 
 #include <google/protobuf/arenastring.h>
 
+#include <limits>
+
 #include <google/protobuf/stubs/logging.h>
 #include <google/protobuf/stubs/common.h>
 #include <google/protobuf/parse_context.h>
@@ -70,24 +72,50 @@ std::string* ArenaStringPtr::SetAndReturnNewString() {
 
 void ArenaStringPtr::DestroyNoArenaSlowPath() { delete UnsafeMutablePointer(); }
 
+void ArenaStringPtr::SetArenaValue(const char* data, size_t size,
+                                   ::google::protobuf::Arena* arena) {
+  GOOGLE_DCHECK(arena != nullptr);
+  GOOGLE_DCHECK_LE(size, std::numeric_limits<uint32_t>::max());
+  tagged_ptr_.SetTagged(tagged_ptr_.Get());
+  if (size <= kArenaInlineCapacity) {
+    LinkArenaValue(static_cast<uint32_t>(size), data, nullptr);
+    return;
+  }
+
+  // The body of the previous value is reused if the value fits into it or if
+  // it is the last allocation on the arena and can be extended, otherwise it
+  // stays abandoned on the arena until the arena is destroyed. "data" may
+  // point into the reused body.
+  size_t body_capacity = ArenaBodyCapacity();
+  char* body = nullptr;
+  if (body_capacity != 0) {
+    body = const_cast<char*>(ArenaData());
+    if (body_capacity < size) {
+      if (arena->MaybeExtendArray(body, body_capacity, size)) {
+        body_capacity = AlignUpTo8(size);
+      } else {
+        body = nullptr;
+      }
+    }
+  }
+  if (body == nullptr) {
+    body_capacity = AlignUpTo8(size);
+    body = Arena::CreateArray<char>(arena, body_capacity);
+  }
+  std::memmove(body, data, size);
+  LinkArenaValue(static_cast<uint32_t>(size), nullptr, body,
+                 static_cast<uint32_t>(body_capacity));
+}
+
 void ArenaStringPtr::Set(const std::string* default_value,
                          ConstStringParam value, ::google::protobuf::Arena* arena) {
   if (IsDefault(default_value)) {
-    if (arena == nullptr) {
-      tagged_ptr_.Set(Arena::Create<std::string>(arena, value));
-    } else {
-      //shm
-      tagged_ptr_.SetTagged(Arena::Create<std::string>(arena, value));
-      raw_string_ = Arena::CreateArray<char>(arena, value.size()+1);
-      std::memcpy(raw_string_, value.c_str(), value.size());
-      raw_string_[value.size()] = '\0';
-    }
-    // tagged_ptr_.Set(Arena::Create<std::string>(arena, value));
-    // raw_string_ = Arena::CreateArray<char>(arena, value.size()+1);
-    // std::memcpy(raw_string_, value.c_str(), value.size());
-    // raw_string_[value.size()] = '\0';
+    tagged_ptr_.Set(Arena::Create<std::string>(arena, value));
   } else {
-    UnsafeMutablePointer()->assign(value.data(), value.length());
+    tagged_ptr_.Get()->assign(value.data(), value.length());
+  }
+  if (arena != nullptr) {
+    SetArenaValue(value.data(), value.length(), arena);
   }
 }
 
@@ -97,12 +125,7 @@ void ArenaStringPtr::Set(const std::string* default_value, std::string&& value,
     if (arena == nullptr) {
       tagged_ptr_.Set(new std::string(std::move(value)));
     } else {
-      //tagged_ptr_.Set(Arena::Create<std::string>(arena, std::move(value)));
-      
-      tagged_ptr_.SetTagged(Arena::Create<std::string>(arena, value));
-      raw_string_ = Arena::CreateArray<char>(arena, value.size()+1);
-      std::memcpy(raw_string_, value.c_str(), value.size());
-      raw_string_[value.size()] = '\0';
+      tagged_ptr_.Set(Arena::Create<std::string>(arena, std::move(value)));
     }
   } else if (IsDonatedString()) {
     std::string* current = tagged_ptr_.Get();
@@ -110,7 +133,11 @@ void ArenaStringPtr::Set(const std::string* default_value, std::string&& value,
     arena->OwnDestructor(s);
     tagged_ptr_.Set(s);
   } else /* !IsDonatedString() */ {
-    *UnsafeMutablePointer() = std::move(value);
+    *tagged_ptr_.Get() = std::move(value);
+  }
+  if (arena != nullptr) {
+    const std::string& current = *tagged_ptr_.Get();
+    SetArenaValue(current.data(), current.size(), arena);
   }
 }
 
@@ -134,6 +161,33 @@ void ArenaStringPtr::Set(NonEmptyDefault, std::string&& value,
   Set(nullptr, std::move(value), arena);
 }
 
+void ArenaStringPtr::SetReferenced(const std::string* default_value,
+                                   const char* data, size_t size,
+                                   ::google::protobuf::Arena* arena) {
+  if (arena == nullptr || size <= kArenaInlineCapacity) {
+    Set(default_value, std::string(data, size), arena);
+    return;
+  }
+  GOOGLE_DCHECK_LE(size, std::numeric_limits<uint32_t>::max());
+  if (IsDefault(default_value)) {
+    tagged_ptr_.Set(Arena::Create<std::string>(arena));
+  } else {
+    tagged_ptr_.Get()->clear();
+  }
+  tagged_ptr_.SetTagged(tagged_ptr_.Get());
+  LinkArenaValue(static_cast<uint32_t>(size), nullptr, data);
+}
+
+void ArenaStringPtr::SetReferenced(EmptyDefault, const char* data, size_t size,
+                                   ::google::protobuf::Arena* arena) {
+  SetReferenced(&GetEmptyStringAlreadyInited(), data, size, arena);
+}
+
+void ArenaStringPtr::SetReferenced(NonEmptyDefault, const char* data,
+                                   size_t size, ::google::protobuf::Arena* arena) {
+  SetReferenced(nullptr, data, size, arena);
+}
+
 std::string* ArenaStringPtr::Mutable(EmptyDefault, ::google::protobuf::Arena* arena) {
   if (!IsDonatedString() && !IsDefault(&GetEmptyStringAlreadyInited())) {
     return UnsafeMutablePointer();
@@ -260,6 +314,7 @@ void ArenaStringPtr::ClearToEmpty() {
     // value, which is trivially true in the donated string case.
     // const_cast<std::string*>(PtrValue<std::string>())->clear();
     tagged_ptr_.Get()->clear();
+    arena_size_ = 0;
   }
 }
 
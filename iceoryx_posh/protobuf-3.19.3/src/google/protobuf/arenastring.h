@@ -31,15 +31,18 @@
 #ifndef GOOGLE_PROTOBUF_ARENASTRING_H__
 #define GOOGLE_PROTOBUF_ARENASTRING_H__
 
+#include <cstdint>
+#include <cstring>
 #include <string>
 #include <type_traits>
 #include <utility>
-#include <unistd.h>
 
 #include <google/protobuf/stubs/logging.h>
 #include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/stringpiece.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/port.h>
+#include <google/protobuf/relocation.h>
 
 #include <google/protobuf/port_def.inc>
 
@@ -176,13 +179,10 @@ static_assert(std::is_trivial<TaggedPtr<std::string>>::value,
 // single "cmp %reg, GLOBAL" in the resulting machine code. (Note that this also
 // requires the String tag to be 0 so we can avoid the mask before comparing.)
 struct PROTOBUF_EXPORT ArenaStringPtr {
-  ArenaStringPtr() : raw_string_(nullptr), ori_this_(this), data_(nullptr), pid_table_{0}, data{nullptr} {
-    // std::cout<<"="<<(void*)this<<std::endl;
-  }
+  ArenaStringPtr() : arena_size_(0), arena_inline_{} {}
   explicit constexpr ArenaStringPtr(
       const ExplicitlyConstructed<std::string>* default_value)
-      : tagged_ptr_(default_value) , raw_string_(nullptr), ori_this_(this), data_(nullptr), pid_table_{0}, data{nullptr}{
-      }
+      : tagged_ptr_(default_value), arena_size_(0), arena_inline_{} {}
 
   // Some methods below are overloaded on a `default_value` and on tags.
   // The tagged overloads help reduce code size in the callers in generated
@@ -228,40 +228,55 @@ struct PROTOBUF_EXPORT ArenaStringPtr {
     Set(p1, sp, arena);
   }
 
+  // Makes the value refer to the "size" bytes at "data" instead of copying
+  // them to the arena. The bytes must stay valid and unmodified as long as the
+  // value is set and must lie in the same shared memory segment as the blocks
+  // of the arena, e.g. in a chunk that is sent together with the message.
+  // Without an arena, or if the value fits inline, the bytes are copied.
+  void SetReferenced(const std::string* default_value, const char* data,
+                     size_t size, ::google::protobuf::Arena* arena);
+  void SetReferenced(EmptyDefault, const char* data, size_t size,
+                     ::google::protobuf::Arena* arena);
+  void SetReferenced(NonEmptyDefault, const char* data, size_t size,
+                     ::google::protobuf::Arena* arena);
+
   // Basic accessors.
   PROTOBUF_NDEBUG_INLINE const std::string& Get() const {
     // Unconditionally mask away the tag.
-    // if(tagged_ptr_.IsTagged()) {    
-    //   int64_t offset = reinterpret_cast<uint64_t>(this) - reinterpret_cast<uint64_t>(ori_this_);
-    //   // if (data_ == nullptr){
-    //   //   data_ = new std::string(reinterpret_cast<char*>((char*)raw_string_ + offset));
-    //   // }
-    //   data_ = new std::string(reinterpret_cast<char*>((char*)raw_string_ + offset));
-    //   return *data_;
-    // } 
     return *tagged_ptr_.Get();
   }
 
+  // Returns the value by copy. Arena allocated strings are read from their
+  // arena representation, which stays readable when the message is accessed
+  // from a different mapping of the arena.
   PROTOBUF_NDEBUG_INLINE const std::string GetChar() const {
-    // Unconditionally mask away the tag.
-    if(tagged_ptr_.IsTagged()) {
-      int64_t offset = reinterpret_cast<uint64_t>(this) - reinterpret_cast<uint64_t>(ori_this_);
-      return reinterpret_cast<char*>((char*)raw_string_ + offset);
-    } 
+    if (tagged_ptr_.IsTagged()) {
+      return std::string(ArenaData(), arena_size_);
+    }
     return *tagged_ptr_.Get();
   }
 
+  // Returns a view of the value without copying it. Like GetChar() it can be
+  // used from a different mapping of the arena; the view is valid as long as
+  // the value is neither modified nor destroyed.
+  PROTOBUF_NDEBUG_INLINE StringPiece GetView() const {
+    if (tagged_ptr_.IsTagged()) {
+      return StringPiece(ArenaData(), arena_size_);
+    }
+    return StringPiece(*tagged_ptr_.Get());
+  }
+
   PROTOBUF_NDEBUG_INLINE const std::string* GetPointer() const {
     // Unconditionally mask away the tag.
-    // if(tagged_ptr_.IsTagged())  {  
-    //   int64_t offset = reinterpret_cast<uint64_t>(this) - reinterpret_cast<uint64_t>(ori_this_);
-
-    //   static std::string* da = new std::string(reinterpret_cast<char*>((char*)raw_string_ + offset));
-    //   return da;
-    // }
     return tagged_ptr_.Get();
   }
 
+  // The returned std::string may be modified at any time, hence on an arena
+  // the value is read from it instead of the arena representation until it is
+  // set again. Its characters live wherever std::string allocates them, e.g.
+  // on the heap of the process, so a message in shared memory must not be read
+  // by other processes in place after a Mutable() without a subsequent Set().
+  //
   // For fields with an empty default value.
   std::string* Mutable(EmptyDefault, ::google::protobuf::Arena* arena);
   // For fields with a non-empty default value.
@@ -314,6 +329,8 @@ struct PROTOBUF_EXPORT ArenaStringPtr {
   // ArenaStringPtr does not own the pointed-to memory. Disregards initial value
   // of ptr_ (so this is the *ONLY* safe method to call after construction or
   // when reinitializing after becoming the active field in a oneof union).
+  // The arena representation is reset as well, since it holds the bytes of
+  // another member of the union in the latter case.
   inline void UnsafeSetDefault(const std::string* default_value);
 
   // Returns a mutable pointer, but doesn't initialize the string to the
@@ -348,20 +365,53 @@ struct PROTOBUF_EXPORT ArenaStringPtr {
   }
 
  private:
+  // Values of arena allocated strings of up to this size are stored inline.
+  static constexpr size_t kArenaInlineCapacity = 20;
+
   TaggedPtr<std::string> tagged_ptr_;
-  char* raw_string_;
-  ArenaStringPtr* ori_this_;
-  mutable std::string* data_;
-  mutable pid_t pid_table_[10];
-  mutable std::string* data[10];
+  // Copy of the value of an arena allocated string, valid while tagged_ptr_ is
+  // tagged. Unlike the std::string behind tagged_ptr_ it does not depend on
+  // the layout of std::string and can be read in place by a process that maps
+  // the arena at a different address: short values are stored in
+  // arena_inline_, longer ones in a body on the arena whose offset relative to
+  // this is stored in the first bytes of arena_inline_. Since all blocks of an
+  // arena are carved out of the same shared memory segment, the offset is the
+  // same in every mapping. The capacity of a body follows its offset, so the
+  // body is reused by the next Set() instead of being abandoned on the arena.
+  // A value set with SetReferenced() has its body outside of the arena, a
+  // capacity of 0 and leaves the std::string empty.
+  uint32_t arena_size_;
+  char arena_inline_[kArenaInlineCapacity];
 
   bool IsDonatedString() const { return false; }
 
+  // Returns the value of an arena allocated string; requires IsTagged().
+  inline const char* ArenaData() const;
+
+  // Returns the capacity of the body of the arena representation, 0 if the
+  // value is stored inline or its body is not owned by this ArenaStringPtr.
+  inline uint32_t ArenaBodyCapacity() const;
+
+  // Copies the value to the arena representation and tags tagged_ptr_. The
+  // std::string behind tagged_ptr_ must hold the same value.
+  void SetArenaValue(const char* data, size_t size, ::google::protobuf::Arena* arena);
+
+  // Points the arena representation to a value of another ArenaStringPtr;
+  // "body" is nullptr if the value is stored inline in "inline_value". The
+  // body is owned by this ArenaStringPtr only if "body_capacity" is not 0.
+  inline void LinkArenaValue(uint32_t size, const char* inline_value,
+                             const char* body, uint32_t body_capacity = 0);
+
+  // Swaps the arena representations, which are only meaningful together with
+  // the swapped tagged pointers.
+  inline static void SwapArenaValues(ArenaStringPtr* rhs, ArenaStringPtr* lhs);
+
   // Swaps tagged pointer without debug hardening. This is to allow python
   // protobuf to maintain pointer stability even in DEBUG builds.
   inline PROTOBUF_NDEBUG_INLINE static void UnsafeShallowSwap(
       ArenaStringPtr* rhs, ArenaStringPtr* lhs) {
     std::swap(lhs->tagged_ptr_, rhs->tagged_ptr_);
+    SwapArenaValues(rhs, lhs);
   }
 
   friend class ::google::protobuf::internal::SwapFieldHelper;
@@ -383,6 +433,55 @@ struct PROTOBUF_EXPORT ArenaStringPtr {
 
 inline void ArenaStringPtr::UnsafeSetDefault(const std::string* value) {
   tagged_ptr_.Set(const_cast<std::string*>(value));
+  arena_size_ = 0;
+}
+
+inline const char* ArenaStringPtr::ArenaData() const {
+  if (arena_size_ <= kArenaInlineCapacity) return arena_inline_;
+  std::ptrdiff_t body_offset;
+  std::memcpy(&body_offset, arena_inline_, sizeof(body_offset));
+  return reinterpret_cast<const char*>(reinterpret_cast<std::uintptr_t>(this) +
+                                       static_cast<std::uintptr_t>(body_offset));
+}
+
+inline uint32_t ArenaStringPtr::ArenaBodyCapacity() const {
+  if (arena_size_ <= kArenaInlineCapacity) return 0;
+  uint32_t body_capacity;
+  std::memcpy(&body_capacity, arena_inline_ + sizeof(std::ptrdiff_t),
+              sizeof(body_capacity));
+  return body_capacity;
+}
+
+inline void ArenaStringPtr::LinkArenaValue(uint32_t size,
+                                           const char* inline_value,
+                                           const char* body,
+                                           uint32_t body_capacity) {
+  static_assert(
+      sizeof(std::ptrdiff_t) + sizeof(uint32_t) <= kArenaInlineCapacity,
+      "the offset and the capacity of a body must fit into arena_inline_");
+  arena_size_ = size;
+  if (body == nullptr) {
+    std::memcpy(arena_inline_, inline_value, kArenaInlineCapacity);
+  } else {
+    std::ptrdiff_t body_offset = RelocationOffset(body, this);
+    std::memcpy(arena_inline_, &body_offset, sizeof(body_offset));
+    std::memcpy(arena_inline_ + sizeof(body_offset), &body_capacity,
+                sizeof(body_capacity));
+  }
+}
+
+inline void ArenaStringPtr::SwapArenaValues(ArenaStringPtr* rhs,
+                                            ArenaStringPtr* lhs) {
+  const uint32_t rhs_size = rhs->arena_size_;
+  const char* rhs_body =
+      rhs_size > kArenaInlineCapacity ? rhs->ArenaData() : nullptr;
+  char rhs_inline[kArenaInlineCapacity];
+  std::memcpy(rhs_inline, rhs->arena_inline_, kArenaInlineCapacity);
+
+  rhs->LinkArenaValue(
+      lhs->arena_size_, lhs->arena_inline_,
+      lhs->arena_size_ > kArenaInlineCapacity ? lhs->ArenaData() : nullptr);
+  lhs->LinkArenaValue(rhs_size, rhs_inline, rhs_body);
 }
 
 // Make sure rhs_arena allocated rhs, and lhs_arena allocated lhs.
@@ -395,6 +494,7 @@ inline PROTOBUF_NDEBUG_INLINE void ArenaStringPtr::InternalSwap(  //
   (void)rhs_arena;
   (void)lhs_arena;
   std::swap(lhs->tagged_ptr_, rhs->tagged_ptr_);
+  SwapArenaValues(rhs, lhs);
 #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
   auto force_realloc = [default_value](ArenaStringPtr* p, Arena* arena) {
     if (p->IsDefault(default_value)) return;
@@ -416,9 +516,7 @@ inline PROTOBUF_NDEBUG_INLINE void ArenaStringPtr::InternalSwap(  //
 inline void ArenaStringPtr::ClearNonDefaultToEmpty() {
   // Unconditionally mask away the tag.
   tagged_ptr_.Get()->clear();
-  if (data_) {
-    delete data_;
-  }
+  arena_size_ = 0;
 }
 
 inline std::string* ArenaStringPtr::MutableNoArenaNoDefault(
@@ -441,8 +539,17 @@ inline void ArenaStringPtr::DestroyNoArena(const std::string* default_value) {
 }
 
 inline std::string* ArenaStringPtr::UnsafeMutablePointer() {
-  GOOGLE_DCHECK(!tagged_ptr_.IsTagged());
   GOOGLE_DCHECK(tagged_ptr_.UnsafeGet() != nullptr);
+  // The caller may modify the std::string, which makes the arena
+  // representation stale; the value is read from the std::string from now on.
+  if (PROTOBUF_PREDICT_FALSE(tagged_ptr_.IsTagged())) {
+    std::string* value = tagged_ptr_.Get();
+    if (value->size() != arena_size_) {
+      // Only a referenced value is missing from the std::string.
+      value->assign(ArenaData(), arena_size_);
+    }
+    tagged_ptr_.Set(value);
+  }
   return tagged_ptr_.UnsafeGet();
 }
 
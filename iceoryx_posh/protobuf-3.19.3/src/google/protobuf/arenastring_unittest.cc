@@ -32,6 +32,7 @@
 
 #include <algorithm>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <vector>
@@ -113,6 +114,180 @@ TEST_P(SingleArena, NullDefault) {
   field.Destroy(nullptr, arena.get());
 }
 
+TEST_P(SingleArena, ViewAndCopyOfShortAndLongValues) {
+  auto arena = GetArena();
+  ArenaStringPtr field;
+  field.UnsafeSetDefault(empty_default);
+  EXPECT_EQ("", field.GetView());
+
+  // Values with embedded zeros must not be cut off.
+  const std::string short_value("short\0value", 11);
+  const std::string long_value("long long long long\0long long value", 35);
+  for (const std::string& value : {short_value, long_value, short_value}) {
+    field.Set(empty_default, value, arena.get());
+    EXPECT_EQ(value, field.Get());
+    EXPECT_EQ(value, field.GetChar());
+    EXPECT_EQ(value, field.GetView());
+  }
+  field.Set(empty_default, std::string(long_value), arena.get());
+  EXPECT_EQ(long_value, field.GetView());
+  field.ClearToEmpty();
+  EXPECT_EQ("", field.GetView());
+  EXPECT_EQ("", field.GetChar());
+  field.Destroy(empty_default, arena.get());
+}
+
+TEST_P(SingleArena, MutableAfterSetIsSeenByAllAccessors) {
+  auto arena = GetArena();
+  ArenaStringPtr field;
+  field.UnsafeSetDefault(empty_default);
+  field.Set(empty_default, "Test long long long long value", arena.get());
+
+  std::string* mut = field.Mutable(EmptyDefault{}, arena.get());
+  EXPECT_EQ("Test long long long long value", *mut);
+  mut->append(" and more");
+  EXPECT_EQ("Test long long long long value and more", field.Get());
+  EXPECT_EQ("Test long long long long value and more", field.GetChar());
+  EXPECT_EQ("Test long long long long value and more", field.GetView());
+
+  // Setting the value again refreshes the arena representation.
+  field.Set(empty_default, "short", arena.get());
+  EXPECT_EQ("short", field.GetView());
+  EXPECT_EQ("short", field.GetChar());
+  field.Destroy(empty_default, arena.get());
+}
+
+TEST_P(SingleArena, SetReferenced) {
+  auto arena = GetArena();
+  ArenaStringPtr field;
+  field.UnsafeSetDefault(empty_default);
+  const std::string value("referenced long long long\0long value", 37);
+  field.SetReferenced(EmptyDefault{}, value.data(), value.size(), arena.get());
+
+  EXPECT_EQ(value, field.GetView());
+  EXPECT_EQ(value, field.GetChar());
+  // Only an arena allows referring to the bytes instead of copying them.
+  EXPECT_EQ(arena != nullptr, field.GetView().data() == value.data());
+
+  // Mutable access materializes the value in the std::string.
+  std::string* mut = field.UnsafeMutablePointer();
+  EXPECT_EQ(value, *mut);
+  EXPECT_EQ(value, field.Get());
+  mut->append("!");
+  EXPECT_EQ(value + "!", field.GetView());
+  field.Destroy(empty_default, arena.get());
+}
+
+TEST(ArenaStringTest, ArenaValuesAreReadableFromAnotherMapping) {
+  // Copies the block of the arena to emulate a process which maps it at
+  // another address; the std::string behind the field is not valid there.
+  std::vector<char> block(4096);
+  std::vector<char> mapping(block.size());
+  ArenaOptions options;
+  options.initial_block = block.data();
+  options.initial_block_size = block.size();
+  Arena arena(options);
+
+  auto create_field = [&arena] {
+    auto* field = new (Arena::CreateArray<char>(&arena, sizeof(ArenaStringPtr)))
+        ArenaStringPtr();
+    field->UnsafeSetDefault(empty_default);
+    return field;
+  };
+  ArenaStringPtr* short_field = create_field();
+  ArenaStringPtr* long_field = create_field();
+  const std::string long_value(100, 'x');
+  short_field->Set(empty_default, "short", &arena);
+  long_field->Set(empty_default, long_value, &arena);
+  std::memcpy(mapping.data(), block.data(), block.size());
+
+  auto in_mapping = [&](const ArenaStringPtr* field) {
+    return reinterpret_cast<const ArenaStringPtr*>(
+        mapping.data() + (reinterpret_cast<const char*>(field) - block.data()));
+  };
+  auto is_in_mapping = [&](const char* p) {
+    return p >= mapping.data() && p < mapping.data() + mapping.size();
+  };
+  StringPiece short_view = in_mapping(short_field)->GetView();
+  StringPiece long_view = in_mapping(long_field)->GetView();
+  EXPECT_EQ("short", short_view);
+  EXPECT_EQ(long_value, long_view);
+  EXPECT_TRUE(is_in_mapping(short_view.data()));
+  EXPECT_TRUE(is_in_mapping(long_view.data()));
+  EXPECT_EQ(long_value, in_mapping(long_field)->GetChar());
+}
+
+TEST(ArenaStringTest, SetReusesTheBodyOfThePreviousValue) {
+  Arena arena;
+  ArenaStringPtr field;
+  field.UnsafeSetDefault(empty_default);
+  field.Set(empty_default, std::string(100, 'x'), &arena);
+  const char* body = field.GetView().data();
+  const uint64_t space_used = arena.SpaceUsed();
+
+  for (int i = 0; i < 10; i++) {
+    const std::string value(i % 2 == 0 ? 30 : 100, static_cast<char>('a' + i));
+    field.Set(empty_default, value, &arena);
+    EXPECT_EQ(value, field.GetView());
+    EXPECT_EQ(value, field.GetChar());
+    EXPECT_EQ(body, field.GetView().data());
+  }
+  // The value may be set from a view of itself.
+  field.Set(empty_default, std::string(field.GetView().substr(10)), &arena);
+  EXPECT_EQ(std::string(90, 'j'), field.GetView());
+  field.Set(empty_default, field.GetView().data() + 20, 70, &arena);
+  EXPECT_EQ(std::string(70, 'j'), field.GetView());
+  EXPECT_EQ(space_used, arena.SpaceUsed());
+  field.Destroy(empty_default, &arena);
+}
+
+TEST(ArenaStringTest, SetExtendsTheBodyIfItIsTheLastAllocation) {
+  Arena arena;
+  ArenaStringPtr field;
+  field.UnsafeSetDefault(empty_default);
+  field.Set(empty_default, std::string(30, 'x'), &arena);
+  const char* body = field.GetView().data();
+
+  field.Set(empty_default, std::string(100, 'y'), &arena);
+  EXPECT_EQ(std::string(100, 'y'), field.GetView());
+  EXPECT_EQ(body, field.GetView().data());
+
+  // Another allocation behind the body requires a new one.
+  Arena::CreateArray<char>(&arena, 8);
+  field.Set(empty_default, std::string(200, 'z'), &arena);
+  EXPECT_EQ(std::string(200, 'z'), field.GetView());
+  EXPECT_NE(body, field.GetView().data());
+  field.Destroy(empty_default, &arena);
+}
+
+TEST(ArenaStringTest, SetAfterUnsafeSetDefaultIgnoresPreviousBytes) {
+  // A member of a oneof union is not constructed before it becomes active.
+  Arena arena;
+  alignas(ArenaStringPtr) char storage[sizeof(ArenaStringPtr)];
+  memset(storage, 0xff, sizeof(storage));
+  ArenaStringPtr* field = reinterpret_cast<ArenaStringPtr*>(storage);
+  field->UnsafeSetDefault(empty_default);
+
+  field->Set(empty_default, std::string(100, 'x'), &arena);
+  EXPECT_EQ(std::string(100, 'x'), field->GetView());
+  field->Destroy(empty_default, &arena);
+}
+
+TEST(ArenaStringTest, SetDoesNotWriteToAReferencedValue) {
+  Arena arena;
+  const std::string referenced(100, 'r');
+  ArenaStringPtr field;
+  field.UnsafeSetDefault(empty_default);
+  field.SetReferenced(empty_default, referenced.data(), referenced.size(),
+                      &arena);
+  EXPECT_EQ(referenced.data(), field.GetView().data());
+
+  field.Set(empty_default, std::string(50, 'x'), &arena);
+  EXPECT_EQ(std::string(50, 'x'), field.GetView());
+  EXPECT_EQ(std::string(100, 'r'), referenced);
+  field.Destroy(empty_default, &arena);
+}
+
 class DualArena : public testing::TestWithParam<std::tuple<bool, bool>> {
  public:
   std::unique_ptr<Arena> GetLhsArena() {
@@ -151,6 +326,33 @@ TEST_P(DualArena, Swap) {
 }
 
 
+TEST_P(DualArena, SwapCarriesTheArenaValues) {
+  auto lhs_arena = GetLhsArena();
+  auto rhs_arena = GetRhsArena();
+  ArenaStringPtr lhs;
+  lhs.UnsafeSetDefault(empty_default);
+  ArenaStringPtr rhs;
+  rhs.UnsafeSetDefault(empty_default);
+
+  lhs.Set(empty_default, "short", lhs_arena.get());
+  rhs.Set(empty_default, "rhs value that has some heft", rhs_arena.get());
+  ArenaStringPtr::InternalSwap(empty_default,          //
+                               &lhs, lhs_arena.get(),  //
+                               &rhs, rhs_arena.get());
+  EXPECT_EQ("rhs value that has some heft", lhs.GetView());
+  EXPECT_EQ("rhs value that has some heft", lhs.GetChar());
+  EXPECT_EQ("short", rhs.GetView());
+  EXPECT_EQ("short", rhs.GetChar());
+
+  ArenaStringPtr::InternalSwap(empty_default,          //
+                               &lhs, rhs_arena.get(),  //
+                               &rhs, lhs_arena.get());
+  EXPECT_EQ("short", lhs.GetView());
+  EXPECT_EQ("rhs value that has some heft", rhs.GetView());
+  lhs.Destroy(empty_default, lhs_arena.get());
+  rhs.Destroy(empty_default, rhs_arena.get());
+}
+
 }  // namespace protobuf
 }  // namespace google
 
@@ -34,6 +34,7 @@
 
 #include <google/protobuf/compiler/cpp/cpp_file.h>
 
+#include <functional>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -217,6 +218,8 @@ void FileGenerator::GenerateHeader(io::Printer* printer) {
 
     GenerateInlineFunctionDefinitions(printer);
 
+    GenerateFlatMessageDefinitions(printer);
+
     format(
         "\n"
         "// @@protoc_insertion_point(namespace_scope)\n"
@@ -1178,6 +1181,12 @@ void FileGenerator::GenerateLibraryIncludes(io::Printer* printer) {
   IncludeFile("net/proto2/io/public/coded_stream.h", printer);
   IncludeFile("net/proto2/public/arena.h", printer);
   IncludeFile("net/proto2/public/arenastring.h", printer);
+  for (auto& generator : message_generators_) {
+    if (HasFlatLayout(generator->descriptor_)) {
+      IncludeFile("net/proto2/public/flat_field.h", printer);
+      break;
+    }
+  }
   if ((options_.force_inline_string || options_.profile_driven_inline_string) &&
       !options_.opensource_runtime) {
     IncludeFile("net/proto2/public/inlined_string_field.h", printer);
@@ -1396,6 +1405,40 @@ void FileGenerator::GenerateInlineFunctionDefinitions(io::Printer* printer) {
   }
 }
 
+void FileGenerator::GenerateFlatMessageDefinitions(io::Printer* printer) {
+  Formatter format(printer, variables_);
+  std::unordered_map<const Descriptor*, MessageGenerator*> generators;
+  for (auto& generator : message_generators_) {
+    if (HasFlatLayout(generator->descriptor_)) {
+      generators[generator->descriptor_] = generator.get();
+    }
+  }
+  // The flat class of a message field has to be complete before it can be
+  // stored inline, so emit the message types in post order. Flat layouts are
+  // never recursive.
+  std::unordered_set<const Descriptor*> generated;
+  std::function<void(const Descriptor*)> generate =
+      [&](const Descriptor* descriptor) {
+        auto generator = generators.find(descriptor);
+        if (generator == generators.end() ||
+            !generated.insert(descriptor).second) {
+          return;
+        }
+        for (int i = 0; i < descriptor->field_count(); i++) {
+          if (descriptor->field(i)->message_type() != nullptr) {
+            generate(descriptor->field(i)->message_type());
+          }
+        }
+        format("\n");
+        format(kThickSeparator);
+        format("\n");
+        generator->second->GenerateFlatClassDefinition(printer);
+      };
+  for (auto& generator : message_generators_) {
+    generate(generator->descriptor_);
+  }
+}
+
 void FileGenerator::GenerateProto2NamespaceEnumSpecializations(
     io::Printer* printer) {
   Formatter format(printer, variables_);
@@ -162,6 +162,10 @@ class FileGenerator {
   // Generates inline function definitions.
   void GenerateInlineFunctionDefinitions(io::Printer* printer);
 
+  // Generates the flat classes of the messages with a flat layout, each after
+  // the flat classes of its message fields.
+  void GenerateFlatMessageDefinitions(io::Printer* printer);
+
   void GenerateProto2NamespaceEnumSpecializations(io::Printer* printer);
 
   // Sometimes the names we use in a .proto file happen to be defined as
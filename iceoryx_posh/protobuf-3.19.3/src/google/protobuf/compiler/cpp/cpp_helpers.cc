@@ -52,6 +52,7 @@
 #include <google/protobuf/io/printer.h>
 #include <google/protobuf/io/zero_copy_stream.h>
 #include <google/protobuf/dynamic_message.h>
+#include <google/protobuf/unknown_field_set.h>
 #include <google/protobuf/wire_format.h>
 #include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/stubs/strutil.h>
@@ -987,6 +988,91 @@ bool IsStringOrMessage(const FieldDescriptor* field) {
   return false;
 }
 
+namespace {
+
+// The extensions of google.protobuf.FieldOptions in iox/options.proto. protoc
+// does not link the generated code of that file, so the options of a field
+// only show up as unknown fields.
+const char kIceoryxOptionsFile[] = "iox/options.proto";
+const int kIceoryxMaxSizeFieldNumber = 71001;
+const int kIceoryxMaxCountFieldNumber = 71002;
+
+int IceoryxFieldOption(const FieldDescriptor* field, int number) {
+  const UnknownFieldSet& unknown_fields =
+      field->options().GetReflection()->GetUnknownFields(field->options());
+  int value = 0;
+  for (int i = 0; i < unknown_fields.field_count(); i++) {
+    const UnknownField& unknown_field = unknown_fields.field(i);
+    if (unknown_field.number() == number &&
+        unknown_field.type() == UnknownField::TYPE_VARINT) {
+      // Values which do not fit into an int are treated as unbounded.
+      value = unknown_field.varint() <= std::numeric_limits<int>::max()
+                  ? static_cast<int>(unknown_field.varint())
+                  : 0;
+    }
+  }
+  return value;
+}
+
+bool ImportsIceoryxOptions(const FileDescriptor* file) {
+  for (int i = 0; i < file->dependency_count(); i++) {
+    if (file->dependency(i)->name() == kIceoryxOptionsFile) return true;
+  }
+  return false;
+}
+
+bool HasFlatLayout(const Descriptor* descriptor,
+                   std::unordered_set<const Descriptor*>* visiting) {
+  if (!ImportsIceoryxOptions(descriptor->file()) ||
+      IsMapEntryMessage(descriptor) || descriptor->extension_range_count() > 0 ||
+      descriptor->real_oneof_decl_count() > 0) {
+    return false;
+  }
+  // A recursive message can not be stored inline.
+  if (!visiting->insert(descriptor).second) return false;
+  bool flat = true;
+  for (int i = 0; flat && i < descriptor->field_count(); i++) {
+    const FieldDescriptor* field = descriptor->field(i);
+    if (field->is_repeated() && IceoryxMaxCount(field) <= 0) {
+      flat = false;
+      continue;
+    }
+    switch (field->cpp_type()) {
+      case FieldDescriptor::CPPTYPE_STRING:
+        flat = IceoryxMaxSize(field) > 0 && !field->has_default_value();
+        break;
+      case FieldDescriptor::CPPTYPE_MESSAGE:
+        flat = !field->is_map() &&
+               field->type() != FieldDescriptor::TYPE_GROUP &&
+               HasFlatLayout(field->message_type(), visiting);
+        break;
+      default:
+        break;
+    }
+  }
+  visiting->erase(descriptor);
+  return flat;
+}
+
+}  // namespace
+
+int IceoryxMaxSize(const FieldDescriptor* field) {
+  return IceoryxFieldOption(field, kIceoryxMaxSizeFieldNumber);
+}
+
+int IceoryxMaxCount(const FieldDescriptor* field) {
+  return IceoryxFieldOption(field, kIceoryxMaxCountFieldNumber);
+}
+
+bool HasFlatLayout(const Descriptor* descriptor) {
+  std::unordered_set<const Descriptor*> visiting;
+  return HasFlatLayout(descriptor, &visiting);
+}
+
+std::string FlatClassName(const Descriptor* descriptor, bool qualified) {
+  return ClassName(descriptor, qualified) + "Flat";
+}
+
 FieldOptions::CType EffectiveStringCType(const FieldDescriptor* field,
                                          const Options& options) {
   GOOGLE_DCHECK(field->cpp_type() == FieldDescriptor::CPPTYPE_STRING);
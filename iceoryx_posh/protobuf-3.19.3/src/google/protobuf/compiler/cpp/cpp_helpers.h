@@ -430,6 +430,21 @@ inline bool IsMapEntryMessage(const Descriptor* descriptor) {
   return descriptor->options().map_entry();
 }
 
+// Returns the bound of a field given by the (iox.max_size) respectively the
+// (iox.max_count) option of iox/options.proto, or 0 if the option is not set.
+int IceoryxMaxSize(const FieldDescriptor* field);
+int IceoryxMaxCount(const FieldDescriptor* field);
+
+// Returns true if a flat class with a compile-time size is generated next to
+// the message class, see iox/options.proto. This requires the file to import
+// iox/options.proto, every string, bytes and repeated field to be bounded and
+// every message field to refer to a message with a flat layout. Messages with
+// oneofs, maps, groups, extensions or string defaults have no flat layout.
+bool HasFlatLayout(const Descriptor* descriptor);
+
+// Returns the name of the flat class of a message with a flat layout.
+std::string FlatClassName(const Descriptor* descriptor, bool qualified);
+
 // Returns true if the field's CPPTYPE is string or message.
 bool IsStringOrMessage(const FieldDescriptor* field);
 
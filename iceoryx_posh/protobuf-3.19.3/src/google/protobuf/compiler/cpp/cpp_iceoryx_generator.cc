@@ -0,0 +1,252 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <google/protobuf/compiler/cpp/cpp_iceoryx_generator.h>
+
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <google/protobuf/compiler/cpp/cpp_helpers.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/io/printer.h>
+#include <google/protobuf/io/zero_copy_stream.h>
+#include <google/protobuf/relocation.h>
+#include <google/protobuf/stubs/strutil.h>
+
+namespace google {
+namespace protobuf {
+namespace compiler {
+namespace cpp {
+
+IceoryxGenerator::IceoryxGenerator() {}
+IceoryxGenerator::~IceoryxGenerator() {}
+
+namespace {
+
+void CollectMessages(const Descriptor* descriptor,
+                     std::vector<const Descriptor*>* messages) {
+  // Map entries are an implementation detail of map fields and cannot be
+  // published on their own.
+  if (IsMapEntryMessage(descriptor)) return;
+  messages->push_back(descriptor);
+  for (int i = 0; i < descriptor->nested_type_count(); i++) {
+    CollectMessages(descriptor->nested_type(i), messages);
+  }
+}
+
+// FNV-1a over the bytes of "value"; the same function as
+// ::iox::popo::MessageLayout::addToAbiHash.
+uint64_t AddToFingerprint(uint64_t fingerprint, uint64_t value) {
+  for (int i = 0; i < 8; i++) {
+    fingerprint ^= (value >> (8 * i)) & 0xFF;
+    fingerprint *= 1099511628211ULL;
+  }
+  return fingerprint;
+}
+
+uint64_t AddToFingerprint(uint64_t fingerprint, const std::string& value) {
+  for (char c : value) {
+    fingerprint = AddToFingerprint(fingerprint, static_cast<unsigned char>(c));
+  }
+  return fingerprint;
+}
+
+// Adds everything of "descriptor" and its submessages to "fingerprint" which
+// determines the layout of the generated classes. The order of the members of
+// a class follows from the types, labels and presence of its fields; their
+// offsets are covered by the size of the class, which the subscriber adds
+// when it is compiled. An equal fingerprint only means that the data members
+// of a message can be read in place; its virtual functions dispatch through
+// the vtable of the process which built it and are never safe to call.
+uint64_t AddSchemaToFingerprint(uint64_t fingerprint,
+                                const Descriptor* descriptor,
+                                std::set<const Descriptor*>* visited) {
+  fingerprint = AddToFingerprint(fingerprint, descriptor->full_name());
+  if (!visited->insert(descriptor).second) return fingerprint;
+
+  fingerprint =
+      AddToFingerprint(fingerprint, descriptor->file()->options().optimize_for());
+  fingerprint =
+      AddToFingerprint(fingerprint, descriptor->extension_range_count());
+  for (int i = 0; i < descriptor->field_count(); i++) {
+    const FieldDescriptor* field = descriptor->field(i);
+    const OneofDescriptor* oneof = field->real_containing_oneof();
+    fingerprint = AddToFingerprint(fingerprint, field->number());
+    fingerprint = AddToFingerprint(fingerprint, field->type());
+    fingerprint = AddToFingerprint(fingerprint, field->label());
+    fingerprint = AddToFingerprint(fingerprint, field->is_packed());
+    fingerprint = AddToFingerprint(fingerprint, field->has_presence());
+    fingerprint = AddToFingerprint(
+        fingerprint, oneof == nullptr ? 0 : oneof->index() + 1);
+    if (field->message_type() != nullptr) {
+      fingerprint =
+          AddSchemaToFingerprint(fingerprint, field->message_type(), visited);
+    }
+  }
+  return fingerprint;
+}
+
+// Generates the schema fingerprint of "descriptor", which
+// ::iox::popo::protobufAbiHash finds via argument dependent lookup. It is
+// computed here since the subscriber may have been built from another version
+// of the .proto file or with another protoc, which generates another
+// representation of the messages.
+void GenerateSchemaFingerprint(const Descriptor* descriptor,
+                               Formatter format) {
+  std::set<const Descriptor*> visited;
+  uint64_t fingerprint =
+      AddToFingerprint(14695981039346656037ULL, GOOGLE_PROTOBUF_VERSION);
+  fingerprint =
+      AddToFingerprint(fingerprint, internal::kArenaRepresentationVersion);
+  fingerprint = AddSchemaToFingerprint(fingerprint, descriptor, &visited);
+
+  format.Set("classname", ClassName(descriptor, false));
+  format.Set("fingerprint",
+             StrCat("0x", strings::Hex(fingerprint, strings::ZERO_PAD_16)));
+  format(
+      "constexpr uint64_t IceoryxSchemaFingerprint(const $classname$*) {\n"
+      "  return $fingerprint$ULL;\n"
+      "}\n"
+      "\n");
+}
+
+// Generates the publisher and subscriber of "classname". Messages are loaned
+// on an arena by a ProtobufPublisher and received by a ProtobufSubscriber,
+// which falls back to a serialized copy in processes with another layout;
+// flat classes have a compile-time size and are loaned as a single chunk by a
+// plain Publisher.
+void GenerateWrappers(const std::string& classname,
+                      const std::string& publisher,
+                      const std::string& subscriber, Formatter format) {
+  format.Set("classname", classname);
+  format.Set("publisher", publisher);
+  format.Set("subscriber", subscriber);
+  format(
+      "class $classname$ZeroCopyPublisher final\n"
+      "    : public ::iox::popo::$publisher$<$classname$> {\n"
+      " public:\n"
+      "  explicit $classname$ZeroCopyPublisher(\n"
+      "      const ::iox::capro::ServiceDescription& service,\n"
+      "      const ::iox::popo::PublisherOptions& options =\n"
+      "          ::iox::popo::PublisherOptions())\n"
+      "      : ::iox::popo::$publisher$<$classname$>(service, options) "
+      "{}\n"
+      "};\n"
+      "\n"
+      "class $classname$ZeroCopySubscriber final\n"
+      "    : public ::iox::popo::$subscriber$<$classname$> {\n"
+      " public:\n"
+      "  explicit $classname$ZeroCopySubscriber(\n"
+      "      const ::iox::capro::ServiceDescription& service,\n"
+      "      const ::iox::popo::SubscriberOptions& options =\n"
+      "          ::iox::popo::SubscriberOptions())\n"
+      "      : ::iox::popo::$subscriber$<$classname$>(service, options) "
+      "{}\n"
+      "};\n"
+      "\n");
+}
+
+}  // namespace
+
+bool IceoryxGenerator::Generate(const FileDescriptor* file,
+                                const std::string& parameter,
+                                GeneratorContext* generator_context,
+                                std::string* error) const {
+  std::vector<std::pair<std::string, std::string> > options;
+  ParseGeneratorParameter(parameter, &options);
+  if (!options.empty()) {
+    *error = "Unknown generator option: " + options[0].first;
+    return false;
+  }
+
+  Options file_options;
+  std::string basename = StripProto(file->name());
+
+  std::vector<const Descriptor*> messages;
+  for (int i = 0; i < file->message_type_count(); i++) {
+    CollectMessages(file->message_type(i), &messages);
+  }
+
+  std::unique_ptr<io::ZeroCopyOutputStream> output(
+      generator_context->Open(basename + ".iox.pb.h"));
+  io::Printer printer(output.get(), '$');
+  Formatter format(&printer);
+  format.Set("filename", file->name());
+  format.Set("guard",
+             "GOOGLE_PROTOBUF_INCLUDED_" +
+                 FilenameIdentifier(file->name() + ".iox.pb.h"));
+  format.Set("pb_h", basename + ".pb.h");
+
+  format(
+      "// Generated by the protocol buffer compiler.  DO NOT EDIT!\n"
+      "// source: $filename$\n"
+      "\n"
+      "#ifndef $guard$\n"
+      "#define $guard$\n"
+      "\n"
+      "#include \"iceoryx_posh/popo/protobuf_publisher.hpp\"\n"
+      "#include \"iceoryx_posh/popo/protobuf_subscriber.hpp\"\n"
+      "\n"
+      "#include \"$pb_h$\"\n"
+      "\n");
+
+  {
+    NamespaceOpener ns(Namespace(file, file_options), format);
+    format("\n");
+    for (const Descriptor* descriptor : messages) {
+      GenerateSchemaFingerprint(descriptor, format);
+      GenerateWrappers(ClassName(descriptor, false), "ProtobufPublisher",
+                       "ProtobufSubscriber", format);
+      if (HasFlatLayout(descriptor)) {
+        GenerateWrappers(FlatClassName(descriptor, false), "Publisher",
+                         "Subscriber", format);
+      }
+    }
+  }
+
+  format(
+      "\n"
+      "#endif  // $guard$\n");
+
+  if (printer.failed()) {
+    *error = "Failed to write " + basename + ".iox.pb.h";
+    return false;
+  }
+  return true;
+}
+
+}  // namespace cpp
+}  // namespace compiler
+}  // namespace protobuf
+}  // namespace google
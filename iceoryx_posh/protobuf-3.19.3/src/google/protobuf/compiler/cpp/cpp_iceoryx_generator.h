@@ -0,0 +1,95 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Generates iceoryx zero-copy publisher and subscriber wrappers for the
+// messages of a .proto file.
+
+#ifndef GOOGLE_PROTOBUF_COMPILER_CPP_ICEORYX_GENERATOR_H__
+#define GOOGLE_PROTOBUF_COMPILER_CPP_ICEORYX_GENERATOR_H__
+
+#include <string>
+#include <google/protobuf/compiler/code_generator.h>
+
+#include <google/protobuf/port_def.inc>
+
+namespace google {
+namespace protobuf {
+namespace compiler {
+namespace cpp {
+
+// CodeGenerator implementation which generates a header "foo.iox.pb.h" next to
+// the "foo.pb.h" of the C++ generator.  For every message Msg of the file it
+// declares the classes
+//
+//   MsgZeroCopyPublisher   derived from iox::popo::ProtobufPublisher<Msg>
+//   MsgZeroCopySubscriber  derived from iox::popo::Subscriber<Msg>
+//
+// The publisher binds the arena of a loan to the publisher port, so that
+// messages are built directly in the chunks of the port; the subscriber takes
+// them as read-only views into the chunks:
+//
+//   tutorial::PersonZeroCopyPublisher publisher({"Tutorial", "Person", "Demo"});
+//   publisher.loan().and_then([](auto& person) {
+//     person->set_name("zerocopy");
+//     person.publish();
+//   });
+//
+//   tutorial::PersonZeroCopySubscriber subscriber({"Tutorial", "Person", "Demo"});
+//   subscriber.take().and_then([](auto& person) { use(person->name()); });
+//
+// The generated classes are thin, the iceoryx templates are header-only and
+// hence the whole build path can be inlined.  Nested messages are named like
+// their C++ classes, e.g. Person_PhoneNumberZeroCopyPublisher.
+class PROTOC_EXPORT IceoryxGenerator : public CodeGenerator {
+ public:
+  IceoryxGenerator();
+  ~IceoryxGenerator();
+
+  // implements CodeGenerator ----------------------------------------
+  bool Generate(const FileDescriptor* file, const std::string& parameter,
+                GeneratorContext* generator_context,
+                std::string* error) const override;
+
+  uint64_t GetSupportedFeatures() const override {
+    return FEATURE_PROTO3_OPTIONAL;
+  }
+
+ private:
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(IceoryxGenerator);
+};
+
+}  // namespace cpp
+}  // namespace compiler
+}  // namespace protobuf
+}  // namespace google
+
+#include <google/protobuf/port_undef.inc>
+
+#endif  // GOOGLE_PROTOBUF_COMPILER_CPP_ICEORYX_GENERATOR_H__
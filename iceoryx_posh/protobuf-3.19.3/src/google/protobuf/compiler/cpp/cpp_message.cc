@@ -4576,6 +4576,346 @@ void MessageGenerator::GenerateIsInitialized(io::Printer* printer) {
       "}\n");
 }
 
+namespace {
+
+// Sets the variables describing the inline storage of a field of a flat class.
+void SetFlatFieldVariables(const FieldDescriptor* field, const Options& options,
+                           Formatter* format) {
+  std::string type;
+  switch (field->cpp_type()) {
+    case FieldDescriptor::CPPTYPE_ENUM:
+      type = QualifiedClassName(field->enum_type(), options);
+      break;
+    case FieldDescriptor::CPPTYPE_STRING:
+      type = StrCat("::", ProtobufNamespace(options), "::FlatString<",
+                    IceoryxMaxSize(field), ">");
+      break;
+    case FieldDescriptor::CPPTYPE_MESSAGE:
+      type = FlatClassName(field->message_type(), true);
+      break;
+    default:
+      type = PrimitiveTypeName(options, field->cpp_type());
+      format->Set("default", DefaultValue(options, field));
+      break;
+  }
+  if (field->cpp_type() == FieldDescriptor::CPPTYPE_ENUM) {
+    format->Set("default", DefaultValue(options, field));
+  }
+  format->Set("name", FieldName(field));
+  format->Set("type", type);
+  format->Set("field_type",
+              field->is_repeated()
+                  ? StrCat("::", ProtobufNamespace(options),
+                           "::FlatRepeatedField< ", type, ", ",
+                           IceoryxMaxCount(field), ">")
+                  : type);
+  format->Set("max_size", IceoryxMaxSize(field));
+  format->Set("max_count", IceoryxMaxCount(field));
+}
+
+// Singular fields with presence track it in a bool of the flat class.
+bool HasFlatPresence(const FieldDescriptor* field) {
+  return !field->is_repeated() && field->has_presence();
+}
+
+void GenerateFlatRepeatedFieldAccessors(const FieldDescriptor* field,
+                                        const Formatter& format) {
+  format(
+      "int $name$_size() const { return $name$_.size(); }\n"
+      "void clear_$name$() { $name$_.Clear(); }\n");
+  switch (field->cpp_type()) {
+    case FieldDescriptor::CPPTYPE_STRING:
+      format(
+          "const $type$& $name$(int index) const { return $name$_.Get(index); "
+          "}\n"
+          "$type$* mutable_$name$(int index) { return $name$_.Mutable(index); "
+          "}\n"
+          "void set_$name$(int index, const std::string& value) {\n"
+          "  $name$_.Mutable(index)->assign(value);\n"
+          "}\n"
+          "void set_$name$(int index, const char* value) {\n"
+          "  $name$_.Mutable(index)->assign(value);\n"
+          "}\n"
+          "void set_$name$(int index, const void* value, size_t size) {\n"
+          "  $name$_.Mutable(index)->assign(value, size);\n"
+          "}\n"
+          "$type$* add_$name$() { return $name$_.Add(); }\n"
+          "void add_$name$(const std::string& value) {\n"
+          "  $name$_.Add()->assign(value);\n"
+          "}\n"
+          "void add_$name$(const char* value) { $name$_.Add()->assign(value); "
+          "}\n"
+          "void add_$name$(const void* value, size_t size) {\n"
+          "  $name$_.Add()->assign(value, size);\n"
+          "}\n");
+      break;
+    case FieldDescriptor::CPPTYPE_MESSAGE:
+      format(
+          "const $type$& $name$(int index) const { return $name$_.Get(index); "
+          "}\n"
+          "$type$* mutable_$name$(int index) { return $name$_.Mutable(index); "
+          "}\n"
+          "$type$* add_$name$() { return $name$_.Add(); }\n");
+      break;
+    default:
+      format(
+          "$type$ $name$(int index) const { return $name$_.Get(index); }\n"
+          "void set_$name$(int index, $type$ value) { $name$_.Set(index, "
+          "value); }\n"
+          "void add_$name$($type$ value) { $name$_.Add(value); }\n");
+      break;
+  }
+  format(
+      "const $field_type$& $name$() const { return $name$_; }\n"
+      "$field_type$* mutable_$name$() { return &$name$_; }\n");
+}
+
+void GenerateFlatSingularFieldAccessors(const FieldDescriptor* field,
+                                        const Formatter& format) {
+  const bool presence = HasFlatPresence(field);
+  if (presence) {
+    format("bool has_$name$() const { return _has_$name$_; }\n");
+  }
+  switch (field->cpp_type()) {
+    case FieldDescriptor::CPPTYPE_STRING:
+      format("const $type$& $name$() const { return $name$_; }\n");
+      for (const auto& setter : std::vector<std::pair<const char*, const char*>>{
+               {"const std::string& value", "value"},
+               {"const char* value", "value"},
+               {"const void* value, size_t size", "value, size"}}) {
+        format("void set_$name$($1$) {\n", setter.first);
+        if (presence) format("  _has_$name$_ = true;\n");
+        format(
+            "  $name$_.assign($1$);\n"
+            "}\n",
+            setter.second);
+      }
+      format("$type$* mutable_$name$() {\n");
+      if (presence) format("  _has_$name$_ = true;\n");
+      format(
+          "  return &$name$_;\n"
+          "}\n"
+          "void clear_$name$() {\n"
+          "  $name$_.clear();\n");
+      break;
+    case FieldDescriptor::CPPTYPE_MESSAGE:
+      format(
+          "const $type$& $name$() const { return $name$_; }\n"
+          "$type$* mutable_$name$() {\n");
+      if (presence) format("  _has_$name$_ = true;\n");
+      format(
+          "  return &$name$_;\n"
+          "}\n"
+          "void clear_$name$() {\n"
+          "  $name$_.Clear();\n");
+      break;
+    default:
+      format(
+          "$type$ $name$() const { return $name$_; }\n"
+          "void set_$name$($type$ value) {\n");
+      if (presence) format("  _has_$name$_ = true;\n");
+      format(
+          "  $name$_ = value;\n"
+          "}\n"
+          "void clear_$name$() {\n"
+          "  $name$_ = $default$;\n");
+      break;
+  }
+  if (presence) format("  _has_$name$_ = false;\n");
+  format("}\n");
+}
+
+// Generates the part of CopyTo() which copies one field into "message".
+void GenerateFlatFieldCopyTo(const FieldDescriptor* field,
+                             const Formatter& format) {
+  if (field->is_repeated()) {
+    switch (field->cpp_type()) {
+      case FieldDescriptor::CPPTYPE_STRING:
+        format(
+            "for (const $type$& value : $name$_) {\n"
+            "  message->add_$name$(value.data(), value.size());\n"
+            "}\n");
+        break;
+      case FieldDescriptor::CPPTYPE_MESSAGE:
+        format(
+            "for (const $type$& value : $name$_) {\n"
+            "  value.CopyTo(message->add_$name$());\n"
+            "}\n");
+        break;
+      default:
+        format(
+            "for ($type$ value : $name$_) {\n"
+            "  message->add_$name$(value);\n"
+            "}\n");
+        break;
+    }
+    return;
+  }
+  if (HasFlatPresence(field)) {
+    format("if (_has_$name$_) ");
+  }
+  switch (field->cpp_type()) {
+    case FieldDescriptor::CPPTYPE_STRING:
+      format(
+          "message->mutable_$name$()->assign($name$_.data(), "
+          "$name$_.size());\n");
+      break;
+    case FieldDescriptor::CPPTYPE_MESSAGE:
+      format("$name$_.CopyTo(message->mutable_$name$());\n");
+      break;
+    default:
+      format("message->set_$name$($name$_);\n");
+      break;
+  }
+}
+
+// Generates the part of CopyFrom() which copies one field of "message" and
+// returns false if it exceeds its bound.
+void GenerateFlatFieldCopyFrom(const FieldDescriptor* field,
+                               const Formatter& format) {
+  if (field->is_repeated()) {
+    format(
+        "if (message.$name$_size() > $max_count$) return false;\n"
+        "for (int i = 0; i < message.$name$_size(); i++) {\n");
+    switch (field->cpp_type()) {
+      case FieldDescriptor::CPPTYPE_STRING:
+        format(
+            "  if (message.$name$(i).size() > $max_size$) return false;\n"
+            "  $name$_.Add()->assign(message.$name$(i));\n");
+        break;
+      case FieldDescriptor::CPPTYPE_MESSAGE:
+        format(
+            "  if (!$name$_.Add()->CopyFrom(message.$name$(i))) return "
+            "false;\n");
+        break;
+      default:
+        format("  $name$_.Add(message.$name$(i));\n");
+        break;
+    }
+    format("}\n");
+    return;
+  }
+  const bool presence = HasFlatPresence(field);
+  switch (field->cpp_type()) {
+    case FieldDescriptor::CPPTYPE_STRING:
+      format("if (message.$name$().size() > $max_size$) return false;\n");
+      if (presence) format("if (message.has_$name$()) ");
+      format("set_$name$(message.$name$());\n");
+      break;
+    case FieldDescriptor::CPPTYPE_MESSAGE:
+      format(
+          "if (message.has_$name$() &&\n"
+          "    !mutable_$name$()->CopyFrom(message.$name$())) {\n"
+          "  return false;\n"
+          "}\n");
+      break;
+    default:
+      if (presence) format("if (message.has_$name$()) ");
+      format("set_$name$(message.$name$());\n");
+      break;
+  }
+}
+
+}  // namespace
+
+void MessageGenerator::GenerateFlatClassDefinition(io::Printer* printer) {
+  Formatter format(printer, variables_);
+  format.Set("flat_classname", FlatClassName(descriptor_, false));
+
+  std::vector<const FieldDescriptor*> fields;
+  for (int i = 0; i < descriptor_->field_count(); i++) {
+    fields.push_back(descriptor_->field(i));
+  }
+  std::vector<const FieldDescriptor*> layout = fields;
+  OptimizeFlatLayout(&layout);
+
+  format(
+      "// $classname$ with every field stored inline, see iox/options.proto.\n"
+      "// It has a size known at compile time and no pointers, so it can be\n"
+      "// constructed in a single shared memory chunk and read in place.\n"
+      "class $flat_classname$ final {\n"
+      " public:\n");
+  format.Indent();
+  format(
+      "typedef $classname$ MessageType;\n"
+      "\n"
+      "void Clear() {\n");
+  for (auto field : fields) {
+    Formatter field_format = format;
+    SetFlatFieldVariables(field, options_, &field_format);
+    field_format("  clear_$name$();\n");
+  }
+  format(
+      "}\n"
+      "\n"
+      "// Copies the fields into \"message\".\n"
+      "void CopyTo($classname$* message) const {\n"
+      "  message->Clear();\n");
+  format.Indent();
+  for (auto field : fields) {
+    Formatter field_format = format;
+    SetFlatFieldVariables(field, options_, &field_format);
+    GenerateFlatFieldCopyTo(field, field_format);
+  }
+  format.Outdent();
+  format(
+      "}\n"
+      "\n"
+      "// Copies the fields of \"message\". Returns false if a field exceeds\n"
+      "// its bound, this message is then only partially filled.\n"
+      "bool CopyFrom(const $classname$& $1$) {\n"
+      "  Clear();\n",
+      fields.empty() ? "" : "message");
+  format.Indent();
+  for (auto field : fields) {
+    Formatter field_format = format;
+    SetFlatFieldVariables(field, options_, &field_format);
+    GenerateFlatFieldCopyFrom(field, field_format);
+  }
+  format.Outdent();
+  format(
+      "  return true;\n"
+      "}\n"
+      "\n"
+      "// accessors -------------------------------------------------------\n");
+  for (auto field : fields) {
+    Formatter field_format = format;
+    SetFlatFieldVariables(field, options_, &field_format);
+    format("\n");
+    PrintFieldComment(field_format, field);
+    if (field->is_repeated()) {
+      GenerateFlatRepeatedFieldAccessors(field, field_format);
+    } else {
+      GenerateFlatSingularFieldAccessors(field, field_format);
+    }
+  }
+  format.Outdent();
+  format(
+      "\n"
+      " private:\n");
+  format.Indent();
+  for (auto field : layout) {
+    Formatter field_format = format;
+    SetFlatFieldVariables(field, options_, &field_format);
+    if (!field->is_repeated() &&
+        field->cpp_type() != FieldDescriptor::CPPTYPE_STRING &&
+        field->cpp_type() != FieldDescriptor::CPPTYPE_MESSAGE) {
+      field_format("$field_type$ $name$_ = $default$;\n");
+    } else {
+      field_format("$field_type$ $name$_;\n");
+    }
+  }
+  // The presence flags need no alignment, so they go last.
+  for (auto field : layout) {
+    if (!HasFlatPresence(field)) continue;
+    Formatter field_format = format;
+    SetFlatFieldVariables(field, options_, &field_format);
+    field_format("bool _has_$name$_ = false;\n");
+  }
+  format.Outdent();
+  format("};\n");
+}
+
 }  // namespace cpp
 }  // namespace compiler
 }  // namespace protobuf
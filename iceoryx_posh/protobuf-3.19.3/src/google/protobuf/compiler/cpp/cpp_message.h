@@ -83,6 +83,10 @@ class MessageGenerator {
   // file).
   void GenerateInlineMethods(io::Printer* printer);
 
+  // Generate the flat class of a message with a flat layout (see
+  // HasFlatLayout()). Placed after the inline methods of the header file.
+  void GenerateFlatClassDefinition(io::Printer* printer);
+
   // Source file stuff.
 
   // Generate all non-inline methods for this class.
@@ -160,9 +160,8 @@ void MessageFieldGenerator::GenerateInlineAccessorDefinitions(
   format(
       "inline const $type$& $classname$::_internal_$name$() const {\n"
       "$type_reference_function$"
-      //"  const $type$* p = $casted_member$;\n"
-      "  const $type$* p = $casted_member$ == nullptr ? nullptr : reinterpret_cast<const $type$*>(\n"
-      "      reinterpret_cast<uint64_t>(this) + reinterpret_cast<uint64_t>($casted_member$) - reinterpret_cast<uint64_t>(orin_this_));\n"
+      "  const $type$* p = ::$proto_ns$::internal::Relocate(\n"
+      "      $casted_member$, GetRelocationOffset());\n"
       "  return p != nullptr ? *p : reinterpret_cast<const $type$&>(\n"
       "      $type_default_instance$);\n"
       "}\n"
@@ -238,10 +237,8 @@ void MessageFieldGenerator::GenerateInlineAccessorDefinitions(
   }
   format(
       "  }\n"
-      // "  return $casted_member$;\n"
-      "  return reinterpret_cast<$type$*>(\n"
-      "      reinterpret_cast<uint64_t>(this) + reinterpret_cast<uint64_t>(\n"
-      "         $casted_member$) - reinterpret_cast<uint64_t>(orin_this_));\n"
+      "  return ::$proto_ns$::internal::Relocate(\n"
+      "      $casted_member$, GetRelocationOffset());\n"
       "}\n"
       "inline $type$* $classname$::mutable_$name$() {\n"
       "  $type$* _msg = _internal_mutable_$name$();\n"
@@ -222,6 +222,56 @@ void PaddingOptimizer::OptimizeLayout(
   }
 }
 
+int FlatAlignment(const FieldDescriptor* field) {
+  int alignment = 1;
+  switch (field->cpp_type()) {
+    case FieldDescriptor::CPPTYPE_BOOL:
+      alignment = 1;
+      break;
+    case FieldDescriptor::CPPTYPE_INT32:
+    case FieldDescriptor::CPPTYPE_UINT32:
+    case FieldDescriptor::CPPTYPE_ENUM:
+    case FieldDescriptor::CPPTYPE_FLOAT:
+    // FlatString starts with its uint32_t size.
+    case FieldDescriptor::CPPTYPE_STRING:
+      alignment = 4;
+      break;
+    case FieldDescriptor::CPPTYPE_INT64:
+    case FieldDescriptor::CPPTYPE_UINT64:
+    case FieldDescriptor::CPPTYPE_DOUBLE:
+      alignment = 8;
+      break;
+    case FieldDescriptor::CPPTYPE_MESSAGE: {
+      const Descriptor* descriptor = field->message_type();
+      for (int i = 0; i < descriptor->field_count(); i++) {
+        alignment = std::max(alignment, FlatAlignment(descriptor->field(i)));
+      }
+      break;
+    }
+  }
+  // FlatRepeatedField starts with its uint32_t size.
+  return field->is_repeated() ? std::max(alignment, 4) : alignment;
+}
+
+void OptimizeFlatLayout(std::vector<const FieldDescriptor*>* fields) {
+  // FlatAlignment() recurses into message fields, so compute it only once per
+  // field.
+  std::vector<std::pair<int, const FieldDescriptor*>> aligned_fields;
+  aligned_fields.reserve(fields->size());
+  for (const FieldDescriptor* field : *fields) {
+    aligned_fields.emplace_back(FlatAlignment(field), field);
+  }
+  std::stable_sort(aligned_fields.begin(), aligned_fields.end(),
+                   [](const std::pair<int, const FieldDescriptor*>& a,
+                      const std::pair<int, const FieldDescriptor*>& b) {
+                     return a.first > b.first;
+                   });
+  fields->clear();
+  for (const auto& aligned_field : aligned_fields) {
+    fields->push_back(aligned_field.second);
+  }
+}
+
 }  // namespace cpp
 }  // namespace compiler
 }  // namespace protobuf
@@ -57,6 +57,16 @@ class PaddingOptimizer : public MessageLayoutHelper {
                       MessageSCCAnalyzer* scc_analyzer) override;
 };
 
+// Returns the alignment of the inline storage of a field in the flat class of a
+// message with a flat layout (see HasFlatLayout()).
+int FlatAlignment(const FieldDescriptor* field);
+
+// Reorders the fields of a message with a flat layout by decreasing alignment
+// of their inline storage. Since the size of every member is a multiple of its
+// alignment, the members of the flat class are then laid out without padding.
+// Fields with the same alignment keep their declaration order.
+void OptimizeFlatLayout(std::vector<const FieldDescriptor*>* fields);
+
 }  // namespace cpp
 }  // namespace compiler
 }  // namespace protobuf
@@ -168,6 +168,23 @@ void StringFieldGenerator::GenerateAccessorDeclarations(
       "template <typename ArgT0 = const std::string&, typename... ArgT>\n"
       "$deprecated_attr$void ${1$set_$name$$}$(ArgT0&& arg0, ArgT... args);\n",
       descriptor_);
+  if (!inlined_) {
+    // Reads the value without copying it, also from a message which was built
+    // on an arena in shared memory that is mapped at another address.
+    format(
+        "$deprecated_attr$::$proto_ns$::StringPiece ${1$$name$_view$}$() "
+        "const;\n",
+        descriptor_);
+  }
+  if (HasReferencedSetter()) {
+    // Lets the value refer to bytes in shared memory next to the arena, e.g.
+    // in another chunk of the same sample, instead of copying them.
+    format(
+        "$deprecated_attr$void "
+        "${1$unsafe_arena_set_referenced_$name$$}$(const void* data, "
+        "size_t size);\n",
+        descriptor_);
+  }
   format(
       "$deprecated_attr$std::string* ${1$mutable_$name$$}$();\n"
       "PROTOBUF_NODISCARD $deprecated_attr$std::string* "
@@ -211,6 +228,27 @@ void StringFieldGenerator::GenerateInlineAccessorDefinitions(
       "  return _internal_$name$();\n"
       "}\n");
   if (!inlined_) {
+    format(
+        "inline ::$proto_ns$::StringPiece $classname$::$name$_view() const {\n");
+    if (!descriptor_->default_value_string().empty()) {
+      format(
+          "  if ($name$_.IsDefault(nullptr)) return "
+          "$default_variable_name$.get();\n");
+    }
+    format(
+        "  return $name$_.GetView();\n"
+        "}\n");
+    if (HasReferencedSetter()) {
+      format(
+          "inline void $classname$::unsafe_arena_set_referenced_$name$(\n"
+          "    const void* data, size_t size) {\n"
+          "  $set_hasbit$\n"
+          "  $name$_.SetReferenced($default_value_tag$, "
+          "static_cast<const char*>(data), size, GetArenaForAllocation());\n"
+          "$annotate_set$"
+          "  // @@protoc_insertion_point(field_set_referenced:$full_name$)\n"
+          "}\n");
+    }
     format(
         "template <typename ArgT0, typename... ArgT>\n"
         "inline PROTOBUF_ALWAYS_INLINE\n"
@@ -569,6 +607,12 @@ void StringOneofFieldGenerator::GenerateInlineAccessorDefinitions(
       "  }\n"
       "  return $default_string$;\n"
       "}\n"
+      "inline ::$proto_ns$::StringPiece $classname$::$name$_view() const {\n"
+      "  if (_internal_has_$name$()) {\n"
+      "    return $field_member$.GetView();\n"
+      "  }\n"
+      "  return $default_string$;\n"
+      "}\n"
       "inline void $classname$::_internal_set_$name$(const std::string& "
       "value) {\n"
       "  if (!_internal_has_$name$()) {\n"
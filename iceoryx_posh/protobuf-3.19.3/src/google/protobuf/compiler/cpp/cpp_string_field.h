@@ -71,6 +71,13 @@ class StringFieldGenerator : public FieldGenerator {
   bool IsInlined() const override { return inlined_; }
 
  private:
+  // Whether unsafe_arena_set_referenced_$name$() is generated, which is the
+  // case for bytes fields that are neither inlined nor part of a oneof.
+  bool HasReferencedSetter() const {
+    return !inlined_ && descriptor_->type() == FieldDescriptor::TYPE_BYTES &&
+           descriptor_->real_containing_oneof() == nullptr;
+  }
+
   bool inlined_;
   GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(StringFieldGenerator);
 };
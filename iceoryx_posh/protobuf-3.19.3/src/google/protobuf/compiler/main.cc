@@ -29,6 +29,7 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <google/protobuf/compiler/cpp/cpp_generator.h>
+#include <google/protobuf/compiler/cpp/cpp_iceoryx_generator.h>
 #include <google/protobuf/compiler/java/java_generator.h>
 #include <google/protobuf/compiler/java/java_kotlin_generator.h>
 #include <google/protobuf/compiler/js/js_generator.h>
@@ -60,6 +61,12 @@ int ProtobufMain(int argc, char* argv[]) {
   cpp_generator.set_runtime_include_base(GOOGLE_PROTOBUF_RUNTIME_INCLUDE_BASE);
 #endif
 
+  // iceoryx zero-copy publisher and subscriber wrappers for the C++ classes
+  cpp::IceoryxGenerator iceoryx_generator;
+  cli.RegisterGenerator("--iceoryx_out", "--iceoryx_opt", &iceoryx_generator,
+                        "Generate iceoryx zero-copy publisher and subscriber "
+                        "header.");
+
   // Proto2 Java
   java::JavaGenerator java_generator;
   cli.RegisterGenerator("--java_out", "--java_opt", &java_generator,
@@ -209,7 +209,11 @@ int FieldSpaceUsed(const FieldDescriptor* field) {
 inline int DivideRoundingUp(int i, int j) { return (i + (j - 1)) / j; }
 
 static const int kSafeAlignment = sizeof(uint64_t);
-static const int kMaxOneofUnionSize = sizeof(uint64_t);
+// A string member of a oneof is an ArenaStringPtr, which is larger than the
+// other members since it holds the arena representation of its value.
+static const int kMaxOneofUnionSize =
+    sizeof(ArenaStringPtr) > sizeof(uint64_t) ? sizeof(ArenaStringPtr)
+                                              : sizeof(uint64_t);
 
 inline int AlignTo(int offset, int alignment) {
   return DivideRoundingUp(offset, alignment) * alignment;
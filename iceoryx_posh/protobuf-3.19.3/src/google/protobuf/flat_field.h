@@ -0,0 +1,185 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Inline storage for the string, bytes and repeated fields of the flat message
+// classes generated for the (iox.max_size) and (iox.max_count) field options,
+// see iox/options.proto.
+//
+// Unlike std::string, RepeatedField or RepeatedPtrField, the containers in this
+// file never allocate: their capacity is a template argument and the elements
+// are stored inside of the container itself. A flat message therefore has a
+// size which is known at compile time, is trivially copyable and contains no
+// pointers, so it can be constructed in a single shared memory chunk and read
+// in place by every process which maps that chunk.
+//
+// Exceeding the capacity of a container is a violation of the bounds declared
+// in the .proto file and is fatal.
+
+#ifndef GOOGLE_PROTOBUF_FLAT_FIELD_H__
+#define GOOGLE_PROTOBUF_FLAT_FIELD_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <string>
+
+#include <google/protobuf/stubs/logging.h>
+#include <google/protobuf/stubs/common.h>
+
+#ifdef SWIG
+#error "You cannot SWIG proto headers"
+#endif
+
+#include <google/protobuf/port_def.inc>
+
+namespace google {
+namespace protobuf {
+
+// A string or bytes field with at most Capacity bytes.
+template <int Capacity>
+class FlatString final {
+  static_assert(Capacity > 0, "FlatString requires a positive capacity");
+
+ public:
+  constexpr FlatString() : size_(0), data_{} {}
+
+  static constexpr int capacity() { return Capacity; }
+  int size() const { return static_cast<int>(size_); }
+  bool empty() const { return size_ == 0; }
+  const char* data() const { return data_; }
+  char* mutable_data() { return data_; }
+
+  std::string ToString() const { return std::string(data_, size_); }
+
+  void assign(const void* value, size_t size) {
+    GOOGLE_CHECK_LE(size, static_cast<size_t>(Capacity))
+        << "string of " << size << " bytes exceeds the (iox.max_size) of "
+        << Capacity;
+    memcpy(data_, value, size);
+    size_ = static_cast<uint32_t>(size);
+  }
+  void assign(const char* value) { assign(value, strlen(value)); }
+  void assign(const std::string& value) { assign(value.data(), value.size()); }
+
+  // Changes the size without touching the content; "size" must not exceed the
+  // capacity. Used after writing to mutable_data() directly.
+  void resize(int size) {
+    GOOGLE_CHECK(size >= 0 && size <= Capacity);
+    size_ = static_cast<uint32_t>(size);
+  }
+  void clear() { size_ = 0; }
+
+  bool operator==(const FlatString& other) const {
+    return size_ == other.size_ && memcmp(data_, other.data_, size_) == 0;
+  }
+  bool operator!=(const FlatString& other) const { return !(*this == other); }
+  bool operator==(const std::string& other) const {
+    return size_ == other.size() && memcmp(data_, other.data(), size_) == 0;
+  }
+  bool operator!=(const std::string& other) const { return !(*this == other); }
+
+  friend std::ostream& operator<<(std::ostream& out,
+                                  const FlatString& value) {
+    return out.write(value.data_, value.size_);
+  }
+
+ private:
+  uint32_t size_;
+  char data_[Capacity];
+};
+
+// A repeated field with at most Capacity elements. Element is a scalar, an
+// enum, a FlatString or a flat message class.
+template <typename Element, int Capacity>
+class FlatRepeatedField final {
+  static_assert(Capacity > 0, "FlatRepeatedField requires a positive capacity");
+
+ public:
+  typedef Element value_type;
+  typedef Element* iterator;
+  typedef const Element* const_iterator;
+
+  constexpr FlatRepeatedField() : size_(0), elements_{} {}
+
+  static constexpr int capacity() { return Capacity; }
+  int size() const { return static_cast<int>(size_); }
+  bool empty() const { return size_ == 0; }
+
+  const Element& Get(int index) const {
+    GOOGLE_DCHECK_GE(index, 0);
+    GOOGLE_DCHECK_LT(index, size());
+    return elements_[index];
+  }
+  Element* Mutable(int index) {
+    GOOGLE_DCHECK_GE(index, 0);
+    GOOGLE_DCHECK_LT(index, size());
+    return &elements_[index];
+  }
+  void Set(int index, const Element& value) { *Mutable(index) = value; }
+
+  // Appends a default constructed element and returns it.
+  Element* Add() {
+    GOOGLE_CHECK_LT(size(), Capacity)
+        << "repeated field exceeds its (iox.max_count) of " << Capacity;
+    Element* element = &elements_[size_++];
+    *element = Element();
+    return element;
+  }
+  void Add(const Element& value) { *Add() = value; }
+
+  void RemoveLast() {
+    GOOGLE_DCHECK_GT(size_, 0u);
+    --size_;
+  }
+  void Clear() { size_ = 0; }
+
+  const Element& operator[](int index) const { return Get(index); }
+  Element& operator[](int index) { return *Mutable(index); }
+
+  const Element* data() const { return elements_; }
+  Element* mutable_data() { return elements_; }
+
+  iterator begin() { return elements_; }
+  const_iterator begin() const { return elements_; }
+  iterator end() { return elements_ + size_; }
+  const_iterator end() const { return elements_ + size_; }
+
+ private:
+  uint32_t size_;
+  Element elements_[Capacity];
+};
+
+}  // namespace protobuf
+}  // namespace google
+
+#include <google/protobuf/port_undef.inc>
+
+#endif  // GOOGLE_PROTOBUF_FLAT_FIELD_H__
@@ -0,0 +1,361 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Tests for the containers in flat_field.h and the flat message classes which
+// protoc generates for messages whose fields are all bounded.
+
+#include <google/protobuf/flat_field.h>
+
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include <google/protobuf/unittest_iox_flat.pb.h>
+#include <google/protobuf/testing/googletest.h>
+#include <gtest/gtest.h>
+
+// Must be included last.
+#include <google/protobuf/port_def.inc>
+
+namespace google {
+namespace protobuf {
+namespace {
+
+using protobuf_unittest::FLAT_BAR;
+using protobuf_unittest::FLAT_FOO;
+using protobuf_unittest::TestFlat;
+using protobuf_unittest::TestFlatFlat;
+using protobuf_unittest::TestFlatNestedFlat;
+
+// A violated bound is fatal: it aborts, or throws if CHECK() uses exceptions.
+#if defined(PROTOBUF_HAS_DEATH_TEST)
+#define EXPECT_FATAL(statement, regex) EXPECT_DEATH(statement, regex)
+#elif PROTOBUF_USE_EXCEPTIONS
+#define EXPECT_FATAL(statement, regex) \
+  EXPECT_THROW(statement, FatalException)
+#endif
+
+constexpr size_t RoundUp(size_t size, size_t alignment) {
+  return (size + alignment - 1) / alignment * alignment;
+}
+
+void FillFlat(TestFlatFlat* flat) {
+  flat->set_bool_value(true);
+  flat->set_int32_value(-32);
+  flat->set_double_value(0.5);
+  flat->set_int64_value(int64_t{1} << 40);
+  flat->set_enum_value(FLAT_FOO);
+  flat->set_name("sixteen bytes ok");
+  flat->set_data(std::string("\0\1\2", 3));
+  flat->add_scores(1);
+  flat->add_scores(2);
+  flat->add_tags("tag");
+  flat->add_tags("eight ch");
+  flat->mutable_nested()->set_value(3);
+  flat->mutable_nested()->set_label("label");
+  flat->add_children()->set_value(4);
+}
+
+void ExpectFlatFilled(const TestFlatFlat& flat) {
+  EXPECT_TRUE(flat.bool_value());
+  EXPECT_EQ(-32, flat.int32_value());
+  EXPECT_EQ(0.5, flat.double_value());
+  EXPECT_EQ(int64_t{1} << 40, flat.int64_value());
+  EXPECT_EQ(FLAT_FOO, flat.enum_value());
+  EXPECT_EQ("sixteen bytes ok", flat.name().ToString());
+  EXPECT_EQ(std::string("\0\1\2", 3), flat.data().ToString());
+  ASSERT_EQ(2, flat.scores_size());
+  EXPECT_EQ(2, flat.scores(1));
+  ASSERT_EQ(2, flat.tags_size());
+  EXPECT_EQ("eight ch", flat.tags(1).ToString());
+  EXPECT_EQ(3, flat.nested().value());
+  EXPECT_EQ("label", flat.nested().label().ToString());
+  ASSERT_EQ(1, flat.children_size());
+  EXPECT_EQ(4, flat.children(0).value());
+  EXPECT_FALSE(flat.children(0).has_label());
+}
+
+TEST(FlatStringTest, HoldsUpToItsCapacity) {
+  FlatString<4> value;
+  EXPECT_EQ(4, value.capacity());
+  EXPECT_TRUE(value.empty());
+
+  value.assign(std::string("a\0c", 3));
+  EXPECT_EQ(3, value.size());
+  EXPECT_EQ(std::string("a\0c", 3), value.ToString());
+
+  value.assign("abcd");
+  EXPECT_EQ(4, value.size());
+  EXPECT_TRUE(value == std::string("abcd"));
+
+  memcpy(value.mutable_data(), "xy", 2);
+  value.resize(2);
+  EXPECT_EQ("xy", value.ToString());
+
+  FlatString<4> copy = value;
+  EXPECT_TRUE(copy == value);
+  copy.clear();
+  EXPECT_TRUE(copy.empty());
+  EXPECT_TRUE(copy != value);
+}
+
+TEST(FlatRepeatedFieldTest, HoldsUpToItsCapacity) {
+  FlatRepeatedField<int32_t, 3> field;
+  EXPECT_EQ(3, field.capacity());
+  EXPECT_TRUE(field.empty());
+
+  field.Add(1);
+  *field.Add() = 2;
+  field.Add(3);
+  EXPECT_EQ(3, field.size());
+  field.Set(0, 10);
+  EXPECT_EQ(10, field.Get(0));
+  EXPECT_EQ(2, field[1]);
+
+  int32_t sum = 0;
+  for (int32_t value : field) sum += value;
+  EXPECT_EQ(15, sum);
+
+  field.RemoveLast();
+  EXPECT_EQ(2, field.size());
+  // An element which is added again starts out default constructed.
+  EXPECT_EQ(0, *field.Add());
+
+  field.Clear();
+  EXPECT_TRUE(field.empty());
+}
+
+#ifdef EXPECT_FATAL
+TEST(FlatStringTest, AssignBeyondTheCapacityIsFatal) {
+  FlatString<4> value;
+  EXPECT_FATAL(value.assign("abcde"), "exceeds the \\(iox.max_size\\) of 4");
+  EXPECT_FATAL(value.resize(5), "");
+}
+
+TEST(FlatRepeatedFieldTest, AddBeyondTheCapacityIsFatal) {
+  FlatRepeatedField<int32_t, 2> field;
+  field.Add(1);
+  field.Add(2);
+  EXPECT_FATAL(field.Add(3), "exceeds its \\(iox.max_count\\) of 2");
+}
+#endif  // EXPECT_FATAL
+
+TEST(FlatMessageTest, IsTriviallyCopyableWithTheDeclaredBounds) {
+  static_assert(std::is_trivially_copyable<TestFlatFlat>::value,
+                "flat messages are trivially copyable");
+  static_assert(std::is_trivially_copyable<TestFlatNestedFlat>::value,
+                "flat messages are trivially copyable");
+  static_assert(std::is_same<TestFlatFlat::MessageType, TestFlat>::value,
+                "MessageType is the regular message");
+
+  TestFlatFlat flat;
+  EXPECT_EQ(16, flat.name().capacity());
+  EXPECT_EQ(32, flat.data().capacity());
+  EXPECT_EQ(4, flat.scores().capacity());
+  EXPECT_EQ(2, flat.tags().capacity());
+  EXPECT_EQ(8, flat.tags().data()->capacity());
+  EXPECT_EQ(8, flat.nested().label().capacity());
+  EXPECT_EQ(2, flat.children().capacity());
+}
+
+TEST(FlatMessageTest, MembersAreOrderedWithoutPadding) {
+  // The members are ordered by decreasing alignment, so only the tail of the
+  // class may be padded.
+  const size_t nested_members =
+      sizeof(int32_t) + sizeof(FlatString<8>) + 2 * sizeof(bool);
+  EXPECT_EQ(RoundUp(nested_members, alignof(TestFlatNestedFlat)),
+            sizeof(TestFlatNestedFlat));
+
+  const size_t members =
+      sizeof(double) + sizeof(int64_t) + sizeof(int32_t) +
+      sizeof(protobuf_unittest::TestFlatEnum) + sizeof(FlatString<16>) +
+      sizeof(FlatString<32>) + sizeof(FlatRepeatedField<int32_t, 4>) +
+      sizeof(FlatRepeatedField<FlatString<8>, 2>) +
+      sizeof(TestFlatNestedFlat) +
+      sizeof(FlatRepeatedField<TestFlatNestedFlat, 2>) + 9 * sizeof(bool);
+  EXPECT_EQ(alignof(double), alignof(TestFlatFlat));
+  EXPECT_EQ(RoundUp(members, alignof(TestFlatFlat)), sizeof(TestFlatFlat));
+}
+
+TEST(FlatMessageTest, DefaultsAndPresence) {
+  TestFlatFlat flat;
+  EXPECT_FALSE(flat.has_int32_value());
+  EXPECT_EQ(7, flat.int32_value());
+  EXPECT_EQ(FLAT_BAR, flat.enum_value());
+  EXPECT_FALSE(flat.has_name());
+  EXPECT_TRUE(flat.name().empty());
+  EXPECT_FALSE(flat.has_nested());
+
+  FillFlat(&flat);
+  EXPECT_TRUE(flat.has_int32_value());
+  EXPECT_TRUE(flat.has_name());
+  EXPECT_TRUE(flat.has_nested());
+  ExpectFlatFilled(flat);
+
+  flat.Clear();
+  EXPECT_FALSE(flat.has_int32_value());
+  EXPECT_EQ(7, flat.int32_value());
+  EXPECT_EQ(FLAT_BAR, flat.enum_value());
+  EXPECT_FALSE(flat.has_name());
+  EXPECT_EQ(0, flat.scores_size());
+  EXPECT_EQ(0, flat.tags_size());
+  EXPECT_FALSE(flat.has_nested());
+  EXPECT_FALSE(flat.nested().has_value());
+  EXPECT_EQ(0, flat.children_size());
+}
+
+TEST(FlatMessageTest, CopyToAndCopyFromRoundTrip) {
+  TestFlatFlat flat;
+  FillFlat(&flat);
+
+  TestFlat message;
+  message.set_int64_value(99);
+  message.add_scores(99);
+  flat.CopyTo(&message);
+  EXPECT_EQ(-32, message.int32_value());
+  EXPECT_EQ(int64_t{1} << 40, message.int64_value());
+  EXPECT_EQ("sixteen bytes ok", message.name());
+  EXPECT_EQ(std::string("\0\1\2", 3), message.data());
+  ASSERT_EQ(2, message.scores_size());
+  EXPECT_EQ(1, message.scores(0));
+  ASSERT_EQ(2, message.tags_size());
+  EXPECT_EQ("tag", message.tags(0));
+  EXPECT_EQ("label", message.nested().label());
+  ASSERT_EQ(1, message.children_size());
+  EXPECT_EQ(4, message.children(0).value());
+  EXPECT_FALSE(message.children(0).has_label());
+
+  TestFlatFlat copy;
+  copy.add_scores(99);
+  ASSERT_TRUE(copy.CopyFrom(message));
+  ExpectFlatFilled(copy);
+  EXPECT_TRUE(copy.has_int32_value());
+  EXPECT_FALSE(TestFlatFlat().has_int32_value());
+
+  TestFlat unset;
+  ASSERT_TRUE(copy.CopyFrom(unset));
+  EXPECT_FALSE(copy.has_name());
+  EXPECT_EQ(0, copy.scores_size());
+  copy.CopyTo(&message);
+  EXPECT_EQ(0, message.ByteSizeLong());
+}
+
+TEST(FlatMessageTest, CopyIsReadableFromAnotherBuffer) {
+  TestFlatFlat flat;
+  FillFlat(&flat);
+
+  // Stands in for another mapping of the shared memory chunk.
+  typename std::aligned_storage<sizeof(TestFlatFlat),
+                                alignof(TestFlatFlat)>::type buffer;
+  memcpy(&buffer, &flat, sizeof(flat));
+  flat.Clear();
+  ExpectFlatFilled(*reinterpret_cast<const TestFlatFlat*>(&buffer));
+}
+
+TEST(FlatMessageTest, CopyFromFailsIfAFieldExceedsItsBound) {
+  TestFlatFlat flat;
+  TestFlat message;
+  message.set_name(std::string(16, 'n'));
+  message.set_data(std::string(32, 'd'));
+  for (int i = 0; i < 4; ++i) message.add_scores(i);
+  message.add_tags(std::string(8, 't'));
+  message.add_tags(std::string(8, 't'));
+  message.mutable_nested()->set_label(std::string(8, 'l'));
+  message.add_children()->set_label(std::string(8, 'c'));
+  message.add_children();
+  EXPECT_TRUE(flat.CopyFrom(message));
+
+  {
+    TestFlat exceeding = message;
+    exceeding.set_name(std::string(17, 'n'));
+    EXPECT_FALSE(flat.CopyFrom(exceeding));
+  }
+  {
+    TestFlat exceeding = message;
+    exceeding.set_data(std::string(33, 'd'));
+    EXPECT_FALSE(flat.CopyFrom(exceeding));
+  }
+  {
+    TestFlat exceeding = message;
+    exceeding.add_scores(4);
+    EXPECT_FALSE(flat.CopyFrom(exceeding));
+  }
+  {
+    TestFlat exceeding = message;
+    exceeding.add_tags("t");
+    EXPECT_FALSE(flat.CopyFrom(exceeding));
+  }
+  {
+    TestFlat exceeding = message;
+    exceeding.set_tags(1, std::string(9, 't'));
+    EXPECT_FALSE(flat.CopyFrom(exceeding));
+  }
+  {
+    TestFlat exceeding = message;
+    exceeding.mutable_nested()->set_label(std::string(9, 'l'));
+    EXPECT_FALSE(flat.CopyFrom(exceeding));
+  }
+  {
+    TestFlat exceeding = message;
+    exceeding.add_children();
+    EXPECT_FALSE(flat.CopyFrom(exceeding));
+  }
+  {
+    TestFlat exceeding = message;
+    exceeding.mutable_children(1)->set_label(std::string(9, 'c'));
+    EXPECT_FALSE(flat.CopyFrom(exceeding));
+  }
+}
+
+#ifdef EXPECT_FATAL
+TEST(FlatMessageTest, SettersBeyondTheBoundsAreFatal) {
+  TestFlatFlat flat;
+  EXPECT_FATAL(flat.set_name(std::string(17, 'n')),
+               "exceeds the \\(iox.max_size\\) of 16");
+  EXPECT_FATAL(flat.add_tags("nine char"),
+               "exceeds the \\(iox.max_size\\) of 8");
+  EXPECT_FATAL(flat.mutable_nested()->set_label("nine char"),
+               "exceeds the \\(iox.max_size\\) of 8");
+
+  for (int i = 0; i < 4; ++i) flat.add_scores(i);
+  EXPECT_FATAL(flat.add_scores(4), "exceeds its \\(iox.max_count\\) of 4");
+  flat.add_children();
+  flat.add_children();
+  EXPECT_FATAL(flat.add_children(), "exceeds its \\(iox.max_count\\) of 2");
+}
+#endif  // EXPECT_FATAL
+
+}  // namespace
+}  // namespace protobuf
+}  // namespace google
+
+#undef EXPECT_FATAL
+
+#include <google/protobuf/port_undef.inc>
@@ -1606,9 +1606,9 @@ std::string Reflection::GetString(const Message& message,
           return GetField<InlinedStringField>(message, field).GetNoArena();
         }
 
-        if (auto* value =
-                GetField<ArenaStringPtr>(message, field).GetPointer()) {
-          return *value;
+        const auto& str = GetField<ArenaStringPtr>(message, field);
+        if (str.GetPointer() != nullptr) {
+          return str.GetChar();
         }
         return field->default_value_string();
       }
@@ -1619,7 +1619,6 @@ std::string Reflection::GetString(const Message& message,
 const std::string& Reflection::GetStringReference(const Message& message,
                                                   const FieldDescriptor* field,
                                                   std::string* scratch) const {
-  (void)scratch;  // Parameter is used by Google-internal code.
   USAGE_CHECK_ALL(GetStringReference, SINGULAR, STRING);
   if (field->is_extension()) {
     return GetExtensionSet(message).GetString(field->number(),
@@ -1635,9 +1634,19 @@ const std::string& Reflection::GetStringReference(const Message& message,
           return GetField<InlinedStringField>(message, field).GetNoArena();
         }
 
-        if (auto* value =
-                GetField<ArenaStringPtr>(message, field).GetPointer()) {
-          return *value;
+        const auto& str = GetField<ArenaStringPtr>(message, field);
+        if (auto* value = str.GetPointer()) {
+          // A value set with SetReferenced() is not held by the std::string.
+          StringPiece view = str.GetView();
+          if (view.size() == value->size()) {
+            return *value;
+          }
+          GOOGLE_DCHECK(scratch != nullptr)
+              << "GetStringReference() needs a scratch string for the "
+                 "referenced value of "
+              << field->full_name();
+          scratch->assign(view.data(), view.size());
+          return *scratch;
         }
         return field->default_value_string();
       }
@@ -2511,7 +2520,7 @@ bool Reflection::HasBit(const Message& message,
                           .empty();
             }
 
-            return GetField<ArenaStringPtr>(message, field).Get().size() > 0;
+            return !GetField<ArenaStringPtr>(message, field).GetView().empty();
           }
         }
         return false;
@@ -135,9 +135,12 @@ TEST(GeneratedMessageReflectionTest, GetStringReference) {
   const Reflection* reflection = message.GetReflection();
   std::string scratch;
 
+  // The getter of a singular string field returns a copy, so the underlying
+  // string is identified by the data of its view.
   EXPECT_EQ(
-      &message.optional_string(),
-      &reflection->GetStringReference(message, F("optional_string"), &scratch))
+      message.optional_string_view().data(),
+      reflection->GetStringReference(message, F("optional_string"), &scratch)
+          .data())
       << "For simple string fields, GetStringReference() should return a "
          "reference to the underlying string.";
   EXPECT_EQ(&message.repeated_string(0),
@@ -50,6 +50,7 @@
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/stubs/once.h>
 #include <google/protobuf/port.h>
+#include <google/protobuf/relocation.h>
 #include <google/protobuf/stubs/strutil.h>
 
 
@@ -442,6 +443,13 @@ class PROTOBUF_EXPORT MessageLite {
   // messages, etc), or owning incoming objects (e.g., set allocated).
   Arena* GetArenaForAllocation() const { return _internal_metadata_.arena(); }
 
+  // Distance between the address this message is accessed at and the address
+  // it was constructed at. Generated accessors apply it to the sub-message
+  // pointers they hold; see relocation.h.
+  std::ptrdiff_t GetRelocationOffset() const {
+    return internal::RelocationOffset(this, orin_this_);
+  }
+
   internal::InternalMetadata _internal_metadata_;
   MessageLite* orin_this_;
 
@@ -0,0 +1,82 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Helpers for messages that are built on an Arena whose blocks live in shared
+// memory. Such a message can be mapped at a different virtual address in every
+// process that reads it, so the pointers stored inside of it (repeated field
+// reps, arena strings, sub-messages) are only valid in the process that built
+// the message.
+//
+// Every relocatable object remembers the address it was constructed at (its
+// "origin"). Since all blocks of one Arena are carved out of the same shared
+// memory segment, the distance between the origin and the address the object is
+// currently accessed at is the same for every pointer it holds. Readers apply
+// that distance to each stored pointer before dereferencing it. In the process
+// that built the message the distance is zero and the pointers are unchanged.
+
+#ifndef GOOGLE_PROTOBUF_RELOCATION_H__
+#define GOOGLE_PROTOBUF_RELOCATION_H__
+
+#include <cstddef>
+#include <cstdint>
+
+namespace google {
+namespace protobuf {
+namespace internal {
+
+// Version of the in-memory representation of messages built on a shared
+// memory Arena, i.e. of the relocation scheme, the arena strings and the
+// repeated fields of the generated code and of this runtime. protoc adds it to
+// the schema fingerprint and the runtime to the ABI hash of a message type, so
+// processes built against different representations never read each other's
+// messages in place. Bump it whenever the representation changes.
+constexpr int kArenaRepresentationVersion = 1;
+
+// Returns the distance between the address an object is accessed at and the
+// address it was constructed at.
+inline std::ptrdiff_t RelocationOffset(const void* self, const void* origin) {
+  return static_cast<std::ptrdiff_t>(reinterpret_cast<std::uintptr_t>(self) -
+                                     reinterpret_cast<std::uintptr_t>(origin));
+}
+
+// Translates a pointer stored by the constructing process into the address
+// space of the current process. A null pointer stays null.
+template <typename T>
+inline T* Relocate(T* ptr, std::ptrdiff_t offset) {
+  if (ptr == nullptr) return nullptr;
+  return reinterpret_cast<T*>(reinterpret_cast<std::uintptr_t>(ptr) +
+                              static_cast<std::uintptr_t>(offset));
+}
+
+}  // namespace internal
+}  // namespace protobuf
+}  // namespace google
+
+#endif  // GOOGLE_PROTOBUF_RELOCATION_H__
@@ -65,6 +65,7 @@
 #include <google/protobuf/arena.h>
 #include <google/protobuf/message_lite.h>
 #include <google/protobuf/port.h>
+#include <google/protobuf/relocation.h>
 
 
 // Must be included last.
@@ -218,9 +219,15 @@ class RepeatedField final {
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Assign(Iter begin, Iter end);
 
   // Reserve space to expand the field to at least the given size.  If the
-  // array is grown, it will always be at least doubled in size.
+  // array is grown, it will always be at least doubled in size, unless it is
+  // the last allocation on its arena and only the requested size fits there.
   void Reserve(int new_size);
 
+  // Like Reserve(), but grows the array to exactly the given size.  Use it
+  // when the final size is known before a loop of Add() calls, so that an
+  // array on an arena does not take more of the arena than it needs.
+  void ReserveExact(int new_size);
+
   // Resize the RepeatedField to a new, smaller size.  This is O(1).
   void Truncate(int new_size);
 
@@ -347,6 +354,8 @@ class RepeatedField final {
   // the arena pointer without an extra allocation in the constructor.
   void* arena_or_elements_;
 
+  // Address this field was constructed at. arena_or_elements_ is only valid at
+  // that address; see relocation.h.
   RepeatedField* ori_this_;
   // Return pointer to elements array.
   // pre-condition: the array must have been allocated.
@@ -360,11 +369,8 @@ class RepeatedField final {
   // a invalid pointer is returned. This only happens for empty repeated fields,
   // where you can't dereference this pointer anyway (it's empty).
   Element* unsafe_elements() const {
-    if (this != ori_this_) {
-      int64_t offset = reinterpret_cast<uint64_t>(this) - reinterpret_cast<uint64_t>(ori_this_);
-      return reinterpret_cast<Element*>(reinterpret_cast<uint64_t>(arena_or_elements_) + offset);
-    }
-    return static_cast<Element*>(arena_or_elements_);
+    return static_cast<Element*>(internal::Relocate(
+        arena_or_elements_, internal::RelocationOffset(this, ori_this_)));
   }
 
   // Return pointer to the Rep struct.
@@ -385,6 +391,12 @@ class RepeatedField final {
   // Copy the elements of |from| into |to|.
   void CopyArray(Element* to, const Element* from, int size);
 
+  // Grows the array to new_size elements.  If the Rep is the last allocation
+  // on its arena it is extended in place, to min_size elements if new_size
+  // does not fit into the current block; otherwise a new Rep of new_size
+  // elements is allocated and the elements are moved.
+  void InternalReserve(int new_size, int min_size);
+
   // Internal helper to delete all elements and deallocate the storage.
   void InternalDeallocate(Rep* rep, int size) {
     if (rep != nullptr) {
@@ -906,19 +918,59 @@ inline int CalculateReserveSize(int total_size, int new_size) {
 }
 }  // namespace internal
 
-// Avoid inlining of Reserve(): new, copy, and delete[] lead to a significant
-// amount of code bloat.
 template <typename Element>
 void RepeatedField<Element>::Reserve(int new_size) {
   if (total_size_ >= new_size) return;
+  InternalReserve(internal::CalculateReserveSize(total_size_, new_size),
+                  new_size);
+}
+
+template <typename Element>
+void RepeatedField<Element>::ReserveExact(int new_size) {
+  if (total_size_ >= new_size) return;
+  // Maintain invariant:
+  //     total_size_ == 0 ||
+  //     total_size_ >= internal::kMinRepeatedFieldAllocationSize
+  new_size = std::max(internal::kRepeatedFieldLowerClampLimit, new_size);
+  InternalReserve(new_size, new_size);
+}
+
+// Avoid inlining of InternalReserve(): new, copy, and delete[] lead to a
+// significant amount of code bloat.
+template <typename Element>
+void RepeatedField<Element>::InternalReserve(int new_size, int min_size) {
   Rep* old_rep = total_size_ > 0 ? rep() : nullptr;
   Rep* new_rep;
   Arena* arena = GetArena();
-  new_size = internal::CalculateReserveSize(total_size_, new_size);
   GOOGLE_DCHECK_LE(
       static_cast<size_t>(new_size),
       (std::numeric_limits<size_t>::max() - kRepHeaderSize) / sizeof(Element))
       << "Requested size is too large to fit into size_t.";
+  if (old_rep != nullptr && arena != nullptr) {
+    // Grow the last allocation of the arena in place: the elements stay where
+    // they are and no part of the arena is abandoned.
+    const size_t old_bytes =
+        kRepHeaderSize + sizeof(Element) * static_cast<size_t>(total_size_);
+    int size = new_size;
+    bool extended = arena->MaybeExtendArray(
+        old_rep, old_bytes,
+        kRepHeaderSize + sizeof(Element) * static_cast<size_t>(size));
+    if (!extended && min_size < new_size) {
+      size = min_size;
+      extended = arena->MaybeExtendArray(
+          old_rep, old_bytes,
+          kRepHeaderSize + sizeof(Element) * static_cast<size_t>(size));
+    }
+    if (extended) {
+      Element* e = &old_rep->elements[total_size_];
+      Element* limit = &old_rep->elements[size];
+      for (; e < limit; e++) {
+        new (e) Element;
+      }
+      total_size_ = size;
+      return;
+    }
+  }
   size_t bytes =
       kRepHeaderSize + sizeof(Element) * static_cast<size_t>(new_size);
   if (arena == nullptr) {
@@ -262,6 +262,49 @@ TEST(RepeatedField, ReserveLessThanExisting) {
   EXPECT_LE(20, ReservedSpace(&field));
 }
 
+TEST(RepeatedField, ReserveGrowsTheLastArenaAllocationInPlace) {
+  std::vector<char> arena_block(4096);
+  ArenaOptions options;
+  options.initial_block = arena_block.data();
+  options.initial_block_size = arena_block.size();
+  Arena arena(options);
+  RepeatedField<int>* field = Arena::CreateMessage<RepeatedField<int>>(&arena);
+  field->Reserve(20);
+  for (int i = 0; i < 20; i++) field->Add(i);
+  const int* previous_ptr = field->data();
+  const int previous_capacity = field->Capacity();
+  const uint64_t previous_space_used = arena.SpaceUsed();
+
+  field->Reserve(100);
+
+  // The array keeps its place and only the added elements take space.
+  EXPECT_EQ(previous_ptr, field->data());
+  EXPECT_LE(100, field->Capacity());
+  EXPECT_EQ(previous_space_used +
+                (field->Capacity() - previous_capacity) * sizeof(int),
+            arena.SpaceUsed());
+  for (int i = 0; i < 20; i++) EXPECT_EQ(i, field->Get(i));
+}
+
+TEST(RepeatedField, ReserveMovesTheArrayIfItIsNotTheLastArenaAllocation) {
+  std::vector<char> arena_block(4096);
+  ArenaOptions options;
+  options.initial_block = arena_block.data();
+  options.initial_block_size = arena_block.size();
+  Arena arena(options);
+  RepeatedField<int>* field = Arena::CreateMessage<RepeatedField<int>>(&arena);
+  field->Reserve(20);
+  for (int i = 0; i < 20; i++) field->Add(i);
+  const int* previous_ptr = field->data();
+  Arena::CreateArray<char>(&arena, 8);
+
+  field->Reserve(100);
+
+  EXPECT_NE(previous_ptr, field->data());
+  EXPECT_LE(100, field->Capacity());
+  for (int i = 0; i < 20; i++) EXPECT_EQ(i, field->Get(i));
+}
+
 TEST(RepeatedField, Resize) {
   RepeatedField<int> field;
   field.Resize(2, 1);
@@ -1112,6 +1155,48 @@ TEST(RepeatedPtrField, ReserveDoesntLoseAllocated) {
   EXPECT_EQ(first, field.Add());
 }
 
+TEST(RepeatedPtrField, ReserveGrowsTheLastArenaAllocationInPlace) {
+  std::vector<char> arena_block(4096);
+  ArenaOptions options;
+  options.initial_block = arena_block.data();
+  options.initial_block_size = arena_block.size();
+  Arena arena(options);
+  RepeatedPtrField<std::string>* field =
+      Arena::CreateMessage<RepeatedPtrField<std::string>>(&arena);
+  field->Reserve(20);
+  const std::string* const* previous_ptr = field->data();
+
+  field->ReserveExact(100);
+
+  EXPECT_EQ(previous_ptr, field->data());
+  EXPECT_EQ(100, field->Capacity());
+  field->Add()->assign("foo");
+  EXPECT_EQ(previous_ptr, field->data());
+  EXPECT_EQ("foo", field->Get(0));
+}
+
+TEST(RepeatedPtrField, ReserveMovesTheArrayIfItIsNotTheLastArenaAllocation) {
+  std::vector<char> arena_block(4096);
+  ArenaOptions options;
+  options.initial_block = arena_block.data();
+  options.initial_block_size = arena_block.size();
+  Arena arena(options);
+  RepeatedPtrField<std::string>* field =
+      Arena::CreateMessage<RepeatedPtrField<std::string>>(&arena);
+  field->Reserve(20);
+  // The element is allocated behind the array.
+  std::string* first = field->Add();
+  first->assign("foo");
+  const std::string* const* previous_ptr = field->data();
+
+  field->Reserve(100);
+
+  EXPECT_NE(previous_ptr, field->data());
+  EXPECT_LE(100, field->Capacity());
+  EXPECT_EQ(first, &field->Get(0));
+  EXPECT_EQ("foo", field->Get(0));
+}
+
 // Clearing elements is tricky with RepeatedPtrFields since the memory for
 // the elements is retained and reused.
 TEST(RepeatedPtrField, ClearedElements) {
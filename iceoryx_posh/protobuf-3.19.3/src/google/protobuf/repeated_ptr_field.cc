@@ -47,7 +47,7 @@ namespace protobuf {
 
 namespace internal {
 
-void** RepeatedPtrFieldBase::InternalExtend(int extend_amount) {
+void** RepeatedPtrFieldBase::InternalExtend(int extend_amount, bool exact) {
   int new_size = current_size_ + extend_amount;
   if (total_size_ >= new_size) {
     // N.B.: rep_ is non-nullptr because extend_amount is always > 0, hence
@@ -56,13 +56,28 @@ void** RepeatedPtrFieldBase::InternalExtend(int extend_amount) {
   }
   Rep* old_rep = rep_;
   Arena* arena = GetArena();
-  new_size = std::max(internal::kRepeatedFieldLowerClampLimit,
-                      std::max(total_size_ * 2, new_size));
+  const int min_size = std::max(internal::kRepeatedFieldLowerClampLimit,
+                                new_size);
+  new_size = exact ? min_size : std::max(total_size_ * 2, min_size);
   GOOGLE_CHECK_LE(static_cast<int64_t>(new_size),
            static_cast<int64_t>(
                (std::numeric_limits<size_t>::max() - kRepHeaderSize) /
                sizeof(old_rep->elements[0])))
       << "Requested size is too large to fit into size_t.";
+  if (old_rep != nullptr && arena != nullptr) {
+    // Grow the last allocation of the arena in place, to the requested size
+    // if the doubled one does not fit into the current block.
+    const size_t old_bytes =
+        kRepHeaderSize + sizeof(old_rep->elements[0]) * total_size_;
+    for (int size : {new_size, min_size}) {
+      if (arena->MaybeExtendArray(
+              old_rep, old_bytes,
+              kRepHeaderSize + sizeof(old_rep->elements[0]) * size)) {
+        total_size_ = size;
+        return &rep_->elements[current_size_];
+      }
+    }
+  }
   size_t bytes = kRepHeaderSize + sizeof(old_rep->elements[0]) * new_size;
   if (arena == nullptr) {
     rep_ = reinterpret_cast<Rep*>(::operator new(bytes));
@@ -98,6 +113,12 @@ void RepeatedPtrFieldBase::Reserve(int new_size) {
   }
 }
 
+void RepeatedPtrFieldBase::ReserveExact(int new_size) {
+  if (new_size > current_size_) {
+    InternalExtend(new_size - current_size_, true);
+  }
+}
+
 void RepeatedPtrFieldBase::DestroyProtos() {
   GOOGLE_DCHECK(rep_);
   GOOGLE_DCHECK(arena_ == nullptr);
@@ -64,6 +64,7 @@
 #include <google/protobuf/arena.h>
 #include <google/protobuf/message_lite.h>
 #include <google/protobuf/port.h>
+#include <google/protobuf/relocation.h>
 
 
 // Must be included last.
@@ -234,6 +235,7 @@ class PROTOBUF_EXPORT RepeatedPtrFieldBase {
   void CloseGap(int start, int num);
 
   void Reserve(int new_size);
+  void ReserveExact(int new_size);
 
   int Capacity() const;
 
@@ -315,8 +317,10 @@ class PROTOBUF_EXPORT RepeatedPtrFieldBase {
   PROTOBUF_NOINLINE void SwapFallback(RepeatedPtrFieldBase* other);
 
   inline Arena* GetArena() const { return arena_; }
+  // Distance between the address this field is accessed at and the address it
+  // was constructed at; see relocation.h.
   inline int64_t GetOffset() const {
-    return reinterpret_cast<uint64_t>(this) - reinterpret_cast<uint64_t>(ori_this_);
+    return internal::RelocationOffset(this, ori_this_);
   }
 
  private:
@@ -344,18 +348,17 @@ class PROTOBUF_EXPORT RepeatedPtrFieldBase {
   };
   static constexpr size_t kRepHeaderSize = offsetof(Rep, elements);
   Rep* rep_;
+  // Address this field was constructed at. Both rep_ and the element pointers
+  // in it are only valid at that address and have to be relocated by
+  // GetOffset() before use.
   RepeatedPtrFieldBase* ori_this_;
-  void** element() const {
-  // if (this != ori_this_) {
-    if (arena_ != nullptr) {
-      int64_t offset = reinterpret_cast<uint64_t>(this) - reinterpret_cast<uint64_t>(ori_this_);
-      return reinterpret_cast<Rep*>((char*)rep_+offset)->elements;
-    }
-    return rep_->elements;
+  Rep* relocated_rep() const { return internal::Relocate(rep_, GetOffset()); }
+  void** element() const { return relocated_rep()->elements; }
+  template <typename TypeHandler>
+  typename TypeHandler::Type* relocated_element(int index) const {
+    return cast<TypeHandler>(
+        internal::Relocate(relocated_rep()->elements[index], GetOffset()));
   }
-  // int64_t GetOffset() const {
-  //   return reinterpret_cast<uint64_t>(this) - reinterpret_cast<uint64_t>(ori_this_);
-  // }
 
   template <typename TypeHandler>
   static inline typename TypeHandler::Type* cast(void* element) {
@@ -382,7 +385,8 @@ class PROTOBUF_EXPORT RepeatedPtrFieldBase {
   // more elements, and return a pointer to the element immediately following
   // the old list of elements.  This interface factors out common behavior from
   // Reserve() and MergeFrom() to reduce code size. |extend_amount| must be > 0.
-  void** InternalExtend(int extend_amount);
+  // Unless |exact| is set the array is at least doubled when it is grown.
+  void** InternalExtend(int extend_amount, bool exact = false);
 
   // Internal helper for Add: add "obj" as the next element in the
   // array, including potentially resizing the array with Reserve if
@@ -583,9 +587,13 @@ class RepeatedPtrField final : private internal::RepeatedPtrFieldBase {
 
   // Reserve space to expand the field to at least the given size.  This only
   // resizes the pointer array; it doesn't allocate any objects.  If the
-  // array is grown, it will always be at least doubled in size.
+  // array is grown, it will always be at least doubled in size, unless it is
+  // the last allocation on its arena and only the requested size fits there.
   void Reserve(int new_size);
 
+  // Like Reserve(), but grows the pointer array to exactly the given size.
+  void ReserveExact(int new_size);
+
   int Capacity() const;
 
   // Gets the underlying array.  This pointer is possibly invalidated by
@@ -869,13 +877,7 @@ inline const typename TypeHandler::Type& RepeatedPtrFieldBase::Get(
     int index) const {
   GOOGLE_DCHECK_GE(index, 0);
   GOOGLE_DCHECK_LT(index, current_size_);
-// if (this != ori_this_) {
-    if (arena_ != nullptr) {
-    //std::cout<<__func__<<":"<<__LINE__<<std::endl;
-    int64_t offset = reinterpret_cast<uint64_t>(this) - reinterpret_cast<uint64_t>(ori_this_);
-    return *cast<TypeHandler>(reinterpret_cast<char*>(reinterpret_cast<Rep*>((char*)rep_+offset)->elements[index])+offset);
-  }
-  return *cast<TypeHandler>(rep_->elements[index]);
+  return *relocated_element<TypeHandler>(index);
 }
 
 template <typename TypeHandler>
@@ -883,39 +885,21 @@ inline const typename TypeHandler::Type& RepeatedPtrFieldBase::at(
     int index) const {
   GOOGLE_CHECK_GE(index, 0);
   GOOGLE_CHECK_LT(index, current_size_);
-// if (this != ori_this_) {
-    if (arena_ != nullptr) {
-    //std::cout<<__func__<<":"<<__LINE__<<std::endl;
-    int64_t offset = reinterpret_cast<uint64_t>(this) - reinterpret_cast<uint64_t>(ori_this_);
-    return *cast<TypeHandler>(reinterpret_cast<char*>(reinterpret_cast<Rep*>((char*)rep_+offset)->elements[index])+offset);
-  }
-  return *cast<TypeHandler>(rep_->elements[index]);
+  return *relocated_element<TypeHandler>(index);
 }
 
 template <typename TypeHandler>
 inline typename TypeHandler::Type& RepeatedPtrFieldBase::at(int index) {
   GOOGLE_CHECK_GE(index, 0);
   GOOGLE_CHECK_LT(index, current_size_);
-// if (this != ori_this_) {
-    if (arena_ != nullptr) {
-    //std::cout<<__func__<<":"<<__LINE__<<std::endl;
-    int64_t offset = reinterpret_cast<uint64_t>(this) - reinterpret_cast<uint64_t>(ori_this_);
-    return *cast<TypeHandler>(reinterpret_cast<char*>(reinterpret_cast<Rep*>((char*)rep_+offset)->elements[index])+offset);
-  }
-  return *cast<TypeHandler>(rep_->elements[index]);
+  return *relocated_element<TypeHandler>(index);
 }
 
 template <typename TypeHandler>
 inline typename TypeHandler::Type* RepeatedPtrFieldBase::Mutable(int index) {
   GOOGLE_DCHECK_GE(index, 0);
   GOOGLE_DCHECK_LT(index, current_size_);
-// if (this != ori_this_) {
-    if (arena_ != nullptr) {
-    //std::cout<<__func__<<":"<<__LINE__<<std::endl;
-    int64_t offset = reinterpret_cast<uint64_t>(this) - reinterpret_cast<uint64_t>(ori_this_);
-    return cast<TypeHandler>(reinterpret_cast<char*>(reinterpret_cast<Rep*>((char*)rep_+offset)->elements[index])+offset);
-  }
-  return cast<TypeHandler>(rep_->elements[index]);
+  return relocated_element<TypeHandler>(index);
 }
 
 template <typename TypeHandler>
@@ -1012,7 +996,8 @@ void RepeatedPtrFieldBase::MergeFromInnerLoop(void** our_elems,
   if (already_allocated < length) {
     Arena* arena = GetArena();
     typename TypeHandler::Type* elem_prototype =
-        reinterpret_cast<typename TypeHandler::Type*>((char*)other_elems[0]+offset);
+        reinterpret_cast<typename TypeHandler::Type*>(
+            internal::Relocate(other_elems[0], offset));
     for (int i = already_allocated; i < length; i++) {
       // Allocate a new empty element that we'll merge into below
       typename TypeHandler::Type* new_elem =
@@ -1024,7 +1009,8 @@ void RepeatedPtrFieldBase::MergeFromInnerLoop(void** our_elems,
   for (int i = 0; i < length; i++) {
     // Already allocated: use existing element.
     typename TypeHandler::Type* other_elem =
-        reinterpret_cast<typename TypeHandler::Type*>((char*)other_elems[i]+offset);
+        reinterpret_cast<typename TypeHandler::Type*>(
+            internal::Relocate(other_elems[i], offset));
     typename TypeHandler::Type* new_elem =
         reinterpret_cast<typename TypeHandler::Type*>(our_elems[i]);
     TypeHandler::Merge(*other_elem, new_elem);
@@ -1041,19 +1027,11 @@ inline void RepeatedPtrFieldBase::CopyFrom(const RepeatedPtrFieldBase& other) {
 inline int RepeatedPtrFieldBase::Capacity() const { return total_size_; }
 
 inline void* const* RepeatedPtrFieldBase::raw_data() const {
-  if (arena_ != nullptr) {
-    int64_t offset = reinterpret_cast<uint64_t>(this) - reinterpret_cast<uint64_t>(ori_this_);
-    return reinterpret_cast<Rep*>((char*)rep_+offset)->elements;
-  }
-  return rep_ ? rep_->elements : nullptr;
+  return rep_ ? relocated_rep()->elements : nullptr;
 }
 
 inline void** RepeatedPtrFieldBase::raw_mutable_data() const {
-  if (arena_ != nullptr) {
-    int64_t offset = reinterpret_cast<uint64_t>(this) - reinterpret_cast<uint64_t>(ori_this_);
-    return const_cast<void**>(reinterpret_cast<Rep*>((char*)rep_+offset)->elements);
-  }
-  return rep_ ? const_cast<void**>(rep_->elements) : nullptr;
+  return rep_ ? const_cast<void**>(relocated_rep()->elements) : nullptr;
 }
 
 template <typename TypeHandler>
@@ -1639,6 +1617,11 @@ inline void RepeatedPtrField<Element>::Reserve(int new_size) {
   return RepeatedPtrFieldBase::Reserve(new_size);
 }
 
+template <typename Element>
+inline void RepeatedPtrField<Element>::ReserveExact(int new_size) {
+  return RepeatedPtrFieldBase::ReserveExact(new_size);
+}
+
 template <typename Element>
 inline int RepeatedPtrField<Element>::Capacity() const {
   return RepeatedPtrFieldBase::Capacity();
@@ -1684,8 +1667,9 @@ class RepeatedPtrIterator {
     }
   }
   // dereferenceable
-  // reference operator*() const { return *reinterpret_cast<Element*>(*it_); }
-  reference operator*() const { return *reinterpret_cast<Element*>(reinterpret_cast<char*>(*it_) + offset_); }
+  reference operator*() const {
+    return *reinterpret_cast<Element*>(internal::Relocate(*it_, offset_));
+  }
   pointer operator->() const { return &(operator*()); }
 
   // {inc,dec}rementable
@@ -34,6 +34,7 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/io/zero_copy_stream.h>
 #include <google/protobuf/stubs/once.h>
+#include <google/protobuf/wire_format.h>
 #include <google/protobuf/util/internal/default_value_objectwriter.h>
 #include <google/protobuf/util/internal/error_listener.h>
 #include <google/protobuf/util/internal/json_objectwriter.h>
@@ -243,14 +244,25 @@ TypeResolver* GetGeneratedTypeResolver() {
 
 util::Status MessageToJsonString(const Message& message, std::string* output,
                                  const JsonOptions& options) {
+  io::StringOutputStream output_stream(output);
+  return MessageToJsonStream(message, &output_stream, options);
+}
+
+util::Status MessageToJsonStream(const Message& message,
+                                 io::ZeroCopyOutputStream* json_output,
+                                 const JsonPrintOptions& options) {
   const DescriptorPool* pool = message.GetDescriptor()->file()->pool();
   TypeResolver* resolver =
       pool == DescriptorPool::generated_pool()
           ? GetGeneratedTypeResolver()
           : NewTypeResolverForDescriptorPool(kTypeUrlPrefix, pool);
-  util::Status result =
-      BinaryToJsonString(resolver, GetTypeUrl(message),
-                         message.SerializeAsString(), output, options);
+  // SerializeAsString() would store the cached sizes in the message.
+  std::string binary;
+  ::google::protobuf::internal::WireFormat::SerializeWithoutCachedSizes(
+      message, &binary);
+  io::ArrayInputStream input_stream(binary.data(), binary.size());
+  util::Status result = BinaryToJsonStream(resolver, GetTypeUrl(message),
+                                           &input_stream, json_output, options);
   if (pool != DescriptorPool::generated_pool()) {
     delete resolver;
   }
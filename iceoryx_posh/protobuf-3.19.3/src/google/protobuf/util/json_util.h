@@ -102,6 +102,22 @@ inline util::Status MessageToJsonString(const Message& message,
   return MessageToJsonString(message, output, JsonOptions());
 }
 
+// Converts from protobuf message to JSON and writes it to |json_output| while
+// it is rendered, e.g. to an io::FileOutputStream to write it straight to a
+// file descriptor. The message is serialized into a temporary buffer first,
+// which is then converted. Like MessageToJsonString(), this only reads the
+// message through const reflection and neither touches its arena nor its
+// cached sizes. The reflection calls virtual functions of the message, so it
+// must have been created by this process.
+PROTOBUF_EXPORT util::Status MessageToJsonStream(
+    const Message& message, io::ZeroCopyOutputStream* json_output,
+    const JsonPrintOptions& options);
+
+inline util::Status MessageToJsonStream(const Message& message,
+                                        io::ZeroCopyOutputStream* json_output) {
+  return MessageToJsonStream(message, json_output, JsonPrintOptions());
+}
+
 // Converts from JSON to protobuf message. This is a simple wrapper of
 // JsonStringToBinary(). It will use the DescriptorPool of the passed-in
 // message to resolve Any types.
@@ -377,6 +377,58 @@ TEST_F(JsonUtilTest, TestDynamicMessage) {
   EXPECT_EQ(ToJson(generated, options), ToJson(*message, options));
 }
 
+TEST_F(JsonUtilTest, TestPrintToStreamDoesNotTouchCachedSizes) {
+  TestMessage m;
+  m.set_int32_value(1024);
+  m.mutable_message_value()->set_value(2048);
+  m.add_repeated_message_value()->set_value(1);
+  m.add_repeated_message_value()->set_value(2);
+  JsonPrintOptions options;
+
+  std::string json;
+  {
+    io::StringOutputStream output_stream(&json);
+    ASSERT_TRUE(MessageToJsonStream(m, &output_stream, options).ok());
+  }
+  EXPECT_EQ(0, m.GetCachedSize());
+  EXPECT_EQ(0, m.message_value().GetCachedSize());
+  EXPECT_EQ(0, m.repeated_message_value(1).GetCachedSize());
+
+  // The same as converting the regular serialization.
+  std::unique_ptr<TypeResolver> resolver(NewTypeResolverForDescriptorPool(
+      "type.googleapis.com", DescriptorPool::generated_pool()));
+  std::string expected;
+  ASSERT_TRUE(BinaryToJsonString(resolver.get(),
+                                 "type.googleapis.com/" +
+                                     m.GetDescriptor()->full_name(),
+                                 m.SerializeAsString(), &expected, options)
+                  .ok());
+  EXPECT_EQ(expected, json);
+}
+
+TEST_F(JsonUtilTest, TestPrintMapToStream) {
+  TestMap m;
+  (*m.mutable_string_map())["hello"] = 1234;
+  (*m.mutable_int32_map())[1] = 2;
+
+  std::string json;
+  {
+    io::StringOutputStream output_stream(&json);
+    ASSERT_TRUE(MessageToJsonStream(m, &output_stream).ok());
+  }
+  EXPECT_EQ(0, m.GetCachedSize());
+
+  std::unique_ptr<TypeResolver> resolver(NewTypeResolverForDescriptorPool(
+      "type.googleapis.com", DescriptorPool::generated_pool()));
+  std::string expected;
+  ASSERT_TRUE(BinaryToJsonString(resolver.get(),
+                                 "type.googleapis.com/" +
+                                     m.GetDescriptor()->full_name(),
+                                 m.SerializeAsString(), &expected)
+                  .ok());
+  EXPECT_EQ(expected, json);
+}
+
 TEST_F(JsonUtilTest, TestParsingUnknownAnyFields) {
   std::string input =
       "{\n"
@@ -1442,6 +1442,142 @@ uint8_t* WireFormat::InternalSerializeMessageSetItem(
   return target;
 }
 
+namespace {
+
+// Helpers of WireFormat::SerializeWithoutCachedSizes() which write an
+// embedded message that was serialized beforehand.
+void WriteSerializedMessage(int field_number, FieldDescriptor::Type type,
+                            const std::string& serialized,
+                            io::CodedOutputStream* output) {
+  if (type == FieldDescriptor::TYPE_GROUP) {
+    WireFormatLite::WriteTag(field_number, WireFormatLite::WIRETYPE_START_GROUP,
+                             output);
+    output->WriteString(serialized);
+    WireFormatLite::WriteTag(field_number, WireFormatLite::WIRETYPE_END_GROUP,
+                             output);
+  } else {
+    WireFormatLite::WriteTag(field_number,
+                             WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(static_cast<uint32_t>(serialized.size()));
+    output->WriteString(serialized);
+  }
+}
+
+}  // namespace
+
+void WireFormat::SerializeFieldWithoutCachedSizes(
+    const FieldDescriptor* field, const Message& message,
+    io::CodedOutputStream* output) {
+  const Reflection* message_reflection = message.GetReflection();
+  std::string serialized;
+
+  if (field->is_extension() &&
+      field->containing_type()->options().message_set_wire_format() &&
+      field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE &&
+      !field->is_repeated()) {
+    SerializeWithoutCachedSizes(
+        message_reflection->GetMessage(message, field), &serialized);
+    WireFormatLite::WriteTag(WireFormatLite::kMessageSetItemNumber,
+                             WireFormatLite::WIRETYPE_START_GROUP, output);
+    WireFormatLite::WriteUInt32(WireFormatLite::kMessageSetTypeIdNumber,
+                                field->number(), output);
+    WriteSerializedMessage(WireFormatLite::kMessageSetMessageNumber,
+                           FieldDescriptor::TYPE_MESSAGE, serialized, output);
+    WireFormatLite::WriteTag(WireFormatLite::kMessageSetItemNumber,
+                             WireFormatLite::WIRETYPE_END_GROUP, output);
+    return;
+  }
+
+  // Map reflection does not touch the map, while repeated field reflection
+  // would sync the repeated field with the map; see InternalSerializeField().
+  if (field->is_map() &&
+      message_reflection->GetMapData(message, field)->IsMapValid()) {
+    const FieldDescriptor* key_field = field->message_type()->field(0);
+    const FieldDescriptor* value_field = field->message_type()->field(1);
+    for (MapIterator it = message_reflection->MapBegin(
+             const_cast<Message*>(&message), field);
+         it != message_reflection->MapEnd(const_cast<Message*>(&message), field);
+         ++it) {
+      if (value_field->cpp_type() != FieldDescriptor::CPPTYPE_MESSAGE) {
+        output->SetCur(InternalSerializeMapEntry(
+            field, it.GetKey(), it.GetValueRef(), output->Cur(),
+            output->EpsCopy()));
+        continue;
+      }
+      serialized.clear();
+      SerializeWithoutCachedSizes(it.GetValueRef().GetMessageValue(),
+                                  &serialized);
+      size_t size = kMapEntryTagByteSize;
+      size += MapKeyDataOnlyByteSize(key_field, it.GetKey());
+      size += io::CodedOutputStream::VarintSize32(
+                  static_cast<uint32_t>(serialized.size())) +
+              serialized.size();
+      WireFormatLite::WriteTag(field->number(),
+                               WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+                               output);
+      output->WriteVarint32(static_cast<uint32_t>(size));
+      output->SetCur(SerializeMapKeyWithCachedSizes(
+          key_field, it.GetKey(), output->Cur(), output->EpsCopy()));
+      WriteSerializedMessage(2, FieldDescriptor::TYPE_MESSAGE, serialized,
+                             output);
+    }
+    return;
+  }
+
+  if (field->cpp_type() != FieldDescriptor::CPPTYPE_MESSAGE) {
+    output->SetCur(
+        InternalSerializeField(field, message, output->Cur(), output->EpsCopy()));
+    return;
+  }
+
+  int count = 0;
+  if (field->is_repeated()) {
+    count = message_reflection->FieldSize(message, field);
+  } else if (field->containing_type()->options().map_entry() ||
+             message_reflection->HasField(message, field)) {
+    count = 1;
+  }
+  for (int j = 0; j < count; j++) {
+    serialized.clear();
+    SerializeWithoutCachedSizes(
+        field->is_repeated()
+            ? message_reflection->GetRepeatedMessage(message, field, j)
+            : message_reflection->GetMessage(message, field),
+        &serialized);
+    WriteSerializedMessage(field->number(), field->type(), serialized, output);
+  }
+}
+
+void WireFormat::SerializeWithoutCachedSizes(const Message& message,
+                                             std::string* output) {
+  const Descriptor* descriptor = message.GetDescriptor();
+  const Reflection* message_reflection = message.GetReflection();
+
+  std::vector<const FieldDescriptor*> fields;
+  if (descriptor->options().map_entry()) {
+    for (int i = 0; i < descriptor->field_count(); i++) {
+      fields.push_back(descriptor->field(i));
+    }
+  } else {
+    message_reflection->ListFields(message, &fields);
+  }
+
+  io::StringOutputStream output_stream(output);
+  io::CodedOutputStream coded_output(&output_stream);
+  for (auto field : fields) {
+    SerializeFieldWithoutCachedSizes(field, message, &coded_output);
+  }
+  if (descriptor->options().message_set_wire_format()) {
+    coded_output.SetCur(InternalSerializeUnknownMessageSetItemsToArray(
+        message_reflection->GetUnknownFields(message), coded_output.Cur(),
+        coded_output.EpsCopy()));
+  } else {
+    coded_output.SetCur(InternalSerializeUnknownFieldsToArray(
+        message_reflection->GetUnknownFields(message), coded_output.Cur(),
+        coded_output.EpsCopy()));
+  }
+}
+
 // ===================================================================
 
 size_t WireFormat::ByteSize(const Message& message) {
@@ -135,6 +135,16 @@ class PROTOBUF_EXPORT WireFormat {
   static uint8_t* _InternalSerialize(const Message& message, uint8_t* target,
                                      io::EpsCopyOutputStream* stream);
 
+  // Appends the message in protocol buffer wire format to |output| without
+  // reading or updating the cached sizes of the message or its embedded
+  // messages; instead, every embedded message is serialized into a buffer
+  // first. The message is only accessed through const reflection, so it may be
+  // mapped read-only and is not synchronized with other readers. Reflection
+  // calls virtual functions of the message, so it must have been created by
+  // this process. Slower than regular serialization.
+  static void SerializeWithoutCachedSizes(const Message& message,
+                                          std::string* output);
+
   // Implements Message::ByteSize() via reflection.  WARNING:  The result
   // of this method is *not* cached anywhere.  However, all embedded messages
   // will have their ByteSize() methods called, so their sizes will be cached.
@@ -284,6 +294,12 @@ class PROTOBUF_EXPORT WireFormat {
                                          Operation op, const char* field_name);
 
  private:
+  // Appends the field of the message to |output|, see
+  // SerializeWithoutCachedSizes().
+  static void SerializeFieldWithoutCachedSizes(const FieldDescriptor* field,
+                                               const Message& message,
+                                               io::CodedOutputStream* output);
+
   struct MessageSetParser;
   // Skip a MessageSet field.
   static bool SkipMessageSetField(io::CodedInputStream* input,
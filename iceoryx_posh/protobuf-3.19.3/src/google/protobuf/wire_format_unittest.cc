@@ -34,6 +34,7 @@
 
 #include <google/protobuf/wire_format.h>
 
+#include <google/protobuf/map_unittest.pb.h>
 #include <google/protobuf/unittest.pb.h>
 #include <google/protobuf/unittest_mset.pb.h>
 #include <google/protobuf/unittest_mset_wire_format.pb.h>
@@ -0,0 +1,64 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: iox/options.proto
+
+#include "iox/options.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+namespace iox {
+}  // namespace iox
+static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_iox_2foptions_2eproto = nullptr;
+static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_iox_2foptions_2eproto = nullptr;
+const uint32_t TableStruct_iox_2foptions_2eproto::offsets[1] = {};
+static constexpr ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema* schemas = nullptr;
+static constexpr ::PROTOBUF_NAMESPACE_ID::Message* const* file_default_instances = nullptr;
+
+const char descriptor_table_protodef_iox_2foptions_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\021iox/options.proto\022\003iox\032 google/protobu"
+  "f/descriptor.proto:1\n\010max_size\022\035.google."
+  "protobuf.FieldOptions\030\331\252\004 \001(\r:2\n\tmax_cou"
+  "nt\022\035.google.protobuf.FieldOptions\030\332\252\004 \001("
+  "\rB\003\370\001\001"
+  ;
+static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_iox_2foptions_2eproto_deps[1] = {
+  &::descriptor_table_google_2fprotobuf_2fdescriptor_2eproto,
+};
+static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_iox_2foptions_2eproto_once;
+const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_iox_2foptions_2eproto = {
+  false, false, 166, descriptor_table_protodef_iox_2foptions_2eproto, "iox/options.proto", 
+  &descriptor_table_iox_2foptions_2eproto_once, descriptor_table_iox_2foptions_2eproto_deps, 1, 0,
+  schemas, file_default_instances, TableStruct_iox_2foptions_2eproto::offsets,
+  nullptr, file_level_enum_descriptors_iox_2foptions_2eproto, file_level_service_descriptors_iox_2foptions_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable* descriptor_table_iox_2foptions_2eproto_getter() {
+  return &descriptor_table_iox_2foptions_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY static ::PROTOBUF_NAMESPACE_ID::internal::AddDescriptorsRunner dynamic_init_dummy_iox_2foptions_2eproto(&descriptor_table_iox_2foptions_2eproto);
+namespace iox {
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< uint32_t >, 13, false >
+  max_size(kMaxSizeFieldNumber, 0u);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< uint32_t >, 13, false >
+  max_count(kMaxCountFieldNumber, 0u);
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace iox
+PROTOBUF_NAMESPACE_OPEN
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
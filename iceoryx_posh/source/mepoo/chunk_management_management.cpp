@@ -17,13 +17,13 @@
 
 #include "iceoryx_posh/internal/mepoo/chunk_management_management.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 
 namespace iox
 {
 namespace mepoo
 {
-ChunkManagementManagement::ChunkManagementManagement(
-                                 const not_null<MemPool*> chunkManagementPool) noexcept
+ChunkManagementManagement::ChunkManagementManagement(const not_null<MemPool*> chunkManagementPool) noexcept
     : m_chunkManagementPool(chunkManagementPool)
 {
     static_assert(alignof(ChunkManagementManagement) <= mepoo::MemPool::CHUNK_MEMORY_ALIGNMENT,
@@ -31,20 +31,89 @@ ChunkManagementManagement::ChunkManagementManagement(
                   "'MemPool::CHUNK_MEMORY_ALIGNMENT'!");
 }
 
-bool ChunkManagementManagement::addChunkManagement(
-                             const not_null<ChunkManagement*> chunkManagement) noexcept
+void ChunkManagementManagement::addChunkManagement(const not_null<ChunkManagement*> chunkManagement) noexcept
 {
-    if (m_chunkManagements.full())
+    ChunkManagement* const newChunkManagement = chunkManagement;
+    newChunkManagement->m_nextChunkManagement = nullptr;
+
+    if (m_lastChunkManagement)
+    {
+        m_lastChunkManagement->m_nextChunkManagement = newChunkManagement;
+    }
+    else
+    {
+        m_firstChunkManagement = newChunkManagement;
+    }
+    m_lastChunkManagement = newChunkManagement;
+    ++m_numberOfChunks;
+}
+
+ChunkManagement* ChunkManagementManagement::front() const noexcept
+{
+    return m_firstChunkManagement.get();
+}
+
+uint64_t ChunkManagementManagement::size() const noexcept
+{
+    return m_numberOfChunks;
+}
+
+bool ChunkManagementManagement::empty() const noexcept
+{
+    return m_numberOfChunks == 0U;
+}
+
+void ChunkManagementManagement::releaseChunks() noexcept
+{
+    ChunkManagement* current = m_firstChunkManagement.get();
+    m_firstChunkManagement = nullptr;
+    m_lastChunkManagement = nullptr;
+    m_numberOfChunks = 0U;
+
+    // the whole chain is owned by this object, therefore the chunks are freed directly without touching the
+    // reference counter of every single chunk
+    while (current != nullptr)
     {
-        m_chunkManagements.clear();
-        return false;
+        ChunkManagement* next = current->m_nextChunkManagement.get();
+        MemoryManager::freeChunk(*current);
+        current = next;
     }
+}
 
-    m_chunkManagements.insert(iox::RelativePointer<ChunkManagement>(chunkManagement));
+void ChunkManagementManagement::releaseChunksAfter(ChunkManagement& lastKeptChunkManagement) noexcept
+{
+    ChunkManagement* current = lastKeptChunkManagement.m_nextChunkManagement.get();
+    lastKeptChunkManagement.m_nextChunkManagement = nullptr;
+    m_lastChunkManagement = &lastKeptChunkManagement;
 
-    return true;
+    while (current != nullptr)
+    {
+        ChunkManagement* next = current->m_nextChunkManagement.get();
+        MemoryManager::freeChunk(*current);
+        --m_numberOfChunks;
+        current = next;
+    }
 }
 
+ChunkManagement* ChunkManagementManagement::releaseAllButFirstChunk() noexcept
+{
+    ChunkManagement* first = m_firstChunkManagement.get();
+    if (first == nullptr)
+    {
+        return nullptr;
+    }
+
+    m_firstChunkManagement = first->m_nextChunkManagement.get();
+    if (!m_firstChunkManagement)
+    {
+        m_lastChunkManagement = nullptr;
+    }
+    --m_numberOfChunks;
+    releaseChunks();
+
+    first->m_nextChunkManagement = nullptr;
+    return first;
+}
 
 } // namespace mepoo
 } // namespace iox
@@ -216,8 +216,13 @@ expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkS
 
 ChunkManagementManagement* MemoryManager::getMultiChunk() noexcept
 {
-    return new (m_chunkManagementManagementPool.front().getChunk())
-            ChunkManagementManagement(&m_chunkManagementManagementPool.front());
+    auto chunk = m_chunkManagementManagementPool.front().getChunk();
+    if (chunk == nullptr)
+    {
+        IOX_LOG(Error, "MemoryManager: unable to acquire a chunk for the management of a multi-chunk sample");
+        return nullptr;
+    }
+    return new (chunk) ChunkManagementManagement(&m_chunkManagementManagementPool.front());
 }
 
 void MemoryManager::freeChunk(ChunkManagement& chunkManagement) noexcept
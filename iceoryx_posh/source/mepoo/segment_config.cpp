@@ -21,6 +21,8 @@ namespace iox
 {
 namespace mepoo
 {
+constexpr uint64_t SegmentConfig::NO_FIXED_BASE_ADDRESS;
+
 SegmentConfig& SegmentConfig::setDefaults() noexcept
 {
     m_sharedMemorySegments.clear();
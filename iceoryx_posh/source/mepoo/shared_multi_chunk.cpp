@@ -56,13 +56,7 @@ void SharedMultiChunk::decrementReferenceCounter() noexcept
     if ((m_chunkManagementManagement != nullptr)
         && (m_chunkManagementManagement->m_referenceCounter.fetch_sub(1U, std::memory_order_relaxed) == 1U))
     {
-        auto iter = m_chunkManagementManagement->m_chunkManagements.begin();
-        while (iter != m_chunkManagementManagement->m_chunkManagements.end())
-        {
-            MemoryManager::freeChunk(*(iter->get()));
-            iter++;
-        }
-
+        m_chunkManagementManagement->releaseChunks();
         m_chunkManagementManagement->m_chunkManagementPool->freeChunk(m_chunkManagementManagement);
         m_chunkManagementManagement = nullptr;
     }
@@ -92,16 +86,8 @@ SharedMultiChunk& SharedMultiChunk::operator=(SharedMultiChunk&& rhs) noexcept
 
 void* SharedMultiChunk::getUserPayload() const noexcept
 {
-    if (m_chunkManagementManagement == nullptr || 
-        m_chunkManagementManagement->m_chunkManagements.size() == 0)
-    {
-        return nullptr;
-    }
-    else
-    {
-        RelativePointer<ChunkManagement>& ChunkManagement = *m_chunkManagementManagement->m_chunkManagements.begin();
-        return ChunkManagement->m_chunkHeader->userPayload();
-    }
+    auto chunkHeader = getChunkHeader();
+    return chunkHeader == nullptr ? nullptr : chunkHeader->userPayload();
 }
 
 bool SharedMultiChunk::operator==(const SharedMultiChunk& rhs) const noexcept
@@ -131,35 +117,17 @@ SharedMultiChunk::operator bool() const noexcept
 
 ChunkHeader* SharedMultiChunk::getChunkHeader() const noexcept
 {
-    if (m_chunkManagementManagement == nullptr ||
-        m_chunkManagementManagement->m_chunkManagements.size() == 0)
+    if (m_chunkManagementManagement == nullptr || m_chunkManagementManagement->empty())
     {
         return nullptr;
     }
-    else
-    {
-        RelativePointer<ChunkManagement>& ChunkManagement = *m_chunkManagementManagement->m_chunkManagements.begin();
-        return ChunkManagement->m_chunkHeader.get();
-    }
+
+    return m_chunkManagementManagement->front()->m_chunkHeader.get();
 }
 
-std::vector<ChunkHeader*> SharedMultiChunk::getChunkHeaders() const noexcept
+ChunkHeaderView SharedMultiChunk::getChunkHeaders() const noexcept
 {
-    if (m_chunkManagementManagement == nullptr ||
-        m_chunkManagementManagement->m_chunkManagements.size() == 0)
-    {
-        return {nullptr};
-    }
-
-    std::vector<ChunkHeader*> chunkHeaders;
-    auto iter = m_chunkManagementManagement->m_chunkManagements.begin();
-    while (iter != m_chunkManagementManagement->m_chunkManagements.end())
-    {
-        chunkHeaders.push_back((*iter)->m_chunkHeader.get());
-        iter++;
-    }
-
-    return chunkHeaders;
+    return ChunkHeaderView(m_chunkManagementManagement);
 }
 
 ChunkManagementManagement* SharedMultiChunk::release() noexcept
@@ -171,18 +139,17 @@ ChunkManagementManagement* SharedMultiChunk::release() noexcept
 
 ChunkManagement* SharedMultiChunk::getFirstChunkManagement() noexcept
 {
-    if (m_chunkManagementManagement == nullptr ||
-        m_chunkManagementManagement->m_chunkManagements.size() == 0)
+    if (m_chunkManagementManagement == nullptr)
     {
         return nullptr;
     }
 
-    return (m_chunkManagementManagement->m_chunkManagements.begin())->get();
+    return m_chunkManagementManagement->front();
 }
 
-bool SharedMultiChunk::addChunkManagement(const not_null<ChunkManagement*> chunkManagement) noexcept
+void SharedMultiChunk::addChunkManagement(const not_null<ChunkManagement*> chunkManagement) noexcept
 {
-    return m_chunkManagementManagement->addChunkManagement(chunkManagement);
+    m_chunkManagementManagement->addChunkManagement(chunkManagement);
 }
 
 } // namespace mepoo
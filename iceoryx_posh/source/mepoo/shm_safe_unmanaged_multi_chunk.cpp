@@ -96,41 +96,6 @@ SharedMultiChunk ShmSafeUnmanagedMultiChunk::cloneToSharedChunk() noexcept
     return SharedMultiChunk(chunkMgmtMgmt.get());
 }
 
-SharedChunk ShmSafeUnmanagedMultiChunk::cloneFirstToSharedChunk() noexcept
-{
-    if (m_chunkManagementManagement.isLogicalNullptr())
-    {
-        return SharedChunk();
-    }
-
-    auto chunkMgmtMgmt =
-        RelativePointer<mepoo::ChunkManagementManagement>(m_chunkManagementManagement.offset(), 
-                                                         segment_id_t{m_chunkManagementManagement.id()});
-    if (chunkMgmtMgmt->m_chunkManagements.size() == 0)
-    {
-        return SharedChunk();
-    }
-
-#if (defined(__GNUC__) && __GNUC__ == 13 && !defined(__clang__))
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wstringop-overflow"
-#endif
-    chunkMgmtMgmt->m_referenceCounter.fetch_add(1U, std::memory_order_relaxed);
-#if (defined(__GNUC__) && __GNUC__ == 13 && !defined(__clang__))
-#pragma GCC diagnostic pop
-#endif
-
-    auto begin = chunkMgmtMgmt->m_chunkManagements.begin();
-    auto iter = ++begin;
-    if (iter != chunkMgmtMgmt->m_chunkManagements.end())
-    {
-        SharedChunk chunk(iter->get());
-        iter = chunkMgmtMgmt->m_chunkManagements.erase(iter);
-    }
-
-    return SharedChunk(begin->get());
-}
-
 SharedChunk ShmSafeUnmanagedMultiChunk::releaseFirstToSharedChunk() noexcept
 {
     if (m_chunkManagementManagement.isLogicalNullptr())
@@ -140,21 +105,14 @@ SharedChunk ShmSafeUnmanagedMultiChunk::releaseFirstToSharedChunk() noexcept
     auto chunkMgmtMgmt =
         RelativePointer<mepoo::ChunkManagementManagement>(m_chunkManagementManagement.offset(), 
                                                          segment_id_t{m_chunkManagementManagement.id()});
-    
-    if (chunkMgmtMgmt->m_chunkManagements.size() == 0)
-    {
-        return SharedChunk();
-    }
 
-    auto begin = chunkMgmtMgmt->m_chunkManagements.begin();
-    auto iter = ++begin;
-    if (iter != chunkMgmtMgmt->m_chunkManagements.end())
+    auto firstChunkManagement = chunkMgmtMgmt->releaseAllButFirstChunk();
+    if (firstChunkManagement == nullptr)
     {
-        SharedChunk chunk(iter->get());
-        iter = chunkMgmtMgmt->m_chunkManagements.erase(iter);
+        return SharedChunk();
     }
 
-    return SharedChunk(begin->get());
+    return SharedChunk(firstChunkManagement);
 }
 
 bool ShmSafeUnmanagedMultiChunk::isLogicalNullptr() const noexcept
@@ -171,13 +129,12 @@ ChunkHeader* ShmSafeUnmanagedMultiChunk::getChunkHeader() noexcept
     auto chunkMgmtMgmt =
         RelativePointer<mepoo::ChunkManagementManagement>(m_chunkManagementManagement.offset(), 
                                                          segment_id_t{m_chunkManagementManagement.id()});
-    if (chunkMgmtMgmt->m_chunkManagements.size() == 0)
+    if (chunkMgmtMgmt->empty())
     {
         return nullptr;
     }
 
-    auto begin = chunkMgmtMgmt->m_chunkManagements.begin();
-    return (*begin)->m_chunkHeader.get();
+    return chunkMgmtMgmt->front()->m_chunkHeader.get();
 }
 
 ChunkManagementManagement* ShmSafeUnmanagedMultiChunk::getChunkManagementManagement() noexcept
@@ -190,38 +147,20 @@ ChunkManagementManagement* ShmSafeUnmanagedMultiChunk::getChunkManagementManagem
     auto chunkMgmtMgmt =
         RelativePointer<mepoo::ChunkManagementManagement>(m_chunkManagementManagement.offset(), 
                                                          segment_id_t{m_chunkManagementManagement.id()});
-    if (chunkMgmtMgmt->m_chunkManagements.size() == 0)
-    {
-        return nullptr;
-    }
-
     return chunkMgmtMgmt.get();
 }
 
-std::vector<ChunkHeader*> ShmSafeUnmanagedMultiChunk::getChunkHeaders() noexcept
+ChunkHeaderView ShmSafeUnmanagedMultiChunk::getChunkHeaders() const noexcept
 {
     if (m_chunkManagementManagement.isLogicalNullptr())
     {
-        return {nullptr};
+        return ChunkHeaderView();
     }
 
     auto chunkMgmtMgmt =
         RelativePointer<mepoo::ChunkManagementManagement>(m_chunkManagementManagement.offset(), 
                                                          segment_id_t{m_chunkManagementManagement.id()});
-    if (chunkMgmtMgmt->m_chunkManagements.size() == 0)
-    {
-        return {nullptr};
-    }
-
-    std::vector<ChunkHeader*> chunkHeaders;
-    auto iter = chunkMgmtMgmt->m_chunkManagements.begin();
-    while (iter != chunkMgmtMgmt->m_chunkManagements.end())
-    {
-        chunkHeaders.push_back((*iter)->m_chunkHeader.get());
-        iter++;
-    }
-    
-    return chunkHeaders;
+    return ChunkHeaderView(chunkMgmtMgmt.get());
 }
 
 const ChunkHeader* ShmSafeUnmanagedMultiChunk::getChunkHeader() const noexcept
@@ -252,7 +191,8 @@ bool ShmSafeUnmanagedMultiChunk::addChunkManagement(const not_null<ChunkManageme
     auto chunkMgmtMgmt =
         RelativePointer<mepoo::ChunkManagementManagement>(m_chunkManagementManagement.offset(), 
                                                          segment_id_t{m_chunkManagementManagement.id()});
-    return chunkMgmtMgmt->addChunkManagement(chunkManagement);
+    chunkMgmtMgmt->addChunkManagement(chunkManagement);
+    return true;
 }
 
 } // namespace mepoo
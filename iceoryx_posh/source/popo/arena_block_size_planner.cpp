@@ -0,0 +1,72 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/arena_block_size_planner.hpp"
+#include "iox/algorithm.hpp"
+#include "iox/memory.hpp"
+
+#include <algorithm>
+#include <functional>
+
+namespace iox
+{
+namespace popo
+{
+constexpr uint32_t ArenaBlockSizePlanner::HISTORY_CAPACITY;
+constexpr uint32_t ArenaBlockSizePlanner::NUMBER_OF_IGNORED_OUTLIERS;
+constexpr uint64_t ArenaBlockSizePlanner::ARENA_BOOKKEEPING_RESERVE;
+
+uint64_t ArenaBlockSizePlanner::firstBlockSize(const uint64_t requestedSize) const noexcept
+{
+    return algorithm::maxVal(requestedSize, m_plannedBlockSize);
+}
+
+void ArenaBlockSizePlanner::recordFootprint(const uint64_t footprint) noexcept
+{
+    m_history[m_nextHistoryIndex] = footprint;
+    m_nextHistoryIndex = (m_nextHistoryIndex + 1U) % HISTORY_CAPACITY;
+    if (m_historySize < HISTORY_CAPACITY)
+    {
+        ++m_historySize;
+    }
+
+    updatePlan();
+}
+
+uint64_t ArenaBlockSizePlanner::plannedBlockSize() const noexcept
+{
+    return m_plannedBlockSize;
+}
+
+void ArenaBlockSizePlanner::updatePlan() noexcept
+{
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    uint64_t sortedHistory[HISTORY_CAPACITY];
+    std::copy(&m_history[0], &m_history[m_historySize], &sortedHistory[0]);
+
+    // outliers are only identified with a full history, before that every footprint counts
+    const uint32_t quantileIndex = (m_historySize == HISTORY_CAPACITY) ? NUMBER_OF_IGNORED_OUTLIERS : 0U;
+    std::nth_element(
+        &sortedHistory[0], &sortedHistory[quantileIndex], &sortedHistory[m_historySize], std::greater<uint64_t>());
+    const uint64_t footprint = sortedHistory[quantileIndex];
+
+    // a small headroom absorbs the usual jitter of the footprint without falling back to a second block
+    constexpr uint64_t HEADROOM_DIVISOR{8U};
+    m_plannedBlockSize = align(footprint + footprint / HEADROOM_DIVISOR + ARENA_BOOKKEEPING_RESERVE, uint64_t{8U});
+}
+
+} // namespace popo
+} // namespace iox
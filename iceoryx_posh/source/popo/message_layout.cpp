@@ -0,0 +1,143 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/popo/message_layout.hpp"
+#include "iox/detail/pointer_repository.hpp"
+#include "iox/relative_pointer.hpp"
+
+namespace iox
+{
+namespace popo
+{
+uint64_t MessageLayout::addToAbiHash(const uint64_t abiHash, const uint64_t value) noexcept
+{
+    // FNV-1a over the bytes of the value
+    constexpr uint64_t FNV_PRIME{1099511628211U};
+    uint64_t hash{abiHash};
+    for (uint32_t i = 0U; i < sizeof(value); ++i)
+    {
+        hash ^= (value >> (8U * i)) & 0xFFU;
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+capro::ServiceDescription MessageLayout::withAbiHash(const capro::ServiceDescription& service,
+                                                     const uint64_t abiHash) noexcept
+{
+    constexpr uint64_t HALF_WIDTH{32U};
+    const auto classHash = service.getClassHash();
+
+    // the class hash the service was created with is kept as digest, so that services which differ in their class
+    // hash still do; a zero class hash stays zero
+    uint64_t classHashDigest{0U};
+    if (classHash != capro::ServiceDescription::ClassHash())
+    {
+        classHashDigest = ABI_HASH_SEED;
+        for (uint64_t i = 0U; i < capro::CLASS_HASH_ELEMENT_COUNT; ++i)
+        {
+            classHashDigest = addToAbiHash(classHashDigest, classHash[i]);
+        }
+        classHashDigest ^= classHashDigest >> HALF_WIDTH;
+    }
+
+    capro::ServiceDescription serviceWithAbiHash(service.getServiceIDString(),
+                                                 service.getInstanceIDString(),
+                                                 service.getEventIDString(),
+                                                 {static_cast<uint32_t>(abiHash),
+                                                  static_cast<uint32_t>(abiHash >> HALF_WIDTH),
+                                                  static_cast<uint32_t>(classHashDigest),
+                                                  ABI_HASH_MARKER},
+                                                 service.getSourceInterface());
+    if (service.isLocal())
+    {
+        serviceWithAbiHash.setLocal();
+    }
+    return serviceWithAbiHash;
+}
+
+uint64_t MessageLayout::abiHashOf(const capro::ServiceDescription& service) noexcept
+{
+    constexpr uint64_t HALF_WIDTH{32U};
+    const auto classHash = service.getClassHash();
+    if (classHash[3U] != ABI_HASH_MARKER)
+    {
+        return LAYOUT_INDEPENDENT;
+    }
+    return static_cast<uint64_t>(classHash[0U]) | (static_cast<uint64_t>(classHash[1U]) << HALF_WIDTH);
+}
+
+MessageLayout
+MessageLayout::create(const uint64_t abiHash, const void* const managementMemory, const bool isRelocatable) noexcept
+{
+    if (isRelocatable)
+    {
+        return MessageLayout{abiHash, RELOCATABLE};
+    }
+
+    const auto managementSegmentId = UntypedRelativePointer::searchId(const_cast<void*>(managementMemory));
+
+    // the segments are registered with the same ids in all processes, the ids of unregistered segments yield a
+    // nullptr and do not contribute to the key
+    uint64_t addressSpaceKey{ABI_HASH_SEED};
+    for (uint64_t id = 1U; id < MAX_POINTER_REPO_CAPACITY; ++id)
+    {
+        auto* basePtr = UntypedRelativePointer::getBasePtr(segment_id_t{id});
+        if (basePtr == nullptr || id == managementSegmentId)
+        {
+            continue;
+        }
+        addressSpaceKey = addToAbiHash(addressSpaceKey, id);
+        addressSpaceKey = addToAbiHash(addressSpaceKey, reinterpret_cast<uint64_t>(basePtr));
+    }
+
+    // the keys are reserved for consumers which read serialized copies only and for relocatable messages
+    if (addressSpaceKey == SERIALIZED_ONLY || addressSpaceKey == RELOCATABLE)
+    {
+        addressSpaceKey = ABI_HASH_SEED;
+    }
+
+    return MessageLayout{abiHash, addressSpaceKey};
+}
+
+MessageLayout MessageLayout::serializedOnly(const uint64_t abiHash) noexcept
+{
+    return MessageLayout{abiHash, SERIALIZED_ONLY};
+}
+
+bool MessageLayout::isLayoutDependent() const noexcept
+{
+    return m_abiHash != LAYOUT_INDEPENDENT;
+}
+
+bool MessageLayout::isReadableInPlaceBy(const MessageLayout& consumer) const noexcept
+{
+    return !isLayoutDependent() || !consumer.isLayoutDependent()
+           || (*this == consumer && consumer.m_addressSpaceKey != SERIALIZED_ONLY);
+}
+
+bool MessageLayout::operator==(const MessageLayout& rhs) const noexcept
+{
+    return m_abiHash == rhs.m_abiHash && m_addressSpaceKey == rhs.m_addressSpaceKey;
+}
+
+bool MessageLayout::operator!=(const MessageLayout& rhs) const noexcept
+{
+    return !(*this == rhs);
+}
+
+} // namespace popo
+} // namespace iox
@@ -42,25 +42,51 @@ ClientPortUser::MemberType_t* ClientPortUser::getMembers() noexcept
 expected<RequestHeader*, AllocationError> ClientPortUser::allocateRequest(const uint64_t userPayloadSize,
                                                                           const uint32_t userPayloadAlignment) noexcept
 {
-    auto allocateResult = m_chunkSender.tryAllocate(
-        getUniqueID(), userPayloadSize, userPayloadAlignment, sizeof(RequestHeader), alignof(RequestHeader));
+    return initializeRequestHeader(m_chunkSender.tryAllocateSingleChunk(getUniqueID(),
+                                                                        userPayloadSize,
+                                                                        userPayloadAlignment,
+                                                                        sizeof(ProtobufRequestHeader_t),
+                                                                        alignof(ProtobufRequestHeader_t)));
+}
 
+expected<RequestHeader*, AllocationError>
+ClientPortUser::allocateMultiChunkRequest(const uint64_t userPayloadSize, const uint32_t userPayloadAlignment) noexcept
+{
+    // every multi-chunk request starts a new sample; further chunks are only added with 'allocateRequestChunk'
+    m_chunkSender.resetChunkManagementManagement();
+    return initializeRequestHeader(m_chunkSender.tryAllocate(getUniqueID(),
+                                                             userPayloadSize,
+                                                             userPayloadAlignment,
+                                                             sizeof(ProtobufRequestHeader_t),
+                                                             alignof(ProtobufRequestHeader_t)));
+}
+
+expected<RequestHeader*, AllocationError> ClientPortUser::initializeRequestHeader(
+    const expected<mepoo::ChunkHeader*, AllocationError>& allocateResult) noexcept
+{
     if (allocateResult.has_error())
     {
         return err(allocateResult.error());
     }
 
-    auto* requestHeader = new (allocateResult.value()->userHeader())
-        RequestHeader(getMembers()->m_chunkReceiverData.m_uniqueId, RpcBaseHeader::UNKNOWN_CLIENT_QUEUE_INDEX);
+    auto* protobufRequestHeader = new (allocateResult.value()->userHeader()) ProtobufRequestHeader_t(
+        in_place, getMembers()->m_chunkReceiverData.m_uniqueId, RpcBaseHeader::UNKNOWN_CLIENT_QUEUE_INDEX);
 
-    return ok(requestHeader);
+    return ok(&protobufRequestHeader->m_userHeader);
+}
+
+expected<mepoo::ChunkHeader*, AllocationError>
+ClientPortUser::allocateRequestChunk(const uint64_t userPayloadSize, const uint32_t userPayloadAlignment) noexcept
+{
+    return m_chunkSender.tryAllocate(
+        getUniqueID(), userPayloadSize, userPayloadAlignment, CHUNK_NO_USER_HEADER_SIZE, CHUNK_NO_USER_HEADER_ALIGNMENT);
 }
 
 void ClientPortUser::releaseRequest(const RequestHeader* const requestHeader) noexcept
 {
     if (requestHeader != nullptr)
     {
-        //m_chunkSender.release(requestHeader->getChunkHeader());
+        m_chunkSender.release(requestHeader->getChunkHeader());
     }
     else
     {
@@ -85,12 +111,12 @@ expected<void, ClientSendError> ClientPortUser::sendRequest(RequestHeader* const
         return err(ClientSendError::NO_CONNECT_REQUESTED);
     }
 
-    /*auto numberOfReceiver = m_chunkSender.send(requestHeader->getChunkHeader());
+    auto numberOfReceiver = m_chunkSender.send(requestHeader->getChunkHeader());
     if (numberOfReceiver == 0U)
     {
         IOX_LOG(Warn, "Try to send request but server is not available!");
         return err(ClientSendError::SERVER_NOT_AVAILABLE);
-    }*/
+    }
 
     return ok();
 }
@@ -118,23 +144,22 @@ ConnectionState ClientPortUser::getConnectionState() const noexcept
 
 expected<const ResponseHeader*, ChunkReceiveResult> ClientPortUser::getResponse() noexcept
 {
-    /*auto getChunkResult = m_chunkReceiver.tryGet();
+    auto getChunkResult = m_chunkReceiver.tryGetChunkHeaders();
 
     if (getChunkResult.has_error())
     {
         return err(getChunkResult.error());
     }
 
-    return ok(static_cast<const ResponseHeader*>(getChunkResult.value()->userHeader()));*/
-
-    return ok(static_cast<const ResponseHeader*>(0));
+    // the ResponseHeader is in the user-header of the first chunk which identifies the whole response
+    return ok(static_cast<const ResponseHeader*>(getChunkResult.value().front()->userHeader()));
 }
 
 void ClientPortUser::releaseResponse(const ResponseHeader* const responseHeader) noexcept
 {
     if (responseHeader != nullptr)
     {
-        //m_chunkReceiver.release(responseHeader->getChunkHeader());
+        m_chunkReceiver.release(responseHeader->getChunkHeader());
     }
     else
     {
@@ -29,7 +29,11 @@ PublisherPortData::PublisherPortData(const capro::ServiceDescription& serviceDes
                                      const mepoo::MemoryInfo& memoryInfo) noexcept
     : BasePortData(serviceDescription, runtimeName, uniqueRouDiId)
     , m_chunkSenderData(
-          memoryManager, publisherOptions.subscriberTooSlowPolicy, publisherOptions.historyCapacity, memoryInfo)
+          memoryManager,
+          publisherOptions.subscriberTooSlowPolicy,
+          publisherOptions.historyCapacity,
+          memoryInfo,
+          publisherOptions.recycleAllChunks)
     , m_options{publisherOptions}
     , m_offeringRequested(publisherOptions.offerOnCreate)
 {
@@ -48,25 +48,34 @@ PublisherPortUser::tryAllocateChunk(const uint64_t userPayloadSize,
         getUniqueID(), userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
 }
 
+expected<mepoo::ChunkHeader*, AllocationError>
+PublisherPortUser::tryAllocateSingleChunk(const uint64_t userPayloadSize,
+                                          const uint32_t userPayloadAlignment,
+                                          const uint32_t userHeaderSize,
+                                          const uint32_t userHeaderAlignment) noexcept
+{
+    return m_chunkSender.tryAllocateSingleChunk(
+        getUniqueID(), userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
+}
+
 mepoo::ChunkManagementManagement*
 PublisherPortUser::tryAllocateChunkManagementManagement() noexcept
 {
     return m_chunkSender.tryAllocateChunkManagementManagement();
 }
 
-void PublisherPortUser::releaseChunk(std::vector<mepoo::ChunkHeader*>& chunkHeaders) noexcept
+void PublisherPortUser::releaseChunk(mepoo::ChunkHeader* const chunkHeader) noexcept
 {
-    m_chunkSender.release(chunkHeaders);
+    m_chunkSender.release(chunkHeader);
 }
 
-void PublisherPortUser::sendChunk(std::vector<mepoo::ChunkHeader*>& chunkHeaders) noexcept
+void PublisherPortUser::sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcept
 {
     const auto offerRequested = getMembers()->m_offeringRequested.load(std::memory_order_relaxed);
 
     if (offerRequested)
     {
-        m_chunkSender.send(chunkHeaders);
-        resetChunkManagementManagement();
+        m_chunkSender.send(chunkHeader);
     }
     else
     {
@@ -114,5 +123,52 @@ void PublisherPortUser::resetChunkManagementManagement() noexcept
     m_chunkSender.resetChunkManagementManagement();
 }
 
+expected<ChunkSenderLoanContext, AllocationError> PublisherPortUser::tryAcquireLoanContext() noexcept
+{
+    return m_chunkSender.tryAcquireLoanContext();
+}
+
+void PublisherPortUser::releaseLoanContext(ChunkSenderLoanContext& loanContext) noexcept
+{
+    m_chunkSender.releaseLoanContext(loanContext);
+}
+
+expected<mepoo::ChunkHeader*, AllocationError>
+PublisherPortUser::tryAllocateChunk(ChunkSenderLoanContext& loanContext,
+                                    const uint64_t userPayloadSize,
+                                    const uint32_t userPayloadAlignment,
+                                    const uint32_t userHeaderSize,
+                                    const uint32_t userHeaderAlignment) noexcept
+{
+    return m_chunkSender.tryAllocate(
+        loanContext, getUniqueID(), userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
+}
+
+void PublisherPortUser::releaseChunk(ChunkSenderLoanContext& loanContext) noexcept
+{
+    m_chunkSender.release(loanContext);
+}
+
+void PublisherPortUser::setMessageLayout(const uint64_t abiHash,
+                                         const bool isRelocatable,
+                                         const ChunkSerializer& serializer) noexcept
+{
+    m_chunkSender.setMessageLayout(MessageLayout::create(abiHash, getMembers(), isRelocatable), serializer);
+}
+
+void PublisherPortUser::sendChunk(ChunkSenderLoanContext& loanContext) noexcept
+{
+    const auto offerRequested = getMembers()->m_offeringRequested.load(std::memory_order_relaxed);
+
+    if (offerRequested)
+    {
+        m_chunkSender.send(loanContext);
+    }
+    else
+    {
+        m_chunkSender.release(loanContext);
+    }
+}
+
 } // namespace popo
 } // namespace iox
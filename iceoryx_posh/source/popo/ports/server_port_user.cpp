@@ -41,7 +41,7 @@ ServerPortUser::MemberType_t* ServerPortUser::getMembers() noexcept
 
 expected<const RequestHeader*, ServerRequestResult> ServerPortUser::getRequest() noexcept
 {
-    /*auto getChunkResult = m_chunkReceiver.tryGet();
+    auto getChunkResult = m_chunkReceiver.tryGetChunkHeaders();
 
     if (getChunkResult.has_error())
     {
@@ -53,15 +53,15 @@ expected<const RequestHeader*, ServerRequestResult> ServerPortUser::getRequest()
         return err(into<ServerRequestResult>(getChunkResult.error()));
     }
 
-    return ok(static_cast<const RequestHeader*>(getChunkResult.value()->userHeader()));*/
-    return ok(static_cast<const RequestHeader*>(0));
+    // the RequestHeader is in the user-header of the first chunk which identifies the whole request
+    return ok(static_cast<const RequestHeader*>(getChunkResult.value().front()->userHeader()));
 }
 
 void ServerPortUser::releaseRequest(const RequestHeader* const requestHeader) noexcept
 {
     if (requestHeader != nullptr)
     {
-        //m_chunkReceiver.release(requestHeader->getChunkHeader());
+        m_chunkReceiver.release(requestHeader->getChunkHeader());
     }
     else
     {
@@ -95,27 +95,64 @@ ServerPortUser::allocateResponse(const RequestHeader* const requestHeader,
         return err(AllocationError::INVALID_PARAMETER_FOR_REQUEST_HEADER);
     }
 
-    auto allocateResult = m_chunkSender.tryAllocate(
-        getUniqueID(), userPayloadSize, userPayloadAlignment, sizeof(ResponseHeader), alignof(ResponseHeader));
+    return initializeResponseHeader(requestHeader,
+                                    m_chunkSender.tryAllocateSingleChunk(getUniqueID(),
+                                                                         userPayloadSize,
+                                                                         userPayloadAlignment,
+                                                                         sizeof(ProtobufResponseHeader_t),
+                                                                         alignof(ProtobufResponseHeader_t)));
+}
+
+expected<ResponseHeader*, AllocationError>
+ServerPortUser::allocateMultiChunkResponse(const RequestHeader* const requestHeader,
+                                           const uint64_t userPayloadSize,
+                                           const uint32_t userPayloadAlignment) noexcept
+{
+    if (requestHeader == nullptr)
+    {
+        return err(AllocationError::INVALID_PARAMETER_FOR_REQUEST_HEADER);
+    }
 
+    // every multi-chunk response starts a new sample; further chunks are only added with 'allocateResponseChunk'
+    m_chunkSender.resetChunkManagementManagement();
+    return initializeResponseHeader(requestHeader,
+                                    m_chunkSender.tryAllocate(getUniqueID(),
+                                                              userPayloadSize,
+                                                              userPayloadAlignment,
+                                                              sizeof(ProtobufResponseHeader_t),
+                                                              alignof(ProtobufResponseHeader_t)));
+}
+
+expected<ResponseHeader*, AllocationError>
+ServerPortUser::initializeResponseHeader(const RequestHeader* const requestHeader,
+                                         const expected<mepoo::ChunkHeader*, AllocationError>& allocateResult) noexcept
+{
     if (allocateResult.has_error())
     {
         return err(allocateResult.error());
     }
 
-    auto* responseHeader =
-        new (allocateResult.value()->userHeader()) ResponseHeader(requestHeader->m_uniqueClientQueueId,
-                                                                  requestHeader->m_lastKnownClientQueueIndex,
-                                                                  requestHeader->getSequenceId());
+    auto* protobufResponseHeader =
+        new (allocateResult.value()->userHeader()) ProtobufResponseHeader_t(in_place,
+                                                                            requestHeader->m_uniqueClientQueueId,
+                                                                            requestHeader->m_lastKnownClientQueueIndex,
+                                                                            requestHeader->getSequenceId());
 
-    return ok(responseHeader);
+    return ok(&protobufResponseHeader->m_userHeader);
+}
+
+expected<mepoo::ChunkHeader*, AllocationError>
+ServerPortUser::allocateResponseChunk(const uint64_t userPayloadSize, const uint32_t userPayloadAlignment) noexcept
+{
+    return m_chunkSender.tryAllocate(
+        getUniqueID(), userPayloadSize, userPayloadAlignment, CHUNK_NO_USER_HEADER_SIZE, CHUNK_NO_USER_HEADER_ALIGNMENT);
 }
 
 void ServerPortUser::releaseResponse(const ResponseHeader* const responseHeader) noexcept
 {
     if (responseHeader != nullptr)
     {
-        //m_chunkSender.release(responseHeader->getChunkHeader());
+        m_chunkSender.release(responseHeader->getChunkHeader());
     }
     else
     {
@@ -32,6 +32,12 @@ const SubscriberOptions& SubscriberPortRouDi::getOptions() const noexcept
     return getMembers()->m_options;
 }
 
+bool SubscriberPortRouDi::receivesSerializedCopies() const noexcept
+{
+    return getMembers()->m_chunkReceiverData.m_layoutAbiHash.load(std::memory_order_acquire)
+           != MessageLayout::LAYOUT_INDEPENDENT;
+}
+
 const SubscriberPortRouDi::MemberType_t* SubscriberPortRouDi::getMembers() const noexcept
 {
     return reinterpret_cast<const MemberType_t*>(BasePort::getMembers());
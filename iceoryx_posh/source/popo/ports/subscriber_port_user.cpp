@@ -63,14 +63,14 @@ SubscribeState SubscriberPortUser::getSubscriptionState() const noexcept
     return getMembers()->m_subscriptionState.load(std::memory_order_relaxed);
 }
 
-expected<std::vector<mepoo::ChunkHeader*>, ChunkReceiveResult> SubscriberPortUser::tryGetChunkHeaders() noexcept
+expected<mepoo::ChunkHeaderView, ChunkReceiveResult> SubscriberPortUser::tryGetChunkHeaders() noexcept
 {
     return m_chunkReceiver.tryGetChunkHeaders();
 }
 
-void SubscriberPortUser::releaseChunk(std::vector<mepoo::ChunkHeader*>& chunkHeaders) noexcept
+void SubscriberPortUser::releaseChunk(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
-    m_chunkReceiver.release(chunkHeaders);
+    m_chunkReceiver.release(chunkHeader);
 }
 
 void SubscriberPortUser::releaseQueuedChunks() noexcept
@@ -104,5 +104,15 @@ bool SubscriberPortUser::isConditionVariableSet() noexcept
     return m_chunkReceiver.isConditionVariableSet();
 }
 
+void SubscriberPortUser::setMessageLayout(const uint64_t abiHash, const bool isRelocatable) noexcept
+{
+    m_chunkReceiver.setMessageLayout(MessageLayout::create(abiHash, getMembers(), isRelocatable));
+}
+
+void SubscriberPortUser::setSerializedMessageLayout(const uint64_t abiHash) noexcept
+{
+    m_chunkReceiver.setMessageLayout(MessageLayout::serializedOnly(abiHash));
+}
+
 } // namespace popo
 } // namespace iox
@@ -18,6 +18,7 @@
 #include "iceoryx_posh/internal/roudi/port_manager.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iceoryx_posh/popo/message_layout.hpp"
 #include "iceoryx_posh/popo/publisher_options.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iox/assertions.hpp"
@@ -520,7 +521,36 @@ bool PortManager::isCompatiblePubSub(const PublisherPortRouDiType& publisher,
 
     const bool historyRequestIsCompatible = !subOpts.requiresPublisherHistorySupport || pubOpts.historyCapacity > 0;
 
-    return blockingPoliciesAreCompatible && historyRequestIsCompatible;
+    return blockingPoliciesAreCompatible && historyRequestIsCompatible && isCompatibleLayout(publisher, subscriber);
+}
+
+bool PortManager::isCompatibleLayout(const PublisherPortRouDiType& publisher,
+                                     const SubscriberPortType& subscriber) const noexcept
+{
+    const auto publisherAbiHash = popo::MessageLayout::abiHashOf(publisher.getCaProServiceDescription());
+    const auto subscriberAbiHash = popo::MessageLayout::abiHashOf(subscriber.getCaProServiceDescription());
+
+    if (publisherAbiHash == subscriberAbiHash)
+    {
+        return true;
+    }
+
+    // a publisher with an ABI hash serializes its messages for subscribers with another one; the connection is
+    // refused when the subscriber would read the messages in place anyway. A port without an ABI hash knows nothing
+    // about the layout: such a subscriber reads all messages in place and such a publisher has no serializer
+    const bool haveBothAbiHashes = publisherAbiHash != popo::MessageLayout::LAYOUT_INDEPENDENT
+                                   && subscriberAbiHash != popo::MessageLayout::LAYOUT_INDEPENDENT;
+    if (haveBothAbiHashes && subscriber.receivesSerializedCopies())
+    {
+        return true;
+    }
+
+    IOX_LOG(Warn,
+            "The layout of the messages of publisher '" << publisher.getRuntimeName() << "' and subscriber '"
+                                                        << subscriber.getRuntimeName() << "' for service '"
+                                                        << publisher.getCaProServiceDescription()
+                                                        << "' differs! They will not be connected.");
+    return false;
 }
 
 bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& message,
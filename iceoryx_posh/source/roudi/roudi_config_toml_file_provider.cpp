@@ -19,9 +19,12 @@
 #include "iceoryx_posh/roudi/roudi_config_toml_file_provider.hpp"
 #include "iceoryx_platform/getopt.hpp"
 #include "iceoryx_platform/platform_settings.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iox/detail/system_configuration.hpp"
 #include "iox/file_reader.hpp"
 #include "iox/into.hpp"
 #include "iox/logging.hpp"
+#include "iox/memory.hpp"
 #include "iox/posix_group.hpp"
 #include "iox/std_string_support.hpp"
 #include "iox/string.hpp"
@@ -143,10 +146,21 @@ TomlRouDiConfigFileProvider::parse(std::istream& stream) noexcept
 
     auto groupOfCurrentProcess = PosixGroup::getGroupOfCurrentProcess().getName();
     iox::IceoryxConfig parsedConfig;
+    uint64_t segmentIndex{0U};
     for (auto segment : *segments)
     {
         auto writer = segment->get_as<std::string>("writer").value_or(into<std::string>(groupOfCurrentProcess));
         auto reader = segment->get_as<std::string>("reader").value_or(into<std::string>(groupOfCurrentProcess));
+        auto fixedBaseAddress =
+            segment->get_as<uint64_t>("base-address").value_or(iox::mepoo::SegmentConfig::NO_FIXED_BASE_ADDRESS);
+        const auto pageSize = iox::detail::pageSize();
+        if (fixedBaseAddress % pageSize != 0U)
+        {
+            IOX_LOG(Error,
+                    "The 'base-address' " << iox::log::hex(fixedBaseAddress) << " of segment " << segmentIndex
+                                          << " is not a multiple of the page size of " << pageSize << " bytes");
+            return iox::err(iox::roudi::RouDiConfigFileParseError::BASE_ADDRESS_NOT_PAGE_ALIGNED);
+        }
         iox::mepoo::MePooConfig mempoolConfig;
         auto mempools = segment->get_table_array("mempool");
         if (!mempools)
@@ -173,10 +187,44 @@ TomlRouDiConfigFileProvider::parse(std::istream& stream) noexcept
             }
             mempoolConfig.addMemPool({*chunkSize, *chunkCount});
         }
+
+        if (fixedBaseAddress != iox::mepoo::SegmentConfig::NO_FIXED_BASE_ADDRESS)
+        {
+            // the segment is mapped with a size of whole pages; the ranges are checked here since an overlap would
+            // otherwise only be detected when RouDi fails to map the second segment
+            const auto segmentSize =
+                iox::align(iox::mepoo::MemoryManager::requiredChunkMemorySize(mempoolConfig), pageSize);
+            uint64_t otherSegmentIndex{0U};
+            for (const auto& otherSegment : parsedConfig.m_sharedMemorySegments)
+            {
+                const auto otherBaseAddress = otherSegment.m_fixedBaseAddress;
+                const auto otherSegmentSize =
+                    iox::align(iox::mepoo::MemoryManager::requiredChunkMemorySize(otherSegment.m_mempoolConfig),
+                               pageSize);
+                if (otherBaseAddress != iox::mepoo::SegmentConfig::NO_FIXED_BASE_ADDRESS
+                    && fixedBaseAddress < otherBaseAddress + otherSegmentSize
+                    && otherBaseAddress < fixedBaseAddress + segmentSize)
+                {
+                    IOX_LOG(Error,
+                            "The address range [" << iox::log::hex(fixedBaseAddress) << ", "
+                                                  << iox::log::hex(fixedBaseAddress + segmentSize) << ") of segment "
+                                                  << segmentIndex << " overlaps with the address range ["
+                                                  << iox::log::hex(otherBaseAddress) << ", "
+                                                  << iox::log::hex(otherBaseAddress + otherSegmentSize)
+                                                  << ") of segment " << otherSegmentIndex);
+                    return iox::err(iox::roudi::RouDiConfigFileParseError::BASE_ADDRESS_RANGES_OVERLAP);
+                }
+                ++otherSegmentIndex;
+            }
+        }
+
         parsedConfig.m_sharedMemorySegments.push_back(
             {PosixGroup::groupName_t(iox::TruncateToCapacity, reader.c_str(), reader.size()),
              PosixGroup::groupName_t(iox::TruncateToCapacity, writer.c_str(), writer.size()),
-             mempoolConfig});
+             mempoolConfig,
+             iox::mepoo::MemoryInfo(),
+             fixedBaseAddress});
+        ++segmentIndex;
     }
 
     return iox::ok(parsedConfig);
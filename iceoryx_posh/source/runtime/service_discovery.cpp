@@ -30,9 +30,10 @@ void ServiceDiscovery::update()
 {
     // allows us to use update and hence findService concurrently
     std::lock_guard<std::mutex> lock(m_serviceRegistryMutex);
-    m_serviceRegistrySubscriber.take().and_then([&](popo::Sample<const roudi::ServiceRegistry>& serviceRegistrySample) {
-        *m_serviceRegistry = *serviceRegistrySample;
-    });
+    m_serviceRegistrySubscriber.take().and_then(
+        [&](popo::ProtobufSample<const roudi::ServiceRegistry>& serviceRegistrySample) {
+            *m_serviceRegistry = *serviceRegistrySample;
+        });
 }
 
 void ServiceDiscovery::findService(const optional<capro::IdString_t>& service,
@@ -46,7 +46,8 @@ SharedMemoryUser::create(const DomainId domainId,
                                   ResourceType::ICEORYX_DEFINED,
                                   {roudi::SHM_NAME},
                                   managementShmSize,
-                                  AccessMode::ReadWrite);
+                                  AccessMode::ReadWrite,
+                                  mepoo::SegmentConfig::NO_FIXED_BASE_ADDRESS);
     if (shmOpen.has_error())
     {
         return err(shmOpen.error());
@@ -70,7 +71,8 @@ SharedMemoryUser::create(const DomainId domainId,
                                       ResourceType::USER_DEFINED,
                                       segment.m_sharedMemoryName,
                                       segment.m_size,
-                                      segment.m_isWritable ? AccessMode::ReadWrite : AccessMode::ReadOnly);
+                                      segment.m_isWritable ? AccessMode::ReadWrite : AccessMode::ReadOnly,
+                                      segment.m_fixedBaseAddress);
         if (shmOpen.has_error())
         {
             return err(shmOpen.error());
@@ -108,13 +110,21 @@ expected<void, SharedMemoryUserError> SharedMemoryUser::openShmSegment(ShmVector
                                                                        const ResourceType resourceType,
                                                                        const ShmName_t& shmName,
                                                                        const uint64_t shmSize,
-                                                                       const AccessMode accessMode) noexcept
+                                                                       const AccessMode accessMode,
+                                                                       const uint64_t fixedBaseAddress) noexcept
 {
+    optional<const void*> baseAddressHint;
+    if (fixedBaseAddress != mepoo::SegmentConfig::NO_FIXED_BASE_ADDRESS)
+    {
+        baseAddressHint = reinterpret_cast<const void*>(fixedBaseAddress);
+    }
+
     auto shmResult = PosixSharedMemoryObjectBuilder()
                          .name(concatenate(iceoryxResourcePrefix(domainId, resourceType), shmName))
                          .memorySizeInBytes(shmSize)
                          .accessMode(accessMode)
                          .openMode(OpenMode::OpenExisting)
+                         .baseAddressHint(baseAddressHint)
                          .create();
 
     if (shmResult.has_error())
@@ -123,6 +133,18 @@ expected<void, SharedMemoryUserError> SharedMemoryUser::openShmSegment(ShmVector
     }
 
     auto& shm = shmResult.value();
+
+    // the hint is not binding; when the range is already in use in this process the segment ends up somewhere else
+    // which is still fine for everything that is addressed via relative pointers, only absolute pointers into the
+    // payload, e.g. inside of arena-built protobuf messages, need to be relocated on access then
+    if (fixedBaseAddress != mepoo::SegmentConfig::NO_FIXED_BASE_ADDRESS
+        && reinterpret_cast<uint64_t>(shm.getBaseAddress()) != fixedBaseAddress)
+    {
+        IOX_LOG(Warn,
+                "Payload segment " << segmentId << " could not be mapped at its fixed base address "
+                                   << iox::log::hex(fixedBaseAddress) << " and was mapped at "
+                                   << iox::log::hex(shm.getBaseAddress()) << " instead");
+    }
     auto registeredSuccessfully = UntypedRelativePointer::registerPtrWithId(
         segment_id_t{segmentId}, shm.getBaseAddress(), shm.get_size().expect("Failed to acquire SHM size."));
 
@@ -0,0 +1,89 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "allocation_counter.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+std::atomic<bool> g_countAllocations{false};
+std::atomic<uint64_t> g_numberOfAllocations{0U};
+
+void* countedAllocation(const std::size_t size)
+{
+    if (g_countAllocations.load(std::memory_order_relaxed))
+    {
+        g_numberOfAllocations.fetch_add(1U, std::memory_order_relaxed);
+    }
+    void* memory = std::malloc(size == 0U ? 1U : size);
+    if (memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+} // namespace
+
+namespace iox
+{
+namespace testing
+{
+void AllocationCounter::start() noexcept
+{
+    g_numberOfAllocations.store(0U, std::memory_order_relaxed);
+    g_countAllocations.store(true, std::memory_order_relaxed);
+}
+
+uint64_t AllocationCounter::stop() noexcept
+{
+    g_countAllocations.store(false, std::memory_order_relaxed);
+    return g_numberOfAllocations.load(std::memory_order_relaxed);
+}
+} // namespace testing
+} // namespace iox
+
+void* operator new(std::size_t size)
+{
+    return countedAllocation(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return countedAllocation(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
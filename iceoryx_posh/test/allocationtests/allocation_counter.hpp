@@ -0,0 +1,43 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ALLOCATIONTESTS_ALLOCATION_COUNTER_HPP
+#define IOX_POSH_ALLOCATIONTESTS_ALLOCATION_COUNTER_HPP
+
+#include <cstdint>
+
+namespace iox
+{
+namespace testing
+{
+/// @brief Counts the heap allocations of the whole process while it is enabled. The global operator new and delete
+/// are replaced for this, hence the tests which use it are built into an executable of their own.
+class AllocationCounter
+{
+  public:
+    AllocationCounter() = delete;
+
+    /// @brief Resets the number of allocations and starts counting
+    static void start() noexcept;
+
+    /// @brief Stops counting
+    /// @return the number of allocations since 'start' was called
+    static uint64_t stop() noexcept;
+};
+} // namespace testing
+} // namespace iox
+
+#endif // IOX_POSH_ALLOCATIONTESTS_ALLOCATION_COUNTER_HPP
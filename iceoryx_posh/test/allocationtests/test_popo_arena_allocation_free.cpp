@@ -0,0 +1,232 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
+#include "iceoryx_posh/internal/popo/ports/publisher_port_roudi.hpp"
+#include "iceoryx_posh/internal/popo/ports/publisher_port_user.hpp"
+#include "iceoryx_posh/internal/popo/ports/subscriber_port_data.hpp"
+#include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
+#include "iceoryx_posh/internal/popo/publisher_impl.hpp"
+#include "iceoryx_posh/internal/popo/subscriber_impl.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iox/bump_allocator.hpp"
+
+#include "allocation_counter.hpp"
+#include "test.hpp"
+
+#include <memory>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::capro;
+using namespace iox::popo;
+
+struct DummyMessage
+{
+    uint64_t data{0U};
+};
+
+/// @brief Stands in for the BasePublisher and BaseSubscriber to run the publisher and subscriber implementations
+/// directly on ports which are connected like RouDi would connect them
+template <typename PortT>
+class PortOwner
+{
+  public:
+    using PortType = PortT;
+
+    explicit PortOwner(PortT&& port) noexcept
+        : m_port(std::move(port))
+    {
+    }
+
+    PortT& port() noexcept
+    {
+        return m_port;
+    }
+
+    const PortT& port() const noexcept
+    {
+        return m_port;
+    }
+
+    iox::expected<iox::mepoo::ChunkHeaderView, ChunkReceiveResult> takeChunks() noexcept
+    {
+        return m_port.tryGetChunkHeaders();
+    }
+
+    struct TriggerResetStub
+    {
+        void reset()
+        {
+        }
+    };
+    TriggerResetStub m_trigger;
+
+  private:
+    PortT m_port;
+};
+
+template <typename Base>
+class PortTestWrapper : public Base
+{
+  public:
+    template <typename PortDataT>
+    explicit PortTestWrapper(PortDataT& portData)
+        : Base(typename Base::PortType(&portData))
+    {
+    }
+};
+
+using TestPublisher =
+    PortTestWrapper<PublisherImpl<DummyMessage, iox::mepoo::NoUserHeader, PortOwner<PublisherPortUser>>>;
+using TestSubscriber =
+    PortTestWrapper<SubscriberImpl<DummyMessage, iox::mepoo::NoUserHeader, PortOwner<SubscriberPortUser>>>;
+
+class ArenaAllocationFree_test : public Test
+{
+  protected:
+    ArenaAllocationFree_test()
+    {
+        iox::mepoo::MePooConfig mempoolconf;
+        mempoolconf.addMemPool({SMALL_CHUNK, NUM_CHUNKS_IN_POOL});
+        mempoolconf.addMemPool({BIG_CHUNK, NUM_CHUNKS_IN_POOL});
+        m_memoryManager.configureMemoryManager(mempoolconf, m_memoryAllocator, m_memoryAllocator);
+    }
+
+    void SetUp() override
+    {
+        // this is basically what RouDi does when a subscriber connects to an offered publisher
+        IOX_DISCARD_RESULT(publisherPortRouDi.tryGetCaProMessage());
+        CaproMessage subscribeMessage(CaproMessageType::SUB, m_serviceDescription);
+        subscribeMessage.m_chunkQueueData = &subscriberPortData.m_chunkReceiverData;
+        subscribeMessage.m_historyCapacity = 0U;
+        auto ackMessage = publisherPortRouDi.dispatchCaProMessageAndGetPossibleResponse(subscribeMessage);
+        ASSERT_TRUE(ackMessage.has_value());
+        ASSERT_THAT(ackMessage->m_type, Eq(CaproMessageType::ACK));
+    }
+
+    void TearDown() override
+    {
+        IOX_DISCARD_RESULT(iox::testing::AllocationCounter::stop());
+    }
+
+    uint32_t usedChunks() const
+    {
+        return m_memoryManager.getMemPoolInfo(0U).m_usedChunks + m_memoryManager.getMemPoolInfo(1U).m_usedChunks;
+    }
+
+    /// @brief one publish/take/release cycle of a message which an arena built on NUMBER_OF_BLOCKS blocks
+    void publishAndTakeArenaMessage(TestPublisher& publisher, TestSubscriber& subscriber, const uint64_t data)
+    {
+        DummyMessage* message{nullptr};
+        for (uint32_t i = 0U; i < NUMBER_OF_BLOCKS; ++i)
+        {
+            size_t actualSize{0U};
+            auto* block = static_cast<uint8_t*>(publisher.loanBlock(BLOCK_SIZE, actualSize));
+            ASSERT_THAT(block, Ne(nullptr));
+            if (message == nullptr)
+            {
+                message = new (block + ARENA_BOOKKEEPING_SIZE) DummyMessage();
+                message->data = data;
+            }
+        }
+
+        auto sample = publisher.getSample(message);
+        ASSERT_FALSE(sample.has_error());
+        sample->publish();
+
+        auto receivedSample = subscriber.take();
+        ASSERT_FALSE(receivedSample.has_error());
+        EXPECT_THAT(receivedSample.value()->data, Eq(data));
+        EXPECT_THAT(receivedSample->getChunkHeaders().size(), Eq(NUMBER_OF_BLOCKS));
+    }
+
+    static constexpr uint32_t NUMBER_OF_BLOCKS{3U};
+    static constexpr size_t BLOCK_SIZE{64U};
+    static constexpr size_t ARENA_BOOKKEEPING_SIZE{16U};
+    static constexpr uint64_t NUMBER_OF_WARM_UP_CYCLES{3U};
+    static constexpr uint64_t NUMBER_OF_MEASURED_CYCLES{100U};
+
+  private:
+    static constexpr size_t MEMORY_SIZE{4U * 1024U * 1024U};
+    static constexpr uint32_t NUM_CHUNKS_IN_POOL{20U};
+    static constexpr uint64_t SMALL_CHUNK{256U};
+    static constexpr uint64_t BIG_CHUNK{1024U};
+    std::unique_ptr<uint8_t[]> m_memory{new uint8_t[MEMORY_SIZE]};
+    iox::BumpAllocator m_memoryAllocator{m_memory.get(), MEMORY_SIZE};
+    iox::mepoo::MemoryManager m_memoryManager;
+
+    ServiceDescription m_serviceDescription{"ice", "cream", "parlor"};
+    iox::RuntimeName_t m_runtimeName{"scoop"};
+
+  public:
+    PublisherPortData publisherPortData{
+        m_serviceDescription, m_runtimeName, iox::roudi::DEFAULT_UNIQUE_ROUDI_ID, &m_memoryManager, PublisherOptions()};
+    SubscriberPortData subscriberPortData{m_serviceDescription,
+                                          m_runtimeName,
+                                          iox::roudi::DEFAULT_UNIQUE_ROUDI_ID,
+                                          VariantQueueTypes::SoFi_SingleProducerSingleConsumer,
+                                          SubscriberOptions()};
+    PublisherPortRouDi publisherPortRouDi{&publisherPortData};
+};
+
+constexpr uint32_t ArenaAllocationFree_test::NUMBER_OF_BLOCKS;
+constexpr size_t ArenaAllocationFree_test::BLOCK_SIZE;
+constexpr size_t ArenaAllocationFree_test::ARENA_BOOKKEEPING_SIZE;
+constexpr uint64_t ArenaAllocationFree_test::NUMBER_OF_WARM_UP_CYCLES;
+constexpr uint64_t ArenaAllocationFree_test::NUMBER_OF_MEASURED_CYCLES;
+
+TEST_F(ArenaAllocationFree_test, PublishingAndTakingArenaMessagesDoesNotAllocate)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7138cd87-9428-4351-b7a6-a93d37a4808d");
+    TestPublisher publisher{publisherPortData};
+    TestSubscriber subscriber{subscriberPortData};
+
+    for (uint64_t i = 0U; i < NUMBER_OF_WARM_UP_CYCLES; ++i)
+    {
+        publishAndTakeArenaMessage(publisher, subscriber, i);
+    }
+
+    iox::testing::AllocationCounter::start();
+    for (uint64_t i = 0U; i < NUMBER_OF_MEASURED_CYCLES; ++i)
+    {
+        publishAndTakeArenaMessage(publisher, subscriber, i);
+    }
+    EXPECT_THAT(iox::testing::AllocationCounter::stop(), Eq(0U));
+}
+
+TEST_F(ArenaAllocationFree_test, ReleasingTheBlocksOfAnUnpublishedArenaMessageDoesNotAllocate)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3205f39f-be69-4097-97af-592e7be0daba");
+    TestPublisher publisher{publisherPortData};
+
+    iox::testing::AllocationCounter::start();
+    for (uint64_t i = 0U; i < NUMBER_OF_MEASURED_CYCLES; ++i)
+    {
+        for (uint32_t j = 0U; j < NUMBER_OF_BLOCKS; ++j)
+        {
+            size_t actualSize{0U};
+            ASSERT_THAT(publisher.loanBlock(BLOCK_SIZE, actualSize), Ne(nullptr));
+        }
+        publisher.releaseBlocks();
+    }
+    EXPECT_THAT(iox::testing::AllocationCounter::stop(), Eq(0U));
+    EXPECT_THAT(usedChunks(), Eq(0U));
+}
+
+} // namespace
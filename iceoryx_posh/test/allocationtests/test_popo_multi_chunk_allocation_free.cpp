@@ -0,0 +1,232 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_sender.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_sender_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iox/bump_allocator.hpp"
+
+#include "allocation_counter.hpp"
+#include "test.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+
+using iox::popo::UniquePortId;
+
+class MultiChunkAllocationFree_test : public Test
+{
+  protected:
+    MultiChunkAllocationFree_test()
+    {
+        m_mempoolconf.addMemPool({SMALL_CHUNK, NUM_CHUNKS_IN_POOL});
+        m_mempoolconf.addMemPool({BIG_CHUNK, NUM_CHUNKS_IN_POOL});
+        m_memoryManager.configureMemoryManager(m_mempoolconf, m_memoryAllocator, m_memoryAllocator);
+    }
+
+    void TearDown() override
+    {
+        IOX_DISCARD_RESULT(iox::testing::AllocationCounter::stop());
+    }
+
+    template <typename ChunkSender_t>
+    iox::mepoo::ChunkHeader* allocateSample(ChunkSender_t& sender)
+    {
+        iox::mepoo::ChunkHeader* firstChunkHeader{nullptr};
+        for (auto userPayloadSize : {SMALL_PAYLOAD, BIG_PAYLOAD, BIG_PAYLOAD})
+        {
+            sender
+                .tryAllocate(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                             userPayloadSize,
+                             iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
+                             iox::CHUNK_NO_USER_HEADER_SIZE,
+                             iox::CHUNK_NO_USER_HEADER_ALIGNMENT)
+                .and_then([&](auto chunkHeader) {
+                    if (firstChunkHeader == nullptr)
+                    {
+                        firstChunkHeader = chunkHeader;
+                    }
+                })
+                .or_else([](auto error) { ADD_FAILURE() << "Allocation failed with " << error; });
+        }
+        return firstChunkHeader;
+    }
+
+    /// @brief one publish/take/release cycle of a sample with NUMBER_OF_CHUNKS_PER_SAMPLE chunks
+    template <typename ChunkSender_t>
+    void sendAndReceiveSample(ChunkSender_t& sender)
+    {
+        sender.send(allocateSample(sender));
+        sender.resetChunkManagementManagement();
+
+        auto result = m_receiver.tryGetChunkHeaders();
+        ASSERT_FALSE(result.has_error());
+
+        uint64_t numberOfChunks{0U};
+        for (auto* chunkHeader : result.value())
+        {
+            EXPECT_THAT(chunkHeader, Ne(nullptr));
+            ++numberOfChunks;
+        }
+        EXPECT_THAT(numberOfChunks, Eq(NUMBER_OF_CHUNKS_PER_SAMPLE));
+
+        m_receiver.release(result.value().front());
+    }
+
+    uint32_t usedChunks() const
+    {
+        return m_memoryManager.getMemPoolInfo(0U).m_usedChunks + m_memoryManager.getMemPoolInfo(1U).m_usedChunks;
+    }
+
+    static constexpr size_t MEMORY_SIZE = 4 * 1024 * 1024;
+    std::unique_ptr<uint8_t[]> m_memory{new uint8_t[MEMORY_SIZE]};
+    static constexpr uint32_t NUM_CHUNKS_IN_POOL = 20;
+    static constexpr uint64_t SMALL_CHUNK = 128;
+    static constexpr uint64_t BIG_CHUNK = 256;
+    static constexpr uint64_t SMALL_PAYLOAD = 100;
+    static constexpr uint64_t BIG_PAYLOAD = 200;
+    static constexpr uint64_t NUMBER_OF_CHUNKS_PER_SAMPLE = 3U;
+    static constexpr uint64_t NUMBER_OF_WARM_UP_CYCLES = 3U;
+    static constexpr uint64_t NUMBER_OF_MEASURED_CYCLES = 100U;
+    static constexpr uint32_t MAX_NUMBER_QUEUES = 128;
+
+    iox::BumpAllocator m_memoryAllocator{m_memory.get(), MEMORY_SIZE};
+    iox::mepoo::MePooConfig m_mempoolconf;
+    iox::mepoo::MemoryManager m_memoryManager;
+
+    struct ChunkDistributorConfig
+    {
+        static constexpr uint32_t MAX_QUEUES = MAX_NUMBER_QUEUES;
+        static constexpr uint64_t MAX_HISTORY_CAPACITY = iox::MAX_PUBLISHER_HISTORY;
+    };
+
+    struct ChunkQueueConfig
+    {
+        static constexpr uint64_t MAX_QUEUE_CAPACITY = NUM_CHUNKS_IN_POOL;
+    };
+
+    using ChunkQueueData_t = iox::popo::ChunkQueueData<ChunkQueueConfig, iox::popo::ThreadSafePolicy>;
+    using ChunkDistributorData_t = iox::popo::ChunkDistributorData<ChunkDistributorConfig,
+                                                                   iox::popo::ThreadSafePolicy,
+                                                                   iox::popo::ChunkQueuePusher<ChunkQueueData_t>>;
+    using ChunkSenderData_t =
+        iox::popo::ChunkSenderData<iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY, ChunkDistributorData_t>;
+    using ChunkReceiverData_t =
+        iox::popo::ChunkReceiverData<iox::MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY, ChunkQueueData_t>;
+
+    ChunkReceiverData_t m_chunkReceiverData{iox::popo::VariantQueueTypes::FiFo_SingleProducerSingleConsumer,
+                                            iox::popo::QueueFullPolicy::DISCARD_OLDEST_DATA};
+    iox::popo::ChunkReceiver<ChunkReceiverData_t> m_receiver{&m_chunkReceiverData};
+};
+
+TEST_F(MultiChunkAllocationFree_test, SendingAndReceivingMultiChunkSamplesDoesNotAllocate)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5c8e2a47-b1d3-4f69-8e07-2d4a9c6f1b38");
+    ChunkSenderData_t chunkSenderData{&m_memoryManager, iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, 0U};
+    iox::popo::ChunkSender<ChunkSenderData_t> sut{&chunkSenderData};
+    ASSERT_FALSE(sut.tryAddQueue(&m_chunkReceiverData).has_error());
+
+    for (uint64_t i = 0U; i < NUMBER_OF_WARM_UP_CYCLES; ++i)
+    {
+        sendAndReceiveSample(sut);
+    }
+
+    iox::testing::AllocationCounter::start();
+    for (uint64_t i = 0U; i < NUMBER_OF_MEASURED_CYCLES; ++i)
+    {
+        sendAndReceiveSample(sut);
+    }
+    EXPECT_THAT(iox::testing::AllocationCounter::stop(), Eq(0U));
+}
+
+TEST_F(MultiChunkAllocationFree_test, SendingAndReceivingRecycledMultiChunkSamplesDoesNotAllocate)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e93f1b6d-27a4-4c85-b0d2-8f61a5e3c7d9");
+    ChunkSenderData_t chunkSenderData{
+        &m_memoryManager, iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, 0U, iox::mepoo::MemoryInfo(), true};
+    iox::popo::ChunkSender<ChunkSenderData_t> sut{&chunkSenderData};
+    ASSERT_FALSE(sut.tryAddQueue(&m_chunkReceiverData).has_error());
+
+    for (uint64_t i = 0U; i < NUMBER_OF_WARM_UP_CYCLES; ++i)
+    {
+        sendAndReceiveSample(sut);
+    }
+
+    iox::testing::AllocationCounter::start();
+    for (uint64_t i = 0U; i < NUMBER_OF_MEASURED_CYCLES; ++i)
+    {
+        sendAndReceiveSample(sut);
+    }
+    EXPECT_THAT(iox::testing::AllocationCounter::stop(), Eq(0U));
+}
+
+TEST_F(MultiChunkAllocationFree_test, ReleasingAMultiChunkSampleWithoutSendingDoesNotAllocate)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1a7d4c92-5e3b-4f08-a6c1-9b2e8d0f7a45");
+    ChunkSenderData_t chunkSenderData{&m_memoryManager, iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, 0U};
+    iox::popo::ChunkSender<ChunkSenderData_t> sut{&chunkSenderData};
+
+    iox::testing::AllocationCounter::start();
+    for (uint64_t i = 0U; i < NUMBER_OF_MEASURED_CYCLES; ++i)
+    {
+        sut.release(allocateSample(sut));
+        sut.resetChunkManagementManagement();
+    }
+    EXPECT_THAT(iox::testing::AllocationCounter::stop(), Eq(0U));
+    EXPECT_THAT(usedChunks(), Eq(0U));
+}
+
+TEST_F(MultiChunkAllocationFree_test, ReceivedChunkHeadersAreInAllocationOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b6f2d8a1-4c7e-49b3-85d0-3e1a7c9f2b64");
+    ChunkSenderData_t chunkSenderData{&m_memoryManager, iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, 0U};
+    iox::popo::ChunkSender<ChunkSenderData_t> sut{&chunkSenderData};
+    ASSERT_FALSE(sut.tryAddQueue(&m_chunkReceiverData).has_error());
+
+    std::vector<iox::mepoo::ChunkHeader*> chunkHeaders;
+    for (auto userPayloadSize : {SMALL_PAYLOAD, BIG_PAYLOAD, SMALL_PAYLOAD})
+    {
+        auto result = sut.tryAllocate(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                      userPayloadSize,
+                                      iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
+                                      iox::CHUNK_NO_USER_HEADER_SIZE,
+                                      iox::CHUNK_NO_USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(result.has_error());
+        chunkHeaders.push_back(result.value());
+    }
+    sut.send(chunkHeaders.front());
+    sut.resetChunkManagementManagement();
+
+    auto result = m_receiver.tryGetChunkHeaders();
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.value().size(), Eq(chunkHeaders.size()));
+    EXPECT_THAT(result.value().front(), Eq(chunkHeaders.front()));
+    EXPECT_THAT(result.value(), ElementsAreArray(chunkHeaders));
+}
+
+} // namespace
@@ -50,6 +50,14 @@ class MockClientPortUser : public MockBasePort
                 allocateRequest,
                 (const uint64_t, const uint32_t),
                 (noexcept));
+    MOCK_METHOD((iox::expected<iox::popo::RequestHeader*, iox::popo::AllocationError>),
+                allocateMultiChunkRequest,
+                (const uint64_t, const uint32_t),
+                (noexcept));
+    MOCK_METHOD((iox::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError>),
+                allocateRequestChunk,
+                (const uint64_t, const uint32_t),
+                (noexcept));
     MOCK_METHOD(void, releaseRequest, (const iox::popo::RequestHeader* const), (noexcept));
     MOCK_METHOD((iox::expected<void, iox::popo::ClientSendError>),
                 sendRequest,
@@ -18,6 +18,7 @@
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/testing/mocks/chunk_mock.hpp"
 #include "iox/detail/convert.hpp"
 #include "iox/detail/hoofs_error_reporting.hpp"
 #include "iox/type_traits.hpp"
@@ -360,6 +361,46 @@ TEST(ChunkHeader_test, UsedChunkSizeIsSizeOfChunkHeaderPlusOneWhenUserPayloadIsO
     EXPECT_THAT(sut.usedSizeOfChunk(), Eq(sizeof(ChunkHeader) + USER_PAYLOAD_SIZE));
 }
 
+TEST(ChunkHeader_test, ProtobufUserHeaderIsRecognizedByItsMagicValueAndVersion)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8e3f6a21-4c9d-4b70-a5e8-2d1b7f0c9a46");
+    ChunkMock<uint64_t, ProtobufUserHeader<>> chunk;
+    auto* userHeader = new (chunk.userHeader()) ProtobufUserHeader<>();
+    userHeader->m_rootMessageOffset = 8;
+    userHeader->m_serializedSize = 4U;
+    const auto userPayloadAddress = reinterpret_cast<uint64_t>(chunk.sample());
+
+    EXPECT_THAT(protobufUserHeader<NoUserHeader>(chunk.chunkHeader()), Eq(userHeader));
+    EXPECT_THAT(reinterpret_cast<uint64_t>(protobufRootMessage<NoUserHeader>(chunk.chunkHeader())),
+                Eq(userPayloadAddress + 8U));
+    EXPECT_THAT(protobufSerializedSize<NoUserHeader>(chunk.chunkHeader()), Eq(iox::optional<uint64_t>(4U)));
+
+    userHeader->m_version = ProtobufUserHeader<>::VERSION + 1U;
+    EXPECT_THAT(protobufUserHeader<NoUserHeader>(chunk.chunkHeader()), Eq(nullptr));
+    EXPECT_THAT(reinterpret_cast<uint64_t>(protobufRootMessage<NoUserHeader>(chunk.chunkHeader())),
+                Eq(userPayloadAddress));
+    EXPECT_FALSE(protobufSerializedSize<NoUserHeader>(chunk.chunkHeader()).has_value());
+}
+
+TEST(ChunkHeader_test, ForeignUserHeaderOfTheSameSizeIsNoProtobufUserHeader)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1b7c0e94-d3a5-4f62-8e19-6a4f2c8d0b73");
+    struct ForeignUserHeader
+    {
+        uint64_t data[sizeof(ProtobufUserHeader<>) / sizeof(uint64_t) + 1U];
+    };
+    ChunkMock<uint64_t, ForeignUserHeader> chunk;
+    for (auto& data : chunk.userHeader()->data)
+    {
+        data = 16U;
+    }
+    ASSERT_THAT(chunk.chunkHeader()->userHeaderSize(), Ge(sizeof(ProtobufUserHeader<>)));
+
+    EXPECT_THAT(protobufUserHeader<NoUserHeader>(chunk.chunkHeader()), Eq(nullptr));
+    EXPECT_THAT(protobufRootMessage<NoUserHeader>(chunk.chunkHeader()), Eq(static_cast<void*>(chunk.sample())));
+    EXPECT_FALSE(protobufSerializedSize<NoUserHeader>(chunk.chunkHeader()).has_value());
+}
+
 TEST(ChunkHeader_test, ConstructorTerminatesWhenUserPayloadSizeExceedsChunkSize)
 {
     ::testing::Test::RecordProperty("TEST_ID", "c8f911eb-ed0d-495a-8858-9fc45f5a06e8");
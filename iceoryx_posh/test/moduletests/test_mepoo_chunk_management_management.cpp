@@ -0,0 +1,171 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/chunk_management_management.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_posh/internal/mepoo/shared_multi_chunk.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iox/bump_allocator.hpp"
+#include "test.hpp"
+
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+
+using namespace iox::mepoo;
+
+class ChunkManagementManagement_test : public Test
+{
+  public:
+    ChunkManagement* getChunkManagement()
+    {
+        auto chunkSettingsResult = ChunkSettings::create(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+        EXPECT_FALSE(chunkSettingsResult.has_error());
+        if (chunkSettingsResult.has_error())
+        {
+            return nullptr;
+        }
+        auto chunkHeader = new (mempool.getChunk()) ChunkHeader(mempool.getChunkSize(), chunkSettingsResult.value());
+        return new (chunkMgmtPool.getChunk()) ChunkManagement{chunkHeader, &mempool, &chunkMgmtPool};
+    }
+
+    ChunkManagementManagement* getChunkManagementManagement()
+    {
+        return new (chunkMgmtMgmtPool.getChunk()) ChunkManagementManagement{&chunkMgmtMgmtPool};
+    }
+
+    std::vector<ChunkManagement*> addChunks(ChunkManagementManagement& sut, const uint32_t numberOfChunks)
+    {
+        std::vector<ChunkManagement*> chunkManagements;
+        for (uint32_t i = 0U; i < numberOfChunks; ++i)
+        {
+            chunkManagements.push_back(getChunkManagement());
+            sut.addChunkManagement(chunkManagements.back());
+        }
+        return chunkManagements;
+    }
+
+    static constexpr uint32_t CHUNK_SIZE{128U};
+    static constexpr uint32_t NUMBER_OF_CHUNKS{16U};
+    static constexpr uint32_t USER_PAYLOAD_SIZE{64U};
+    static constexpr uint32_t MEMORY_SIZE{16384U};
+
+    alignas(MemPool::CHUNK_MEMORY_ALIGNMENT) char memory[MEMORY_SIZE];
+    iox::BumpAllocator allocator{memory, MEMORY_SIZE};
+    MemPool mempool{sizeof(ChunkHeader) + USER_PAYLOAD_SIZE, NUMBER_OF_CHUNKS, allocator, allocator};
+    MemPool chunkMgmtPool{CHUNK_SIZE, NUMBER_OF_CHUNKS, allocator, allocator};
+    MemPool chunkMgmtMgmtPool{CHUNK_SIZE, NUMBER_OF_CHUNKS, allocator, allocator};
+};
+
+TEST_F(ChunkManagementManagement_test, NewlyCreatedChunkManagementManagementIsEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4f0b2c52-5d2e-4a39-9a44-0d7f6a6e3f10");
+    auto sut = getChunkManagementManagement();
+
+    EXPECT_TRUE(sut->empty());
+    EXPECT_THAT(sut->size(), Eq(0U));
+    EXPECT_THAT(sut->front(), Eq(nullptr));
+}
+
+TEST_F(ChunkManagementManagement_test, AddingManyChunksKeepsAllOfThemInInsertionOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b8f3f7a4-2f8b-4c0e-9d6b-6d3c2b9b1e21");
+    constexpr uint32_t NUMBER_OF_ADDED_CHUNKS{NUMBER_OF_CHUNKS};
+    auto sut = getChunkManagementManagement();
+
+    auto chunkManagements = addChunks(*sut, NUMBER_OF_ADDED_CHUNKS);
+
+    EXPECT_FALSE(sut->empty());
+    EXPECT_THAT(sut->size(), Eq(NUMBER_OF_ADDED_CHUNKS));
+    EXPECT_THAT(sut->front(), Eq(chunkManagements.front()));
+
+    std::vector<ChunkManagement*> chainedChunkManagements;
+    sut->forEach([&](const ChunkManagement& chunkManagement) {
+        chainedChunkManagements.push_back(const_cast<ChunkManagement*>(&chunkManagement));
+    });
+    EXPECT_THAT(chainedChunkManagements, ContainerEq(chunkManagements));
+}
+
+TEST_F(ChunkManagementManagement_test, ReleaseChunksReturnsAllChunksToTheirPools)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1c7e0d91-3a55-4d8f-bf0a-8e2a4f6c7d32");
+    auto sut = getChunkManagementManagement();
+    addChunks(*sut, NUMBER_OF_CHUNKS);
+
+    sut->releaseChunks();
+
+    EXPECT_TRUE(sut->empty());
+    EXPECT_THAT(sut->front(), Eq(nullptr));
+    EXPECT_THAT(mempool.getUsedChunks(), Eq(0U));
+    EXPECT_THAT(chunkMgmtPool.getUsedChunks(), Eq(0U));
+}
+
+TEST_F(ChunkManagementManagement_test, ReleaseAllButFirstChunkDetachesTheFirstChunkAndFreesTheRest)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e5a2d6b0-7c41-4f93-8a1d-3b9e0f5c6a43");
+    auto sut = getChunkManagementManagement();
+    auto chunkManagements = addChunks(*sut, 5U);
+
+    auto firstChunkManagement = sut->releaseAllButFirstChunk();
+
+    EXPECT_THAT(firstChunkManagement, Eq(chunkManagements.front()));
+    EXPECT_THAT(firstChunkManagement->m_nextChunkManagement.get(), Eq(nullptr));
+    EXPECT_TRUE(sut->empty());
+    EXPECT_THAT(mempool.getUsedChunks(), Eq(1U));
+    EXPECT_THAT(chunkMgmtPool.getUsedChunks(), Eq(1U));
+}
+
+TEST_F(ChunkManagementManagement_test, ReleaseAllButFirstChunkOnEmptyChainReturnsNullptr)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9d4b1f27-0e6c-4a85-b2f3-7a1c8e4d5b54");
+    auto sut = getChunkManagementManagement();
+
+    EXPECT_THAT(sut->releaseAllButFirstChunk(), Eq(nullptr));
+}
+
+TEST_F(ChunkManagementManagement_test, ChunkCanBeAddedAgainAfterItWasDetached)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "36c8e2a1-5b9f-4d70-8e4a-c1f2b3d4e565");
+    auto sut = getChunkManagementManagement();
+    addChunks(*sut, 3U);
+    auto firstChunkManagement = sut->releaseAllButFirstChunk();
+
+    sut->addChunkManagement(firstChunkManagement);
+
+    EXPECT_THAT(sut->size(), Eq(1U));
+    EXPECT_THAT(sut->front(), Eq(firstChunkManagement));
+}
+
+TEST_F(ChunkManagementManagement_test, DestroyingLastSharedMultiChunkReleasesTheWholeChain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a7f3c9d2-1e4b-4b86-9c5d-2e8f0a1b7c76");
+    {
+        auto chunkManagementManagement = getChunkManagementManagement();
+        addChunks(*chunkManagementManagement, NUMBER_OF_CHUNKS);
+        SharedMultiChunk sut{chunkManagementManagement};
+        SharedMultiChunk copy{sut};
+
+        EXPECT_THAT(sut.getChunkHeaders().size(), Eq(NUMBER_OF_CHUNKS));
+    }
+
+    EXPECT_THAT(mempool.getUsedChunks(), Eq(0U));
+    EXPECT_THAT(chunkMgmtPool.getUsedChunks(), Eq(0U));
+    EXPECT_THAT(chunkMgmtMgmtPool.getUsedChunks(), Eq(0U));
+}
+
+} // namespace
@@ -22,10 +22,14 @@
 #include "iceoryx_platform/types.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/mepoo/mepoo_segment.hpp"
+#include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iox/bump_allocator.hpp"
 #include "iox/expected.hpp"
 #include "iox/posix_group.hpp"
 #include "iox/posix_shared_memory_object.hpp"
+
+#include "iceoryx_hoofs/testing/error_reporting/testing_support.hpp"
+#include "iceoryx_hoofs/testing/fatal_failure.hpp"
 #include "test.hpp"
 
 
@@ -37,6 +41,7 @@ namespace
 using namespace ::testing;
 using namespace iox;
 using namespace iox::mepoo;
+using namespace iox::testing;
 
 class MePooSegment_test : public Test
 {
@@ -205,6 +210,58 @@ TEST_F(MePooSegment_test, GetWriterGroup)
     EXPECT_THAT(sut->getWriterGroup(), Eq(iox::PosixGroup("iox_roudi_test2")));
 }
 
+TEST_F(MePooSegment_test, GetFixedBaseAddressWithoutConfiguredAddressReturnsNoFixedBaseAddress)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "820485a4-e9be-499b-948f-7bb157bb4930");
+    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+
+    MePooSegment_test::SharedMemoryObject_MOCK::createVerificator = [](const detail::PosixSharedMemory::Name_t,
+                                                                       const uint64_t,
+                                                                       const iox::AccessMode,
+                                                                       const iox::OpenMode,
+                                                                       const void* baseAddressHint,
+                                                                       const iox::access_rights) {
+        EXPECT_THAT(baseAddressHint, Eq(nullptr));
+    };
+    auto sut = createSut();
+    MePooSegment_test::SharedMemoryObject_MOCK::createVerificator =
+        MePooSegment_test::SharedMemoryObject_MOCK::createFct();
+
+    EXPECT_THAT(sut->getFixedBaseAddress(), Eq(SegmentConfig::NO_FIXED_BASE_ADDRESS));
+}
+
+TEST_F(MePooSegment_test, MappingAtUnavailableFixedBaseAddressLeadsToFatalError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "909227d7-973d-47aa-8ec2-bd018992e061");
+    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+
+    constexpr uint64_t FIXED_BASE_ADDRESS{0x10000U};
+    MePooSegment_test::SharedMemoryObject_MOCK::createVerificator = [](const detail::PosixSharedMemory::Name_t,
+                                                                       const uint64_t,
+                                                                       const iox::AccessMode,
+                                                                       const iox::OpenMode,
+                                                                       const void* baseAddressHint,
+                                                                       const iox::access_rights) {
+        EXPECT_THAT(reinterpret_cast<uint64_t>(baseAddressHint), Eq(FIXED_BASE_ADDRESS));
+    };
+
+    // the mock always maps its memory somewhere else than the requested address
+    IOX_EXPECT_FATAL_FAILURE(
+        [&] {
+            SUT sut{mepooConfig,
+                    DEFAULT_DOMAIN_ID,
+                    m_managementAllocator,
+                    PosixGroup{"iox_roudi_test1"},
+                    PosixGroup{"iox_roudi_test2"},
+                    MemoryInfo(),
+                    FIXED_BASE_ADDRESS};
+        },
+        iox::PoshError::MEPOO__SEGMENT_FIXED_BASE_ADDRESS_UNAVAILABLE);
+
+    MePooSegment_test::SharedMemoryObject_MOCK::createVerificator =
+        MePooSegment_test::SharedMemoryObject_MOCK::createFct();
+}
+
 TEST_F(MePooSegment_test, GetMemoryManager)
 {
     ::testing::Test::RecordProperty("TEST_ID", "4bc4af78-4beb-42eb-aee4-0f7cffb66411");
@@ -45,7 +45,8 @@ class MePooSegmentMock
                      iox::BumpAllocator& managementAllocator [[maybe_unused]],
                      const PosixGroup& readerGroup [[maybe_unused]],
                      const PosixGroup& writerGroup [[maybe_unused]],
-                     const MemoryInfo& memoryInfo [[maybe_unused]]) noexcept
+                     const MemoryInfo& memoryInfo [[maybe_unused]],
+                     const uint64_t fixedBaseAddress [[maybe_unused]]) noexcept
     {
     }
 };
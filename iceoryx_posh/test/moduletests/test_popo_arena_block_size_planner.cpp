@@ -0,0 +1,148 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/arena_block_size_planner.hpp"
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+
+class ArenaBlockSizePlanner_test : public Test
+{
+  public:
+    void recordFootprints(const uint64_t footprint, const uint32_t count)
+    {
+        for (uint32_t i = 0U; i < count; ++i)
+        {
+            sut.recordFootprint(footprint);
+        }
+    }
+
+    static uint64_t expectedPlan(const uint64_t footprint)
+    {
+        const uint64_t plan = footprint + footprint / 8U + ArenaBlockSizePlanner::ARENA_BOOKKEEPING_RESERVE;
+        return (plan + 7U) / 8U * 8U;
+    }
+
+    static constexpr uint64_t REQUESTED_SIZE{256U};
+    static constexpr uint64_t TYPICAL_FOOTPRINT{4000U};
+
+    ArenaBlockSizePlanner sut;
+};
+
+TEST_F(ArenaBlockSizePlanner_test, WithoutHistoryTheRequestedSizeIsUsed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6b1f0c3e-8d42-4a57-9e2b-1f4a7c9d0e11");
+    EXPECT_THAT(sut.plannedBlockSize(), Eq(0U));
+    EXPECT_THAT(sut.firstBlockSize(REQUESTED_SIZE), Eq(REQUESTED_SIZE));
+}
+
+TEST_F(ArenaBlockSizePlanner_test, FirstBlockCoversRecordedFootprint)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0d9e3a72-4c1b-4f86-b5a0-2e7c8d1f9a22");
+    sut.recordFootprint(TYPICAL_FOOTPRINT);
+
+    EXPECT_THAT(sut.plannedBlockSize(), Eq(expectedPlan(TYPICAL_FOOTPRINT)));
+    EXPECT_THAT(sut.firstBlockSize(REQUESTED_SIZE), Eq(expectedPlan(TYPICAL_FOOTPRINT)));
+    EXPECT_THAT(sut.plannedBlockSize() % 8U, Eq(0U));
+}
+
+TEST_F(ArenaBlockSizePlanner_test, LargerRequestedSizeThanPlanIsKept)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c4a8f1d6-2b73-4e09-8a6c-5d3b0e2f7a33");
+    sut.recordFootprint(TYPICAL_FOOTPRINT);
+    constexpr uint64_t LARGE_REQUESTED_SIZE{100000U};
+
+    EXPECT_THAT(sut.firstBlockSize(LARGE_REQUESTED_SIZE), Eq(LARGE_REQUESTED_SIZE));
+}
+
+TEST_F(ArenaBlockSizePlanner_test, SingleOutlierInFullHistoryDoesNotInflatePlan)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8e2c5b19-7f0a-4d34-9b1e-6a4d2c8f0b44");
+    recordFootprints(TYPICAL_FOOTPRINT, ArenaBlockSizePlanner::HISTORY_CAPACITY - 1U);
+    sut.recordFootprint(TYPICAL_FOOTPRINT * 100U);
+
+    EXPECT_THAT(sut.plannedBlockSize(), Eq(expectedPlan(TYPICAL_FOOTPRINT)));
+}
+
+TEST_F(ArenaBlockSizePlanner_test, PlanFollowsGrowingFootprint)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2f7d9a04-1e5c-4b68-a3d2-7b5e3d9f1c55");
+    recordFootprints(TYPICAL_FOOTPRINT, ArenaBlockSizePlanner::HISTORY_CAPACITY);
+    recordFootprints(TYPICAL_FOOTPRINT * 2U, ArenaBlockSizePlanner::NUMBER_OF_IGNORED_OUTLIERS + 1U);
+
+    EXPECT_THAT(sut.plannedBlockSize(), Eq(expectedPlan(TYPICAL_FOOTPRINT * 2U)));
+}
+
+TEST_F(ArenaBlockSizePlanner_test, PlanShrinksOnceLargeFootprintsLeftTheHistory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a1b3e6c8-9d20-4f71-8c4e-0d6f4e1a2b66");
+    constexpr uint64_t SMALL_FOOTPRINT{500U};
+    recordFootprints(TYPICAL_FOOTPRINT, ArenaBlockSizePlanner::HISTORY_CAPACITY);
+    recordFootprints(SMALL_FOOTPRINT, ArenaBlockSizePlanner::HISTORY_CAPACITY);
+
+    EXPECT_THAT(sut.plannedBlockSize(), Eq(expectedPlan(SMALL_FOOTPRINT)));
+}
+
+struct ArenaStub
+{
+    uint64_t SpaceUsed() const
+    {
+        return spaceUsed;
+    }
+    uint64_t spaceUsed{0U};
+};
+
+struct ArenaAwareMessage
+{
+    const ArenaStub* GetArena() const
+    {
+        return arena;
+    }
+    const ArenaStub* arena{nullptr};
+};
+
+TEST(ArenaFootprint_test, FootprintOfArenaAwareMessageIsSpaceUsedOfItsArena)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5c9e2f17-3a84-4b06-9d5f-8e7a5f2b3c77");
+    ArenaStub arena{1234U};
+    ArenaAwareMessage message{&arena};
+
+    auto footprint = ArenaFootprint<ArenaAwareMessage>::of(message);
+
+    ASSERT_TRUE(footprint.has_value());
+    EXPECT_THAT(footprint.value(), Eq(1234U));
+}
+
+TEST(ArenaFootprint_test, FootprintOfMessageWithoutArenaIsUnknown)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e0d4a3b2-6f19-4c85-a7e0-9f8b6a3c4d88");
+    ArenaAwareMessage message;
+
+    EXPECT_FALSE(ArenaFootprint<ArenaAwareMessage>::of(message).has_value());
+}
+
+TEST(ArenaFootprint_test, FootprintOfPlainTypeIsUnknown)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7b6f5c4d-0a2e-4d93-b8f1-a09c7b4d5e99");
+    constexpr uint64_t PLAIN_VALUE{42U};
+
+    EXPECT_FALSE(ArenaFootprint<uint64_t>::of(PLAIN_VALUE).has_value());
+}
+
+} // namespace
@@ -0,0 +1,209 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/arena_loan.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_sender.hpp"
+#include "iceoryx_posh/testing/mocks/chunk_mock.hpp"
+#include "test.hpp"
+
+#include <cstring>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+
+struct Block
+{
+    uint8_t data[1024];
+};
+
+using ProtobufUserHeader_t = iox::mepoo::ProtobufUserHeader<iox::mepoo::NoUserHeader>;
+using BlockChunk = ChunkMock<Block, ProtobufUserHeader_t>;
+
+class ArenaLoan_test : public Test
+{
+  public:
+    ArenaLoan_test()
+    {
+        // the publisher constructs the user-header of each loaned block
+        for (auto& chunk : m_chunks)
+        {
+            new (chunk.userHeader()) ProtobufUserHeader_t();
+        }
+    }
+
+    /// @brief returns an allocator which hands out the chunks in order and records the requested block sizes
+    auto allocator(std::vector<uint64_t>& requestedSizes)
+    {
+        return [this, &requestedSizes](const uint64_t blockSize,
+                                       const uint32_t) -> iox::expected<iox::mepoo::ChunkHeader*, AllocationError> {
+            requestedSizes.push_back(blockSize);
+            if (m_nextChunk == CHUNKS || blockSize > sizeof(Block))
+            {
+                return iox::err(AllocationError::RUNNING_OUT_OF_CHUNKS);
+            }
+            return iox::ok(m_chunks[m_nextChunk++].chunkHeader());
+        };
+    }
+
+    void* loanBlock(const size_t size)
+    {
+        size_t actualSize{0U};
+        return sut.loanBlock(size, actualSize, allocator(firstSizes), allocator(nextSizes));
+    }
+
+    static constexpr uint32_t CHUNKS{3U};
+    BlockChunk m_chunks[CHUNKS];
+    uint32_t m_nextChunk{0U};
+    std::vector<uint64_t> firstSizes;
+    std::vector<uint64_t> nextSizes;
+
+    ArenaLoan<iox::mepoo::NoUserHeader> sut;
+};
+
+TEST_F(ArenaLoan_test, FirstBlockStartsTheLoanAndFurtherBlocksAreAdded)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c359f7b6-0ae5-4810-b436-5803f8698df9");
+    EXPECT_THAT(sut.firstChunkHeader(), Eq(nullptr));
+
+    size_t actualSize{0U};
+    auto* firstBlock = sut.loanBlock(64U, actualSize, allocator(firstSizes), allocator(nextSizes));
+    auto* secondBlock = loanBlock(64U);
+
+    EXPECT_THAT(firstBlock, Eq(m_chunks[0].sample()));
+    EXPECT_THAT(secondBlock, Eq(m_chunks[1].sample()));
+    EXPECT_THAT(actualSize, Ge(64U));
+    EXPECT_THAT(actualSize, Le(m_chunks[0].chunkHeader()->actualUserPayloadSize()));
+    EXPECT_THAT(firstSizes.size(), Eq(1U));
+    EXPECT_THAT(nextSizes.size(), Eq(1U));
+    EXPECT_THAT(sut.firstChunkHeader(), Eq(m_chunks[0].chunkHeader()));
+}
+
+TEST_F(ArenaLoan_test, FailingAllocationReturnsNullptr)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a48925b3-8cb1-4b37-934f-e9a8142fb7ff");
+    EXPECT_THAT(loanBlock(sizeof(Block) + 1U), Eq(nullptr));
+    EXPECT_THAT(sut.firstChunkHeader(), Eq(nullptr));
+}
+
+TEST_F(ArenaLoan_test, FirstChunkIsReturnedWhenTheLastBlockIsReleased)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "754da9ca-c99b-44ee-8106-c27dd944bb8f");
+    auto* firstBlock = loanBlock(64U);
+    auto* secondBlock = loanBlock(64U);
+
+    EXPECT_THAT(sut.releaseBlock(secondBlock), Eq(nullptr));
+    EXPECT_THAT(sut.releaseBlock(firstBlock), Eq(m_chunks[0].chunkHeader()));
+    EXPECT_THAT(sut.firstChunkHeader(), Eq(nullptr));
+}
+
+TEST_F(ArenaLoan_test, BlocksWhichDoNotBelongToTheLoanAreIgnoredOnRelease)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5419229d-0868-4843-bacf-fae14c620a03");
+    auto* block = loanBlock(64U);
+    BlockChunk foreignChunk;
+
+    EXPECT_THAT(sut.releaseBlock(foreignChunk.sample()), Eq(nullptr));
+    EXPECT_THAT(sut.releaseBlock(block), Eq(m_chunks[0].chunkHeader()));
+}
+
+TEST_F(ArenaLoan_test, RootMessageIsRecordedRelativeToTheFirstBlock)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2f8f4fa9-8a95-4a11-b477-b1c86e2f9a03");
+    loanBlock(64U);
+    auto* secondBlock = static_cast<uint8_t*>(loanBlock(64U));
+    auto* rootMessage = secondBlock + 16U;
+
+    EXPECT_THAT(sut.setRootMessage(rootMessage), Eq(m_chunks[0].chunkHeader()));
+    EXPECT_THAT(iox::mepoo::protobufRootMessage<iox::mepoo::NoUserHeader>(m_chunks[0].chunkHeader()),
+                Eq(rootMessage));
+}
+
+TEST_F(ArenaLoan_test, RootMessageCannotBeSetWithoutLoan)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b3f2bfe4-f612-4e92-ad6f-7d63b5a8fa5a");
+    uint8_t message{0U};
+    EXPECT_THAT(sut.setRootMessage(&message), Eq(nullptr));
+}
+
+TEST_F(ArenaLoan_test, ContainsDetectsMessagesInAllBlocks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a9d26723-8fe5-4d47-8ea1-119890a4b3dc");
+    auto* firstBlock = static_cast<uint8_t*>(loanBlock(64U));
+    auto* secondBlock = static_cast<uint8_t*>(loanBlock(64U));
+
+    EXPECT_TRUE(sut.contains(firstBlock));
+    EXPECT_TRUE(sut.contains(secondBlock + 64U));
+    EXPECT_FALSE(sut.contains(m_chunks[2].sample()));
+}
+
+TEST_F(ArenaLoan_test, FinishedLoanPlansTheFirstBlockOfTheNextLoan)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e0d90fdc-3c20-4701-8023-d883152e91d2");
+    constexpr uint64_t FOOTPRINT{100U};
+    loanBlock(64U);
+    sut.finish(m_chunks[0].chunkHeader(), FOOTPRINT);
+    EXPECT_THAT(sut.firstChunkHeader(), Eq(nullptr));
+
+    loanBlock(64U);
+
+    ASSERT_THAT(firstSizes.size(), Eq(2U));
+    EXPECT_THAT(firstSizes[1], Gt(FOOTPRINT));
+}
+
+TEST_F(ArenaLoan_test, PlannedBlockFallsBackToTheRequestedSizeWhenItCannotBeAllocated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "de02864c-270d-43cd-b6fd-093169b6e37f");
+    loanBlock(64U);
+    sut.finish(m_chunks[0].chunkHeader(), 10U * sizeof(Block));
+
+    EXPECT_THAT(loanBlock(64U), Eq(m_chunks[1].sample()));
+    ASSERT_THAT(firstSizes.size(), Eq(3U));
+    EXPECT_THAT(firstSizes[1], Gt(sizeof(Block)));
+    EXPECT_THAT(firstSizes[2], AllOf(Ge(64U), Lt(sizeof(Block))));
+}
+
+TEST_F(ArenaLoan_test, ArenaDoesNotSeeTheLinkToTheNextBlock)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e8ee43d8-3c9f-4f69-9b0f-3af2c4a87ed0");
+    size_t actualSize{0U};
+    auto* firstBlock =
+        static_cast<uint8_t*>(sut.loanBlock(64U, actualSize, allocator(firstSizes), allocator(nextSizes)));
+    ASSERT_THAT(firstBlock, Ne(nullptr));
+
+    // the arena owns all bytes of the usable size; overwriting them must not break the chain of the loan
+    std::memset(firstBlock, 0xAB, actualSize);
+    auto* secondBlock = loanBlock(64U);
+    std::memset(firstBlock, 0xCD, actualSize);
+
+    EXPECT_THAT(sut.releaseBlock(firstBlock), Eq(nullptr));
+    EXPECT_THAT(sut.releaseBlock(secondBlock), Eq(m_chunks[0].chunkHeader()));
+}
+
+TEST_F(ArenaLoan_test, FinishingAnotherMessageKeepsTheLoan)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d7692ec1-b31a-40c5-a18b-d288908eeee6");
+    loanBlock(64U);
+    BlockChunk otherChunk;
+
+    sut.finish(otherChunk.chunkHeader(), iox::nullopt);
+
+    EXPECT_THAT(sut.firstChunkHeader(), Eq(m_chunks[0].chunkHeader()));
+}
+
+} // namespace
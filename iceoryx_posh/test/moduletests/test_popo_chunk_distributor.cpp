@@ -35,6 +35,8 @@
 #include "test.hpp"
 
 #include <memory>
+#include <thread>
+#include <vector>
 
 namespace
 {
@@ -51,7 +53,7 @@ template <typename PolicyType>
 class ChunkDistributor_test : public Test
 {
   public:
-    SharedChunk allocateChunk(uint64_t value)
+    SharedMultiChunk allocateChunk(uint64_t value)
     {
         ChunkManagement* chunkMgmt = static_cast<ChunkManagement*>(chunkMgmtPool.getChunk());
         auto chunk = mempool.getChunk();
@@ -67,9 +69,11 @@ class ChunkDistributor_test : public Test
         ChunkHeader* chunkHeader = new (chunk) ChunkHeader(mempool.getChunkSize(), chunkSettings);
         new (chunkMgmt) ChunkManagement{chunkHeader, &mempool, &chunkMgmtPool};
         *static_cast<uint64_t*>(chunkHeader->userPayload()) = value;
-        return SharedChunk(chunkMgmt);
+        auto chunkMgmtMgmt = new (chunkMgmtPool.getChunk()) ChunkManagementManagement(&chunkMgmtPool);
+        chunkMgmtMgmt->addChunkManagement(chunkMgmt);
+        return SharedMultiChunk(chunkMgmtMgmt);
     }
-    uint32_t getSharedChunkValue(const SharedChunk& chunk)
+    uint32_t getSharedChunkValue(const SharedMultiChunk& chunk)
     {
         return *static_cast<uint32_t*>(chunk.getUserPayload());
     }
@@ -83,7 +87,7 @@ class ChunkDistributor_test : public Test
     std::unique_ptr<uint8_t[]> memory{new uint8_t[MEMORY_SIZE]};
     iox::BumpAllocator allocator{memory.get(), MEMORY_SIZE};
     MemPool mempool{sizeof(ChunkHeader) + USER_PAYLOAD_SIZE, MEMPOOL_CHUNK_COUNT, allocator, allocator};
-    MemPool chunkMgmtPool{128U, MEMPOOL_CHUNK_COUNT, allocator, allocator};
+    MemPool chunkMgmtPool{128U, 2U * MEMPOOL_CHUNK_COUNT, allocator, allocator};
 
     struct ChunkDistributorConfig
     {
@@ -822,4 +826,231 @@ TYPED_TEST(ChunkDistributor_test, MultipleBlockingQueuesWillBeFilledWhenThereBec
     }
 }
 
+TYPED_TEST(ChunkDistributor_test, QueueWithDifferentLayoutGetsSerializedCopy)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "08a506f1-b75d-4137-b883-ea33c02283cb");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    sut.setMessageLayout(MessageLayout{1U, 1U});
+
+    auto inPlaceQueueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> inPlaceQueue(inPlaceQueueData.get());
+    inPlaceQueue.setMessageLayout(MessageLayout{1U, 1U});
+    auto serializedQueueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> serializedQueue(serializedQueueData.get());
+    serializedQueue.setMessageLayout(MessageLayout{1U, 2U});
+    ASSERT_FALSE(sut.tryAddQueue(inPlaceQueueData.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(serializedQueueData.get()).has_error());
+
+    auto numberOfDeliveries =
+        sut.deliverToAllStoredQueues(this->allocateChunk(4451), [&] { return this->allocateChunk(73); });
+    EXPECT_THAT(numberOfDeliveries, Eq(2U));
+
+    auto maybeInPlaceChunk = inPlaceQueue.tryPop();
+    ASSERT_THAT(maybeInPlaceChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeInPlaceChunk), Eq(4451U));
+    auto maybeSerializedChunk = serializedQueue.tryPop();
+    ASSERT_THAT(maybeSerializedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSerializedChunk), Eq(73U));
+}
+
+TYPED_TEST(ChunkDistributor_test, SerializedCopyIsCreatedOnceForAllQueuesWhichNeedIt)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "864ca378-a032-4611-867f-2c847256f591");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    sut.setMessageLayout(MessageLayout{1U, 1U});
+
+    constexpr uint32_t NUMBER_OF_QUEUES{3U};
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueData;
+    for (uint32_t i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        queueData.emplace_back(this->getChunkQueueData());
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t>(queueData.back().get())
+            .setMessageLayout(MessageLayout{2U, 1U});
+        ASSERT_FALSE(sut.tryAddQueue(queueData.back().get()).has_error());
+    }
+
+    uint32_t numberOfSerializations{0U};
+    auto numberOfDeliveries = sut.deliverToAllStoredQueues(this->allocateChunk(4451), [&] {
+        ++numberOfSerializations;
+        return this->allocateChunk(73);
+    });
+
+    EXPECT_THAT(numberOfDeliveries, Eq(NUMBER_OF_QUEUES));
+    EXPECT_THAT(numberOfSerializations, Eq(1U));
+    for (auto& data : queueData)
+    {
+        auto maybeSharedChunk = ChunkQueuePopper<typename TestFixture::ChunkQueueData_t>(data.get()).tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(73U));
+    }
+}
+
+TYPED_TEST(ChunkDistributor_test, QueuesWithoutLayoutAndLayoutIndependentProducerNeverNeedSerializedCopy)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "39d71dc9-d9b7-4926-b29c-2190e1bff8e7");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueWithLayoutData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queueWithLayout(queueWithLayoutData.get());
+    queueWithLayout.setMessageLayout(MessageLayout{2U, 1U});
+    auto queueWithoutLayoutData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queueWithoutLayout(queueWithoutLayoutData.get());
+    ASSERT_FALSE(sut.tryAddQueue(queueWithLayoutData.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueWithoutLayoutData.get()).has_error());
+
+    uint32_t numberOfSerializations{0U};
+    auto serializedCopy = [&] {
+        ++numberOfSerializations;
+        return this->allocateChunk(73);
+    };
+    // a layout independent producer
+    sut.deliverToAllStoredQueues(this->allocateChunk(1), serializedCopy);
+    // a consumer without layout
+    sut.setMessageLayout(MessageLayout{1U, 1U});
+    ASSERT_FALSE(sut.tryRemoveQueue(queueWithLayoutData.get()).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(2), serializedCopy);
+
+    EXPECT_THAT(numberOfSerializations, Eq(0U));
+    EXPECT_THAT(queueWithLayout.size(), Eq(1U));
+    EXPECT_THAT(queueWithoutLayout.size(), Eq(2U));
+}
+
+TYPED_TEST(ChunkDistributor_test, QueueWithDifferentLayoutLosesChunkWhenSerializedCopyFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2a71395a-741d-49a9-97e5-26d669ce144b");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    sut.setMessageLayout(MessageLayout{1U, 1U});
+
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setMessageLayout(MessageLayout{1U, 2U});
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    auto numberOfDeliveries =
+        sut.deliverToAllStoredQueues(this->allocateChunk(4451), [] { return SharedMultiChunk(); });
+
+    EXPECT_THAT(numberOfDeliveries, Eq(0U));
+    EXPECT_THAT(queue.size(), Eq(0U));
+    EXPECT_THAT(queue.hasLostChunks(), Eq(true));
+}
+
+TYPED_TEST(ChunkDistributor_test, SerializedOnlyQueueWithSameLayoutGetsSharedSerializedCopy)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "42423226-a76b-45d2-aabc-b61d132d5985");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    sut.setMessageLayout(MessageLayout{1U, 1U});
+
+    auto inPlaceQueueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> inPlaceQueue(inPlaceQueueData.get());
+    inPlaceQueue.setMessageLayout(MessageLayout{1U, 1U});
+    auto firstSerializedQueueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> firstSerializedQueue(firstSerializedQueueData.get());
+    firstSerializedQueue.setMessageLayout(MessageLayout::serializedOnly(1U));
+    auto secondSerializedQueueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> secondSerializedQueue(secondSerializedQueueData.get());
+    secondSerializedQueue.setMessageLayout(MessageLayout::serializedOnly(1U));
+    ASSERT_FALSE(sut.tryAddQueue(inPlaceQueueData.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(firstSerializedQueueData.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(secondSerializedQueueData.get()).has_error());
+
+    uint64_t numberOfSerializedCopies{0U};
+    auto numberOfDeliveries = sut.deliverToAllStoredQueues(this->allocateChunk(4451), [&] {
+        ++numberOfSerializedCopies;
+        return this->allocateChunk(73);
+    });
+
+    EXPECT_THAT(numberOfDeliveries, Eq(3U));
+    EXPECT_THAT(numberOfSerializedCopies, Eq(1U));
+    auto maybeInPlaceChunk = inPlaceQueue.tryPop();
+    ASSERT_THAT(maybeInPlaceChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeInPlaceChunk), Eq(4451U));
+    for (auto* queue : {&firstSerializedQueue, &secondSerializedQueue})
+    {
+        auto maybeSerializedChunk = queue->tryPop();
+        ASSERT_THAT(maybeSerializedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSerializedChunk), Eq(73U));
+    }
+}
+
+TYPED_TEST(ChunkDistributor_test, SerializedCopyIsCreatedWithoutHoldingTheLock)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5d0b8c1e-2a77-4a4c-8f0e-91a7d6c2b3e4");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    sut.setMessageLayout(MessageLayout{1U, 1U});
+
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setMessageLayout(MessageLayout{1U, 2U});
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    // the lock is recursive, hence it is tried from another thread
+    bool isLockAvailable{false};
+    auto numberOfDeliveries = sut.deliverToAllStoredQueues(this->allocateChunk(4451), [&] {
+        std::thread([&] {
+            isLockAvailable = sutData->tryLock();
+            if (isLockAvailable)
+            {
+                sutData->unlock();
+            }
+        }).join();
+        return this->allocateChunk(73);
+    });
+
+    EXPECT_THAT(numberOfDeliveries, Eq(1U));
+    EXPECT_TRUE(isLockAvailable);
+    auto maybeSerializedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSerializedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSerializedChunk), Eq(73U));
+}
+
+TYPED_TEST(ChunkDistributor_test, QueueWithDifferentLayoutLosesTheHistory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b7e3f1d2-64c8-4d0f-9a5e-3c2d1e0f4a8b");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    sut.setMessageLayout(MessageLayout{1U, 1U});
+    sut.deliverToAllStoredQueues(this->allocateChunk(1));
+
+    auto serializedQueueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> serializedQueue(serializedQueueData.get());
+    serializedQueue.setMessageLayout(MessageLayout{1U, 2U});
+    auto queueWithoutHistoryRequestData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queueWithoutHistoryRequest(
+        queueWithoutHistoryRequestData.get());
+    queueWithoutHistoryRequest.setMessageLayout(MessageLayout{1U, 2U});
+    ASSERT_FALSE(sut.tryAddQueue(serializedQueueData.get(), 1U).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueWithoutHistoryRequestData.get(), 0U).has_error());
+
+    EXPECT_THAT(serializedQueue.size(), Eq(0U));
+    EXPECT_TRUE(serializedQueue.hasLostChunks());
+    EXPECT_FALSE(queueWithoutHistoryRequest.hasLostChunks());
+}
+
+TYPED_TEST(ChunkDistributor_test, NoHistoryIsDeliveredToQueueWithDifferentLayout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a6c90c68-07c9-4ee7-b09a-19dc4e21e18a");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    sut.setMessageLayout(MessageLayout{1U, 1U});
+    sut.deliverToAllStoredQueues(this->allocateChunk(1));
+
+    auto serializedQueueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> serializedQueue(serializedQueueData.get());
+    serializedQueue.setMessageLayout(MessageLayout{1U, 2U});
+    auto inPlaceQueueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> inPlaceQueue(inPlaceQueueData.get());
+    inPlaceQueue.setMessageLayout(MessageLayout{1U, 1U});
+    ASSERT_FALSE(sut.tryAddQueue(serializedQueueData.get(), 1U).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(inPlaceQueueData.get(), 1U).has_error());
+
+    EXPECT_THAT(serializedQueue.size(), Eq(0U));
+    EXPECT_THAT(inPlaceQueue.size(), Eq(1U));
+}
+
 } // namespace
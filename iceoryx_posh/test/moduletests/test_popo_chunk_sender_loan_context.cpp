@@ -0,0 +1,268 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_sender.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_sender_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iox/bump_allocator.hpp"
+
+#include "test.hpp"
+
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+
+using iox::popo::ChunkSenderLoanContext;
+using iox::popo::UniquePortId;
+
+class ChunkSenderLoanContext_test : public Test
+{
+  protected:
+    ChunkSenderLoanContext_test()
+    {
+        m_mempoolconf.addMemPool({SMALL_CHUNK, NUM_CHUNKS_IN_POOL});
+        m_mempoolconf.addMemPool({BIG_CHUNK, NUM_CHUNKS_IN_POOL});
+        m_memoryManager.configureMemoryManager(m_mempoolconf, m_memoryAllocator, m_memoryAllocator);
+    }
+
+    ChunkSenderLoanContext acquireLoanContext()
+    {
+        auto loanContextResult = m_sut.tryAcquireLoanContext();
+        EXPECT_FALSE(loanContextResult.has_error());
+        return loanContextResult.has_error() ? ChunkSenderLoanContext() : loanContextResult.value();
+    }
+
+    std::vector<iox::mepoo::ChunkHeader*> allocateSample(ChunkSenderLoanContext& loanContext,
+                                                         const std::vector<uint64_t>& userPayloadSizes)
+    {
+        std::vector<iox::mepoo::ChunkHeader*> chunkHeaders;
+        for (auto userPayloadSize : userPayloadSizes)
+        {
+            m_sut
+                .tryAllocate(loanContext,
+                             UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                             userPayloadSize,
+                             iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
+                             iox::CHUNK_NO_USER_HEADER_SIZE,
+                             iox::CHUNK_NO_USER_HEADER_ALIGNMENT)
+                .and_then([&](auto chunkHeader) { chunkHeaders.push_back(chunkHeader); })
+                .or_else([](auto error) { ADD_FAILURE() << "Allocation failed with " << error; });
+        }
+        return chunkHeaders;
+    }
+
+    uint32_t usedChunks() const
+    {
+        return m_memoryManager.getMemPoolInfo(0U).m_usedChunks + m_memoryManager.getMemPoolInfo(1U).m_usedChunks;
+    }
+
+    static constexpr size_t MEMORY_SIZE = 4 * 1024 * 1024;
+    std::unique_ptr<uint8_t[]> m_memory{new uint8_t[MEMORY_SIZE]};
+    static constexpr uint32_t NUM_CHUNKS_IN_POOL = 200;
+    static constexpr uint64_t SMALL_CHUNK = 128;
+    static constexpr uint64_t BIG_CHUNK = 256;
+    static constexpr uint64_t SMALL_PAYLOAD = 100;
+    static constexpr uint64_t BIG_PAYLOAD = 200;
+    static constexpr uint32_t MAX_NUMBER_QUEUES = 128;
+
+    iox::BumpAllocator m_memoryAllocator{m_memory.get(), MEMORY_SIZE};
+    iox::mepoo::MePooConfig m_mempoolconf;
+    iox::mepoo::MemoryManager m_memoryManager;
+
+    struct ChunkDistributorConfig
+    {
+        static constexpr uint32_t MAX_QUEUES = MAX_NUMBER_QUEUES;
+        static constexpr uint64_t MAX_HISTORY_CAPACITY = iox::MAX_PUBLISHER_HISTORY;
+    };
+
+    struct ChunkQueueConfig
+    {
+        static constexpr uint64_t MAX_QUEUE_CAPACITY = NUM_CHUNKS_IN_POOL;
+    };
+
+    using ChunkQueueData_t = iox::popo::ChunkQueueData<ChunkQueueConfig, iox::popo::ThreadSafePolicy>;
+    using ChunkDistributorData_t = iox::popo::ChunkDistributorData<ChunkDistributorConfig,
+                                                                   iox::popo::ThreadSafePolicy,
+                                                                   iox::popo::ChunkQueuePusher<ChunkQueueData_t>>;
+    using ChunkSenderData_t =
+        iox::popo::ChunkSenderData<iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY, ChunkDistributorData_t>;
+
+    ChunkQueueData_t m_chunkQueueData{iox::popo::QueueFullPolicy::DISCARD_OLDEST_DATA,
+                                      iox::popo::VariantQueueTypes::FiFo_SingleProducerSingleConsumer};
+    ChunkSenderData_t m_chunkSenderData{&m_memoryManager, iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, 0U};
+    iox::popo::ChunkSender<ChunkSenderData_t> m_sut{&m_chunkSenderData};
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> m_queue{&m_chunkQueueData};
+};
+
+TEST_F(ChunkSenderLoanContext_test, AcquiringMoreLoanContextsThanAvailableFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2e7c4a91-d8b3-4f6e-a150-93c7d2e8f4b1");
+    std::vector<ChunkSenderLoanContext> loanContexts;
+    for (uint32_t i = 0U; i < iox::MAX_LOAN_CONTEXTS_PER_PUBLISHER; ++i)
+    {
+        loanContexts.push_back(acquireLoanContext());
+    }
+
+    auto loanContextResult = m_sut.tryAcquireLoanContext();
+    ASSERT_TRUE(loanContextResult.has_error());
+    EXPECT_THAT(loanContextResult.error(), Eq(iox::popo::AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL));
+
+    m_sut.releaseLoanContext(loanContexts.front());
+    EXPECT_FALSE(m_sut.tryAcquireLoanContext().has_error());
+}
+
+TEST_F(ChunkSenderLoanContext_test, ChunksAllocatedInALoanContextAreSentAsOneSample)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8b1f5d37-6e2a-4c90-b4d8-1a7e3f9c2b56");
+    ASSERT_FALSE(m_sut.tryAddQueue(&m_chunkQueueData).has_error());
+    auto loanContext = acquireLoanContext();
+    auto chunkHeaders = allocateSample(loanContext, {SMALL_PAYLOAD, BIG_PAYLOAD, SMALL_PAYLOAD});
+
+    EXPECT_THAT(m_sut.send(loanContext), Eq(1U));
+
+    auto sample = m_queue.tryPop();
+    ASSERT_TRUE(sample.has_value());
+    EXPECT_THAT(sample->getChunkHeaders(), ElementsAreArray(chunkHeaders));
+}
+
+TEST_F(ChunkSenderLoanContext_test, LoanContextCanAssembleTheNextSampleAfterSending)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f3a9c6e1-47b2-4d85-9e0c-5b2d8a1f7c39");
+    ASSERT_FALSE(m_sut.tryAddQueue(&m_chunkQueueData).has_error());
+    auto loanContext = acquireLoanContext();
+    allocateSample(loanContext, {SMALL_PAYLOAD, BIG_PAYLOAD});
+    m_sut.send(loanContext);
+
+    auto chunkHeaders = allocateSample(loanContext, {BIG_PAYLOAD});
+    m_sut.send(loanContext);
+
+    ASSERT_TRUE(m_queue.tryPop().has_value());
+    auto sample = m_queue.tryPop();
+    ASSERT_TRUE(sample.has_value());
+    EXPECT_THAT(sample->getChunkHeaders(), ElementsAreArray(chunkHeaders));
+}
+
+TEST_F(ChunkSenderLoanContext_test, ReleasingTheSampleOfALoanContextFreesAllItsChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "64d0b8e2-1c7f-4a39-85e6-d2f9a3b7c410");
+    auto loanContext = acquireLoanContext();
+    allocateSample(loanContext, {SMALL_PAYLOAD, BIG_PAYLOAD, BIG_PAYLOAD});
+    ASSERT_THAT(usedChunks(), Eq(3U));
+
+    m_sut.release(loanContext);
+
+    EXPECT_THAT(usedChunks(), Eq(0U));
+}
+
+TEST_F(ChunkSenderLoanContext_test, ReleasingTheLoanContextFreesItsPendingSample)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b72e3f18-9a5d-4c06-a8e1-3f7c5d9b2e60");
+    auto loanContext = acquireLoanContext();
+    allocateSample(loanContext, {SMALL_PAYLOAD, BIG_PAYLOAD});
+
+    m_sut.releaseLoanContext(loanContext);
+
+    EXPECT_THAT(usedChunks(), Eq(0U));
+    EXPECT_THAT(loanContext.m_index, Eq(ChunkSenderLoanContext::INVALID_INDEX));
+}
+
+TEST_F(ChunkSenderLoanContext_test, LoanContextsDoNotInterfereWithTheRegularAllocation)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0e5a7c93-b2f4-4d18-96c3-a8e1d7f5b2c4");
+    ASSERT_FALSE(m_sut.tryAddQueue(&m_chunkQueueData).has_error());
+    auto loanContext = acquireLoanContext();
+
+    auto regularChunkHeader = m_sut.tryAllocate(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                                SMALL_PAYLOAD,
+                                                iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
+                                                iox::CHUNK_NO_USER_HEADER_SIZE,
+                                                iox::CHUNK_NO_USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(regularChunkHeader.has_error());
+    auto loanContextChunkHeaders = allocateSample(loanContext, {SMALL_PAYLOAD, BIG_PAYLOAD});
+    std::vector<iox::mepoo::ChunkHeader*> regularChunkHeaders{regularChunkHeader.value()};
+
+    m_sut.send(loanContext);
+    m_sut.send(regularChunkHeaders.front());
+    m_sut.resetChunkManagementManagement();
+
+    auto loanContextSample = m_queue.tryPop();
+    auto regularSample = m_queue.tryPop();
+    ASSERT_TRUE(loanContextSample.has_value());
+    ASSERT_TRUE(regularSample.has_value());
+    EXPECT_THAT(loanContextSample->getChunkHeaders(), ElementsAreArray(loanContextChunkHeaders));
+    EXPECT_THAT(regularSample->getChunkHeaders(), ElementsAreArray(regularChunkHeaders));
+}
+
+TEST_F(ChunkSenderLoanContext_test, ReleaseAllFreesTheSamplesOfAllLoanContexts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d49b2e76-3a1c-4f85-b0d7-6e8c2a5f9b13");
+    auto loanContext1 = acquireLoanContext();
+    auto loanContext2 = acquireLoanContext();
+    allocateSample(loanContext1, {SMALL_PAYLOAD, BIG_PAYLOAD});
+    allocateSample(loanContext2, {BIG_PAYLOAD});
+    ASSERT_THAT(usedChunks(), Eq(3U));
+
+    m_sut.releaseAll();
+
+    EXPECT_THAT(usedChunks(), Eq(0U));
+}
+
+TEST_F(ChunkSenderLoanContext_test, SamplesAssembledConcurrentlyOnDifferentThreadsAreAllDelivered)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7a3e9d15-c0b6-4e24-8f91-2d5b7c3a6e08");
+    constexpr uint32_t NUMBER_OF_THREADS{4U};
+    constexpr uint32_t SAMPLES_PER_THREAD{20U};
+    ASSERT_FALSE(m_sut.tryAddQueue(&m_chunkQueueData).has_error());
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0U; t < NUMBER_OF_THREADS; ++t)
+    {
+        threads.emplace_back([&] {
+            auto loanContext = acquireLoanContext();
+            for (uint32_t i = 0U; i < SAMPLES_PER_THREAD; ++i)
+            {
+                allocateSample(loanContext, {SMALL_PAYLOAD, BIG_PAYLOAD});
+                m_sut.send(loanContext);
+            }
+            m_sut.releaseLoanContext(loanContext);
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    std::set<uint64_t> sequenceNumbers;
+    for (auto sample = m_queue.tryPop(); sample.has_value(); sample = m_queue.tryPop())
+    {
+        EXPECT_THAT(sample->getChunkHeaders().size(), Eq(2U));
+        sequenceNumbers.insert(sample->getChunkHeader()->sequenceNumber());
+    }
+    EXPECT_THAT(sequenceNumbers.size(), Eq(NUMBER_OF_THREADS * SAMPLES_PER_THREAD));
+}
+
+} // namespace
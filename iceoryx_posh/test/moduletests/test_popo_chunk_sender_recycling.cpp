@@ -0,0 +1,209 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_sender.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_sender_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iox/bump_allocator.hpp"
+
+#include "test.hpp"
+
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+
+using iox::popo::UniquePortId;
+
+class ChunkSenderRecycling_test : public Test
+{
+  protected:
+    ChunkSenderRecycling_test()
+    {
+        m_mempoolconf.addMemPool({SMALL_CHUNK, NUM_CHUNKS_IN_POOL});
+        m_mempoolconf.addMemPool({BIG_CHUNK, NUM_CHUNKS_IN_POOL});
+        m_memoryManager.configureMemoryManager(m_mempoolconf, m_memoryAllocator, m_memoryAllocator);
+    }
+
+    void recreateSut(const uint64_t historyCapacity, const bool recycleAllChunks)
+    {
+        m_chunkSenderData.~ChunkSenderData_t();
+        new (&m_chunkSenderData) ChunkSenderData_t{&m_memoryManager,
+                                                   iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA,
+                                                   historyCapacity,
+                                                   iox::mepoo::MemoryInfo(),
+                                                   recycleAllChunks};
+    }
+
+    std::vector<iox::mepoo::ChunkHeader*> allocateSample(const std::vector<uint64_t>& userPayloadSizes)
+    {
+        std::vector<iox::mepoo::ChunkHeader*> chunkHeaders;
+        for (auto userPayloadSize : userPayloadSizes)
+        {
+            m_sut.tryAllocate(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                              userPayloadSize,
+                              iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
+                              iox::CHUNK_NO_USER_HEADER_SIZE,
+                              iox::CHUNK_NO_USER_HEADER_ALIGNMENT)
+                .and_then([&](auto chunkHeader) { chunkHeaders.push_back(chunkHeader); })
+                .or_else([](auto error) { GTEST_FAIL() << "Allocation failed with " << error; });
+        }
+        return chunkHeaders;
+    }
+
+    void sendSample(std::vector<iox::mepoo::ChunkHeader*> chunkHeaders)
+    {
+        m_sut.send(chunkHeaders.front());
+        m_sut.resetChunkManagementManagement();
+    }
+
+    uint32_t usedChunks() const
+    {
+        return m_memoryManager.getMemPoolInfo(0U).m_usedChunks + m_memoryManager.getMemPoolInfo(1U).m_usedChunks;
+    }
+
+    static constexpr size_t MEMORY_SIZE = 1024 * 1024;
+    uint8_t m_memory[MEMORY_SIZE];
+    static constexpr uint32_t NUM_CHUNKS_IN_POOL = 20;
+    static constexpr uint64_t SMALL_CHUNK = 128;
+    static constexpr uint64_t BIG_CHUNK = 256;
+    static constexpr uint64_t SMALL_PAYLOAD = 100;
+    static constexpr uint64_t BIG_PAYLOAD = 200;
+    static constexpr uint32_t MAX_NUMBER_QUEUES = 128;
+
+    iox::BumpAllocator m_memoryAllocator{m_memory, MEMORY_SIZE};
+    iox::mepoo::MePooConfig m_mempoolconf;
+    iox::mepoo::MemoryManager m_memoryManager;
+
+    struct ChunkDistributorConfig
+    {
+        static constexpr uint32_t MAX_QUEUES = MAX_NUMBER_QUEUES;
+        static constexpr uint64_t MAX_HISTORY_CAPACITY = iox::MAX_PUBLISHER_HISTORY;
+    };
+
+    struct ChunkQueueConfig
+    {
+        static constexpr uint64_t MAX_QUEUE_CAPACITY = NUM_CHUNKS_IN_POOL;
+    };
+
+    using ChunkQueueData_t = iox::popo::ChunkQueueData<ChunkQueueConfig, iox::popo::ThreadSafePolicy>;
+    using ChunkDistributorData_t = iox::popo::ChunkDistributorData<ChunkDistributorConfig,
+                                                                   iox::popo::ThreadSafePolicy,
+                                                                   iox::popo::ChunkQueuePusher<ChunkQueueData_t>>;
+    using ChunkSenderData_t =
+        iox::popo::ChunkSenderData<iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY, ChunkDistributorData_t>;
+
+    ChunkSenderData_t m_chunkSenderData{&m_memoryManager,
+                                        iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA,
+                                        0U,
+                                        iox::mepoo::MemoryInfo(),
+                                        true};
+    iox::popo::ChunkSender<ChunkSenderData_t> m_sut{&m_chunkSenderData};
+};
+
+TEST_F(ChunkSenderRecycling_test, AllChunksOfReleasedPreviousSampleAreReused)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3f2a6c81-9b4d-4e07-a5c2-1d8e7f3b6a01");
+    auto previousSample = allocateSample({SMALL_PAYLOAD, SMALL_PAYLOAD, BIG_PAYLOAD});
+    sendSample(previousSample);
+    const auto usedChunksAfterFirstSample = usedChunks();
+
+    auto recycledSample = allocateSample({SMALL_PAYLOAD, SMALL_PAYLOAD, BIG_PAYLOAD});
+
+    EXPECT_THAT(recycledSample, ContainerEq(previousSample));
+    EXPECT_THAT(usedChunks(), Eq(usedChunksAfterFirstSample));
+
+    sendSample(recycledSample);
+    EXPECT_THAT(usedChunks(), Eq(usedChunksAfterFirstSample));
+}
+
+TEST_F(ChunkSenderRecycling_test, ChunksOfPreviousSampleWhichAreNotReusedAreFreedOnSend)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b71e4d09-2c5a-4f83-9e16-7a0d3c5b8e02");
+    sendSample(allocateSample({SMALL_PAYLOAD, SMALL_PAYLOAD, SMALL_PAYLOAD}));
+
+    auto recycledSample = allocateSample({SMALL_PAYLOAD});
+    sendSample(recycledSample);
+
+    EXPECT_THAT(usedChunks(), Eq(1U));
+}
+
+TEST_F(ChunkSenderRecycling_test, ChunkWhichDoesNotFitEndsRecyclingOfFollowingChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5d8c3a17-6e2f-4b90-81d4-9c7e2a4f1b03");
+    auto previousSample = allocateSample({SMALL_PAYLOAD, SMALL_PAYLOAD, SMALL_PAYLOAD});
+    sendSample(previousSample);
+
+    auto sample = allocateSample({SMALL_PAYLOAD, BIG_PAYLOAD, SMALL_PAYLOAD});
+
+    ASSERT_THAT(sample.size(), Eq(3U));
+    EXPECT_THAT(sample[0], Eq(previousSample[0]));
+    EXPECT_THAT(sample[1], Ne(previousSample[1]));
+
+    sendSample(sample);
+    EXPECT_THAT(usedChunks(), Eq(3U));
+}
+
+TEST_F(ChunkSenderRecycling_test, SampleStillHeldByOthersIsNotReused)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e9a4b2c6-0f7d-4a31-b8e5-2d6f1c9a7e04");
+    recreateSut(1U, true);
+    auto previousSample = allocateSample({SMALL_PAYLOAD, SMALL_PAYLOAD});
+    sendSample(previousSample);
+
+    auto sample = allocateSample({SMALL_PAYLOAD, SMALL_PAYLOAD});
+
+    EXPECT_THAT(sample[0], Ne(previousSample[0]));
+    EXPECT_THAT(sample[1], Ne(previousSample[1]));
+    EXPECT_THAT(usedChunks(), Eq(4U));
+}
+
+TEST_F(ChunkSenderRecycling_test, WithoutRecyclingOnlyTheFirstChunkIsReused)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1c6f8e3a-4b92-4d75-a0c8-6e3b9d2f5a05");
+    recreateSut(0U, false);
+    auto previousSample = allocateSample({SMALL_PAYLOAD, SMALL_PAYLOAD, SMALL_PAYLOAD});
+    sendSample(previousSample);
+
+    auto sample = allocateSample({SMALL_PAYLOAD, SMALL_PAYLOAD, SMALL_PAYLOAD});
+
+    ASSERT_THAT(sample.size(), Eq(3U));
+    EXPECT_THAT(sample[0], Eq(previousSample[0]));
+
+    sendSample(sample);
+    EXPECT_THAT(usedChunks(), Eq(3U));
+}
+
+TEST_F(ChunkSenderRecycling_test, ReleasingARecycledSampleFreesAllItsChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7a3d5f90-8c1e-4b26-9f47-3e8a0b6c2d06");
+    sendSample(allocateSample({SMALL_PAYLOAD, SMALL_PAYLOAD, SMALL_PAYLOAD}));
+
+    auto sample = allocateSample({SMALL_PAYLOAD, SMALL_PAYLOAD});
+    m_sut.release(sample.front());
+    m_sut.resetChunkManagementManagement();
+
+    EXPECT_THAT(usedChunks(), Eq(0U));
+}
+
+} // namespace
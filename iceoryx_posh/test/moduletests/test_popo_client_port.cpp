@@ -140,7 +140,7 @@ class ClientPort_test : public Test
         return m_memoryManager.getMemPoolInfo(0U).m_usedChunks;
     }
 
-    iox::mepoo::SharedChunk getChunkFromMemoryManager(uint64_t userPayloadSize, uint32_t userHeaderSize)
+    iox::mepoo::SharedMultiChunk getChunkFromMemoryManager(uint64_t userPayloadSize, uint32_t userHeaderSize)
     {
         auto chunkSettings = iox::mepoo::ChunkSettings::create(userPayloadSize,
                                                                iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
@@ -148,7 +148,11 @@ class ClientPort_test : public Test
                                                                iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT)
                                  .expect("Valid 'ChunkSettings'");
 
-        return m_memoryManager.getChunk(chunkSettings).expect("Obtaining chunk");
+        auto chunkManagementManagement = m_memoryManager.getMultiChunk();
+        IOX_ENFORCE(chunkManagementManagement != nullptr, "Obtaining multi chunk");
+        chunkManagementManagement->addChunkManagement(
+            m_memoryManager.getChunk(chunkSettings).expect("Obtaining chunk").release());
+        return iox::mepoo::SharedMultiChunk(chunkManagementManagement);
     }
 
     /// @return true if all pushes succeed, false if a push failed and a chunk was lost
@@ -417,7 +421,7 @@ TEST_F(ClientPort_test, ReleaseResponseWithValidResponseReleasesChunkToTheMempoo
 
     constexpr uint64_t USER_PAYLOAD_SIZE{10};
 
-    iox::optional<iox::mepoo::SharedChunk> sharedChunk{
+    iox::optional<iox::mepoo::SharedMultiChunk> sharedChunk{
         getChunkFromMemoryManager(USER_PAYLOAD_SIZE, sizeof(ResponseHeader))};
     sut.responseQueuePusher.push(sharedChunk.value());
     sharedChunk.reset();
@@ -444,7 +448,7 @@ TEST_F(ClientPort_test, ReleaseQueuedResponsesReleasesAllChunksToTheMempool)
 
     for (uint32_t i = 0; i < NUMBER_OF_QUEUED_RESPONSES; ++i)
     {
-        iox::optional<iox::mepoo::SharedChunk> sharedChunk{
+        iox::optional<iox::mepoo::SharedMultiChunk> sharedChunk{
             getChunkFromMemoryManager(USER_PAYLOAD_SIZE, sizeof(ResponseHeader))};
         sut.responseQueuePusher.push(sharedChunk.value());
         sharedChunk.reset();
@@ -0,0 +1,427 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/ports/client_port_data.hpp"
+#include "iceoryx_posh/internal/popo/ports/client_port_roudi.hpp"
+#include "iceoryx_posh/internal/popo/ports/client_port_user.hpp"
+#include "iceoryx_posh/internal/popo/ports/server_port_data.hpp"
+#include "iceoryx_posh/internal/popo/ports/server_port_roudi.hpp"
+#include "iceoryx_posh/internal/popo/ports/server_port_user.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_posh/popo/client.hpp"
+#include "iceoryx_posh/popo/server.hpp"
+#include "iceoryx_posh/popo/untyped_client.hpp"
+#include "iceoryx_posh/popo/untyped_server.hpp"
+#include "iox/bump_allocator.hpp"
+
+#include "test.hpp"
+
+#include <cstring>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::capro;
+using namespace iox::popo;
+
+struct DummyRequest
+{
+    uint64_t data{0U};
+};
+
+struct DummyResponse
+{
+    uint64_t data{0U};
+};
+
+/// @brief Stands in for the BaseClient and BaseServer to run the client and server implementations directly on ports
+/// which are connected like RouDi would connect them
+template <typename PortT>
+class PortOwner
+{
+  public:
+    using PortType = PortT;
+
+    explicit PortOwner(PortT&& port) noexcept
+        : m_port(std::move(port))
+    {
+    }
+
+    PortT& port() noexcept
+    {
+        return m_port;
+    }
+
+    const PortT& port() const noexcept
+    {
+        return m_port;
+    }
+
+    struct TriggerResetStub
+    {
+        void reset()
+        {
+        }
+    };
+    TriggerResetStub m_trigger;
+
+  private:
+    PortT m_port;
+};
+
+template <typename Base>
+class PortTestWrapper : public Base
+{
+  public:
+    template <typename PortDataT>
+    explicit PortTestWrapper(PortDataT& portData)
+        : Base(typename Base::PortType(portData))
+    {
+    }
+};
+
+using TestClient = PortTestWrapper<ClientImpl<DummyRequest, DummyResponse, PortOwner<ClientPortUser>>>;
+using TestServer = PortTestWrapper<ServerImpl<DummyRequest, DummyResponse, PortOwner<ServerPortUser>>>;
+using TestUntypedClient = PortTestWrapper<UntypedClientImpl<PortOwner<ClientPortUser>>>;
+using TestUntypedServer = PortTestWrapper<UntypedServerImpl<PortOwner<ServerPortUser>>>;
+
+class ClientServerArena_test : public Test
+{
+  public:
+    ClientServerArena_test()
+    {
+        iox::mepoo::MePooConfig mempoolconf;
+        mempoolconf.addMemPool({CHUNK_SIZE, NUM_CHUNKS});
+        m_memoryManager.configureMemoryManager(mempoolconf, m_memoryAllocator, m_memoryAllocator);
+    }
+
+    void SetUp() override
+    {
+        // this is basically what RouDi does when a server is offered and a client connects to it
+        IOX_DISCARD_RESULT(serverPortRouDi.tryGetCaProMessage());
+        auto connectMessage = clientPortRouDi.tryGetCaProMessage();
+        ASSERT_TRUE(connectMessage.has_value());
+        auto ackMessage = serverPortRouDi.dispatchCaProMessageAndGetPossibleResponse(connectMessage.value());
+        ASSERT_TRUE(ackMessage.has_value());
+        ASSERT_THAT(ackMessage->m_type, Eq(CaproMessageType::ACK));
+        IOX_DISCARD_RESULT(clientPortRouDi.dispatchCaProMessageAndGetPossibleResponse(ackMessage.value()));
+        ASSERT_THAT(clientPortData.m_connectionState.load(), Eq(iox::ConnectionState::CONNECTED));
+    }
+
+    uint32_t getNumberOfUsedChunks() const
+    {
+        return m_memoryManager.getMemPoolInfo(0U).m_usedChunks;
+    }
+
+    /// @brief Loans blocks like an arena and places the message in the block with the given index, behind some
+    /// bookkeeping of the arena
+    template <typename T, typename LoanBlock>
+    T* buildMessageOnBlocks(const uint32_t numberOfBlocks,
+                            const uint32_t blockIndexOfMessage,
+                            const uint64_t data,
+                            LoanBlock&& loanBlock)
+    {
+        T* message{nullptr};
+        for (uint32_t i = 0U; i < numberOfBlocks; ++i)
+        {
+            size_t actualSize{0U};
+            auto* block = static_cast<uint8_t*>(loanBlock(BLOCK_SIZE, actualSize));
+            EXPECT_THAT(block, Ne(nullptr));
+            EXPECT_THAT(actualSize, Ge(BLOCK_SIZE));
+            if (block == nullptr)
+            {
+                return nullptr;
+            }
+            blocks.push_back(block);
+            if (i == blockIndexOfMessage)
+            {
+                message = new (block + ARENA_BOOKKEEPING_SIZE) T();
+                message->data = data;
+            }
+        }
+        return message;
+    }
+
+    static constexpr size_t BLOCK_SIZE{64U};
+    static constexpr size_t ARENA_BOOKKEEPING_SIZE{16U};
+    static constexpr uint64_t REQUEST_DATA{42U};
+    static constexpr uint64_t RESPONSE_DATA{73U};
+    static constexpr int64_t SEQUENCE_ID{1337};
+
+    std::vector<void*> blocks;
+
+  private:
+    static constexpr uint32_t NUM_CHUNKS{32U};
+    static constexpr uint64_t CHUNK_SIZE{256U};
+    static constexpr size_t MEMORY_SIZE{1024U * 1024U};
+    uint8_t m_memory[MEMORY_SIZE];
+    iox::BumpAllocator m_memoryAllocator{m_memory, MEMORY_SIZE};
+    iox::mepoo::MemoryManager m_memoryManager;
+
+    ServiceDescription m_serviceDescription{"ice", "cream", "parlor"};
+    iox::RuntimeName_t m_runtimeName{"scoop"};
+
+    ClientOptions m_clientOptions = [] {
+        ClientOptions options;
+        options.connectOnCreate = true;
+        return options;
+    }();
+    ServerOptions m_serverOptions = [] {
+        ServerOptions options;
+        options.offerOnCreate = true;
+        return options;
+    }();
+
+  public:
+    ClientPortData clientPortData{
+        m_serviceDescription, m_runtimeName, iox::roudi::DEFAULT_UNIQUE_ROUDI_ID, m_clientOptions, &m_memoryManager};
+    ClientPortRouDi clientPortRouDi{clientPortData};
+    ServerPortData serverPortData{
+        m_serviceDescription, m_runtimeName, iox::roudi::DEFAULT_UNIQUE_ROUDI_ID, m_serverOptions, &m_memoryManager};
+    ServerPortRouDi serverPortRouDi{serverPortData};
+};
+
+constexpr size_t ClientServerArena_test::BLOCK_SIZE;
+constexpr size_t ClientServerArena_test::ARENA_BOOKKEEPING_SIZE;
+constexpr uint64_t ClientServerArena_test::REQUEST_DATA;
+constexpr uint64_t ClientServerArena_test::RESPONSE_DATA;
+constexpr int64_t ClientServerArena_test::SEQUENCE_ID;
+
+TEST_F(ClientServerArena_test, LoanedRequestIsReceivedByServer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ae319979-1d16-490d-8965-98498c8cb647");
+    TestClient client{clientPortData};
+    TestServer server{serverPortData};
+
+    client.loan()
+        .and_then([&](auto& request) {
+            request->data = REQUEST_DATA;
+            EXPECT_FALSE(request.send().has_error());
+        })
+        .or_else([](auto& error) { GTEST_FAIL() << "Expected request but got error: " << error; });
+
+    server.take()
+        .and_then([&](auto& request) { EXPECT_THAT(request->data, Eq(REQUEST_DATA)); })
+        .or_else([](auto& error) { GTEST_FAIL() << "Expected request but got error: " << error; });
+
+    // the client keeps its last request for recycling
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(1U));
+    clientPortRouDi.releaseAllChunks();
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(0U));
+}
+
+TEST_F(ClientServerArena_test, RequestBuiltOnSeveralArenaBlocksIsReceivedWithAllChunksByServer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3a183d67-8a38-41ea-bfc7-61202459a0e5");
+    TestClient client{clientPortData};
+    TestServer server{serverPortData};
+
+    constexpr uint32_t NUMBER_OF_BLOCKS{3U};
+    auto* message = buildMessageOnBlocks<DummyRequest>(
+        NUMBER_OF_BLOCKS, 1U, REQUEST_DATA, [&](size_t size, size_t& actualSize) {
+            return client.loanBlock(size, actualSize);
+        });
+    ASSERT_THAT(message, Ne(nullptr));
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(NUMBER_OF_BLOCKS));
+
+    auto requestResult = client.getRequest(message);
+    ASSERT_FALSE(requestResult.has_error());
+    auto& request = requestResult.value();
+    EXPECT_THAT(request.getChunkHeader(), Eq(iox::mepoo::ChunkHeader::fromUserPayload(blocks.front())));
+    request.getRequestHeader().setSequenceId(SEQUENCE_ID);
+    ASSERT_FALSE(request.send().has_error());
+
+    auto receivedRequest = server.take();
+    ASSERT_FALSE(receivedRequest.has_error());
+    EXPECT_THAT(receivedRequest->get(), Eq(message));
+    EXPECT_THAT(receivedRequest.value()->data, Eq(REQUEST_DATA));
+    EXPECT_THAT(receivedRequest->getRequestHeader().getSequenceId(), Eq(SEQUENCE_ID));
+    EXPECT_THAT(receivedRequest->getChunkHeader(), Eq(iox::mepoo::ChunkHeader::fromUserPayload(blocks.front())));
+
+    // the blocks of the sent request are owned by the received request
+    for (auto* block : blocks)
+    {
+        client.releaseBlock(block);
+    }
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(NUMBER_OF_BLOCKS));
+
+    receivedRequest = iox::err(ServerRequestResult::NO_PENDING_REQUESTS);
+    // the client keeps its last request with all its chunks for recycling
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(NUMBER_OF_BLOCKS));
+    clientPortRouDi.releaseAllChunks();
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(0U));
+}
+
+TEST_F(ClientServerArena_test, ResponseBuiltOnSeveralArenaBlocksIsReceivedWithAllChunksByClient)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a3e58a93-81a1-454e-986e-3ab8ff61c299");
+    TestClient client{clientPortData};
+    TestServer server{serverPortData};
+
+    client.loan()
+        .and_then([&](auto& request) {
+            request.getRequestHeader().setSequenceId(SEQUENCE_ID);
+            EXPECT_FALSE(request.send().has_error());
+        })
+        .or_else([](auto& error) { GTEST_FAIL() << "Expected request but got error: " << error; });
+
+    auto receivedRequest = server.take();
+    ASSERT_FALSE(receivedRequest.has_error());
+
+    constexpr uint32_t NUMBER_OF_BLOCKS{2U};
+    auto* message = buildMessageOnBlocks<DummyResponse>(
+        NUMBER_OF_BLOCKS, 1U, RESPONSE_DATA, [&](size_t size, size_t& actualSize) {
+            return server.loanBlock(receivedRequest.value(), size, actualSize);
+        });
+    ASSERT_THAT(message, Ne(nullptr));
+
+    auto responseResult = server.getResponse(message);
+    ASSERT_FALSE(responseResult.has_error());
+    ASSERT_FALSE(responseResult->send().has_error());
+    receivedRequest = iox::err(ServerRequestResult::NO_PENDING_REQUESTS);
+    // the client and the server keep their last request and response for recycling
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(1U + NUMBER_OF_BLOCKS));
+
+    auto receivedResponse = client.take();
+    ASSERT_FALSE(receivedResponse.has_error());
+    EXPECT_THAT(receivedResponse->get(), Eq(message));
+    EXPECT_THAT(receivedResponse.value()->data, Eq(RESPONSE_DATA));
+    EXPECT_THAT(receivedResponse->getResponseHeader().getSequenceId(), Eq(SEQUENCE_ID));
+
+    receivedResponse = iox::err(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(1U + NUMBER_OF_BLOCKS));
+    serverPortRouDi.releaseAllChunks();
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(1U));
+}
+
+TEST_F(ClientServerArena_test, ReleasingAllBlocksOfUnsentArenaRequestReturnsAllChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fa983128-5d63-4096-8b15-230c74b894e8");
+    TestClient client{clientPortData};
+
+    constexpr uint32_t NUMBER_OF_BLOCKS{3U};
+    auto* message = buildMessageOnBlocks<DummyRequest>(
+        NUMBER_OF_BLOCKS, 0U, REQUEST_DATA, [&](size_t size, size_t& actualSize) {
+            return client.loanBlock(size, actualSize);
+        });
+    ASSERT_THAT(message, Ne(nullptr));
+
+    for (uint32_t i = 0U; i < NUMBER_OF_BLOCKS; ++i)
+    {
+        EXPECT_THAT(getNumberOfUsedChunks(), Eq(NUMBER_OF_BLOCKS));
+        client.releaseBlock(blocks[i]);
+    }
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(0U));
+
+    // the next loan starts a new request
+    blocks.clear();
+    ASSERT_THAT(buildMessageOnBlocks<DummyRequest>(
+                    1U, 0U, REQUEST_DATA, [&](size_t size, size_t& actualSize) { return client.loanBlock(size, actualSize); }),
+                Ne(nullptr));
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(1U));
+}
+
+TEST_F(ClientServerArena_test, PlainRequestSentWhileArenaRequestIsPendingDoesNotTakeArenaBlocksAlong)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "399b0697-e9aa-4e99-bb5f-23bfe35b766e");
+    TestClient client{clientPortData};
+    TestServer server{serverPortData};
+
+    constexpr uint32_t NUMBER_OF_BLOCKS{3U};
+    auto loanBlock = [&](size_t size, size_t& actualSize) { return client.loanBlock(size, actualSize); };
+    auto* message = buildMessageOnBlocks<DummyRequest>(NUMBER_OF_BLOCKS - 1U, 0U, REQUEST_DATA, loanBlock);
+    ASSERT_THAT(message, Ne(nullptr));
+
+    client.loan()
+        .and_then([&](auto& request) {
+            request->data = REQUEST_DATA + 1U;
+            EXPECT_FALSE(request.send().has_error());
+        })
+        .or_else([](auto& error) { GTEST_FAIL() << "Expected request but got error: " << error; });
+
+    // the pending arena request continues with the next block
+    ASSERT_THAT(buildMessageOnBlocks<DummyRequest>(1U, 0U, 0U, loanBlock), Ne(nullptr));
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(NUMBER_OF_BLOCKS + 1U));
+
+    auto requestResult = client.getRequest(message);
+    ASSERT_FALSE(requestResult.has_error());
+    EXPECT_THAT(requestResult->getChunkHeader(), Eq(iox::mepoo::ChunkHeader::fromUserPayload(blocks.front())));
+    ASSERT_FALSE(requestResult->send().has_error());
+
+    server.take()
+        .and_then([&](auto& request) { EXPECT_THAT(request->data, Eq(REQUEST_DATA + 1U)); })
+        .or_else([](auto& error) { GTEST_FAIL() << "Expected request but got error: " << error; });
+    // the plain request did not own any block of the arena request
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(NUMBER_OF_BLOCKS));
+
+    auto receivedRequest = server.take();
+    ASSERT_FALSE(receivedRequest.has_error());
+    EXPECT_THAT(receivedRequest->get(), Eq(message));
+    EXPECT_THAT(receivedRequest.value()->data, Eq(REQUEST_DATA));
+
+    for (auto* block : blocks)
+    {
+        client.releaseBlock(block);
+    }
+    receivedRequest = iox::err(ServerRequestResult::NO_PENDING_REQUESTS);
+    // the client keeps its last request with all its chunks for recycling
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(NUMBER_OF_BLOCKS));
+    clientPortRouDi.releaseAllChunks();
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(0U));
+}
+
+TEST_F(ClientServerArena_test, UntypedClientSendsRootMessageOfArenaWhichUntypedServerLocatesViaFirstChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8ad0d1ad-aaaa-49ad-a498-e0c18308b70f");
+    TestUntypedClient client{clientPortData};
+    TestUntypedServer server{serverPortData};
+
+    constexpr uint32_t NUMBER_OF_BLOCKS{2U};
+    auto* message = buildMessageOnBlocks<DummyRequest>(
+        NUMBER_OF_BLOCKS, 1U, REQUEST_DATA, [&](size_t size, size_t& actualSize) {
+            return client.loanBlock(size, actualSize);
+        });
+    ASSERT_THAT(message, Ne(nullptr));
+    ASSERT_FALSE(client.send(message).has_error());
+
+    auto takeResult = server.take();
+    ASSERT_FALSE(takeResult.has_error());
+    EXPECT_THAT(takeResult.value(), Eq(blocks.front()));
+    const auto* chunkHeader = iox::mepoo::ChunkHeader::fromUserPayload(takeResult.value());
+    const auto* receivedMessage =
+        static_cast<const DummyRequest*>(iox::mepoo::protobufRootMessage<RequestHeader>(chunkHeader));
+    EXPECT_THAT(receivedMessage, Eq(message));
+    EXPECT_THAT(receivedMessage->data, Eq(REQUEST_DATA));
+
+    server.releaseRequest(takeResult.value());
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(NUMBER_OF_BLOCKS));
+    clientPortRouDi.releaseAllChunks();
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(0U));
+}
+
+TEST_F(ClientServerArena_test, ServerCannotWrapMessageIntoResponseWithoutLoanedBlocks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5d904213-1d3c-4773-a79e-51192fea53d3");
+    TestServer server{serverPortData};
+
+    DummyResponse message;
+    auto responseResult = server.getResponse(&message);
+    ASSERT_TRUE(responseResult.has_error());
+    EXPECT_THAT(responseResult.error(), Eq(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER));
+}
+
+} // namespace
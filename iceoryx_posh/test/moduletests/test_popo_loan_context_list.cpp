@@ -0,0 +1,203 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/loan_context_list.hpp"
+
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iox/bump_allocator.hpp"
+
+#include "test.hpp"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::mepoo;
+using namespace iox::popo;
+
+class LoanContextList_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        MePooConfig mempoolconf;
+        mempoolconf.addMemPool({CHUNK_SIZE, NUM_CHUNKS_IN_POOL});
+
+        iox::BumpAllocator memoryAllocator{m_memory.get(), MEMORY_SIZE};
+        memoryManager.configureMemoryManager(mempoolconf, memoryAllocator, memoryAllocator);
+    }
+
+    SharedMultiChunk getSampleFromMemoryManager(const uint32_t numberOfChunks)
+    {
+        constexpr uint64_t USER_PAYLOAD_SIZE{32U};
+        auto chunkSettings =
+            iox::mepoo::ChunkSettings::create(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT)
+                .expect("Valid 'ChunkSettings'");
+
+        auto chunkManagementManagement = memoryManager.getMultiChunk();
+        EXPECT_THAT(chunkManagementManagement, Ne(nullptr));
+        for (uint32_t i = 0U; i < numberOfChunks; ++i)
+        {
+            chunkManagementManagement->addChunkManagement(memoryManager.getChunk(chunkSettings).expect("Chunk").release());
+        }
+        return SharedMultiChunk(chunkManagementManagement);
+    }
+
+    uint32_t usedChunks() const
+    {
+        return memoryManager.getMemPoolInfo(0U).m_usedChunks;
+    }
+
+    static constexpr uint32_t NUM_CHUNKS_IN_POOL = 100U;
+    static constexpr uint64_t CHUNK_SIZE = 128U;
+    static constexpr uint32_t LOAN_CONTEXT_LIST_CAPACITY{4U};
+
+    MemoryManager memoryManager;
+    LoanContextList<LOAN_CONTEXT_LIST_CAPACITY> sut;
+
+  private:
+    static constexpr size_t MEGABYTE = 1U << 20U;
+    static constexpr size_t MEMORY_SIZE = 4U * MEGABYTE;
+    std::unique_ptr<char[]> m_memory{new char[MEMORY_SIZE]};
+};
+
+TEST_F(LoanContextList_test, AllEntriesCanBeAcquired)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5c1d7f3e-82a4-4b6e-9d07-3e6f1a2b8c45");
+    std::vector<uint32_t> indices;
+    uint32_t index{0U};
+    for (uint32_t i = 0U; i < LOAN_CONTEXT_LIST_CAPACITY; ++i)
+    {
+        ASSERT_TRUE(sut.acquire(index));
+        indices.push_back(index);
+    }
+
+    std::sort(indices.begin(), indices.end());
+    EXPECT_THAT(std::unique(indices.begin(), indices.end()), Eq(indices.end()));
+    EXPECT_FALSE(sut.acquire(index));
+}
+
+TEST_F(LoanContextList_test, ReleasedEntryCanBeAcquiredAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e8a2b4c6-1d3f-4a5b-8c7d-9e0f1a2b3c4d");
+    uint32_t index{0U};
+    for (uint32_t i = 0U; i < LOAN_CONTEXT_LIST_CAPACITY; ++i)
+    {
+        ASSERT_TRUE(sut.acquire(index));
+    }
+
+    sut.release(index);
+
+    uint32_t reacquiredIndex{0U};
+    ASSERT_TRUE(sut.acquire(reacquiredIndex));
+    EXPECT_THAT(reacquiredIndex, Eq(index));
+}
+
+TEST_F(LoanContextList_test, TakingFromAnEmptyEntryReturnsNoSample)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0b7e4d19-6c2a-4f83-a5e1-d2c3b4a59687");
+    uint32_t index{0U};
+    ASSERT_TRUE(sut.acquire(index));
+
+    EXPECT_FALSE(sut.take(index));
+}
+
+TEST_F(LoanContextList_test, StoredSampleCanBeTakenAgainWithAllItsChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a4f63c21-9b8e-47d5-b0c2-71e8d9f4a3b6");
+    uint32_t index{0U};
+    ASSERT_TRUE(sut.acquire(index));
+    auto sample = getSampleFromMemoryManager(3U);
+    const auto chunkHeaderView = sample.getChunkHeaders();
+    const std::vector<iox::mepoo::ChunkHeader*> chunkHeaders(chunkHeaderView.begin(), chunkHeaderView.end());
+
+    sut.store(index, std::move(sample));
+    auto takenSample = sut.take(index);
+
+    ASSERT_TRUE(takenSample);
+    EXPECT_THAT(takenSample.getChunkHeaders(), ElementsAreArray(chunkHeaders));
+    EXPECT_THAT(usedChunks(), Eq(3U));
+}
+
+TEST_F(LoanContextList_test, ReleasingAnEntryFreesTheStoredSample)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3d9f8e27-5a41-4c6b-9e83-f0a1b2c3d4e5");
+    uint32_t index{0U};
+    ASSERT_TRUE(sut.acquire(index));
+    sut.store(index, getSampleFromMemoryManager(2U));
+    ASSERT_THAT(usedChunks(), Eq(2U));
+
+    sut.release(index);
+
+    EXPECT_THAT(usedChunks(), Eq(0U));
+}
+
+TEST_F(LoanContextList_test, CleanupFreesAllStoredSamplesAndMakesAllEntriesAvailable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7f2e1d0c-b9a8-4765-8432-10fedcba9876");
+    uint32_t index{0U};
+    for (uint32_t i = 0U; i < LOAN_CONTEXT_LIST_CAPACITY; ++i)
+    {
+        ASSERT_TRUE(sut.acquire(index));
+        sut.store(index, getSampleFromMemoryManager(2U));
+    }
+    ASSERT_THAT(usedChunks(), Eq(2U * LOAN_CONTEXT_LIST_CAPACITY));
+
+    sut.cleanup();
+
+    EXPECT_THAT(usedChunks(), Eq(0U));
+    for (uint32_t i = 0U; i < LOAN_CONTEXT_LIST_CAPACITY; ++i)
+    {
+        EXPECT_TRUE(sut.acquire(index));
+    }
+}
+
+TEST_F(LoanContextList_test, ConcurrentlyUsedEntriesDoNotLoseChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c61b9a3e-2f4d-4e8a-b7c5-d9e0f1a2b3c7");
+    constexpr uint32_t NUMBER_OF_ITERATIONS{1000U};
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0U; t < LOAN_CONTEXT_LIST_CAPACITY; ++t)
+    {
+        threads.emplace_back([&] {
+            for (uint32_t i = 0U; i < NUMBER_OF_ITERATIONS; ++i)
+            {
+                uint32_t index{0U};
+                if (!sut.acquire(index))
+                {
+                    continue;
+                }
+                sut.store(index, getSampleFromMemoryManager(2U));
+                EXPECT_THAT(sut.take(index).getChunkHeaders().size(), Eq(2U));
+                sut.store(index, getSampleFromMemoryManager(1U));
+                sut.release(index);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_THAT(usedChunks(), Eq(0U));
+}
+
+} // namespace
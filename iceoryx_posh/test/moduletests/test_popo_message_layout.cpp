@@ -0,0 +1,141 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/popo/message_layout.hpp"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+
+TEST(MessageLayout_test, DefaultLayoutIsLayoutIndependent)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8741d15a-f529-443f-9afe-141837e2c64f");
+    MessageLayout sut;
+    EXPECT_FALSE(sut.isLayoutDependent());
+    EXPECT_TRUE((MessageLayout{1U, 1U}.isLayoutDependent()));
+}
+
+TEST(MessageLayout_test, LayoutIndependentMessagesAreReadableInPlaceByEveryone)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7c87017c-bd82-4a2b-8293-5138842777fa");
+    MessageLayout sut;
+    EXPECT_TRUE(sut.isReadableInPlaceBy(MessageLayout{}));
+    EXPECT_TRUE((sut.isReadableInPlaceBy(MessageLayout{1U, 1U})));
+}
+
+TEST(MessageLayout_test, LayoutDependentMessagesAreReadableInPlaceOnlyWithSameLayoutOrWithoutLayout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bf224197-c3cf-45fb-aef6-5877bde6d148");
+    MessageLayout sut{1U, 1U};
+    EXPECT_TRUE(sut.isReadableInPlaceBy(MessageLayout{}));
+    EXPECT_TRUE((sut.isReadableInPlaceBy(MessageLayout{1U, 1U})));
+    EXPECT_FALSE((sut.isReadableInPlaceBy(MessageLayout{2U, 1U})));
+    EXPECT_FALSE((sut.isReadableInPlaceBy(MessageLayout{1U, 2U})));
+}
+
+TEST(MessageLayout_test, SerializedOnlyConsumerReadsOnlyLayoutIndependentMessagesInPlace)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b4e73de5-2018-48f3-8b90-b645bffa8cda");
+    uint64_t management{0U};
+    const auto publisherLayout = MessageLayout::create(42U, &management, false);
+    const auto sut = MessageLayout::serializedOnly(42U);
+
+    EXPECT_TRUE(sut.isLayoutDependent());
+    EXPECT_THAT(publisherLayout.m_addressSpaceKey, Ne(MessageLayout::SERIALIZED_ONLY));
+    EXPECT_FALSE(publisherLayout.isReadableInPlaceBy(sut));
+    EXPECT_FALSE(sut.isReadableInPlaceBy(sut));
+    EXPECT_TRUE(MessageLayout{}.isReadableInPlaceBy(sut));
+}
+
+TEST(MessageLayout_test, CreateYieldsSameLayoutWithinOneProcess)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8721fb05-e863-4af0-8e9b-71b4da2aec18");
+    uint64_t management{0U};
+    auto sut = MessageLayout::create(42U, &management, false);
+    EXPECT_THAT(sut.m_abiHash, Eq(42U));
+    EXPECT_TRUE(sut == MessageLayout::create(42U, &management, false));
+    EXPECT_TRUE(sut != MessageLayout::create(43U, &management, false));
+}
+
+TEST(MessageLayout_test, RelocatableLayoutDependsOnTheAbiHashOnly)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6a1f3c8e-0d47-4b92-a5e3-9c2b7d0f1e64");
+    uint64_t management{0U};
+    auto sut = MessageLayout::create(42U, &management, true);
+
+    EXPECT_THAT(sut.m_abiHash, Eq(42U));
+    EXPECT_THAT(sut.m_addressSpaceKey, Eq(MessageLayout::RELOCATABLE));
+    EXPECT_TRUE(sut.isReadableInPlaceBy(MessageLayout::create(42U, &management, true)));
+    EXPECT_FALSE(sut.isReadableInPlaceBy(MessageLayout::create(43U, &management, true)));
+    EXPECT_FALSE(sut.isReadableInPlaceBy(MessageLayout::create(42U, &management, false)));
+    EXPECT_FALSE(sut.isReadableInPlaceBy(MessageLayout::serializedOnly(42U)));
+}
+
+TEST(MessageLayout_test, AbiHashDependsOnAddedValues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e0a42a4d-5db9-454e-9e09-4f7d64a9b60a");
+    const auto hash = MessageLayout::addToAbiHash(MessageLayout::ABI_HASH_SEED, 1U);
+    EXPECT_THAT(hash, Ne(MessageLayout::ABI_HASH_SEED));
+    EXPECT_THAT(hash, Eq(MessageLayout::addToAbiHash(MessageLayout::ABI_HASH_SEED, 1U)));
+    EXPECT_THAT(hash, Ne(MessageLayout::addToAbiHash(MessageLayout::ABI_HASH_SEED, 2U)));
+}
+
+TEST(MessageLayout_test, AbiHashIsCarriedInServiceDescription)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b9302a0f-9f2e-4910-98c2-5954291dc94e");
+    constexpr uint64_t ABI_HASH{0x0123456789ABCDEFU};
+    iox::capro::ServiceDescription service{"Radar", "FrontLeft", "Objects"};
+    service.setLocal();
+
+    auto sut = MessageLayout::withAbiHash(service, ABI_HASH);
+
+    EXPECT_THAT(MessageLayout::abiHashOf(sut), Eq(ABI_HASH));
+    EXPECT_THAT(MessageLayout::abiHashOf(service), Eq(MessageLayout::LAYOUT_INDEPENDENT));
+    EXPECT_THAT(sut, Eq(service));
+    EXPECT_TRUE(sut.isLocal());
+}
+
+TEST(MessageLayout_test, AbiHashKeepsTheClassHashOfTheServiceDescription)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2d5a0f9e-8b4c-4e71-a3c6-0f7d2b9e1c48");
+    constexpr uint64_t ABI_HASH{0x0123456789ABCDEFU};
+    const iox::capro::ServiceDescription service{"Radar", "FrontLeft", "Objects"};
+    const iox::capro::ServiceDescription firstServiceWithClassHash{"Radar", "FrontLeft", "Objects", {1U, 2U, 3U, 4U}};
+    const iox::capro::ServiceDescription secondServiceWithClassHash{"Radar", "FrontLeft", "Objects", {4U, 3U, 2U, 1U}};
+
+    auto sut = MessageLayout::withAbiHash(service, ABI_HASH);
+    auto firstSut = MessageLayout::withAbiHash(firstServiceWithClassHash, ABI_HASH);
+    auto secondSut = MessageLayout::withAbiHash(secondServiceWithClassHash, ABI_HASH);
+
+    EXPECT_THAT(MessageLayout::abiHashOf(firstSut), Eq(ABI_HASH));
+    EXPECT_THAT(MessageLayout::abiHashOf(secondSut), Eq(ABI_HASH));
+    EXPECT_THAT(sut.getClassHash()[2U], Eq(0U));
+    EXPECT_THAT(firstSut.getClassHash()[2U], Ne(0U));
+    EXPECT_THAT(firstSut.getClassHash(), Ne(secondSut.getClassHash()));
+}
+
+TEST(MessageLayout_test, ClassHashWithoutMarkerCarriesNoAbiHash)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f4c1e8a7-3b2d-4a9f-86e5-7d0c9b1a2e36");
+    const iox::capro::ServiceDescription service{"Radar", "FrontLeft", "Objects", {1U, 2U, 3U, 4U}};
+
+    EXPECT_THAT(MessageLayout::abiHashOf(service), Eq(MessageLayout::LAYOUT_INDEPENDENT));
+}
+
+} // namespace
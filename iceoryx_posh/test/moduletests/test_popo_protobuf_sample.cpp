@@ -0,0 +1,155 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/popo/protobuf_sample.hpp"
+#include "iceoryx_posh/testing/mocks/chunk_mock.hpp"
+
+#include "test.hpp"
+
+#include <cstddef>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+
+struct DummyMessage
+{
+    uint64_t value{42U};
+};
+
+struct DummyUserHeader
+{
+    uint64_t size{0U};
+};
+
+// mimics an arena block with some bookkeeping in front of the message
+struct DummyArenaBlock
+{
+    uint8_t blockHeader[24];
+    DummyMessage message;
+};
+
+using UserHeader_t = iox::mepoo::ProtobufUserHeader<DummyUserHeader>;
+
+class ProtobufSample_test : public Test
+{
+  public:
+    using SUT = ProtobufSample<const DummyMessage, const DummyUserHeader>;
+
+    void SetUp() override
+    {
+        new (chunk.userHeader()) UserHeader_t();
+        new (chunk.sample()) DummyArenaBlock();
+    }
+
+    SUT createSut()
+    {
+        return SUT(chunk.chunkHeader(), [this](const DummyMessage*) { ++numberOfDeleterCalls; });
+    }
+
+    ChunkMock<DummyArenaBlock, UserHeader_t> chunk;
+    uint64_t numberOfDeleterCalls{0U};
+};
+
+TEST_F(ProtobufSample_test, RootMessageIsLocatedViaRecordedOffset)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "04bb213a-84d2-454c-a234-8b523ff4abd5");
+    chunk.userHeader()->m_rootMessageOffset = static_cast<int64_t>(offsetof(DummyArenaBlock, message));
+
+    auto sut = createSut();
+
+    EXPECT_THAT(sut.get(), Eq(&chunk.sample()->message));
+    EXPECT_THAT(sut->value, Eq(42U));
+}
+
+TEST_F(ProtobufSample_test, RootMessageIsAtStartOfUserPayloadWithoutRecordedOffset)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5db5adf0-35a2-4f24-a86d-8feb53d15614");
+    auto sut = createSut();
+
+    EXPECT_THAT(static_cast<const void*>(sut.get()), Eq(static_cast<const void*>(chunk.sample())));
+}
+
+TEST_F(ProtobufSample_test, GetUserHeaderReturnsHeaderOfPublisher)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "40a9dcc0-7a98-4f2f-92c2-5f44d7d28bc6");
+    constexpr uint64_t SIZE{73U};
+    chunk.userHeader()->m_userHeader.size = SIZE;
+
+    auto sut = createSut();
+
+    EXPECT_THAT(sut.getUserHeader().size, Eq(SIZE));
+    EXPECT_THAT(sut.getChunkHeader(), Eq(chunk.chunkHeader()));
+}
+
+TEST_F(ProtobufSample_test, SampleConstructedFromChunkHeadersProvidesThem)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "87874e12-5369-4ad1-ac80-c71d5c7620eb");
+    alignas(iox::mepoo::ChunkManagementManagement) uint8_t memory[sizeof(iox::mepoo::ChunkManagementManagement)];
+    alignas(iox::mepoo::ChunkManagement) uint8_t chunkManagementMemory[sizeof(iox::mepoo::ChunkManagement)];
+    auto* chunkManagementManagement = reinterpret_cast<iox::mepoo::ChunkManagementManagement*>(memory);
+    auto* chunkManagement = reinterpret_cast<iox::mepoo::ChunkManagement*>(chunkManagementMemory);
+    // only the chain is used, therefore the pools are never touched
+    auto* dummyPool = reinterpret_cast<iox::mepoo::MemPool*>(memory);
+    new (chunkManagementManagement) iox::mepoo::ChunkManagementManagement(dummyPool);
+    new (chunkManagement) iox::mepoo::ChunkManagement(chunk.chunkHeader(), dummyPool, dummyPool);
+    chunkManagementManagement->addChunkManagement(chunkManagement);
+
+    {
+        SUT sut(iox::mepoo::ChunkHeaderView(chunkManagementManagement),
+                [this](const DummyMessage*) { ++numberOfDeleterCalls; });
+
+        EXPECT_THAT(sut.getChunkHeader(), Eq(chunk.chunkHeader()));
+        EXPECT_THAT(sut.getChunkHeaders(), ElementsAre(chunk.chunkHeader()));
+        EXPECT_THAT(static_cast<const void*>(sut.get()), Eq(static_cast<const void*>(chunk.sample())));
+    }
+
+    EXPECT_THAT(numberOfDeleterCalls, Eq(1U));
+}
+
+TEST_F(ProtobufSample_test, SampleConstructedFromChunkHeaderHasNoChunkHeaders)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c88cde7a-632a-41c4-b9d4-407b968cd953");
+    auto sut = createSut();
+
+    EXPECT_TRUE(sut.getChunkHeaders().empty());
+}
+
+TEST_F(ProtobufSample_test, DestructionCallsDeleterOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a8d0cf24-b0a1-4e73-b56c-5a81bc6d6ef2");
+    {
+        auto sut = createSut();
+    }
+
+    EXPECT_THAT(numberOfDeleterCalls, Eq(1U));
+}
+
+TEST_F(ProtobufSample_test, MovedSampleCallsDeleterOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0fc008a2-d0f3-4ee5-87bc-b349d43570cb");
+    {
+        auto sut = createSut();
+        auto movedSut = std::move(sut);
+        EXPECT_TRUE(movedSut);
+    }
+
+    EXPECT_THAT(numberOfDeleterCalls, Eq(1U));
+}
+
+} // namespace
@@ -41,6 +41,25 @@ struct DummyData
     uint64_t val{defaultVal()};
 };
 
+/// @brief Provides the serialization interface of a 'google::protobuf::MessageLite' which is used by 'publishSerialized'
+struct SerializableDummyData
+{
+    size_t ByteSizeLong() const
+    {
+        ++byteSizeCalls;
+        return sizeof(uint64_t);
+    }
+
+    uint8_t* SerializeWithCachedSizesToArray(uint8_t* target) const
+    {
+        memcpy(target, &val, sizeof(uint64_t));
+        return target + sizeof(uint64_t);
+    }
+
+    uint64_t val{0U};
+    mutable uint64_t byteSizeCalls{0U};
+};
+
 using TestPublisher = iox::popo::PublisherImpl<DummyData, iox::mepoo::NoUserHeader, MockBasePublisher<DummyData>>;
 
 class PublisherTest : public Test
@@ -68,7 +87,7 @@ class PublisherTest : public Test
 TEST_F(PublisherTest, LoansChunkLargeEnoughForTheType)
 {
     ::testing::Test::RecordProperty("TEST_ID", "38d0779a-1fd5-407d-95aa-2cf24fcf3a09");
-    EXPECT_CALL(portMock, tryAllocateChunk(sizeof(DummyData), _, _, _))
+    EXPECT_CALL(portMock, tryAllocateSingleChunk(sizeof(DummyData), _, _, _))
         .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))));
     // ===== Test ===== //
     auto result = sut.loan();
@@ -81,7 +100,7 @@ TEST_F(PublisherTest, LoansChunkLargeEnoughForTheType)
 TEST_F(PublisherTest, LoanedSampleIsDefaultInitialized)
 {
     ::testing::Test::RecordProperty("TEST_ID", "52b5de5e-be1b-4815-8ac6-45b8dd3e9814");
-    EXPECT_CALL(portMock, tryAllocateChunk(sizeof(DummyData), _, _, _))
+    EXPECT_CALL(portMock, tryAllocateSingleChunk(sizeof(DummyData), _, _, _))
         .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))));
     // ===== Test ===== //
     auto result = sut.loan();
@@ -96,7 +115,7 @@ TEST_F(PublisherTest, LoanWithArgumentsCallsCustomCtor)
 {
     ::testing::Test::RecordProperty("TEST_ID", "1fd165ed-73a2-4465-a740-6d7b502b0d95");
     constexpr uint64_t CUSTOM_VALUE{73};
-    EXPECT_CALL(portMock, tryAllocateChunk(sizeof(DummyData), _, _, _))
+    EXPECT_CALL(portMock, tryAllocateSingleChunk(sizeof(DummyData), _, _, _))
         .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))));
     // ===== Test ===== //
     auto result = sut.loan(CUSTOM_VALUE);
@@ -110,7 +129,7 @@ TEST_F(PublisherTest, LoanWithArgumentsCallsCustomCtor)
 TEST_F(PublisherTest, CanLoanSamplesAndPublishTheResultOfALambdaWithAdditionalArguments)
 {
     ::testing::Test::RecordProperty("TEST_ID", "6e341963-5917-440b-b01a-2fc8fff64def");
-    EXPECT_CALL(portMock, tryAllocateChunk(sizeof(DummyData), _, _, _))
+    EXPECT_CALL(portMock, tryAllocateSingleChunk(sizeof(DummyData), _, _, _))
         .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))));
     EXPECT_CALL(portMock, sendChunk(chunkMock.chunkHeader()));
     // ===== Test ===== //
@@ -128,7 +147,7 @@ TEST_F(PublisherTest, CanLoanSamplesAndPublishTheResultOfALambdaWithAdditionalAr
 TEST_F(PublisherTest, CanLoanSamplesAndPublishTheResultOfALambdaWithNoAdditionalArguments)
 {
     ::testing::Test::RecordProperty("TEST_ID", "98bf5461-58c6-401d-a599-8e8f4dc5f806");
-    EXPECT_CALL(portMock, tryAllocateChunk(sizeof(DummyData), _, _, _))
+    EXPECT_CALL(portMock, tryAllocateSingleChunk(sizeof(DummyData), _, _, _))
         .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))));
     EXPECT_CALL(portMock, sendChunk(chunkMock.chunkHeader()));
     // ===== Test ===== //
@@ -152,7 +171,7 @@ TEST_F(PublisherTest, CanLoanSamplesAndPublishTheResultOfACallableStructWithNoAd
             data->val = 777;
         };
     };
-    EXPECT_CALL(portMock, tryAllocateChunk(sizeof(DummyData), _, _, _))
+    EXPECT_CALL(portMock, tryAllocateSingleChunk(sizeof(DummyData), _, _, _))
         .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))));
     EXPECT_CALL(portMock, sendChunk(chunkMock.chunkHeader()));
     // ===== Test ===== //
@@ -173,7 +192,7 @@ TEST_F(PublisherTest, CanLoanSamplesAndPublishTheResultOfACallableStructWithAddi
             data->val = 777;
         };
     };
-    EXPECT_CALL(portMock, tryAllocateChunk(sizeof(DummyData), _, _, _))
+    EXPECT_CALL(portMock, tryAllocateSingleChunk(sizeof(DummyData), _, _, _))
         .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))));
     EXPECT_CALL(portMock, sendChunk(chunkMock.chunkHeader()));
     // ===== Test ===== //
@@ -197,7 +216,7 @@ void freeFunctionWithAdditionalArgs(DummyData* allocation, uint64_t, float)
 TEST_F(PublisherTest, CanLoanSamplesAndPublishTheResultOfFunctionPointerWithNoAdditionalArguments)
 {
     ::testing::Test::RecordProperty("TEST_ID", "eae5694a-25c3-48ec-b1ac-518321730773");
-    EXPECT_CALL(portMock, tryAllocateChunk(sizeof(DummyData), _, _, _))
+    EXPECT_CALL(portMock, tryAllocateSingleChunk(sizeof(DummyData), _, _, _))
         .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))));
     EXPECT_CALL(portMock, sendChunk(chunkMock.chunkHeader()));
     // ===== Test ===== //
@@ -210,7 +229,7 @@ TEST_F(PublisherTest, CanLoanSamplesAndPublishTheResultOfFunctionPointerWithNoAd
 TEST_F(PublisherTest, CanLoanSamplesAndPublishTheResultOfFunctionPointerWithAdditionalArguments)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5696d415-1278-4bfe-891f-9c994cd0025e");
-    EXPECT_CALL(portMock, tryAllocateChunk(sizeof(DummyData), _, _, _))
+    EXPECT_CALL(portMock, tryAllocateSingleChunk(sizeof(DummyData), _, _, _))
         .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))));
     EXPECT_CALL(portMock, sendChunk(chunkMock.chunkHeader()));
     // ===== Test ===== //
@@ -223,7 +242,7 @@ TEST_F(PublisherTest, CanLoanSamplesAndPublishTheResultOfFunctionPointerWithAddi
 TEST_F(PublisherTest, CanLoanSamplesAndPublishCopiesOfProvidedValues)
 {
     ::testing::Test::RecordProperty("TEST_ID", "84d2599b-f6b2-497d-b2e9-029b58738552");
-    EXPECT_CALL(portMock, tryAllocateChunk(sizeof(DummyData), _, _, _))
+    EXPECT_CALL(portMock, tryAllocateSingleChunk(sizeof(DummyData), _, _, _))
         .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))));
     EXPECT_CALL(portMock, sendChunk(chunkMock.chunkHeader()));
     DummyData data(73);
@@ -237,7 +256,7 @@ TEST_F(PublisherTest, CanLoanSamplesAndPublishCopiesOfProvidedValues)
 TEST_F(PublisherTest, LoanFailsAndForwardsAllocationErrorsToCaller)
 {
     ::testing::Test::RecordProperty("TEST_ID", "257750cd-3a1b-4363-a6d2-4318590528bb");
-    EXPECT_CALL(portMock, tryAllocateChunk(sizeof(DummyData), _, _, _))
+    EXPECT_CALL(portMock, tryAllocateSingleChunk(sizeof(DummyData), _, _, _))
         .WillOnce(Return(ByMove(iox::err(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS))));
     // ===== Test ===== //
     auto result = sut.loan();
@@ -247,11 +266,224 @@ TEST_F(PublisherTest, LoanFailsAndForwardsAllocationErrorsToCaller)
     // ===== Cleanup ===== //
 }
 
+TEST_F(PublisherTest, PublishSerializedLoansChunkWithTheSizeOfTheMessageAndPublishesIt)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "af575652-2192-471a-9719-f8287b1bba4e");
+    ChunkMock<DummyData, iox::mepoo::ProtobufUserHeader<>> protobufChunkMock;
+    EXPECT_CALL(portMock, tryAllocateSingleChunk(sizeof(uint64_t), _, sizeof(iox::mepoo::ProtobufUserHeader<>), _))
+        .WillOnce(Return(ByMove(iox::ok(protobufChunkMock.chunkHeader()))));
+    EXPECT_CALL(portMock, sendChunk(protobufChunkMock.chunkHeader()));
+    SerializableDummyData message;
+    message.val = 73U;
+    // ===== Test ===== //
+    auto result = sut.publishSerialized(message);
+    // ===== Verify ===== //
+    EXPECT_FALSE(result.has_error());
+    EXPECT_EQ(message.byteSizeCalls, 1U);
+    EXPECT_EQ(protobufChunkMock.sample()->val, 73U);
+    auto serializedSize =
+        iox::mepoo::protobufSerializedSize<iox::mepoo::NoUserHeader>(protobufChunkMock.chunkHeader());
+    ASSERT_TRUE(serializedSize.has_value());
+    EXPECT_EQ(serializedSize.value(), sizeof(uint64_t));
+    // ===== Cleanup ===== //
+}
+
+TEST_F(PublisherTest, PublishSerializedForwardsAllocationErrorsToCaller)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "497c050f-8064-4cce-bcd3-a7bdc863f73a");
+    EXPECT_CALL(portMock, tryAllocateSingleChunk(_, _, _, _))
+        .WillOnce(Return(ByMove(iox::err(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS))));
+    EXPECT_CALL(portMock, sendChunk(_)).Times(0);
+    SerializableDummyData message;
+    // ===== Test ===== //
+    auto result = sut.publishSerialized(message);
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS, result.error());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(PublisherTest, ChunksWhichWereNotSerializedHaveNoSerializedSize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b6c0d938-987b-431d-a15a-4147d5781530");
+    ChunkMock<DummyData, iox::mepoo::ProtobufUserHeader<>> protobufChunkMock;
+    new (protobufChunkMock.chunkHeader()->userHeader()) iox::mepoo::ProtobufUserHeader<>();
+
+    EXPECT_FALSE(iox::mepoo::protobufSerializedSize<iox::mepoo::NoUserHeader>(protobufChunkMock.chunkHeader())
+                     .has_value());
+    EXPECT_FALSE(iox::mepoo::protobufSerializedSize<iox::mepoo::NoUserHeader>(chunkMock.chunkHeader()).has_value());
+}
+
+TEST_F(PublisherTest, AttachedChunkCannotBeLoanedWithoutArenaBlock)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cde8df2a-faa6-4744-b258-3bbb49928da7");
+    EXPECT_CALL(portMock, tryAllocateChunk(_, _, _, _)).Times(0);
+    // ===== Test ===== //
+    auto result = sut.loanAttachedChunk(1024U);
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(iox::popo::AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER, result.error());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(PublisherTest, AttachedChunkIsLoanedWithTheRequestedUserPayloadAndPublishedWithTheSample)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "251b3109-69ea-45d4-b3d9-f3d6e88acc73");
+    ChunkMock<DummyData, iox::mepoo::ProtobufUserHeader<>> blockChunkMock;
+    EXPECT_CALL(portMock, tryAllocateChunk(_, _, sizeof(iox::mepoo::ProtobufUserHeader<>), _))
+        .WillOnce(Return(ByMove(iox::ok(blockChunkMock.chunkHeader()))));
+    EXPECT_CALL(portMock, tryAllocateChunk(1024U, 64U, 0U, 1U))
+        .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))));
+    EXPECT_CALL(portMock, sendChunk(blockChunkMock.chunkHeader())).Times(1);
+    EXPECT_CALL(portMock, releaseChunk(_)).Times(0);
+    size_t actualSize{0U};
+    auto* block = sut.loanBlock(sizeof(DummyData), actualSize);
+    ASSERT_NE(block, nullptr);
+    // ===== Test ===== //
+    auto attachedChunk = sut.loanAttachedChunk(1024U, 64U);
+    // ===== Verify ===== //
+    ASSERT_FALSE(attachedChunk.has_error());
+    EXPECT_EQ(attachedChunk.value(), chunkMock.chunkHeader());
+    auto sample = sut.getSample(new (block) DummyData);
+    ASSERT_FALSE(sample.has_error());
+    sample.value().publish();
+    // ===== Cleanup ===== //
+}
+
+TEST_F(PublisherTest, AttachedChunkIsReleasedWithTheArenaBlocksOfAnUnpublishedSample)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "87c6e91e-c647-4126-b473-194ff9124962");
+    ChunkMock<DummyData, iox::mepoo::ProtobufUserHeader<>> blockChunkMock;
+    EXPECT_CALL(portMock, tryAllocateChunk(_, _, sizeof(iox::mepoo::ProtobufUserHeader<>), _))
+        .WillOnce(Return(ByMove(iox::ok(blockChunkMock.chunkHeader()))));
+    EXPECT_CALL(portMock, tryAllocateChunk(1024U, _, 0U, _))
+        .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))));
+    size_t actualSize{0U};
+    auto* block = sut.loanBlock(sizeof(DummyData), actualSize);
+    ASSERT_NE(block, nullptr);
+    ASSERT_FALSE(sut.loanAttachedChunk(1024U).has_error());
+    // ===== Verify ===== //
+    // the attached chunk is part of the sample, hence releasing the last arena block releases it as well
+    EXPECT_CALL(portMock, releaseChunk(blockChunkMock.chunkHeader())).Times(1);
+    // ===== Test ===== //
+    sut.releaseBlock(block);
+    // ===== Cleanup ===== //
+}
+
+TEST_F(PublisherTest, ReleasingAllArenaBlocksAtOnceReleasesTheUnpublishedSample)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "94e00e03-a131-4f9e-9c09-fde50328003c");
+    ChunkMock<DummyData, iox::mepoo::ProtobufUserHeader<>> blockChunkMock;
+    EXPECT_CALL(portMock, tryAllocateChunk(_, _, sizeof(iox::mepoo::ProtobufUserHeader<>), _))
+        .WillOnce(Return(ByMove(iox::ok(blockChunkMock.chunkHeader()))));
+    size_t actualSize{0U};
+    ASSERT_NE(sut.loanBlock(sizeof(DummyData), actualSize), nullptr);
+    // ===== Verify ===== //
+    EXPECT_CALL(portMock, releaseChunk(blockChunkMock.chunkHeader())).Times(1);
+    // ===== Test ===== //
+    sut.releaseBlocks();
+    sut.releaseBlocks();
+    // ===== Cleanup ===== //
+}
+
+TEST_F(PublisherTest, ReleasingAllArenaBlocksAtOnceIsIgnoredForAPublishedSample)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c834f61b-99ec-48a9-93e2-59ef000dd370");
+    ChunkMock<DummyData, iox::mepoo::ProtobufUserHeader<>> blockChunkMock;
+    EXPECT_CALL(portMock, tryAllocateChunk(_, _, sizeof(iox::mepoo::ProtobufUserHeader<>), _))
+        .WillOnce(Return(ByMove(iox::ok(blockChunkMock.chunkHeader()))));
+    EXPECT_CALL(portMock, sendChunk(blockChunkMock.chunkHeader())).Times(1);
+    EXPECT_CALL(portMock, releaseChunk(_)).Times(0);
+    size_t actualSize{0U};
+    auto* block = sut.loanBlock(sizeof(DummyData), actualSize);
+    ASSERT_NE(block, nullptr);
+    auto sample = sut.getSample(new (block) DummyData);
+    ASSERT_FALSE(sample.has_error());
+    sample.value().publish();
+    // ===== Test ===== //
+    sut.releaseBlocks();
+    // ===== Verify ===== //
+    // ===== Cleanup ===== //
+}
+
+TEST_F(PublisherTest, SampleLoanedWhileArenaMessageIsPendingIsPublishedWithItsOwnChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "708905cd-2730-4482-9295-61c46bdc6f32");
+    ChunkMock<DummyData, iox::mepoo::ProtobufUserHeader<>> blockChunkMock;
+    EXPECT_CALL(portMock, tryAllocateChunk(_, _, sizeof(iox::mepoo::ProtobufUserHeader<>), _))
+        .WillOnce(Return(ByMove(iox::ok(blockChunkMock.chunkHeader()))));
+    EXPECT_CALL(portMock, tryAllocateSingleChunk(sizeof(DummyData), _, _, _))
+        .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))));
+    size_t actualSize{0U};
+    auto* block = sut.loanBlock(sizeof(DummyData), actualSize);
+    ASSERT_NE(block, nullptr);
+    // ===== Test ===== //
+    auto plainSample = sut.loan();
+    ASSERT_FALSE(plainSample.has_error());
+    // ===== Verify ===== //
+    {
+        InSequence sequence;
+        EXPECT_CALL(portMock, sendChunk(chunkMock.chunkHeader())).Times(1);
+        EXPECT_CALL(portMock, sendChunk(blockChunkMock.chunkHeader())).Times(1);
+    }
+    plainSample.value().publish();
+    // the arena message is still pending and published with its own blocks
+    auto arenaSample = sut.getSample(new (block) DummyData);
+    ASSERT_FALSE(arenaSample.has_error());
+    arenaSample.value().publish();
+    // ===== Cleanup ===== //
+}
+
+TEST_F(PublisherTest, PublishSerializedWhileArenaMessageIsPendingLeavesTheArenaMessageUntouched)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4223d0bb-6d3c-46f5-a151-5e2f0689363b");
+    ChunkMock<DummyData, iox::mepoo::ProtobufUserHeader<>> blockChunkMock;
+    ChunkMock<DummyData, iox::mepoo::ProtobufUserHeader<>> serializedChunkMock;
+    EXPECT_CALL(portMock, tryAllocateChunk(_, _, sizeof(iox::mepoo::ProtobufUserHeader<>), _))
+        .WillOnce(Return(ByMove(iox::ok(blockChunkMock.chunkHeader()))));
+    EXPECT_CALL(portMock, tryAllocateSingleChunk(sizeof(uint64_t), _, sizeof(iox::mepoo::ProtobufUserHeader<>), _))
+        .WillOnce(Return(ByMove(iox::ok(serializedChunkMock.chunkHeader()))));
+    EXPECT_CALL(portMock, sendChunk(serializedChunkMock.chunkHeader())).Times(1);
+    size_t actualSize{0U};
+    auto* block = sut.loanBlock(sizeof(DummyData), actualSize);
+    ASSERT_NE(block, nullptr);
+    SerializableDummyData message;
+    // ===== Test ===== //
+    ASSERT_FALSE(sut.publishSerialized(message).has_error());
+    // ===== Verify ===== //
+    EXPECT_CALL(portMock, releaseChunk(blockChunkMock.chunkHeader())).Times(1);
+    sut.releaseBlock(block);
+    // ===== Cleanup ===== //
+}
+
+TEST_F(PublisherTest, ArenaBlockReservesTheArenaHeaderBehindTheProtobufUserHeader)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "94eea1e1-06d3-4f76-ba1d-f8aec1dc6470");
+    struct ArenaUserHeader
+    {
+        iox::mepoo::ProtobufUserHeader<> protobufUserHeader;
+        uint64_t arena[4];
+    };
+    constexpr uint32_t ARENA_HEADER_SIZE{sizeof(ArenaUserHeader) - sizeof(iox::mepoo::ProtobufUserHeader<>)};
+    ChunkMock<DummyData, ArenaUserHeader> blockChunkMock;
+    EXPECT_CALL(portMock, tryAllocateChunk(_, _, sizeof(ArenaUserHeader), alignof(iox::mepoo::ProtobufUserHeader<>)))
+        .WillOnce(Return(ByMove(iox::ok(blockChunkMock.chunkHeader()))));
+    EXPECT_CALL(portMock, releaseChunk(blockChunkMock.chunkHeader())).Times(1);
+    size_t actualSize{0U};
+    void* arenaHeader{nullptr};
+    // ===== Test ===== //
+    auto* block = sut.loanBlock(sizeof(DummyData), actualSize, ARENA_HEADER_SIZE, arenaHeader);
+    // ===== Verify ===== //
+    EXPECT_EQ(block, blockChunkMock.chunkHeader()->userPayload());
+    EXPECT_EQ(arenaHeader, &blockChunkMock.userHeader()->arena);
+    // ===== Cleanup ===== //
+    sut.releaseBlocks();
+}
 
 TEST_F(PublisherTest, LoanedSamplesContainPointerToChunkHeader)
 {
     ::testing::Test::RecordProperty("TEST_ID", "935108d7-bf2f-4557-8722-f7f474f413a3");
-    EXPECT_CALL(portMock, tryAllocateChunk(sizeof(DummyData), _, _, _))
+    EXPECT_CALL(portMock, tryAllocateSingleChunk(sizeof(DummyData), _, _, _))
         .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))));
     // ===== Test ===== //
     auto result = sut.loan();
@@ -265,7 +497,7 @@ TEST_F(PublisherTest, LoanedSamplesContainPointerToChunkHeader)
 TEST_F(PublisherTest, PublishingSendsUnderlyingMemoryChunkOnPublisherPort)
 {
     ::testing::Test::RecordProperty("TEST_ID", "743183e2-76cb-4d51-9643-a962d933fdac");
-    EXPECT_CALL(portMock, tryAllocateChunk(sizeof(DummyData), _, _, _))
+    EXPECT_CALL(portMock, tryAllocateSingleChunk(sizeof(DummyData), _, _, _))
         .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))));
     EXPECT_CALL(portMock, sendChunk(chunkMock.chunkHeader()));
     // ===== Test ===== //
@@ -274,6 +506,22 @@ TEST_F(PublisherTest, PublishingSendsUnderlyingMemoryChunkOnPublisherPort)
     // ===== Cleanup ===== //
 }
 
+TEST_F(PublisherTest, PublishedSampleIsNotReleasedByItsDeleter)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5d0b7e29-3c84-4f1a-9e62-b8a1f04c7d35");
+    EXPECT_CALL(portMock, tryAllocateSingleChunk(sizeof(DummyData), _, _, _))
+        .WillOnce(Return(ByMove(iox::ok(chunkMock.chunkHeader()))));
+    EXPECT_CALL(portMock, sendChunk(chunkMock.chunkHeader())).Times(1);
+    EXPECT_CALL(portMock, releaseChunk(_)).Times(0);
+    // ===== Test ===== //
+    auto sample = sut.loan();
+    ASSERT_FALSE(sample.has_error());
+    sample.value().publish();
+    // ===== Verify ===== //
+    EXPECT_FALSE(sample.value());
+    // ===== Cleanup ===== //
+}
+
 // test whether the BasePublisher methods are called
 
 TEST_F(PublisherTest, OfferDoesOfferServiceOnUnderlyingPort)
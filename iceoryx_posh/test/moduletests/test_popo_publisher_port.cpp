@@ -295,6 +295,28 @@ TEST_F(PublisherPort_test, releasingAnAllocatedChunkReleasesTheMemory)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
 }
 
+TEST_F(PublisherPort_test, singleChunkAllocatedWhileASampleIsAssembledIsNotPartOfThatSample)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "12ea9d3c-c01f-4b80-b394-240379f15134");
+    auto firstChunkHeader = m_sutNoOfferOnCreateUserSide
+                                .tryAllocateChunk(10U, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT)
+                                .value();
+    ASSERT_FALSE(m_sutNoOfferOnCreateUserSide
+                     .tryAllocateChunk(10U, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT)
+                     .has_error());
+
+    auto singleChunkHeader = m_sutNoOfferOnCreateUserSide.tryAllocateSingleChunk(
+        10U, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(singleChunkHeader.has_error());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(3U));
+
+    m_sutNoOfferOnCreateUserSide.releaseChunk(singleChunkHeader.value());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(2U));
+
+    m_sutNoOfferOnCreateUserSide.releaseChunk(firstChunkHeader);
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
 TEST_F(PublisherPort_test, allocatedChunkContainsPublisherIdAsOriginId)
 {
     ::testing::Test::RecordProperty("TEST_ID", "6b873fcb-d67d-48ca-a67d-b807311161d4");
@@ -0,0 +1,121 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
+#include "iceoryx_posh/internal/popo/ports/publisher_port_user.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iox/bump_allocator.hpp"
+
+#include "test.hpp"
+
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+
+class PublisherPortRelease_test : public Test
+{
+  protected:
+    PublisherPortRelease_test()
+    {
+        m_mempoolconf.addMemPool({SMALL_CHUNK, NUM_CHUNKS_IN_POOL});
+        m_mempoolconf.addMemPool({BIG_CHUNK, NUM_CHUNKS_IN_POOL});
+        m_memoryManager.configureMemoryManager(m_mempoolconf, m_memoryAllocator, m_memoryAllocator);
+    }
+
+    std::vector<iox::mepoo::ChunkHeader*> allocateSample(const std::vector<uint64_t>& userPayloadSizes)
+    {
+        std::vector<iox::mepoo::ChunkHeader*> chunkHeaders;
+        for (auto userPayloadSize : userPayloadSizes)
+        {
+            m_sut.tryAllocateChunk(userPayloadSize, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT)
+                .and_then([&](auto chunkHeader) { chunkHeaders.push_back(chunkHeader); })
+                .or_else([](auto error) { GTEST_FAIL() << "Allocation failed with " << error; });
+        }
+        return chunkHeaders;
+    }
+
+    uint32_t usedChunks() const
+    {
+        return m_memoryManager.getMemPoolInfo(0U).m_usedChunks + m_memoryManager.getMemPoolInfo(1U).m_usedChunks;
+    }
+
+    static constexpr size_t MEMORY_SIZE = 1024 * 1024;
+    uint8_t m_memory[MEMORY_SIZE];
+    static constexpr uint32_t NUM_CHUNKS_IN_POOL = 20;
+    static constexpr uint64_t SMALL_CHUNK = 128;
+    static constexpr uint64_t BIG_CHUNK = 256;
+    static constexpr uint64_t SMALL_PAYLOAD = 100;
+    static constexpr uint64_t BIG_PAYLOAD = 200;
+
+    iox::BumpAllocator m_memoryAllocator{m_memory, MEMORY_SIZE};
+    iox::mepoo::MePooConfig m_mempoolconf;
+    iox::mepoo::MemoryManager m_memoryManager;
+
+    iox::popo::PublisherOptions m_publisherOptions{};
+    iox::popo::PublisherPortData m_publisherPortData{iox::capro::ServiceDescription("x", "y", "z"),
+                                                     "myApp",
+                                                     iox::roudi::DEFAULT_UNIQUE_ROUDI_ID,
+                                                     &m_memoryManager,
+                                                     m_publisherOptions};
+    iox::popo::PublisherPortUser m_sut{&m_publisherPortData};
+};
+
+TEST_F(PublisherPortRelease_test, ReleasingAMultiChunkLoanReturnsAllChunksToTheMempools)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b4e1c7d2-6a3f-4f58-9e21-7c0d5a8b3f14");
+    auto chunkHeaders = allocateSample({SMALL_PAYLOAD, BIG_PAYLOAD, BIG_PAYLOAD});
+    ASSERT_THAT(chunkHeaders.size(), Eq(3U));
+    EXPECT_THAT(usedChunks(), Eq(3U));
+
+    m_sut.releaseChunk(chunkHeaders.front());
+
+    EXPECT_THAT(usedChunks(), Eq(0U));
+}
+
+TEST_F(PublisherPortRelease_test, LoanAfterReleasedLoanStartsANewSample)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0d93f5a7-28c4-4b1e-a6f0-e35b9c7d4a82");
+    auto abortedChunkHeaders = allocateSample({SMALL_PAYLOAD, BIG_PAYLOAD});
+    m_sut.releaseChunk(abortedChunkHeaders.front());
+
+    auto chunkHeaders = allocateSample({SMALL_PAYLOAD});
+    ASSERT_THAT(chunkHeaders.size(), Eq(1U));
+    EXPECT_THAT(usedChunks(), Eq(1U));
+
+    m_sut.releaseChunk(chunkHeaders.front());
+
+    EXPECT_THAT(usedChunks(), Eq(0U));
+}
+
+TEST_F(PublisherPortRelease_test, RepeatedlyAbortedLoansDoNotExhaustTheChunksInUse)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7a2c6e19-f04b-4d83-b5e7-91c3d8a6f250");
+    constexpr uint64_t NUMBER_OF_ABORTED_LOANS{iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY * 2U};
+    for (uint64_t i = 0U; i < NUMBER_OF_ABORTED_LOANS; ++i)
+    {
+        auto chunkHeaders = allocateSample({SMALL_PAYLOAD, BIG_PAYLOAD});
+        ASSERT_THAT(chunkHeaders.size(), Eq(2U));
+        m_sut.releaseChunk(chunkHeaders.front());
+    }
+
+    EXPECT_THAT(usedChunks(), Eq(0U));
+}
+
+} // namespace
@@ -103,7 +103,7 @@ class ServerPort_test : public Test
         return m_memoryManager.getMemPoolInfo(0U).m_usedChunks;
     }
 
-    SharedChunk getChunkFromMemoryManager(uint64_t userPayloadSize, uint32_t userHeaderSize)
+    SharedMultiChunk getChunkFromMemoryManager(uint64_t userPayloadSize, uint32_t userHeaderSize)
     {
         auto chunkSettings = ChunkSettings::create(userPayloadSize,
                                                    iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
@@ -111,12 +111,16 @@ class ServerPort_test : public Test
                                                    iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT)
                                  .expect("Valid 'ChunkSettings'");
 
-        return m_memoryManager.getChunk(chunkSettings).expect("Obtaining chunk");
+        auto chunkManagementManagement = m_memoryManager.getMultiChunk();
+        IOX_ENFORCE(chunkManagementManagement != nullptr, "Obtaining multi chunk");
+        chunkManagementManagement->addChunkManagement(
+            m_memoryManager.getChunk(chunkSettings).expect("Obtaining chunk").release());
+        return SharedMultiChunk(chunkManagementManagement);
     }
 
     static constexpr uint64_t DUMMY_DATA{0U};
 
-    SharedChunk getChunkWithInitializedRequestHeaderAndData(const uint64_t data = DUMMY_DATA)
+    SharedMultiChunk getChunkWithInitializedRequestHeaderAndData(const uint64_t data = DUMMY_DATA)
     {
         constexpr uint64_t USER_PAYLOAD_SIZE{sizeof(uint64_t)};
         auto sharedChunk = getChunkFromMemoryManager(USER_PAYLOAD_SIZE, sizeof(RequestHeader));
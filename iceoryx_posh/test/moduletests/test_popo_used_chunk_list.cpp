@@ -45,17 +45,24 @@ class UsedChunkList_test : public Test
 
     void TearDown() override {};
 
-    SharedChunk getChunkFromMemoryManager()
+    SharedMultiChunk getChunkFromMemoryManager(const uint32_t numberOfChunks = 1U)
     {
         constexpr uint64_t USER_PAYLOAD_SIZE{32U};
         auto chunkSettings =
             iox::mepoo::ChunkSettings::create(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT)
                 .expect("Valid 'ChunkSettings'");
 
-        return memoryManager.getChunk(chunkSettings).expect("Obtaining chunk");
+        auto chunkManagementManagement = memoryManager.getMultiChunk();
+        IOX_ENFORCE(chunkManagementManagement != nullptr, "Obtaining multi chunk");
+        for (uint32_t i = 0U; i < numberOfChunks; ++i)
+        {
+            chunkManagementManagement->addChunkManagement(
+                memoryManager.getChunk(chunkSettings).expect("Obtaining chunk").release());
+        }
+        return SharedMultiChunk(chunkManagementManagement);
     }
 
-    void createMultipleChunks(uint32_t numberOfChunks, std::function<void(SharedChunk&&)> testHook)
+    void createMultipleChunks(uint32_t numberOfChunks, std::function<void(SharedMultiChunk&&)> testHook)
     {
         ASSERT_TRUE(testHook);
         for (uint32_t i = 0; i < numberOfChunks; ++i)
@@ -110,13 +117,13 @@ TEST_F(UsedChunkList_test, MultipleChunksCanBeAdded)
 TEST_F(UsedChunkList_test, AddChunksUpToCapacityWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "1b1b9b29-e00f-4791-9a62-f8fd398fb955");
-    createMultipleChunks(USED_CHUNK_LIST_CAPACITY, [this](SharedChunk&& chunk) { EXPECT_TRUE(sut.insert(chunk)); });
+    createMultipleChunks(USED_CHUNK_LIST_CAPACITY, [this](SharedMultiChunk&& chunk) { EXPECT_TRUE(sut.insert(chunk)); });
 }
 
 TEST_F(UsedChunkList_test, AddChunksUntilOverflowIsHandledGracefully)
 {
     ::testing::Test::RecordProperty("TEST_ID", "6922015f-bf26-4bf3-8b7d-8adf6e846030");
-    createMultipleChunks(USED_CHUNK_LIST_CAPACITY, [this](SharedChunk&& chunk) { EXPECT_TRUE(sut.insert(chunk)); });
+    createMultipleChunks(USED_CHUNK_LIST_CAPACITY, [this](SharedMultiChunk&& chunk) { EXPECT_TRUE(sut.insert(chunk)); });
 
     EXPECT_FALSE(sut.insert(getChunkFromMemoryManager()));
 }
@@ -128,7 +135,7 @@ TEST_F(UsedChunkList_test, OneChunkCanBeRemoved)
     auto chunkHeader = chunk.getChunkHeader();
     sut.insert(chunk);
 
-    SharedChunk removedChunk;
+    SharedMultiChunk removedChunk;
     EXPECT_TRUE(sut.remove(chunkHeader, removedChunk));
     EXPECT_TRUE(removedChunk);
 
@@ -145,7 +152,7 @@ TEST_F(UsedChunkList_test, RemoveSameChunkAddedTwiceWorks)
 
     for (auto i = 0; i < 2; ++i)
     {
-        SharedChunk removedChunk;
+        SharedMultiChunk removedChunk;
         EXPECT_TRUE(sut.remove(chunkHeader, removedChunk));
         EXPECT_TRUE(removedChunk);
     }
@@ -157,14 +164,14 @@ TEST_F(UsedChunkList_test, MultipleChunksCanBeRemoved)
 {
     ::testing::Test::RecordProperty("TEST_ID", "13dd689b-d0b4-4d30-a154-0b8a9e7de5e1");
     std::vector<ChunkHeader*> chunkHeaderInUse;
-    createMultipleChunks(3U, [&](SharedChunk&& chunk) {
+    createMultipleChunks(3U, [&](SharedMultiChunk&& chunk) {
         chunkHeaderInUse.push_back(chunk.getChunkHeader());
         sut.insert(chunk);
     });
 
     for (auto chunkHeader : chunkHeaderInUse)
     {
-        SharedChunk removedChunk;
+        SharedMultiChunk removedChunk;
         EXPECT_TRUE(sut.remove(chunkHeader, removedChunk));
         EXPECT_TRUE(removedChunk);
     }
@@ -176,7 +183,7 @@ TEST_F(UsedChunkList_test, MultipleChunksCanBeRemovedInReverseOrder)
 {
     ::testing::Test::RecordProperty("TEST_ID", "bab1402e-1217-4d3f-8386-c78777c709bf");
     std::vector<ChunkHeader*> chunkHeaderInUse;
-    createMultipleChunks(3U, [&](SharedChunk&& chunk) {
+    createMultipleChunks(3U, [&](SharedMultiChunk&& chunk) {
         chunkHeaderInUse.push_back(chunk.getChunkHeader());
         sut.insert(chunk);
     });
@@ -184,7 +191,7 @@ TEST_F(UsedChunkList_test, MultipleChunksCanBeRemovedInReverseOrder)
     constexpr uint32_t removeOrderIndices[]{2U, 1U, 0U};
     for (auto index : removeOrderIndices)
     {
-        SharedChunk removedChunk;
+        SharedMultiChunk removedChunk;
         EXPECT_TRUE(sut.remove(chunkHeaderInUse[index], removedChunk));
         EXPECT_TRUE(removedChunk);
     }
@@ -196,7 +203,7 @@ TEST_F(UsedChunkList_test, MultipleChunksCanBeRemovedInArbitraryOrder)
 {
     ::testing::Test::RecordProperty("TEST_ID", "1f8030d5-be3e-4804-a1f3-c3f7ebcbf88b");
     std::vector<ChunkHeader*> chunkHeaderInUse;
-    createMultipleChunks(3U, [&](SharedChunk&& chunk) {
+    createMultipleChunks(3U, [&](SharedMultiChunk&& chunk) {
         chunkHeaderInUse.push_back(chunk.getChunkHeader());
         sut.insert(chunk);
     });
@@ -204,7 +211,7 @@ TEST_F(UsedChunkList_test, MultipleChunksCanBeRemovedInArbitraryOrder)
     constexpr uint32_t removeOrderIndices[]{0U, 2U, 1U};
     for (auto index : removeOrderIndices)
     {
-        SharedChunk removedChunk;
+        SharedMultiChunk removedChunk;
         EXPECT_TRUE(sut.remove(chunkHeaderInUse[index], removedChunk));
         EXPECT_TRUE(removedChunk);
     }
@@ -216,14 +223,14 @@ TEST_F(UsedChunkList_test, UsedChunkListCanBeFilledToCapacityAndFullyEmptied)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5932b727-dfbe-4041-985d-7a819c8ea06c");
     std::vector<ChunkHeader*> chunkHeaderInUse;
-    createMultipleChunks(USED_CHUNK_LIST_CAPACITY, [&](SharedChunk&& chunk) {
+    createMultipleChunks(USED_CHUNK_LIST_CAPACITY, [&](SharedMultiChunk&& chunk) {
         chunkHeaderInUse.push_back(chunk.getChunkHeader());
         EXPECT_TRUE(sut.insert(chunk));
     });
 
     for (auto chunkHeader : chunkHeaderInUse)
     {
-        SharedChunk removedChunk;
+        SharedMultiChunk removedChunk;
         EXPECT_TRUE(sut.remove(chunkHeader, removedChunk));
         EXPECT_TRUE(removedChunk);
     }
@@ -237,7 +244,7 @@ TEST_F(UsedChunkList_test, RemoveChunkFromEmptyListIsHandledGracefully)
     auto chunk = getChunkFromMemoryManager();
     auto chunkHeader = chunk.getChunkHeader();
 
-    SharedChunk chunkNotInList;
+    SharedMultiChunk chunkNotInList;
     EXPECT_FALSE(sut.remove(chunkHeader, chunkNotInList));
     EXPECT_FALSE(chunkNotInList);
 }
@@ -245,12 +252,12 @@ TEST_F(UsedChunkList_test, RemoveChunkFromEmptyListIsHandledGracefully)
 TEST_F(UsedChunkList_test, RemoveChunkNotInListIsHandledGracefully)
 {
     ::testing::Test::RecordProperty("TEST_ID", "ecca24b5-c526-4c41-b78f-ff34d6e9ee3e");
-    createMultipleChunks(3U, [&](SharedChunk&& chunk) { sut.insert(chunk); });
+    createMultipleChunks(3U, [&](SharedMultiChunk&& chunk) { sut.insert(chunk); });
 
     auto chunk = getChunkFromMemoryManager();
     auto chunkHeader = chunk.getChunkHeader();
 
-    SharedChunk chunkNotInList;
+    SharedMultiChunk chunkNotInList;
     EXPECT_FALSE(sut.remove(chunkHeader, chunkNotInList));
     EXPECT_FALSE(chunkNotInList);
 }
@@ -259,19 +266,19 @@ TEST_F(UsedChunkList_test, RemoveChunkNotInListDoesNotRemoveOtherChunk)
 {
     ::testing::Test::RecordProperty("TEST_ID", "6a01903b-3fd2-4632-a941-60621d6f3450");
     std::vector<ChunkHeader*> chunkHeaderInUse;
-    createMultipleChunks(3U, [&](SharedChunk&& chunk) {
+    createMultipleChunks(3U, [&](SharedMultiChunk&& chunk) {
         chunkHeaderInUse.push_back(chunk.getChunkHeader());
         sut.insert(chunk);
     });
 
     auto chunk = getChunkFromMemoryManager();
     auto chunkHeader = chunk.getChunkHeader();
-    SharedChunk chunkNotInList;
+    SharedMultiChunk chunkNotInList;
     sut.remove(chunkHeader, chunkNotInList);
 
     for (auto chunkHeader : chunkHeaderInUse)
     {
-        SharedChunk removedChunk;
+        SharedMultiChunk removedChunk;
         EXPECT_TRUE(sut.remove(chunkHeader, removedChunk));
         EXPECT_TRUE(removedChunk);
     }
@@ -295,7 +302,7 @@ TEST_F(UsedChunkList_test, RemovingChunkFromListLetsTheSharedChunkReturnOwnershi
         auto chunkHeader = chunk.getChunkHeader();
         sut.insert(chunk);
 
-        SharedChunk removedChunk;
+        SharedMultiChunk removedChunk;
         sut.remove(chunkHeader, removedChunk);
     }
 
@@ -306,7 +313,7 @@ TEST_F(UsedChunkList_test, CallingCleanupReleasesAllChunks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "765e2726-b022-41fc-a839-77db9ac07d2b");
     std::vector<ChunkHeader*> chunkHeaderInUse;
-    createMultipleChunks(USED_CHUNK_LIST_CAPACITY, [&](SharedChunk&& chunk) {
+    createMultipleChunks(USED_CHUNK_LIST_CAPACITY, [&](SharedMultiChunk&& chunk) {
         chunkHeaderInUse.push_back(chunk.getChunkHeader());
         sut.insert(chunk);
     });
@@ -316,4 +323,83 @@ TEST_F(UsedChunkList_test, CallingCleanupReleasesAllChunks)
     EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(0U));
     checkIfEmpty();
 }
+
+TEST_F(UsedChunkList_test, SampleWithMultipleChunksIsRemovedByTheChunkHeaderOfItsFirstChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "174a5e54-7ce0-44c9-8c68-d6222a0fc3d9");
+    auto chunk = getChunkFromMemoryManager(3U);
+    auto chunkHeader = chunk.getChunkHeader();
+    sut.insert(chunk);
+    chunk = SharedMultiChunk();
+
+    SharedMultiChunk removedChunk;
+    EXPECT_TRUE(sut.remove(chunkHeader, removedChunk));
+    ASSERT_TRUE(removedChunk);
+    EXPECT_THAT(removedChunk.getChunkHeaders().size(), Eq(3U));
+
+    removedChunk = SharedMultiChunk();
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+}
+
+TEST_F(UsedChunkList_test, RemovingASampleByTheChunkHeaderOfAFollowingChunkFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0a18c908-b1f2-4e59-bb04-195f285ce7fd");
+    auto chunk = getChunkFromMemoryManager(2U);
+    auto chunkHeaders = chunk.getChunkHeaders();
+    auto followingChunkHeader = *(++chunkHeaders.begin());
+    sut.insert(chunk);
+
+    SharedMultiChunk removedChunk;
+    EXPECT_FALSE(sut.remove(followingChunkHeader, removedChunk));
+    EXPECT_FALSE(removedChunk);
+    EXPECT_TRUE(sut.remove(chunk.getChunkHeader(), removedChunk));
+}
+
+TEST_F(UsedChunkList_test, InterleavedInsertAndRemoveKeepsAllSamplesFindable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8f4524fd-71b9-4333-a096-4c02a1ba7f67");
+    // exercises the probe sequences of the lookup table with holes at every position
+    std::vector<ChunkHeader*> chunkHeaderInUse;
+    createMultipleChunks(USED_CHUNK_LIST_CAPACITY, [&](SharedMultiChunk&& chunk) {
+        chunkHeaderInUse.push_back(chunk.getChunkHeader());
+        EXPECT_TRUE(sut.insert(chunk));
+    });
+
+    constexpr uint32_t NUMBER_OF_ROUNDS{50U};
+    for (uint32_t round = 0U; round < NUMBER_OF_ROUNDS; ++round)
+    {
+        auto position = (round * 7U) % chunkHeaderInUse.size();
+        SharedMultiChunk removedChunk;
+        ASSERT_TRUE(sut.remove(chunkHeaderInUse[position], removedChunk));
+        ASSERT_TRUE(removedChunk);
+        removedChunk = SharedMultiChunk();
+
+        auto chunk = getChunkFromMemoryManager(round % 3U + 1U);
+        chunkHeaderInUse[position] = chunk.getChunkHeader();
+        ASSERT_TRUE(sut.insert(chunk));
+    }
+
+    for (auto chunkHeader : chunkHeaderInUse)
+    {
+        SharedMultiChunk removedChunk;
+        EXPECT_TRUE(sut.remove(chunkHeader, removedChunk));
+        EXPECT_TRUE(removedChunk);
+    }
+
+    checkIfEmpty();
+}
+
+TEST_F(UsedChunkList_test, RemovedSampleCannotBeRemovedAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8e6a7886-9f19-4ffe-be87-8d06c1cbf595");
+    auto chunk = getChunkFromMemoryManager(2U);
+    auto chunkHeader = chunk.getChunkHeader();
+    sut.insert(chunk);
+
+    SharedMultiChunk removedChunk;
+    EXPECT_TRUE(sut.remove(chunkHeader, removedChunk));
+    SharedMultiChunk removedAgain;
+    EXPECT_FALSE(sut.remove(chunkHeader, removedAgain));
+    EXPECT_FALSE(removedAgain);
+}
 } // namespace
@@ -98,6 +98,41 @@ TEST_F(RoudiConfigTomlFileProvider_test, ParsingFileIsSuccessful)
     });
 }
 
+TEST_F(RoudiConfigTomlFileProvider_test, ParsingSegmentsWithDisjointBaseAddressesIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d7c3e9a0-5b14-4f86-9a2e-1c6f0b8d4e53");
+    std::istringstream stream(R"([general]
+        version = 1
+
+        [[segment]]
+        base-address = 0x200000000
+
+        [[segment.mempool]]
+        size = 128
+        count = 100
+
+        [[segment]]
+        base-address = 0x100000000
+
+        [[segment.mempool]]
+        size = 128
+        count = 100
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 100
+    )");
+
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    ASSERT_THAT(result.value().m_sharedMemorySegments.size(), Eq(3U));
+    EXPECT_THAT(result.value().m_sharedMemorySegments[0].m_fixedBaseAddress, Eq(0x200000000U));
+    EXPECT_THAT(result.value().m_sharedMemorySegments[1].m_fixedBaseAddress, Eq(0x100000000U));
+}
+
 constexpr const char* CONFIG_NO_GENERAL_SECTION = R"(
     [[segment]]
 
@@ -181,6 +216,38 @@ constexpr const char* CONFIG_MEMPOOL_WITHOUT_CHUNK_COUNT = R"(
     size = 128
 )";
 
+constexpr const char* CONFIG_BASE_ADDRESS_NOT_PAGE_ALIGNED = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+    base-address = 0x100000001
+
+    [[segment.mempool]]
+    size = 128
+    count = 100
+)";
+
+// the first segment requires more than 64 KiB, therefore the second one starts within the first one
+constexpr const char* CONFIG_BASE_ADDRESS_RANGES_OVERLAP = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+    base-address = 0x100000000
+
+    [[segment.mempool]]
+    size = 128
+    count = 1000
+
+    [[segment]]
+    base-address = 0x100010000
+
+    [[segment.mempool]]
+    size = 128
+    count = 100
+)";
+
 constexpr const char* CONFIG_EXCEPTION_IN_PARSER = R"(🐔)";
 
 INSTANTIATE_TEST_SUITE_P(
@@ -200,6 +267,10 @@ INSTANTIATE_TEST_SUITE_P(
                                  CONFIG_MEMPOOL_WITHOUT_CHUNK_SIZE},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::MEMPOOL_WITHOUT_CHUNK_COUNT,
                                  CONFIG_MEMPOOL_WITHOUT_CHUNK_COUNT},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::BASE_ADDRESS_NOT_PAGE_ALIGNED,
+                                 CONFIG_BASE_ADDRESS_NOT_PAGE_ALIGNED},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::BASE_ADDRESS_RANGES_OVERLAP,
+                                 CONFIG_BASE_ADDRESS_RANGES_OVERLAP},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::EXCEPTION_IN_PARSER,
                                  CONFIG_EXCEPTION_IN_PARSER}));
 
@@ -17,6 +17,7 @@
 
 #include "iceoryx_hoofs/testing/barrier.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iceoryx_posh/popo/message_layout.hpp"
 #include "iox/atomic.hpp"
 #include "iox/std_string_support.hpp"
 #include "test_roudi_portmanager_fixture.hpp"
@@ -571,6 +572,115 @@ TEST_F(PortManager_test, SubscriberNotRequiringHistorySupportDoesConnectToPublis
     EXPECT_TRUE(publisher.hasSubscribers());
 }
 
+TEST_F(PortManager_test, PublisherAndSubscriberWithSameAbiHashAreConnected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "730dc729-b4c2-4d4d-a0d6-d02066278424");
+
+    const auto service = iox::popo::MessageLayout::withAbiHash({"1", "1", "1"}, 42U);
+    PublisherPortUser publisher(m_portManager
+                                    ->acquirePublisherPortData(service,
+                                                               createTestPubOptions(),
+                                                               "guiseppe",
+                                                               m_payloadDataSegmentMemoryManager,
+                                                               PortConfigInfo())
+                                    .value());
+    SubscriberPortUser subscriber(
+        m_portManager->acquireSubscriberPortData(service, createTestSubOptions(), "schlomo", PortConfigInfo()).value());
+
+    EXPECT_TRUE(publisher.hasSubscribers());
+}
+
+TEST_F(PortManager_test, SubscriberWithoutAbiHashIsNotConnectedToPublisherWithAbiHash)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a980ec04-69ea-4ccb-ae03-23f9900b43e8");
+
+    const auto publisherService = iox::popo::MessageLayout::withAbiHash({"1", "1", "1"}, 42U);
+    PublisherPortUser publisher(m_portManager
+                                    ->acquirePublisherPortData(publisherService,
+                                                               createTestPubOptions(),
+                                                               "guiseppe",
+                                                               m_payloadDataSegmentMemoryManager,
+                                                               PortConfigInfo())
+                                    .value());
+    SubscriberPortUser subscriber(
+        m_portManager->acquireSubscriberPortData({"1", "1", "1"}, createTestSubOptions(), "schlomo", PortConfigInfo())
+            .value());
+    m_portManager->doDiscovery();
+
+    EXPECT_FALSE(publisher.hasSubscribers());
+}
+
+TEST_F(PortManager_test, SubscriberWithAbiHashIsNotConnectedToPublisherWithoutAbiHash)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6b0e2f1c-9d8a-4c37-b5e4-1a2f3d4c5b6e");
+
+    PublisherPortUser publisher(m_portManager
+                                    ->acquirePublisherPortData({"1", "1", "1"},
+                                                               createTestPubOptions(),
+                                                               "guiseppe",
+                                                               m_payloadDataSegmentMemoryManager,
+                                                               PortConfigInfo())
+                                    .value());
+    auto subscriberOptions = createTestSubOptions();
+    subscriberOptions.subscribeOnCreate = false;
+    const auto subscriberService = iox::popo::MessageLayout::withAbiHash({"1", "1", "1"}, 73U);
+    SubscriberPortUser subscriber(
+        m_portManager->acquireSubscriberPortData(subscriberService, subscriberOptions, "schlomo", PortConfigInfo())
+            .value());
+    // even a subscriber which receives serialized copies cannot get them from a publisher without serializer
+    subscriber.setMessageLayout(73U, true);
+    subscriber.subscribe();
+    m_portManager->doDiscovery();
+
+    EXPECT_FALSE(publisher.hasSubscribers());
+}
+
+TEST_F(PortManager_test, SubscriberWithOtherAbiHashWhichReadsInPlaceIsNotConnected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1e599de2-b39f-4999-a9a2-ba1846af5a4d");
+
+    const auto publisherService = iox::popo::MessageLayout::withAbiHash({"1", "1", "1"}, 42U);
+    PublisherPortUser publisher(m_portManager
+                                    ->acquirePublisherPortData(publisherService,
+                                                               createTestPubOptions(),
+                                                               "guiseppe",
+                                                               m_payloadDataSegmentMemoryManager,
+                                                               PortConfigInfo())
+                                    .value());
+    const auto subscriberService = iox::popo::MessageLayout::withAbiHash({"1", "1", "1"}, 73U);
+    SubscriberPortUser subscriber(
+        m_portManager->acquireSubscriberPortData(subscriberService, createTestSubOptions(), "schlomo", PortConfigInfo())
+            .value());
+    m_portManager->doDiscovery();
+
+    EXPECT_FALSE(publisher.hasSubscribers());
+}
+
+TEST_F(PortManager_test, SubscriberWithOtherAbiHashWhichReceivesSerializedCopiesIsConnected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "47941fde-b292-4f7a-909d-a0272b129f26");
+
+    const auto publisherService = iox::popo::MessageLayout::withAbiHash({"1", "1", "1"}, 42U);
+    PublisherPortUser publisher(m_portManager
+                                    ->acquirePublisherPortData(publisherService,
+                                                               createTestPubOptions(),
+                                                               "guiseppe",
+                                                               m_payloadDataSegmentMemoryManager,
+                                                               PortConfigInfo())
+                                    .value());
+    auto subscriberOptions = createTestSubOptions();
+    subscriberOptions.subscribeOnCreate = false;
+    const auto subscriberService = iox::popo::MessageLayout::withAbiHash({"1", "1", "1"}, 73U);
+    SubscriberPortUser subscriber(
+        m_portManager->acquireSubscriberPortData(subscriberService, subscriberOptions, "schlomo", PortConfigInfo())
+            .value());
+    subscriber.setMessageLayout(73U, true);
+    subscriber.subscribe();
+    m_portManager->doDiscovery();
+
+    EXPECT_TRUE(publisher.hasSubscribers());
+}
+
 TEST_F(PortManager_test, DeleteInterfacePortfromMaximumNumberAndAddOneIsSuccessful)
 {
     ::testing::Test::RecordProperty("TEST_ID", "2e682da4-aea0-4c37-8895-4049506db936");
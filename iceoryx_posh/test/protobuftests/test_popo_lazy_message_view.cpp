@@ -0,0 +1,240 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/popo/lazy_message_view.hpp"
+#include "test_messages.pb.h"
+
+#include "test.hpp"
+
+#include <string>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+
+using iox_test::Reading;
+
+class LazyMessageView_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        m_reading.set_id(ID);
+        m_reading.set_name("reading");
+        m_reading.add_values(1.0);
+        m_reading.add_values(2.0);
+        m_serialized = m_reading.SerializeAsString();
+    }
+
+    static constexpr uint64_t ID{42U};
+
+    Reading m_reading;
+    std::string m_serialized;
+};
+
+TEST_F(LazyMessageView_test, HasReportsTheFieldsOfTheMessage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3c8e1f5a-7b2d-4e96-a0c4-5d1b9f6e2a87");
+    m_reading.clear_name();
+    m_serialized = m_reading.SerializeAsString();
+    LazyMessageView<Reading> sut(m_serialized.data(), m_serialized.size());
+
+    EXPECT_TRUE(sut.has(Reading::kIdFieldNumber));
+    EXPECT_TRUE(sut.has(Reading::kValuesFieldNumber));
+    EXPECT_FALSE(sut.has(Reading::kNameFieldNumber));
+    EXPECT_FALSE(sut.has(42U));
+}
+
+TEST_F(LazyMessageView_test, GetParsesOnlyTheRequestedField)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a6d40b7e-1c9f-4f23-8e5a-b7c2d3f0e914");
+    LazyMessageView<Reading> sut(m_serialized.data(), m_serialized.size());
+
+    auto reading = sut.get(Reading::kIdFieldNumber);
+    ASSERT_FALSE(reading.has_error());
+    EXPECT_THAT(reading.value()->id(), Eq(ID));
+    EXPECT_THAT(reading.value()->name(), Eq(""));
+    EXPECT_THAT(reading.value()->values_size(), Eq(0));
+
+    reading = sut.get(Reading::kValuesFieldNumber);
+    ASSERT_FALSE(reading.has_error());
+    EXPECT_THAT(reading.value()->id(), Eq(ID));
+    EXPECT_THAT(reading.value()->name(), Eq(""));
+    ASSERT_THAT(reading.value()->values_size(), Eq(2));
+    EXPECT_THAT(reading.value()->values(1), Eq(2.0));
+}
+
+TEST_F(LazyMessageView_test, RepeatedAccessDoesNotParseTheFieldAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5f2b9c81-d04e-4a7b-93e6-0c8a1e7d4b52");
+    LazyMessageView<Reading> sut(m_serialized.data(), m_serialized.size());
+
+    ASSERT_FALSE(sut.get(Reading::kValuesFieldNumber).has_error());
+    auto reading = sut.get(Reading::kValuesFieldNumber);
+
+    ASSERT_FALSE(reading.has_error());
+    EXPECT_THAT(reading.value()->values_size(), Eq(2));
+}
+
+TEST_F(LazyMessageView_test, GetAllEqualsAFullParse)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e1a7c3d9-2f58-4b06-9d4e-8b3f5a0c7e61");
+    LazyMessageView<Reading> sut(m_serialized.data(), m_serialized.size());
+
+    ASSERT_FALSE(sut.get(Reading::kNameFieldNumber).has_error());
+    auto reading = sut.getAll();
+
+    ASSERT_FALSE(reading.has_error());
+    EXPECT_THAT(reading.value()->SerializeAsString(), Eq(m_serialized));
+}
+
+TEST_F(LazyMessageView_test, OccurrencesOfAFieldAreMergedInWireOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7b0e4d2a-96c1-4f8e-a35b-2d6f9e1c0b48");
+    Reading second;
+    second.set_id(ID + 1U);
+    second.add_values(3.0);
+    // concatenated messages are merged, the last occurrence of a singular field wins
+    const auto serialized = m_serialized + second.SerializeAsString();
+    Reading expected;
+    ASSERT_TRUE(expected.ParseFromString(serialized));
+    LazyMessageView<Reading> sut(serialized.data(), serialized.size());
+
+    auto reading = sut.get(Reading::kIdFieldNumber);
+    ASSERT_FALSE(reading.has_error());
+    EXPECT_THAT(reading.value()->id(), Eq(ID + 1U));
+
+    reading = sut.get(Reading::kValuesFieldNumber);
+    ASSERT_FALSE(reading.has_error());
+    ASSERT_THAT(reading.value()->values_size(), Eq(3));
+    EXPECT_THAT(reading.value()->values(2), Eq(3.0));
+
+    reading = sut.getAll();
+    ASSERT_FALSE(reading.has_error());
+    EXPECT_THAT(reading.value()->SerializeAsString(), Eq(expected.SerializeAsString()));
+}
+
+TEST_F(LazyMessageView_test, MissingFieldHasTheDefaultValue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0d9c5e3b-4a17-4e82-b6f0-9e2a7c1d5f36");
+    m_reading.clear_name();
+    m_serialized = m_reading.SerializeAsString();
+    LazyMessageView<Reading> sut(m_serialized.data(), m_serialized.size());
+
+    auto reading = sut.get(Reading::kNameFieldNumber);
+    ASSERT_FALSE(reading.has_error());
+    EXPECT_THAT(reading.value()->name(), Eq(""));
+    EXPECT_THAT(reading.value()->id(), Eq(0U));
+
+    EXPECT_FALSE(sut.get(42U).has_error());
+}
+
+TEST_F(LazyMessageView_test, EmptyMessageHasOnlyDefaultValues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c4f81a6e-3b95-4d2c-8a07-e5b9d0f3a128");
+    LazyMessageView<Reading> sut(nullptr, 0U);
+
+    EXPECT_FALSE(sut.has(Reading::kIdFieldNumber));
+    auto reading = sut.getAll();
+    ASSERT_FALSE(reading.has_error());
+    EXPECT_THAT(reading.value()->ByteSizeLong(), Eq(0U));
+}
+
+TEST_F(LazyMessageView_test, TruncatedMessageIsMalformed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9a3d7f0c-5e28-4b61-a4c9-1f8e6b2d0a75");
+    LazyMessageView<Reading> sut(m_serialized.data(), m_serialized.size() - 1U);
+
+    auto reading = sut.get(Reading::kIdFieldNumber);
+    ASSERT_TRUE(reading.has_error());
+    EXPECT_THAT(reading.error(), Eq(LazyMessageViewError::MALFORMED_MESSAGE));
+    reading = sut.getAll();
+    ASSERT_TRUE(reading.has_error());
+    EXPECT_THAT(reading.error(), Eq(LazyMessageViewError::MALFORMED_MESSAGE));
+}
+
+TEST_F(LazyMessageView_test, LengthBeyondTheEndOfTheMessageIsMalformed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2e6b0c9d-8f43-4a15-b7d2-6c0e3a9f1b84");
+    // field 2 with a length of 100 bytes, followed by only 4 bytes
+    const std::string serialized{"\x08\x01\x12\x64name"};
+    LazyMessageView<Reading> sut(serialized.data(), serialized.size());
+
+    auto reading = sut.get(Reading::kIdFieldNumber);
+    ASSERT_TRUE(reading.has_error());
+    EXPECT_THAT(reading.error(), Eq(LazyMessageViewError::MALFORMED_MESSAGE));
+}
+
+TEST_F(LazyMessageView_test, InvalidTagIsMalformed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f8c2a5e1-0b7d-4369-9e4a-3d5c8b1f7a06");
+    // a tag with the field number 0 and an end-group tag without start-group tag
+    for (const auto& serialized : {std::string{"\x08\x01\x00\x01", 4U}, std::string{"\x08\x01\x0c"}})
+    {
+        LazyMessageView<Reading> sut(serialized.data(), serialized.size());
+
+        auto reading = sut.getAll();
+        ASSERT_TRUE(reading.has_error());
+        EXPECT_THAT(reading.error(), Eq(LazyMessageViewError::MALFORMED_MESSAGE));
+    }
+}
+
+TEST_F(LazyMessageView_test, FieldWithAnInvalidValueIsMalformedOnAccess)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6d1e8b3f-a95c-4027-8b6e-0f4a2c7d9e13");
+    // proto3 strings must be valid UTF-8
+    const std::string serialized{"\x08\x2a\x12\x01\xff"};
+    LazyMessageView<Reading> sut(serialized.data(), serialized.size());
+
+    EXPECT_TRUE(sut.has(Reading::kNameFieldNumber));
+    auto reading = sut.get(Reading::kIdFieldNumber);
+    ASSERT_FALSE(reading.has_error());
+    EXPECT_THAT(reading.value()->id(), Eq(ID));
+
+    reading = sut.get(Reading::kNameFieldNumber);
+    ASSERT_TRUE(reading.has_error());
+    EXPECT_THAT(reading.error(), Eq(LazyMessageViewError::MALFORMED_FIELD));
+    reading = sut.getAll();
+    ASSERT_TRUE(reading.has_error());
+    EXPECT_THAT(reading.error(), Eq(LazyMessageViewError::MALFORMED_FIELD));
+}
+
+TEST_F(LazyMessageView_test, MessageWithMoreRangesThanTheCapacityIsParsedAsAWhole)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b2a9f4c7-6e03-4d58-a1b8-7c5e0d3f9a62");
+    LazyMessageView<Reading, 1U> sut(m_serialized.data(), m_serialized.size());
+
+    EXPECT_TRUE(sut.has(Reading::kIdFieldNumber));
+    EXPECT_TRUE(sut.has(Reading::kValuesFieldNumber));
+    EXPECT_FALSE(sut.has(42U));
+
+    auto reading = sut.get(Reading::kIdFieldNumber);
+    ASSERT_FALSE(reading.has_error());
+    EXPECT_THAT(reading.value()->SerializeAsString(), Eq(m_serialized));
+}
+
+TEST_F(LazyMessageView_test, MalformedRemainderBeyondTheCapacityIsDetectedOnAccess)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4e7f1b0a-c3d6-4e95-8f21-a0b7d9c5e348");
+    LazyMessageView<Reading, 1U> sut(m_serialized.data(), m_serialized.size() - 1U);
+
+    auto reading = sut.get(Reading::kIdFieldNumber);
+    ASSERT_TRUE(reading.has_error());
+    EXPECT_THAT(reading.error(), Eq(LazyMessageViewError::MALFORMED_MESSAGE));
+}
+
+} // namespace
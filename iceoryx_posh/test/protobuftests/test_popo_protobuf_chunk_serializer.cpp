@@ -0,0 +1,97 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/protobuf_chunk_serializer.hpp"
+#include "iceoryx_posh/testing/mocks/chunk_mock.hpp"
+#include "test_messages.pb.h"
+
+#include "test.hpp"
+
+#include <new>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+
+using ProtobufUserHeader_t = iox::mepoo::ProtobufUserHeader<iox::mepoo::NoUserHeader>;
+using Serializer = ProtobufChunkSerializer<iox_test::Reading, iox::mepoo::NoUserHeader>;
+
+struct Payload
+{
+    alignas(8) uint8_t data[256];
+};
+
+class ProtobufChunkSerializer_test : public Test
+{
+  public:
+    static void fill(iox_test::Reading& reading)
+    {
+        reading.set_id(42U);
+        reading.set_name("reading");
+        reading.add_values(1.0);
+        reading.add_values(2.0);
+    }
+};
+
+TEST_F(ProtobufChunkSerializer_test, SampleWithoutProtobufUserHeaderCannotBeSerialized)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6ce5d36b-6cd2-49b8-9f5e-52c7d1d34c0a");
+    // e.g. a sample of 'loanSample', 'publishCopyOf' or 'publishResultOf'
+    ChunkMock<iox_test::Reading> chunk;
+    auto* reading = new (chunk.sample()) iox_test::Reading();
+    fill(*reading);
+
+    EXPECT_FALSE(Serializer::serializedSize(chunk.chunkHeader()).has_value());
+
+    reading->~Reading();
+}
+
+TEST_F(ProtobufChunkSerializer_test, SerializedSizeOfRootMessageIsItsByteSize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0b1fd2c4-0b0a-4b8e-8df4-2e7b4e61f1d3");
+    ChunkMock<Payload, ProtobufUserHeader_t> chunk;
+    new (chunk.userHeader()) ProtobufUserHeader_t();
+    auto* reading = new (chunk.sample()) iox_test::Reading();
+    fill(*reading);
+    chunk.userHeader()->m_rootMessageOffset = 0;
+
+    auto serializedSize = Serializer::serializedSize(chunk.chunkHeader());
+    ASSERT_TRUE(serializedSize.has_value());
+    EXPECT_THAT(serializedSize.value(), Eq(reading->ByteSizeLong()));
+
+    reading->~Reading();
+}
+
+TEST_F(ProtobufChunkSerializer_test, SerializedMessageKeepsItsSize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a0d2e3f9-7e5b-4f8c-9d1c-1e4b3c2a5f60");
+    iox_test::Reading reading;
+    fill(reading);
+    const uint64_t byteSize = reading.ByteSizeLong();
+
+    // e.g. a sample of 'publishSerialized'; the payload does not hold a message object
+    ChunkMock<Payload, ProtobufUserHeader_t> chunk;
+    new (chunk.userHeader()) ProtobufUserHeader_t();
+    ASSERT_TRUE(reading.SerializeToArray(chunk.sample()->data, sizeof(Payload::data)));
+    chunk.userHeader()->m_serializedSize = byteSize;
+
+    auto serializedSize = Serializer::serializedSize(chunk.chunkHeader());
+    ASSERT_TRUE(serializedSize.has_value());
+    EXPECT_THAT(serializedSize.value(), Eq(byteSize));
+}
+
+} // namespace
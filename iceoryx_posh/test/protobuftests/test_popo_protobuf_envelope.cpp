@@ -0,0 +1,196 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/popo/protobuf_envelope.hpp"
+#include "iceoryx_posh/roudi_env/minimal_iceoryx_config.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_posh/testing/roudi_gtest.hpp"
+#include "test_messages.pb.h"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+using namespace iox::roudi_env;
+
+using Envelope = ProtobufEnvelope<iox_test::Reading, iox_test::Position>;
+
+class ProtobufEnvelope_test : public RouDi_GTest
+{
+  public:
+    ProtobufEnvelope_test()
+        : RouDi_GTest(MinimalIceoryxConfigBuilder()
+                          .payloadChunkSize(PAYLOAD_CHUNK_SIZE)
+                          .payloadChunkCount(PAYLOAD_CHUNK_COUNT)
+                          .create())
+    {
+    }
+
+    void SetUp() override
+    {
+        iox::runtime::PoshRuntime::initRuntime("ProtobufEnvelope_test");
+    }
+
+    /// @brief publishes a position with the provided type id in the user-header
+    void publishPosition(ProtobufEnvelopePublisher<Envelope>& publisher, const uint32_t typeId)
+    {
+        auto loan = publisher.loan<iox_test::Position>();
+        ASSERT_FALSE(loan.has_error());
+        loan.value()->set_frame("map");
+        loan.value()->add_coordinates(1.0);
+        loan.value()->add_coordinates(2.0);
+        loan.value().getUserHeader().m_typeId = typeId;
+        loan.value().publish();
+    }
+
+    static constexpr uint64_t PAYLOAD_CHUNK_SIZE{1024U};
+    static constexpr uint32_t PAYLOAD_CHUNK_COUNT{10U};
+
+    const iox::capro::ServiceDescription m_service{"Protobuf", "Envelope", "Messages"};
+};
+
+TEST_F(ProtobufEnvelope_test, TypeIdIsThePositionOfTheTypeInTheEnvelope)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6b0f6b7c-2a7e-4f6d-9a55-4d9f0c1e7a31");
+    static_assert(Envelope::NUMBER_OF_TYPES == 2U, "The envelope has two types");
+    static_assert(Envelope::typeId<iox_test::Reading>() == 0U, "Reading is the first type");
+    static_assert(Envelope::typeId<iox_test::Position>() == 1U, "Position is the second type");
+
+    using SwappedEnvelope = ProtobufEnvelope<iox_test::Position, iox_test::Reading>;
+    EXPECT_THAT(SwappedEnvelope::typeId<iox_test::Reading>(), Eq(1U));
+    EXPECT_THAT(SwappedEnvelope::typeId<iox_test::Position>(), Eq(0U));
+}
+
+TEST_F(ProtobufEnvelope_test, AbiHashDependsOnTheOrderOfTheTypes)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a1f3d0b2-8c64-4f3e-b6f1-2e7d5a9c4b80");
+    using SwappedEnvelope = ProtobufEnvelope<iox_test::Position, iox_test::Reading>;
+
+    EXPECT_THAT(Envelope::abiHash(), Ne(iox::popo::MessageLayout::LAYOUT_INDEPENDENT));
+    EXPECT_THAT(Envelope::abiHash(), Eq(Envelope::abiHash()));
+    EXPECT_THAT(Envelope::abiHash(), Ne(SwappedEnvelope::abiHash()));
+    EXPECT_THAT(Envelope::abiHash(), Ne(ProtobufEnvelope<iox_test::Reading>::abiHash()));
+}
+
+TEST_F(ProtobufEnvelope_test, LoanStoresTheTypeIdInTheUserHeader)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4c2e8a17-93d5-4b0f-8e6a-1f5b7d3c9e02");
+    ProtobufEnvelopePublisher<Envelope> sut(m_service);
+
+    {
+        auto loan = sut.loan<iox_test::Reading>();
+        ASSERT_FALSE(loan.has_error());
+        EXPECT_THAT(loan.value().getUserHeader().m_typeId, Eq(Envelope::typeId<iox_test::Reading>()));
+    }
+    {
+        auto loan = sut.loan<iox_test::Position>();
+        ASSERT_FALSE(loan.has_error());
+        EXPECT_THAT(loan.value().getUserHeader().m_typeId, Eq(Envelope::typeId<iox_test::Position>()));
+    }
+}
+
+TEST_F(ProtobufEnvelope_test, MessageIsReadInPlaceAndDispatchedByItsTypeId)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d83b5e6f-0a2c-4e71-9b4d-6c8f1a2e5b37");
+    ProtobufEnvelopePublisher<Envelope> publisher(m_service);
+    ProtobufEnvelopeSubscriber<Envelope> sut(m_service);
+    this->InterOpWait();
+
+    publishPosition(publisher, Envelope::typeId<iox_test::Position>());
+
+    std::string frame;
+    auto dispatchTable = makeProtobufDispatchTable<Envelope>(
+        [&](const iox_test::Position& position) { frame = position.frame(); });
+    auto sample = sut.take();
+    ASSERT_FALSE(sample.has_error());
+    EXPECT_TRUE(sut.serialized(sample.value()).has_error());
+    EXPECT_TRUE(dispatchTable(sample.value()));
+    EXPECT_THAT(frame, Eq("map"));
+}
+
+TEST_F(ProtobufEnvelope_test, SerializedMessageIsParsedIntoTheTypeOfItsTypeId)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0e7c4a92-5f1b-4d3a-8c6e-b2d9f7a1c453");
+    ProtobufEnvelopePublisher<Envelope> publisher(m_service);
+    ProtobufEnvelopeSubscriber<Envelope> sut(m_service, SubscriberOptions(), ProtobufDelivery::SERIALIZED);
+    this->InterOpWait();
+
+    publishPosition(publisher, Envelope::typeId<iox_test::Position>());
+
+    auto sample = sut.take();
+    ASSERT_FALSE(sample.has_error());
+    EXPECT_FALSE(sut.serialized(sample.value()).has_error());
+    EXPECT_THAT(sample.value().getUserHeader().m_typeId, Eq(Envelope::typeId<iox_test::Position>()));
+    const auto* position = dynamic_cast<const iox_test::Position*>(sample.value().get());
+    ASSERT_THAT(position, Ne(nullptr));
+    EXPECT_THAT(position->frame(), Eq("map"));
+    ASSERT_THAT(position->coordinates_size(), Eq(2));
+    EXPECT_THAT(position->coordinates(1), Eq(2.0));
+}
+
+TEST_F(ProtobufEnvelope_test, SerializedMessageWithUnknownTypeIdIsDropped)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7a9d2c5e-1b8f-4a63-9e0d-3f6b4c8a2e71");
+    ProtobufEnvelopePublisher<Envelope> publisher(m_service);
+    ProtobufEnvelopeSubscriber<Envelope> sut(m_service, SubscriberOptions(), ProtobufDelivery::SERIALIZED);
+    this->InterOpWait();
+
+    publishPosition(publisher, Envelope::NUMBER_OF_TYPES);
+    publishPosition(publisher, ProtobufEnvelopeHeader::INVALID_TYPE_ID);
+
+    auto sample = sut.take();
+    ASSERT_TRUE(sample.has_error());
+    EXPECT_THAT(sample.error(), Eq(iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE));
+    EXPECT_TRUE(sut.take().has_error());
+    EXPECT_FALSE(sut.hasData());
+}
+
+TEST_F(ProtobufEnvelope_test, MessageWithUnknownTypeIdIsNotDispatched)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f2c6e8a0-4d7b-4b19-a5e3-8d1c0f9b6a24");
+    ProtobufEnvelopePublisher<Envelope> publisher(m_service);
+    ProtobufEnvelopeSubscriber<Envelope> sut(m_service);
+    this->InterOpWait();
+
+    publishPosition(publisher, Envelope::NUMBER_OF_TYPES);
+
+    bool called{false};
+    auto dispatchTable = makeProtobufDispatchTable<Envelope>([&](const iox_test::Position&) { called = true; });
+    auto sample = sut.take();
+    ASSERT_FALSE(sample.has_error());
+    EXPECT_FALSE(dispatchTable(sample.value()));
+    EXPECT_FALSE(called);
+}
+
+TEST_F(ProtobufEnvelope_test, DispatchWithoutHandlerForTheTypeReturnsFalse)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b5e1a7d3-6c90-4f28-8a4b-9e2d7c0f1b65");
+    uint64_t readingId{0U};
+    auto sut = makeProtobufDispatchTable<Envelope>([&](const iox_test::Reading& reading) { readingId = reading.id(); });
+
+    iox_test::Reading reading;
+    reading.set_id(42U);
+    iox_test::Position position;
+
+    EXPECT_TRUE(sut.dispatch(Envelope::typeId<iox_test::Reading>(), reading));
+    EXPECT_THAT(readingId, Eq(42U));
+    EXPECT_FALSE(sut.dispatch(Envelope::typeId<iox_test::Position>(), position));
+    EXPECT_FALSE(sut.dispatch(Envelope::NUMBER_OF_TYPES, position));
+}
+
+} // namespace
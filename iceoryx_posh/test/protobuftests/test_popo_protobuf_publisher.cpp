@@ -0,0 +1,219 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/popo/protobuf_publisher.hpp"
+#include "iceoryx_posh/popo/protobuf_subscriber.hpp"
+#include "iceoryx_posh/roudi_env/minimal_iceoryx_config.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_posh/testing/roudi_gtest.hpp"
+#include "test_messages.pb.h"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+using namespace iox::roudi_env;
+
+class ProtobufPublisher_test : public RouDi_GTest
+{
+  public:
+    ProtobufPublisher_test()
+        : RouDi_GTest(MinimalIceoryxConfigBuilder()
+                          .payloadChunkSize(PAYLOAD_CHUNK_SIZE)
+                          .payloadChunkCount(PAYLOAD_CHUNK_COUNT)
+                          .create())
+    {
+    }
+
+    void SetUp() override
+    {
+        iox::runtime::PoshRuntime::initRuntime("ProtobufPublisher_test");
+    }
+
+    static void fill(iox_test::Reading& reading, const uint64_t id)
+    {
+        reading.set_id(id);
+        reading.set_name("reading");
+        for (uint64_t i = 0U; i < NUMBER_OF_VALUES; ++i)
+        {
+            reading.add_values(static_cast<double>(id + i));
+        }
+    }
+
+    static constexpr uint64_t PAYLOAD_CHUNK_SIZE{1024U};
+    static constexpr uint32_t PAYLOAD_CHUNK_COUNT{10U};
+    static constexpr uint64_t NUMBER_OF_VALUES{8U};
+
+    const iox::capro::ServiceDescription m_service{"Protobuf", "Publisher", "Readings"};
+};
+
+TEST_F(ProtobufPublisher_test, PublishingWithoutSubscriberReturnsTheChunksOfEveryMessage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0c1729c8-d9a1-4175-a133-f6825b7ff0f3");
+    ProtobufPublisher<iox_test::Reading> sut(m_service);
+
+    for (uint64_t i = 0U; i < 3U * PAYLOAD_CHUNK_COUNT; ++i)
+    {
+        auto loan = sut.loan();
+        ASSERT_FALSE(loan.has_error());
+        fill(*loan.value(), i);
+        loan.value().publish();
+    }
+}
+
+TEST_F(ProtobufPublisher_test, MessagePublishedWithoutSubscriberIsIntactInTheHistory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f3d6bd17-f187-449b-99c9-09a88e4bfe08");
+    PublisherOptions publisherOptions;
+    publisherOptions.historyCapacity = 1U;
+    ProtobufPublisher<iox_test::Reading> sut(m_service, publisherOptions);
+
+    constexpr uint64_t ID{42U};
+    auto loan = sut.loan();
+    ASSERT_FALSE(loan.has_error());
+    fill(*loan.value(), ID);
+    loan.value().publish();
+
+    SubscriberOptions subscriberOptions;
+    subscriberOptions.historyRequest = 1U;
+    ProtobufSubscriber<iox_test::Reading> subscriber(m_service, subscriberOptions);
+    this->InterOpWait();
+
+    auto sample = subscriber.take();
+    ASSERT_FALSE(sample.has_error());
+    EXPECT_THAT(sample.value()->id(), Eq(ID));
+    EXPECT_THAT(sample.value()->name(), Eq("reading"));
+    EXPECT_THAT(sample.value()->values_size(), Eq(static_cast<int>(NUMBER_OF_VALUES)));
+}
+
+TEST_F(ProtobufPublisher_test, DroppedLoanReturnsItsChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c8a582ad-7a2a-45b1-ae82-b829282f4eaf");
+    ProtobufPublisher<iox_test::Reading> sut(m_service);
+
+    for (uint64_t i = 0U; i < 3U * PAYLOAD_CHUNK_COUNT; ++i)
+    {
+        auto loan = sut.loan();
+        ASSERT_FALSE(loan.has_error());
+        fill(*loan.value(), i);
+    }
+}
+
+TEST_F(ProtobufPublisher_test, PublishedMessageIsReadInPlaceBySubscriber)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "53be894d-9763-478c-8a21-3c9e100eb301");
+    ProtobufPublisher<iox_test::Reading> sut(m_service);
+    ProtobufSubscriber<iox_test::Reading> subscriber(m_service);
+    this->InterOpWait();
+
+    constexpr uint64_t ID{73U};
+    auto loan = sut.loan();
+    ASSERT_FALSE(loan.has_error());
+    fill(*loan.value(), ID);
+    loan.value().publish();
+
+    auto sample = subscriber.take();
+    ASSERT_FALSE(sample.has_error());
+    EXPECT_THAT(sample.value()->id(), Eq(ID));
+    EXPECT_THAT(sample.value()->name(), Eq("reading"));
+    ASSERT_THAT(sample.value()->values_size(), Eq(static_cast<int>(NUMBER_OF_VALUES)));
+    EXPECT_THAT(sample.value()->values(1), Eq(static_cast<double>(ID + 1U)));
+}
+
+TEST_F(ProtobufPublisher_test, PublishedMessageIsDeliveredSerializedToSerializedSubscriber)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3f0a3c43-3cfa-4d8e-a8f5-3d27be1c8bde");
+    ProtobufPublisher<iox_test::Reading> sut(m_service);
+    ProtobufSubscriber<iox_test::Reading> subscriber(m_service, SubscriberOptions(), ProtobufDelivery::SERIALIZED);
+    this->InterOpWait();
+
+    constexpr uint64_t ID{13U};
+    auto loan = sut.loan();
+    ASSERT_FALSE(loan.has_error());
+    fill(*loan.value(), ID);
+    loan.value().publish();
+
+    auto sample = subscriber.take();
+    ASSERT_FALSE(sample.has_error());
+    EXPECT_THAT(sample.value()->id(), Eq(ID));
+    EXPECT_THAT(sample.value()->values_size(), Eq(static_cast<int>(NUMBER_OF_VALUES)));
+    EXPECT_FALSE(subscriber.serialized(sample.value()).has_error());
+}
+
+TEST_F(ProtobufPublisher_test, MessagePublishedSerializedIsForwardedToSerializedSubscriber)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9c6cf0fd-2f61-45b5-8d2b-50e0b2fa6e53");
+    ProtobufPublisher<iox_test::Reading> sut(m_service);
+    ProtobufSubscriber<iox_test::Reading> subscriber(m_service, SubscriberOptions(), ProtobufDelivery::SERIALIZED);
+    this->InterOpWait();
+
+    constexpr uint64_t ID{37U};
+    iox_test::Reading reading;
+    fill(reading, ID);
+    ASSERT_FALSE(sut.publishSerialized(reading).has_error());
+
+    auto sample = subscriber.take();
+    ASSERT_FALSE(sample.has_error());
+    EXPECT_THAT(sample.value()->id(), Eq(ID));
+    EXPECT_THAT(sample.value()->name(), Eq("reading"));
+    auto serialized = subscriber.serialized(sample.value());
+    ASSERT_FALSE(serialized.has_error());
+    EXPECT_THAT(serialized.value()->userPayloadSize(), Eq(reading.ByteSizeLong()));
+    EXPECT_FALSE(subscriber.hasMissedData());
+}
+
+TEST_F(ProtobufPublisher_test, CopiedMessageIsLostForSerializedSubscriber)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c2b0d9a4-5d9b-4a0a-9a3f-7e0c6b3ff1a2");
+    ProtobufPublisher<iox_test::Reading> sut(m_service);
+    ProtobufSubscriber<iox_test::Reading> inPlaceSubscriber(m_service);
+    ProtobufSubscriber<iox_test::Reading> serializedSubscriber(
+        m_service, SubscriberOptions(), ProtobufDelivery::SERIALIZED);
+    this->InterOpWait();
+
+    iox_test::Reading reading;
+    fill(reading, 5U);
+    ASSERT_FALSE(sut.publishCopyOf(reading).has_error());
+
+    EXPECT_FALSE(inPlaceSubscriber.take().has_error());
+    EXPECT_TRUE(serializedSubscriber.take().has_error());
+    EXPECT_TRUE(serializedSubscriber.hasMissedData());
+}
+
+TEST_F(ProtobufPublisher_test, SerializedSubscriberGetsNoHistoryButMissedData)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e5a8a7a4-0f4a-4d6e-9d43-51cb9f0c7c1e");
+    PublisherOptions publisherOptions;
+    publisherOptions.historyCapacity = 1U;
+    ProtobufPublisher<iox_test::Reading> sut(m_service, publisherOptions);
+
+    auto loan = sut.loan();
+    ASSERT_FALSE(loan.has_error());
+    fill(*loan.value(), 1U);
+    loan.value().publish();
+
+    SubscriberOptions subscriberOptions;
+    subscriberOptions.historyRequest = 1U;
+    ProtobufSubscriber<iox_test::Reading> subscriber(m_service, subscriberOptions, ProtobufDelivery::SERIALIZED);
+    this->InterOpWait();
+
+    EXPECT_TRUE(subscriber.take().has_error());
+    EXPECT_TRUE(subscriber.hasMissedData());
+}
+
+} // namespace
@@ -0,0 +1,121 @@
+// Copyright (c) 2025 by Latitude AI. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/used_chunk_list.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iox/bump_allocator.hpp"
+
+#include <chrono>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using namespace iox::mepoo;
+using namespace iox::popo;
+
+namespace
+{
+constexpr uint32_t NUMBER_OF_HELD_SAMPLES{iox::MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY};
+constexpr uint64_t NUMBER_OF_ITERATIONS{1000000U};
+constexpr uint64_t CHUNK_SIZE{128U};
+constexpr uint64_t USER_PAYLOAD_SIZE{32U};
+
+/// @brief Keeps a subscriber-sized UsedChunkList filled with NUMBER_OF_HELD_SAMPLES samples and measures how long
+/// releasing a sample and inserting it again takes; this is the per-sample cost of a subscriber which holds as many
+/// samples as it is allowed to
+class FullUsedChunkList
+{
+  public:
+    explicit FullUsedChunkList(const uint32_t chunksPerSample)
+    {
+        MePooConfig mempoolconf;
+        mempoolconf.addMemPool({CHUNK_SIZE, NUMBER_OF_HELD_SAMPLES * chunksPerSample});
+        iox::BumpAllocator memoryAllocator{m_memory.get(), MEMORY_SIZE};
+        m_memoryManager.configureMemoryManager(mempoolconf, memoryAllocator, memoryAllocator);
+
+        auto chunkSettings = ChunkSettings::create(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT)
+                                 .expect("Valid 'ChunkSettings'");
+        for (uint32_t i = 0U; i < NUMBER_OF_HELD_SAMPLES; ++i)
+        {
+            auto chunkManagementManagement = m_memoryManager.getMultiChunk();
+            for (uint32_t j = 0U; j < chunksPerSample; ++j)
+            {
+                chunkManagementManagement->addChunkManagement(
+                    m_memoryManager.getChunk(chunkSettings).expect("Obtaining chunk").release());
+            }
+            SharedMultiChunk sample(chunkManagementManagement);
+            m_chunkHeaders.push_back(sample.getChunkHeader());
+            m_sut.insert(sample);
+        }
+    }
+
+    /// @brief releases and re-inserts the held samples round robin
+    /// @param[in] oldestFirst releases the sample which is held longest if true, otherwise the one held shortest
+    /// @return average duration of one release and insert in nanoseconds
+    uint64_t measure(const bool oldestFirst)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (uint64_t i = 0U; i < NUMBER_OF_ITERATIONS; ++i)
+        {
+            auto position = oldestFirst ? i % NUMBER_OF_HELD_SAMPLES : NUMBER_OF_HELD_SAMPLES - 1U;
+            SharedMultiChunk sample;
+            if (!m_sut.remove(m_chunkHeaders[position], sample))
+            {
+                std::cerr << "sample not found" << std::endl;
+                std::terminate();
+            }
+            m_sut.insert(sample);
+        }
+        auto end = std::chrono::steady_clock::now();
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count())
+               / NUMBER_OF_ITERATIONS;
+    }
+
+  private:
+    static constexpr uint64_t MEMORY_SIZE{64U * 1024U * 1024U};
+    std::unique_ptr<char[]> m_memory{new char[MEMORY_SIZE]};
+    MemoryManager m_memoryManager;
+    UsedChunkList<NUMBER_OF_HELD_SAMPLES + 1U> m_sut;
+    std::vector<ChunkHeader*> m_chunkHeaders;
+};
+
+void benchmark(const uint32_t chunksPerSample)
+{
+    FullUsedChunkList list(chunksPerSample);
+    // warm up the caches
+    list.measure(true);
+    auto oldestFirst = list.measure(true);
+    auto newestFirst = list.measure(false);
+
+    // Not using iceoryx logger due to width requirements
+    std::cout << std::setw(8) << NUMBER_OF_HELD_SAMPLES << " (held samples) : " << std::setw(4) << chunksPerSample
+              << " (chunks/sample) : " << std::setw(6) << oldestFirst << " (nanosecs/release oldest) : "
+              << std::setw(6) << newestFirst << " (nanosecs/release newest)" << std::endl;
+}
+} // namespace
+
+int main()
+{
+    benchmark(1U);
+    benchmark(4U);
+    benchmark(16U);
+
+    return 0;
+}
@@ -48,6 +48,12 @@ BAZEL_GTEST_FILTER="-Thread_test*"
 msg "running tests"
 bazel test //... --deleted_packages=iceoryx_hoofs/test/stresstests  --test_output=all --test_arg=--gtest_filter="$BAZEL_GTEST_FILTER"
 
+# the checked-in descriptor.pb.h of the bundled protobuf keeps the string getters returning a reference
+PROTOBUF_GTEST_FILTER="-BootstrapTest.GeneratedFilesMatch"
+
+msg "running the tests of the bundled protobuf"
+bazel test @com_google_protobuf//:protobuf_test --test_output=errors --test_arg=--gtest_filter="$PROTOBUF_GTEST_FILTER"
+
 # Build with clang
 msg "Bazel build with clang"
 bazel build --config=clang //...